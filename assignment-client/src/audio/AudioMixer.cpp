@@ -11,6 +11,7 @@
 
 #include "AudioMixer.h"
 
+#include <limits>
 #include <thread>
 
 #include <QtCore/QJsonArray>
@@ -42,6 +43,7 @@
 using namespace std;
 
 static const float DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE = 0.5f;    // attenuation = -6dB * log2(distance)
+static const float DEFAULT_MAX_AUDIBLE_DISTANCE = 1000.0f;  // meters, sources further from a listener are not mixed
 static const int DISABLE_STATIC_JITTER_FRAMES = -1;
 static const float DEFAULT_NOISE_MUTING_THRESHOLD = 1.0f;
 static const QString AUDIO_MIXER_LOGGING_TARGET_NAME = "audio-mixer";
@@ -52,6 +54,7 @@ static const QString AUDIO_THREADING_GROUP_KEY = "audio_threading";
 int AudioMixer::_numStaticJitterFrames{ DISABLE_STATIC_JITTER_FRAMES };
 float AudioMixer::_noiseMutingThreshold{ DEFAULT_NOISE_MUTING_THRESHOLD };
 float AudioMixer::_attenuationPerDoublingInDistance{ DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE };
+float AudioMixer::_maxAudibleDistance{ DEFAULT_MAX_AUDIBLE_DISTANCE };
 map<QString, shared_ptr<CodecPlugin>> AudioMixer::_availableCodecs{ };
 QStringList AudioMixer::_codecPreferenceOrder{};
 vector<AudioMixer::ZoneDescription> AudioMixer::_audioZones;
@@ -309,6 +312,8 @@ void AudioMixer::sendStatsPacket() {
     addTiming(_mixTiming, "mix");
     addTiming(_eventsTiming, "events");
 
+    timingStats["us_per_frame_p99"] = (qint64)_frameDurationPercentile.getValueAtPercentile();
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     timingStats["ns_per_mix"] = (_stats.totalMixes > 0) ?  (float)(_stats.mixTime / _stats.totalMixes) : 0;
 #endif
@@ -338,9 +343,24 @@ void AudioMixer::sendStatsPacket() {
     mixStats["3_active_to_skippped"] = (int)(_stats.activeToSkipped / (float)_numStatFrames);
     mixStats["3_active_to_inactive"] = (int)(_stats.activeToInactive / (float)_numStatFrames);
 
+    int totalStreams = _stats.skipped + _stats.inactive + _stats.active + _stats.distant;
+    mixStats["2_distant_streams"] = (int)(_stats.distant / (float)_numStatFrames);
+    mixStats["%_distant_streams"] = (totalStreams > 0) ? (float(_stats.distant) / totalStreams) * 100.0f : 0.0f;
+    mixStats["3_to_distant"] = (int)(_stats.toDistant / (float)_numStatFrames);
+    mixStats["3_distant_to_inactive"] = (int)(_stats.distantToInactive / (float)_numStatFrames);
+    mixStats["avg_sources_in_range_per_listener"] = (_stats.cullingListeners > 0) ?
+        (float(_stats.sourcesInRange) / _stats.cullingListeners) : 0.0f;
+
     mixStats["total_mixes"] = _stats.totalMixes;
     mixStats["avg_mixes_per_block"] = _stats.totalMixes / _numStatFrames;
 
+    int encodeCacheLookups = _stats.encodeCacheHits + _stats.encodeCacheMisses;
+    mixStats["4_encode_cache_hits"] = (int)(_stats.encodeCacheHits / (float)_numStatFrames);
+    mixStats["4_encode_cache_misses"] = (int)(_stats.encodeCacheMisses / (float)_numStatFrames);
+    mixStats["%_encode_cache_hits"] = (encodeCacheLookups > 0) ?
+        (float(_stats.encodeCacheHits) / encodeCacheLookups) * 100.0f : 0.0f;
+    mixStats["4_encode_cache_us_saved"] = (qint64)(_stats.encodeTimeSaved / NSECS_PER_USEC / _numStatFrames);
+
     statsObject["mix_stats"] = mixStats;
 
     _numStatFrames = _numSilentPackets = 0;
@@ -424,6 +444,7 @@ void AudioMixer::start() {
         } else {
             auto timer = _checkTimeTiming.timer();
             auto frameDuration = timeFrame();
+            _frameDurationPercentile.updatePercentile(frameDuration.count());
             throttle(frameDuration, frame);
         }
 
@@ -458,6 +479,14 @@ void AudioMixer::start() {
         if (_throttlingRatio > EPSILON) {
             numToRetain = nodeList->size() * (1.0f - _throttlingRatio);
         }
+        // encoded mixes can only be shared between listeners within a single frame
+        _workerSharedData.encodeCache.clear();
+
+        // index the sources after any streams were added or removed this frame
+        nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+            _workerSharedData.spatialIndex.build(cbegin, cend);
+        });
+
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
@@ -548,6 +577,7 @@ void AudioMixer::throttle(chrono::microseconds duration, int frame) {
 void AudioMixer::clearDomainSettings() {
     _numStaticJitterFrames = DISABLE_STATIC_JITTER_FRAMES;
     _attenuationPerDoublingInDistance = DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE;
+    _maxAudibleDistance = DEFAULT_MAX_AUDIBLE_DISTANCE;
     _noiseMutingThreshold = DEFAULT_NOISE_MUTING_THRESHOLD;
     _codecPreferenceOrder.clear();
     _audioZones.clear();
@@ -674,6 +704,17 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             }
         }
 
+        const QString MAX_AUDIBLE_DISTANCE = "max_audible_distance";
+        if (audioEnvGroupObject[MAX_AUDIBLE_DISTANCE].isString()) {
+            bool ok = false;
+            float maxAudibleDistance = audioEnvGroupObject[MAX_AUDIBLE_DISTANCE].toString().toFloat(&ok);
+            if (ok) {
+                // zero (or less) for no limit
+                _maxAudibleDistance = (maxAudibleDistance > 0.0f) ? maxAudibleDistance : numeric_limits<float>::infinity();
+                qCDebug(audio) << "Max audible distance changed to" << _maxAudibleDistance;
+            }
+        }
+
         const QString NOISE_MUTING_THRESHOLD = "noise_muting_threshold";
         if (audioEnvGroupObject[NOISE_MUTING_THRESHOLD].isString()) {
             bool ok = false;
@@ -15,6 +15,7 @@
 #include <AABox.h>
 #include <AudioHRTF.h>
 #include <AudioRingBuffer.h>
+#include <MovingPercentile.h>
 #include <ThreadedAssignment.h>
 #include <UUIDHasher.h>
 
@@ -53,6 +54,7 @@ public:
     static int getStaticJitterFrames() { return _numStaticJitterFrames; }
     static bool shouldMute(float quietestFrame) { return quietestFrame > _noiseMutingThreshold; }
     static float getAttenuationPerDoublingInDistance() { return _attenuationPerDoublingInDistance; }
+    static float getMaxAudibleDistance() { return _maxAudibleDistance; }
     static const std::vector<ZoneDescription>& getAudioZones() { return _audioZones; }
     static const std::vector<ZoneSettings>& getZoneSettings() { return _zoneSettings; }
     static const std::vector<ReverbSettings>& getReverbSettings() { return _zoneReverbSettings; }
@@ -138,9 +140,14 @@ private:
     Timer _eventsTiming;
     Timer _packetsTiming;
 
+    // the tail of the frame durations that throttling averages away
+    static const int FRAME_DURATION_WINDOW_FRAMES = 1000;
+    MovingPercentile _frameDurationPercentile { FRAME_DURATION_WINDOW_FRAMES, 0.99f };
+
     static int _numStaticJitterFrames; // -1 denotes dynamic jitter buffering
     static float _noiseMutingThreshold;
     static float _attenuationPerDoublingInDistance;
+    static float _maxAudibleDistance;
     static std::map<QString, CodecPluginPointer> _availableCodecs;
     static QStringList _codecPreferenceOrder;
 
@@ -361,6 +361,7 @@ void AudioMixerClientData::removeAgentAvatarAudioStream() {
         _streams.skipped.clear();
         _streams.inactive.clear();
         _streams.active.clear();
+        _streams.distant.clear();
     }
 }
 
@@ -648,6 +649,23 @@ void AudioMixerClientData::sendAudioStreamStatsPackets(const SharedNodePointer&
     }
 }
 
+static QJsonArray latencyHistogramToJson(const AdaptiveJitterTarget::LatencyHistogram& histogram) {
+    QJsonArray result;
+    for (auto count : histogram) {
+        result.push_back((double)count);
+    }
+    return result;
+}
+
+static void addJitterTargetStats(QJsonObject& stats, const InboundAudioStream& stream) {
+    const AdaptiveJitterTarget& jitterTarget = stream.getJitterTarget();
+    stats["desired_target"] = jitterTarget.getTargetFrames();
+    stats["delay_percentile"] = formatUsecTime((double)jitterTarget.getDelayAtPercentile());
+    stats["time_scaled_samples"] = stream.getTimeScaledSamples();
+    stats["target_latency_histogram"] = latencyHistogramToJson(jitterTarget.getTargetLatencyHistogram());
+    stats["actual_latency_histogram"] = latencyHistogramToJson(jitterTarget.getActualLatencyHistogram());
+}
+
 QJsonObject AudioMixerClientData::getAudioStreamStats() {
     QJsonObject result;
 
@@ -694,6 +712,7 @@ QJsonObject AudioMixerClientData::getAudioStreamStats() {
         upstreamStats["min_gap_30s"] = formatUsecTime(streamStats._timeGapWindowMin);
         upstreamStats["max_gap_30s"] = formatUsecTime(streamStats._timeGapWindowMax);
         upstreamStats["avg_gap_30s"] = formatUsecTime(streamStats._timeGapWindowAverage);
+        addJitterTargetStats(upstreamStats, *avatarAudioStream);
 
         result["upstream"] = upstreamStats;
     } else {
@@ -724,6 +743,7 @@ QJsonObject AudioMixerClientData::getAudioStreamStats() {
             upstreamStats["min_gap_30s"] = formatUsecTime(streamStats._timeGapWindowMin);
             upstreamStats["max_gap_30s"] = formatUsecTime(streamStats._timeGapWindowMax);
             upstreamStats["avg_gap_30s"] = formatUsecTime(streamStats._timeGapWindowAverage);
+            addJitterTargetStats(upstreamStats, *injectorPair);
 
             injectorArray.push_back(upstreamStats);
         }
@@ -13,6 +13,7 @@
 #define hifi_AudioMixerClientData_h
 
 #include <queue>
+#include <unordered_map>
 
 #include <tbb/concurrent_vector.h>
 
@@ -100,6 +101,12 @@ public:
         // once you have encoded, you need to flush eventually.
         _shouldFlushEncoder = true;
     }
+    // reuse an identical mix already encoded for another listener with the same stateless codec
+    void encodeShared(const QByteArray& sharedEncodedBuffer, QByteArray& encodedBuffer) {
+        encodedBuffer = sharedEncodedBuffer;
+        _shouldFlushEncoder = true;
+    }
+    bool hasStatelessEncoder() const { return _encoder && _encoder->isStateless(); }
     void encodeFrameOfZeros(QByteArray& encodedZeros);
     bool shouldFlushEncoder() { return _shouldFlushEncoder; }
 
@@ -128,10 +135,12 @@ public:
     };
 
     using MixableStreamsVector = std::vector<MixableStream>;
+    using DistantStreamsMap = std::unordered_map<const PositionalAudioStream*, MixableStream>;
     struct Streams {
         MixableStreamsVector active;
         MixableStreamsVector inactive;
         MixableStreamsVector skipped;
+        DistantStreamsMap distant; // beyond the listener's audible radius, not visited until back in range
     };
 
     Streams& getStreams() { return _streams; }
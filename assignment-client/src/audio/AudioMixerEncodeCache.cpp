@@ -0,0 +1,66 @@
+//
+//  AudioMixerEncodeCache.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerEncodeCache.h"
+
+uint64_t AudioMixerEncodeCache::fingerprint(const QByteArray& decodedBuffer) {
+    // 64-bit FNV-1a, collisions are resolved by comparing the full buffers
+    const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    const uint64_t FNV_PRIME = 1099511628211ULL;
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(decodedBuffer.constData());
+    for (int i = 0; i < decodedBuffer.size(); ++i) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+bool AudioMixerEncodeCache::find(const QString& codecName, uint64_t fingerprint, const QByteArray& decodedBuffer,
+                                 QByteArray& encodedBuffer, uint64_t& encodeTime) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto range = _entries.equal_range(fingerprint);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& entry = it->second;
+        if (entry.codecName == codecName && entry.decodedBuffer == decodedBuffer) {
+            encodedBuffer = entry.encodedBuffer;
+            encodeTime = entry.encodeTime;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AudioMixerEncodeCache::insert(const QString& codecName, uint64_t fingerprint, const QByteArray& decodedBuffer,
+                                   const QByteArray& encodedBuffer, uint64_t encodeTime) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_entries.size() >= MAX_ENTRIES) {
+        return;
+    }
+
+    // another slave may have encoded the same mix concurrently, keep the first
+    auto range = _entries.equal_range(fingerprint);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& entry = it->second;
+        if (entry.codecName == codecName && entry.decodedBuffer == decodedBuffer) {
+            return;
+        }
+    }
+
+    _entries.emplace(fingerprint, Entry { codecName, decodedBuffer, encodedBuffer, encodeTime });
+}
+
+void AudioMixerEncodeCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+}
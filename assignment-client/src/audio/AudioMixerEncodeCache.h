@@ -0,0 +1,52 @@
+//
+//  AudioMixerEncodeCache.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerEncodeCache_h
+#define hifi_AudioMixerEncodeCache_h
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include <QByteArray>
+#include <QString>
+
+// Per-frame cache of encoded mixes, shared by all slaves.
+//   Listeners that receive byte-identical mixes with the same stateless codec
+//   (see Encoder::isStateless) can share a single encoded payload.
+//   The cache must be cleared at the start of every mix phase.
+class AudioMixerEncodeCache {
+public:
+    static uint64_t fingerprint(const QByteArray& decodedBuffer);
+
+    // returns true and sets encodedBuffer and encodeTime if an identical mix was encoded with codecName this frame
+    bool find(const QString& codecName, uint64_t fingerprint, const QByteArray& decodedBuffer,
+              QByteArray& encodedBuffer, uint64_t& encodeTime);
+    void insert(const QString& codecName, uint64_t fingerprint, const QByteArray& decodedBuffer,
+                const QByteArray& encodedBuffer, uint64_t encodeTime);
+
+    void clear();
+
+private:
+    struct Entry {
+        QString codecName;
+        QByteArray decodedBuffer;
+        QByteArray encodedBuffer;
+        uint64_t encodeTime; // ns
+    };
+
+    // bound the memory held by frames where every mix is unique
+    static const size_t MAX_ENTRIES = 512;
+
+    std::mutex _mutex;
+    std::unordered_multimap<uint64_t, Entry> _entries; // guarded by _mutex
+};
+
+#endif // hifi_AudioMixerEncodeCache_h
@@ -12,6 +12,8 @@
 #include "AudioMixerSlave.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include <glm/glm.hpp>
 #include <glm/gtx/norm.hpp>
@@ -42,6 +44,29 @@ using MixableStream = AudioMixerClientData::MixableStream;
 using MixableStreamsVector = AudioMixerClientData::MixableStreamsVector;
 
 // packet helpers
+void AudioMixerSlave::encodeSharedMix(AudioMixerClientData& listenerData, const QByteArray& decodedBuffer,
+                                      QByteArray& encodedBuffer) {
+    QString codecName = listenerData.getCodecName();
+    uint64_t fingerprint = AudioMixerEncodeCache::fingerprint(decodedBuffer);
+
+    QByteArray sharedEncodedBuffer;
+    uint64_t encodeTime = 0;
+    if (_sharedData.encodeCache.find(codecName, fingerprint, decodedBuffer, sharedEncodedBuffer, encodeTime)) {
+        listenerData.encodeShared(sharedEncodedBuffer, encodedBuffer);
+        ++stats.encodeCacheHits;
+        stats.encodeTimeSaved += encodeTime;
+        return;
+    }
+
+    auto encodeStart = p_high_resolution_clock::now();
+    listenerData.encode(decodedBuffer, encodedBuffer);
+    auto encodeEnd = p_high_resolution_clock::now();
+    encodeTime = std::chrono::duration_cast<std::chrono::nanoseconds>(encodeEnd - encodeStart).count();
+
+    _sharedData.encodeCache.insert(codecName, fingerprint, decodedBuffer, encodedBuffer, encodeTime);
+    ++stats.encodeCacheMisses;
+}
+
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec);
 void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer);
 void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
@@ -97,15 +122,23 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
         ++stats.sumListeners;
 
         // mix the audio
+        int numPersonalizedMixes = stats.hrtfRenders + stats.manualEchoMixes;
         bool mixHasAudio = prepareMix(node);
 
+        // a mix without HRTF renders or echoes may be identical to other listeners' mixes
+        bool isPersonalizedMix = (stats.hrtfRenders + stats.manualEchoMixes) != numPersonalizedMixes;
+
         // send audio packet
         if (mixHasAudio || data->shouldFlushEncoder()) {
             QByteArray encodedBuffer;
             if (mixHasAudio) {
                 // encode the audio
                 QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
-                data->encode(decodedBuffer, encodedBuffer);
+                if (!isPersonalizedMix && data->hasStatelessEncoder()) {
+                    encodeSharedMix(*data, decodedBuffer, encodedBuffer);
+                } else {
+                    data->encode(decodedBuffer, encodedBuffer);
+                }
             } else {
                 // time to flush (resets shouldFlush until the next encode)
                 data->encodeFrameOfZeros(encodedBuffer);
@@ -306,6 +339,92 @@ float approximateVolume(const MixableStream& stream, const AvatarAudioStream* li
     return stream.positionalStream->getLastPopOutputTrailingLoudness() * gain;
 };
 
+void AudioMixerSlave::cullDistantStreams(const Node& listener, AudioMixerClientData& listenerData,
+                                         const AvatarAudioStream& listenerAudioStream) {
+    auto& streams = listenerData.getStreams();
+    auto& spatialIndex = _sharedData.spatialIndex;
+    const glm::vec3& listenerPosition = listenerAudioStream.getPosition();
+
+    // soloed streams are heard at any distance
+    float radius = listenerData.getSoloedNodes().empty() ? spatialIndex.getAudibleRadius(listenerPosition)
+                                                        : std::numeric_limits<float>::infinity();
+    bool isCulling = std::isfinite(radius);
+
+    // distant streams are not visited by the mix, so forget the ones removed this frame here
+    if (!streams.distant.empty() && (!_sharedData.removedNodes.empty() || !_sharedData.removedStreams.empty())) {
+        for (auto it = streams.distant.begin(); it != streams.distant.end();) {
+            if (shouldBeRemoved(it->second, _sharedData)) {
+                it = streams.distant.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    auto readmit = [&](MixableStream& stream) {
+        // ignore changes were not staged for this stream while it was distant
+        stream.ignoredByListener = contains(listener.getIgnoredNodeIDs(), stream.nodeStreamID.nodeID);
+        stream.ignoringListener = contains(listenerData.getIgnoringNodeIDs(), stream.nodeStreamID.nodeID);
+        streams.inactive.push_back(move(stream));
+        ++stats.distantToInactive;
+    };
+
+    if (!isCulling) {
+        for (auto& distantStream : streams.distant) {
+            readmit(distantStream.second);
+        }
+        streams.distant.clear();
+        return;
+    }
+
+    ++stats.cullingListeners;
+
+    // bring back the distant streams that are now in range
+    _sourcesInRange.clear();
+    spatialIndex.findSources(listenerPosition, radius, _sourcesInRange);
+    stats.sourcesInRange += (int)_sourcesInRange.size();
+
+    if (!streams.distant.empty()) {
+        for (int id : _sourcesInRange) {
+            auto it = streams.distant.find(spatialIndex.getSource(id));
+            if (it != streams.distant.end()) {
+                readmit(it->second);
+                streams.distant.erase(it);
+            }
+        }
+    }
+
+    // and send the streams that went out of range to distant
+    float evictionRadius = AudioSourceGrid::computeEvictionRadius(radius);
+    float evictionRadiusSquared = evictionRadius * evictionRadius;
+    auto shouldBeDistant = [&](MixableStream& stream) {
+        if (shouldBeRemoved(stream, _sharedData)) {
+            // the mix will erase it
+            return false;
+        }
+
+        glm::vec3 relativePosition = stream.positionalStream->getPosition() - listenerPosition;
+        if (glm::dot(relativePosition, relativePosition) <= evictionRadiusSquared) {
+            return false;
+        }
+
+        resetHRTFState(stream);
+        // emplace would drop the stream if its key were already taken, so replace any stale entry instead
+        const PositionalAudioStream* positionalStream = stream.positionalStream;
+        auto it = streams.distant.find(positionalStream);
+        if (it != streams.distant.end()) {
+            it->second = move(stream);
+        } else {
+            streams.distant.emplace(positionalStream, move(stream));
+        }
+        ++stats.toDistant;
+        return true;
+    };
+    erase_if(streams.active, shouldBeDistant);
+    erase_if(streams.inactive, shouldBeDistant);
+    erase_if(streams.skipped, shouldBeDistant);
+}
+
 bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     AvatarAudioStream* listenerAudioStream = static_cast<AudioMixerClientData*>(listener->getLinkedData())->getAvatarAudioStream();
     AudioMixerClientData* listenerData = static_cast<AudioMixerClientData*>(listener->getLinkedData());
@@ -320,6 +439,8 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
     addStreams(*listener, *listenerData);
 
+    cullDistantStreams(*listener, *listenerData, *listenerAudioStream);
+
     // Process skipped streams
     erase_if(streams.skipped, [&](MixableStream& stream) {
         if (shouldBeRemoved(stream, _sharedData)) {
@@ -463,6 +584,7 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     stats.skipped += (int)streams.skipped.size();
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
+    stats.distant += (int)streams.distant.size();
 
     // clear the newly ignored, un-ignored, ignoring, and un-ignoring streams now that we've processed them
     listenerData->clearStagedIgnoreChanges();
@@ -23,6 +23,8 @@
 #include <PositionalAudioStream.h>
 
 #include "AudioMixerClientData.h"
+#include "AudioMixerEncodeCache.h"
+#include "AudioMixerSpatialIndex.h"
 #include "AudioMixerStats.h"
 
 class AvatarAudioStream;
@@ -36,6 +38,8 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioMixerEncodeCache encodeCache;
+        AudioMixerSpatialIndex spatialIndex;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -66,12 +70,22 @@ private:
                               float masterInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // encode through the shared encode cache, for mixes that are not personalized to the listener
+    void encodeSharedMix(AudioMixerClientData& listenerData, const QByteArray& decodedBuffer, QByteArray& encodedBuffer);
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
+    // move streams beyond the listener's audible radius to (and back from) the distant streams
+    void cullDistantStreams(const Node& listener, AudioMixerClientData& listenerData,
+                            const AvatarAudioStream& listenerAudioStream);
+
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // culling buffer
+    std::vector<int> _sourcesInRange; // spatial index ids
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
@@ -0,0 +1,74 @@
+//
+//  AudioMixerSpatialIndex.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "AudioMixer.h"
+#include "AudioMixerClientData.h"
+
+void AudioMixerSpatialIndex::build(ConstIter begin, ConstIter end) {
+    _grid.clear();
+    _streams.clear();
+    _zoneRadii.clear();
+
+    float maxRadius = AudioMixer::getMaxAudibleDistance();
+    _defaultRadius = AudioSourceGrid::computeAudibleRadius(AudioMixer::getAttenuationPerDoublingInDistance(), maxRadius);
+    _isEnabled = std::isfinite(_defaultRadius);
+    if (!_isEnabled) {
+        return;
+    }
+
+    // precompute the radius of zones that can be heard further than the default
+    for (const auto& settings : AudioMixer::getZoneSettings()) {
+        float radius = AudioSourceGrid::computeAudibleRadius(settings.coefficient, maxRadius);
+        if (radius > _defaultRadius) {
+            auto it = std::find_if(_zoneRadii.begin(), _zoneRadii.end(), [&](const ZoneRadius& zoneRadius) {
+                return zoneRadius.zone == settings.listener;
+            });
+            if (it == _zoneRadii.end()) {
+                _zoneRadii.push_back({ settings.listener, radius });
+            } else {
+                it->radius = std::max(it->radius, radius);
+            }
+        }
+    }
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (nodeData) {
+            for (const auto& stream : nodeData->getAudioStreams()) {
+                _grid.addSource(stream->getPosition(), (int)_streams.size());
+                _streams.push_back(stream.get());
+            }
+        }
+    });
+
+    _grid.build();
+}
+
+float AudioMixerSpatialIndex::getAudibleRadius(const glm::vec3& listenerPosition) const {
+    if (!_isEnabled) {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    auto& audioZones = AudioMixer::getAudioZones();
+
+    float radius = _defaultRadius;
+    for (const auto& zoneRadius : _zoneRadii) {
+        if (zoneRadius.radius > radius && audioZones[zoneRadius.zone].area.contains(listenerPosition)) {
+            radius = zoneRadius.radius;
+        }
+    }
+    return radius;
+}
@@ -0,0 +1,63 @@
+//
+//  AudioMixerSpatialIndex.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSpatialIndex_h
+#define hifi_AudioMixerSpatialIndex_h
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AudioSourceGrid.h>
+#include <NodeList.h>
+
+class PositionalAudioStream;
+
+// Per-frame grid of audio source positions, shared by all slaves.
+//   Distance attenuation makes a source inaudible beyond some radius, which depends on the attenuation
+//   settings of the zone the listener is in, and is limited by the max audible distance of the domain.
+//   When every setting has a finite audible radius, listeners only need to consider the sources within it.
+//   The index must be rebuilt after packets are processed and before the mix phase of every frame.
+class AudioMixerSpatialIndex {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    void build(ConstIter begin, ConstIter end);
+
+    // false if some attenuation setting is audible at any distance, in which case there is nothing to cull
+    bool isEnabled() const { return _isEnabled; }
+
+    // the radius beyond which no source is audible to a listener at this position
+    float getAudibleRadius(const glm::vec3& listenerPosition) const;
+
+    // appends the ids of the sources within radius of position
+    void findSources(const glm::vec3& position, float radius, std::vector<int>& ids) const {
+        _grid.findSources(position, radius, ids);
+    }
+
+    const PositionalAudioStream* getSource(int id) const { return _streams[id]; }
+    int getNumSources() const { return (int)_streams.size(); }
+
+private:
+    // audible radius of the zones with settings that attenuate less than the default
+    struct ZoneRadius {
+        int zone;
+        float radius;
+    };
+
+    bool _isEnabled { false };
+    float _defaultRadius { 0.0f };
+    std::vector<ZoneRadius> _zoneRadii;
+
+    AudioSourceGrid _grid;
+    std::vector<const PositionalAudioStream*> _streams; // by grid id
+};
+
+#endif // hifi_AudioMixerSpatialIndex_h
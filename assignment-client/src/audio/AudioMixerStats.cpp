@@ -36,6 +36,16 @@ void AudioMixerStats::reset() {
     inactive = 0;
     active = 0;
 
+    distant = 0;
+    toDistant = 0;
+    distantToInactive = 0;
+    cullingListeners = 0;
+    sourcesInRange = 0;
+
+    encodeCacheHits = 0;
+    encodeCacheMisses = 0;
+    encodeTimeSaved = 0;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime = 0;
 #endif
@@ -66,6 +76,16 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     inactive += otherStats.inactive;
     active += otherStats.active;
 
+    distant += otherStats.distant;
+    toDistant += otherStats.toDistant;
+    distantToInactive += otherStats.distantToInactive;
+    cullingListeners += otherStats.cullingListeners;
+    sourcesInRange += otherStats.sourcesInRange;
+
+    encodeCacheHits += otherStats.encodeCacheHits;
+    encodeCacheMisses += otherStats.encodeCacheMisses;
+    encodeTimeSaved += otherStats.encodeTimeSaved;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime += otherStats.mixTime;
 #endif
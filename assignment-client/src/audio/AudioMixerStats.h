@@ -12,9 +12,7 @@
 #ifndef hifi_AudioMixerStats_h
 #define hifi_AudioMixerStats_h
 
-#ifdef HIFI_AUDIO_MIXER_DEBUG
 #include <cstdint>
-#endif
 
 struct AudioMixerStats {
     int sumStreams { 0 };
@@ -41,6 +39,16 @@ struct AudioMixerStats {
     int inactive { 0 };
     int active { 0 };
 
+    int distant { 0 };
+    int toDistant { 0 };
+    int distantToInactive { 0 };
+    int cullingListeners { 0 };
+    int sourcesInRange { 0 };
+
+    int encodeCacheHits { 0 };
+    int encodeCacheMisses { 0 };
+    uint64_t encodeTimeSaved { 0 }; // ns
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     uint64_t mixTime { 0 };
 #endif
@@ -17,6 +17,9 @@ macro(TARGET_BULLET)
         list(APPEND BULLET_LIBRARIES ${LIB_DIR}/libBulletSoftBody.a)
     else()
         find_package(Bullet REQUIRED)
+        # our bullet3 port is built with BULLET2_MULTITHREADING, and its headers must see the same BT_THREADSAFE.
+        # ThreadSafeDynamicsWorld.h picks its base class on it, so it is public for every target that includes it
+        target_compile_definitions(${TARGET_NAME} PUBLIC BT_THREADSAFE=1)
    endif()
     # perform the system include hack for OS X to ignore warnings
     if (APPLE)
@@ -71,6 +71,9 @@ Item {
                     StatText {
                         text: "Physics Object Count: " + root.physicsObjectCount
                     }
+                    StatText {
+                        text: "Renderables Updated: " + root.renderablesUpdatedCount
+                    }
                     StatText {
                         visible: root.expanded
                         text: root.gameUpdateStats
@@ -338,6 +338,9 @@ Setting::Handle<int> maxOctreePacketsPerSecond{"maxOctreePPS", DEFAULT_MAX_OCTRE
 
 Setting::Handle<bool> loginDialogPoppedUp{"loginDialogPoppedUp", false};
 
+// the number of threads for the bullet narrowphase and island solving, 1 steps physics on the physics thread only
+Setting::Handle<int> physicsThreads{"physicsThreads", 1};
+
 static const QUrl AVATAR_INPUTS_BAR_QML = PathUtils::qmlUrl("AvatarInputsBar.qml");
 static const QUrl MIC_BAR_APPLICATION_QML = PathUtils::qmlUrl("hifi/audio/MicBarApplication.qml");
 static const QUrl BUBBLE_ICON_QML = PathUtils::qmlUrl("BubbleIcon.qml");
@@ -5587,7 +5590,13 @@ void Application::init() {
         return atan2(maxSize, distance);
     });
 
+    static const std::string STATIC_MESH_CACHE_DIRNAME { "static_mesh_cache" };
+    static const std::string STATIC_MESH_CACHE_EXT { "bvh" };
+    auto staticMeshCache = std::make_shared<StaticMeshCache>(STATIC_MESH_CACHE_DIRNAME, STATIC_MESH_CACHE_EXT);
+    staticMeshCache->initialize();
+    _shapeManager.setStaticMeshCache(staticMeshCache);
     ObjectMotionState::setShapeManager(&_shapeManager);
+    _physicsEngine->setNumThreads(physicsThreads.get());
     _physicsEngine->init();
 
     EntityTreePointer tree = getEntities()->getTree();
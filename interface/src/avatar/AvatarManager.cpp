@@ -32,6 +32,7 @@
 #include <AvatarData.h>
 #include <PerfStat.h>
 #include <PrioritySortUtil.h>
+#include <TBBHelpers.h>
 #include <RegisteredMetaTypes.h>
 #include <Rig.h>
 #include <SettingHandle.h>
@@ -55,6 +56,9 @@
 // We add _myAvatar into the hash with all the other AvatarData, and we use the default NULL QUid as the key.
 const QUuid MY_AVATAR_KEY;  // NULL key
 
+// the number of avatars per thread whose joints are simulated between checks of the time budget
+const int AVATARS_PER_THREAD_PER_BATCH = 2;
+
 AvatarManager::AvatarManager(QObject* parent) :
     _myAvatar(new MyAvatar(qApp->thread()), [](MyAvatar* ptr) { ptr->deleteLater(); })
 {
@@ -296,6 +300,16 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     render::Transaction renderTransaction;
     workload::Transaction workloadTransaction;
 
+    // the joints of a batch of avatars are simulated at once, on as many threads as there are cores, between main thread
+    // passes over the batch in priority order. The time budget is checked between batches, so it bounds the time spent
+    // by each thread rather than the total.
+    const int batchSize = _parallelSimulation ? AVATARS_PER_THREAD_PER_BATCH * std::max(QThread::idealThreadCount(), 1) : 1;
+    std::vector<uint8_t> inViewFlags;
+    std::vector<uint64_t> jointSimulationTimes;
+    std::vector<int> parallelIndices;
+    _avatarAnimationTimeHistogram.fill(0);
+    uint64_t maxJointSimulationTime = 0;
+
     for (int p = kHero; p < NumVariants; p++) {
         auto& priorityQueue = avatarPriorityQueues[p];
         // Sorting the current queue HERE as part of the measured timing.
@@ -303,56 +317,9 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
 
         auto passExpiry = updatePriorityExpiries[p];
 
-        for (auto it = sortedAvatarVector.begin(); it != sortedAvatarVector.end(); ++it) {
-            const SortableAvatar& sortData = *it;
-            const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
-            if (!avatar->_isClientAvatar) {
-                avatar->setIsClientAvatar(true);
-            }
-            // TODO: to help us scale to more avatars it would be nice to not have to poll this stuff every update
-            if (avatar->getSkeletonModel()->isLoaded()) {
-                // remove the orb if it is there
-                avatar->removeOrb();
-                if (avatar->needsPhysicsUpdate()) {
-                    _otherAvatarsToChangeInPhysics.insert(avatar);
-                }
-            } else {
-                avatar->updateOrbPosition();
-            }
-
-            // for ALL avatars...
-            if (_shouldRender) {
-                avatar->ensureInScene(avatar, qApp->getMain3DScene());
-            }
-
-            avatar->animateScaleChanges(deltaTime);
-
+        for (auto it = sortedAvatarVector.begin(); it != sortedAvatarVector.end(); ) {
             uint64_t now = usecTimestampNow();
-            if (now < passExpiry) {
-                // we're within budget
-                bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
-                if (inView && avatar->hasNewJointData()) {
-                    numAvatarsUpdated++;
-                }
-                auto transitStatus = avatar->_transit.update(deltaTime, avatar->_serverPosition, _transitConfig);
-                if (avatar->getIsNewAvatar() && (transitStatus == AvatarTransit::Status::START_TRANSIT ||
-                                                 transitStatus == AvatarTransit::Status::ABORT_TRANSIT)) {
-                    avatar->_transit.reset();
-                    avatar->setIsNewAvatar(false);
-                }
-                avatar->simulate(deltaTime, inView);
-                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
-                    _myAvatar->addAvatarHandsToFlow(avatar);
-                }
-                if (_drawOtherAvatarSkeletons) {
-                    avatar->debugJointData();
-                }
-                avatar->setEnableMeshVisible(!_drawOtherAvatarSkeletons);
-                avatar->updateRenderItem(renderTransaction);
-                avatar->updateSpaceProxy(workloadTransaction);
-                avatar->setLastRenderUpdateTime(startTime);
-
-            } else {
+            if (now >= passExpiry) {
                 // we've spent our time budget for this priority bucket
                 // let's deal with the reminding avatars if this pass and BREAK from the for loop
 
@@ -379,6 +346,96 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
                 // We had to cut short this pass, we must break out of the for loop here
                 break;
             }
+
+            // we're within budget
+            auto batchEnd = it + std::min<ptrdiff_t>(batchSize, sortedAvatarVector.end() - it);
+            int numInBatch = (int)(batchEnd - it);
+            inViewFlags.resize(numInBatch);
+            jointSimulationTimes.resize(numInBatch);
+
+            for (int i = 0; i < numInBatch; i++) {
+                const SortableAvatar& sortData = it[i];
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+                if (!avatar->_isClientAvatar) {
+                    avatar->setIsClientAvatar(true);
+                }
+                // TODO: to help us scale to more avatars it would be nice to not have to poll this stuff every update
+                if (avatar->getSkeletonModel()->isLoaded()) {
+                    // remove the orb if it is there
+                    avatar->removeOrb();
+                    if (avatar->needsPhysicsUpdate()) {
+                        _otherAvatarsToChangeInPhysics.insert(avatar);
+                    }
+                } else {
+                    avatar->updateOrbPosition();
+                }
+
+                // for ALL avatars...
+                if (_shouldRender) {
+                    avatar->ensureInScene(avatar, qApp->getMain3DScene());
+                }
+
+                avatar->animateScaleChanges(deltaTime);
+
+                bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
+                inViewFlags[i] = inView;
+                if (inView && avatar->hasNewJointData()) {
+                    numAvatarsUpdated++;
+                }
+                auto transitStatus = avatar->_transit.update(deltaTime, avatar->_serverPosition, _transitConfig);
+                if (avatar->getIsNewAvatar() && (transitStatus == AvatarTransit::Status::START_TRANSIT ||
+                                                 transitStatus == AvatarTransit::Status::ABORT_TRANSIT)) {
+                    avatar->_transit.reset();
+                    avatar->setIsNewAvatar(false);
+                }
+                avatar->beginSimulate(deltaTime, inView);
+            }
+
+            auto simulateJoints = [&](int i) {
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(it[i].getAvatar());
+                uint64_t start = usecTimestampNow();
+                avatar->simulateJoints(deltaTime, inViewFlags[i]);
+                jointSimulationTimes[i] = usecTimestampNow() - start;
+            };
+
+            // a skeleton model whose geometry has just loaded builds its joint states in updateGeometry() and emits
+            // rigReady(), whose receivers expect the main thread, so those avatars are simulated here, before the others
+            parallelIndices.clear();
+            for (int i = 0; i < numInBatch; i++) {
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(it[i].getAvatar());
+                if (avatar->getSkeletonModel()->needsGeometryUpdate()) {
+                    simulateJoints(i);
+                } else {
+                    parallelIndices.push_back(i);
+                }
+            }
+            if (parallelIndices.size() > 1) {
+                tbb::parallel_for(0, (int)parallelIndices.size(), [&](int j) {
+                    simulateJoints(parallelIndices[j]);
+                });
+            } else if (parallelIndices.size() == 1) {
+                simulateJoints(parallelIndices[0]);
+            }
+
+            for (int i = 0; i < numInBatch; i++) {
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(it[i].getAvatar());
+                avatar->endSimulate(deltaTime, inViewFlags[i]);
+                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
+                    _myAvatar->addAvatarHandsToFlow(avatar);
+                }
+                if (_drawOtherAvatarSkeletons) {
+                    avatar->debugJointData();
+                }
+                avatar->setEnableMeshVisible(!_drawOtherAvatarSkeletons);
+                avatar->updateRenderItem(renderTransaction);
+                avatar->updateSpaceProxy(workloadTransaction);
+                avatar->setLastRenderUpdateTime(startTime);
+
+                addAvatarAnimationTime(jointSimulationTimes[i]);
+                maxJointSimulationTime = std::max(maxJointSimulationTime, jointSimulationTimes[i]);
+            }
+
+            it = batchEnd;
         }
 
         if (p == kHero) {
@@ -386,6 +443,8 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
         }
     }
 
+    _maxAvatarAnimationTime = (float)maxJointSimulationTime / (float)USECS_PER_MSEC;
+
     if (_shouldRender) {
         qApp->getMain3DScene()->enqueueTransaction(renderTransaction);
     }
@@ -399,6 +458,16 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     _avatarSimulationTime = (float)(usecTimestampNow() - startTime) / (float)USECS_PER_MSEC;
 }
 
+void AvatarManager::addAvatarAnimationTime(uint64_t usecs) {
+    int bucket = 0;
+    uint64_t bucketLimit = AVATAR_ANIMATION_TIME_HISTOGRAM_FIRST_BUCKET_USECS;
+    while (bucket < NUM_AVATAR_ANIMATION_TIME_BUCKETS - 1 && usecs >= bucketLimit) {
+        bucket++;
+        bucketLimit *= 2;
+    }
+    _avatarAnimationTimeHistogram[bucket]++;
+}
+
 void AvatarManager::postUpdate(float deltaTime, const render::ScenePointer& scene) {
     auto hashCopy = getHashCopy();
     AvatarHash::iterator avatarIterator = hashCopy.begin();
@@ -12,6 +12,7 @@
 #ifndef hifi_AvatarManager_h
 #define hifi_AvatarManager_h
 
+#include <array>
 #include <set>
 
 #include <QtCore/QHash>
@@ -119,6 +120,14 @@ public:
     int getNumHeroAvatarsUpdated() const { return _numHeroAvatarsUpdated; }
     float getAvatarSimulationTime() const { return _avatarSimulationTime; }
 
+    // the number of avatars whose joints took less than 100 us to simulate in the last update,
+    // then less than 200 us, 400 us, ..., then the rest
+    static const int NUM_AVATAR_ANIMATION_TIME_BUCKETS = 8;
+    static const uint64_t AVATAR_ANIMATION_TIME_HISTOGRAM_FIRST_BUCKET_USECS = 100;
+    using AnimationTimeHistogram = std::array<int, NUM_AVATAR_ANIMATION_TIME_BUCKETS>;
+    const AnimationTimeHistogram& getAvatarAnimationTimeHistogram() const { return _avatarAnimationTimeHistogram; }
+    float getMaxAvatarAnimationTime() const { return _maxAvatarAnimationTime; }
+
     void updateMyAvatar(float deltaTime);
     void updateOtherAvatars(float deltaTime);
 
@@ -271,6 +280,16 @@ public slots:
         _drawOtherAvatarSkeletons = isEnabled;
     }
 
+    /**jsdoc
+    * Sets whether the joints of other avatars are simulated on several threads at once.
+    * @function AvatarManager.setEnableParallelSimulation
+    * @param {boolean} enabled - <code>true</code> to simulate on several threads, <code>false</code> to simulate on the
+    *     main thread only.
+    */
+    void setEnableParallelSimulation(bool isEnabled) {
+        _parallelSimulation = isEnabled;
+    }
+
 protected:
     AvatarSharedPointer addAvatar(const QUuid& sessionUUID, const QWeakPointer<Node>& mixerWeakPointer) override;
     DetailedMotionState* createDetailedMotionState(OtherAvatarPointer avatar, int32_t jointIndex);
@@ -290,6 +309,7 @@ private:
     void handleRemovedAvatar(const AvatarSharedPointer& removedAvatar,
                              KillAvatarReason removalReason = KillAvatarReason::NoReason) override;
     void handleTransitAnimations(AvatarTransit::Status status);
+    void addAvatarAnimationTime(uint64_t usecs);
 
     using SetOfOtherAvatars = std::set<OtherAvatarPointer>;
     SetOfOtherAvatars _otherAvatarsToChangeInPhysics;
@@ -305,6 +325,8 @@ private:
     int _numHeroAvatars{ 0 };
     int _numHeroAvatarsUpdated{ 0 };
     float _avatarSimulationTime { 0.0f };
+    AnimationTimeHistogram _avatarAnimationTimeHistogram {};
+    float _maxAvatarAnimationTime { 0.0f };
     bool _shouldRender { true };
     bool _myAvatarDataPacketsPaused { false };
 
@@ -313,6 +335,7 @@ private:
 
     AvatarTransit::TransitConfig  _transitConfig;
     bool _drawOtherAvatarSkeletons { false };
+    bool _parallelSimulation { true };
 };
 
 #endif // hifi_AvatarManager_h
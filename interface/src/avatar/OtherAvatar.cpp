@@ -244,6 +244,12 @@ void OtherAvatar::setCollisionWithOtherAvatarsFlags() {
 }
 
 void OtherAvatar::simulate(float deltaTime, bool inView) {
+    beginSimulate(deltaTime, inView);
+    simulateJoints(deltaTime, inView);
+    endSimulate(deltaTime, inView);
+}
+
+void OtherAvatar::beginSimulate(float deltaTime, bool inView) {
     PROFILE_RANGE(simulation, "simulate");
 
     _globalPosition = _transit.isActive() ? _transit.getCurrentPosition() : _serverPosition;
@@ -255,40 +261,55 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
     if (inView) {
         _simulationInViewRate.increment();
     }
+}
 
+void OtherAvatar::simulateJoints(float deltaTime, bool inView) {
+    // only touches the state of this avatar, its rig and its skeleton model,
+    // so AvatarManager may run it for several avatars at once
     PerformanceTimer perfTimer("simulate");
-    {
-        PROFILE_RANGE(simulation, "updateJoints");
-        if (inView) {
-            Head* head = getHead();
-            if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
-                glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
-                _skeletonModel->getRig().computeExternalPoses(rootTransform);
-                _jointDataSimulationRate.increment();
-
-                head->simulate(deltaTime);
-                _skeletonModel->simulate(deltaTime, true);
-
-                locationChanged(); // joints changed, so if there are any children, update them.
-                _hasNewJointData = false;
-
-                glm::vec3 headPosition = getWorldPosition();
-                if (!_skeletonModel->getHeadPosition(headPosition)) {
-                    headPosition = getWorldPosition();
-                }
-                head->setPosition(headPosition);
-            } else {
-                head->simulate(deltaTime);
-                _skeletonModel->simulate(deltaTime, false);
-            }
-            head->setScale(getModelScale());
-            relayJointDataToChildren();
+    PROFILE_RANGE(simulation, "updateJoints");
+    _jointsChanged = false;
+    if (inView) {
+        Head* head = getHead();
+        if (_hasNewJointData || _transit.isActive()) {
+            _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+            glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+            _skeletonModel->getRig().computeExternalPoses(rootTransform);
+            _jointDataSimulationRate.increment();
+
+            head->simulate(deltaTime);
+            _skeletonModel->simulate(deltaTime, true);
+
+            _hasNewJointData = false;
+            _jointsChanged = true;
         } else {
-            // a non-full update is still required so that the position, rotation, scale and bounds of the skeletonModel are updated.
+            head->simulate(deltaTime);
             _skeletonModel->simulate(deltaTime, false);
         }
-        _skeletonModelSimulationRate.increment();
+    } else {
+        // a non-full update is still required so that the position, rotation, scale and bounds of the skeletonModel are updated.
+        _skeletonModel->simulate(deltaTime, false);
+    }
+
+    // compute the joint matrices for rendering now, rather than lazily during the post update on the main thread
+    _skeletonModel->updateClusterMatrices();
+    _skeletonModelSimulationRate.increment();
+}
+
+void OtherAvatar::endSimulate(float deltaTime, bool inView) {
+    if (inView) {
+        Head* head = getHead();
+        if (_jointsChanged) {
+            locationChanged(); // joints changed, so if there are any children, update them.
+
+            glm::vec3 headPosition = getWorldPosition();
+            if (!_skeletonModel->getHeadPosition(headPosition)) {
+                headPosition = getWorldPosition();
+            }
+            head->setPosition(headPosition);
+        }
+        head->setScale(getModelScale());
+        relayJointDataToChildren();
     }
 
     // update animation for display name fade in/out
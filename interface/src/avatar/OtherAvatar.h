@@ -64,6 +64,15 @@ public:
     void setCollisionWithOtherAvatarsFlags() override;
 
     void simulate(float deltaTime, bool inView) override;
+
+    // simulate, split so that simulateJoints can run on a worker thread between the other two, which must run on the
+    // main thread. Neither simulateJoints nor anything it calls may touch other avatars, entities or the scene, or emit
+    // signals: it may only run on a worker once the skeleton model no longer needsGeometryUpdate(). It does queue the
+    // model's post update lambda, which is thread safe.
+    void beginSimulate(float deltaTime, bool inView);
+    void simulateJoints(float deltaTime, bool inView);
+    void endSimulate(float deltaTime, bool inView);
+
     void debugJointData() const;
     friend AvatarManager;
 
@@ -91,6 +100,7 @@ protected:
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
     bool _needsDetailedRebuild { false };
+    bool _jointsChanged { false };
 };
 
 using OtherAvatarPointer = std::shared_ptr<OtherAvatar>;
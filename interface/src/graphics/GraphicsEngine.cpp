@@ -19,6 +19,7 @@
 #include <FramebufferCache.h>
 #include <UpdateSceneTask.h>
 #include <RenderViewTask.h>
+#include <render/CullTask.h>
 #include <SecondaryCamera.h>
 
 #include "RenderEventHandler.h"
@@ -68,7 +69,8 @@ void GraphicsEngine::initializeGPU(GLWidget* glwidget) {
 void GraphicsEngine::initializeRender() {
 
     // Set up the render engine
-    render::CullFunctor cullFunctor = LODManager::shouldRender;
+    // the render library's own LOD test, which it can evaluate in batches
+    render::CullFunctor cullFunctor = render::shouldRenderAtLOD;
     _renderEngine->addJob<UpdateSceneTask>("UpdateScene");
 #ifndef Q_OS_ANDROID
     _renderEngine->addJob<SecondaryCameraRenderTask>("SecondaryCameraJob", cullFunctor);
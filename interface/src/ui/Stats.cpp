@@ -127,6 +127,7 @@ void Stats::updateStats(bool force) {
     STAT_UPDATE(avatarCount, avatarManager->size() - 1);
     STAT_UPDATE(heroAvatarCount, avatarManager->getNumHeroAvatars());
     STAT_UPDATE(physicsObjectCount, qApp->getNumCollisionObjects());
+    STAT_UPDATE(renderablesUpdatedCount, qApp->getEntities()->getNumRenderablesUpdated());
     STAT_UPDATE(updatedAvatarCount, avatarManager->getNumAvatarsUpdated());
     STAT_UPDATE(updatedHeroAvatarCount, avatarManager->getNumHeroAvatarsUpdated());
     STAT_UPDATE(notUpdatedAvatarCount, avatarManager->getNumAvatarsNotUpdated());
@@ -389,6 +390,14 @@ void Stats::updateStats(bool force) {
     auto config = qApp->getRenderEngine()->getConfiguration().get();
     STAT_UPDATE(engineFrameTime, (float) config->getCPURunTime());
     STAT_UPDATE(avatarSimulationTime, (float)avatarManager->getAvatarSimulationTime());
+    {
+        QVariantList avatarAnimationTimeHistogram;
+        for (int count : avatarManager->getAvatarAnimationTimeHistogram()) {
+            avatarAnimationTimeHistogram.push_back(count);
+        }
+        STAT_UPDATE(avatarAnimationTimeHistogram, avatarAnimationTimeHistogram);
+    }
+    STAT_UPDATE(maxAvatarAnimationTime, avatarManager->getMaxAvatarAnimationTime());
 
     if (_expanded) {
         STAT_UPDATE(gpuBuffers, (int)gpu::Context::getBufferGPUCount());
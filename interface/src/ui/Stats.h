@@ -87,6 +87,9 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} physicsObjectCount - The number of objects that have collisions enabled.
  *     <em>Read-only.</em>
+ * @property {number} renderablesUpdatedCount - The number of entity renderers updated in the scene in the most recent game
+ *     loop.
+ *     <em>Read-only.</em>
  * @property {number} updatedAvatarCount - The number of avatars in the domain, other than the client's, that were updated in 
  *     the most recent game loop.
  *     <em>Read-only.</em>
@@ -333,6 +336,12 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} avatarSimulationTime - The time being spent simulating avatars each frame, in ms.
  *     <em>Read-only.</em>
+ * @property {number[]} avatarAnimationTimeHistogram - The number of avatars whose joints took less than 0.1 ms to simulate
+ *     in the last frame, then less than 0.2 ms, 0.4 ms, ..., 6.4 ms, then the rest.
+ *     <em>Read-only.</em>
+ * @property {number} maxAvatarAnimationTime - The longest time spent simulating the joints of one avatar in the last
+ *     frame, in ms.
+ *     <em>Read-only.</em>
  *
  * @property {number} stylusPicksCount - The number of stylus picks currently in effect.
  *     <em>Read-only.</em>
@@ -481,6 +490,7 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(QString, uxMode, QString())
     STATS_PROPERTY(int, heroAvatarCount, 0)
     STATS_PROPERTY(int, physicsObjectCount, 0)
+    STATS_PROPERTY(int, renderablesUpdatedCount, 0)
     STATS_PROPERTY(int, updatedAvatarCount, 0)
     STATS_PROPERTY(int, updatedHeroAvatarCount, 0)
     STATS_PROPERTY(int, notUpdatedAvatarCount, 0)
@@ -575,6 +585,8 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(float, batchFrameTime, 0)
     STATS_PROPERTY(float, engineFrameTime, 0)
     STATS_PROPERTY(float, avatarSimulationTime, 0)
+    STATS_PROPERTY(QVariantList, avatarAnimationTimeHistogram, QVariantList())
+    STATS_PROPERTY(float, maxAvatarAnimationTime, 0)
 
     STATS_PROPERTY(int, stylusPicksCount, 0)
     STATS_PROPERTY(int, rayPicksCount, 0)
@@ -789,6 +801,13 @@ signals:
      */
     void physicsObjectCountChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>renderablesUpdatedCount</code> property changes.
+     * @function Stats.renderablesUpdatedCountChanged
+     * @returns {Signal}
+     */
+    void renderablesUpdatedCountChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>updatedAvatarCount</code> property changes.
      * @function Stats.updatedAvatarCountChanged
@@ -1428,6 +1447,20 @@ signals:
      */
     void avatarSimulationTimeChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>avatarAnimationTimeHistogram</code> property changes.
+     * @function Stats.avatarAnimationTimeHistogramChanged
+     * @returns {Signal}
+     */
+    void avatarAnimationTimeHistogramChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>maxAvatarAnimationTime</code> property changes.
+     * @function Stats.maxAvatarAnimationTimeChanged
+     * @returns {Signal}
+     */
+    void maxAvatarAnimationTimeChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>stylusPicksCount</code> property changes.
      * @function Stats.stylusPicksCountChanged
@@ -0,0 +1,203 @@
+//
+//  AnimPoseSoA.cpp
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseSoA.h"
+
+#include <GLMHelpers.h>
+
+// how far apart the components of a scale may be for it to count as uniform
+static const float UNIFORM_SCALE_TOLERANCE = 1.0e-5f;
+
+static bool isUniformPositiveScale(float x, float y, float z) {
+    float tolerance = UNIFORM_SCALE_TOLERANCE * x;
+    return x > 0.0f && fabsf(y - x) <= tolerance && fabsf(z - x) <= tolerance;
+}
+
+void AnimPoseSoA::resize(int numPoses) {
+    _size = numPoses;
+    _stride = (numPoses + 3) & ~3;
+    _data.resize(NUM_COMPONENTS * _stride);
+    for (int c = 0; c < NUM_COMPONENTS; c++) {
+        _components[c] = _data.data() + c * _stride;
+    }
+    // keep the padding finite
+    for (int i = _size; i < _stride; i++) {
+        set(i, AnimPose::identity);
+    }
+}
+
+AnimPose AnimPoseSoA::get(int i) const {
+    const auto& c = _components;
+    return AnimPose(glm::vec3(c[SCALE_X][i], c[SCALE_Y][i], c[SCALE_Z][i]),
+                    glm::quat(c[ROT_W][i], c[ROT_X][i], c[ROT_Y][i], c[ROT_Z][i]),
+                    glm::vec3(c[TRANS_X][i], c[TRANS_Y][i], c[TRANS_Z][i]));
+}
+
+void AnimPoseSoA::set(int i, const AnimPose& pose) {
+    auto& c = _components;
+    c[SCALE_X][i] = pose.scale().x;
+    c[SCALE_Y][i] = pose.scale().y;
+    c[SCALE_Z][i] = pose.scale().z;
+    c[ROT_X][i] = pose.rot().x;
+    c[ROT_Y][i] = pose.rot().y;
+    c[ROT_Z][i] = pose.rot().z;
+    c[ROT_W][i] = pose.rot().w;
+    c[TRANS_X][i] = pose.trans().x;
+    c[TRANS_Y][i] = pose.trans().y;
+    c[TRANS_Z][i] = pose.trans().z;
+}
+
+void AnimPoseSoA::load(const AnimPose* poses, int numPoses) {
+    resize(numPoses);
+    for (int i = 0; i < numPoses; i++) {
+        set(i, poses[i]);
+    }
+}
+
+void AnimPoseSoA::load(const AnimPose* poses, const int* order, int numPoses) {
+    resize(numPoses);
+    for (int i = 0; i < numPoses; i++) {
+        set(i, poses[order[i]]);
+    }
+}
+
+void AnimPoseSoA::store(AnimPose* poses) const {
+    for (int i = 0; i < _size; i++) {
+        poses[i] = get(i);
+    }
+}
+
+void AnimPoseSoA::store(AnimPose* poses, const int* order) const {
+    for (int i = 0; i < _size; i++) {
+        poses[order[i]] = get(i);
+    }
+}
+
+// TRS composition of parent p and child c, for a uniform positive parent scale
+static inline void multiplyPose(const float p[AnimPoseSoA::NUM_COMPONENTS], const float c[AnimPoseSoA::NUM_COMPONENTS],
+                                float r[AnimPoseSoA::NUM_COMPONENTS]) {
+    const float px = p[AnimPoseSoA::ROT_X], py = p[AnimPoseSoA::ROT_Y], pz = p[AnimPoseSoA::ROT_Z], pw = p[AnimPoseSoA::ROT_W];
+    const float cx = c[AnimPoseSoA::ROT_X], cy = c[AnimPoseSoA::ROT_Y], cz = c[AnimPoseSoA::ROT_Z], cw = c[AnimPoseSoA::ROT_W];
+    const float s = p[AnimPoseSoA::SCALE_X];
+
+    // v = parent scale * child translation, rotated by the parent rotation
+    float vx = s * c[AnimPoseSoA::TRANS_X], vy = s * c[AnimPoseSoA::TRANS_Y], vz = s * c[AnimPoseSoA::TRANS_Z];
+    float tx = 2.0f * (py * vz - pz * vy);
+    float ty = 2.0f * (pz * vx - px * vz);
+    float tz = 2.0f * (px * vy - py * vx);
+
+    r[AnimPoseSoA::TRANS_X] = p[AnimPoseSoA::TRANS_X] + vx + pw * tx + (py * tz - pz * ty);
+    r[AnimPoseSoA::TRANS_Y] = p[AnimPoseSoA::TRANS_Y] + vy + pw * ty + (pz * tx - px * tz);
+    r[AnimPoseSoA::TRANS_Z] = p[AnimPoseSoA::TRANS_Z] + vz + pw * tz + (px * ty - py * tx);
+
+    r[AnimPoseSoA::ROT_X] = pw * cx + px * cw + py * cz - pz * cy;
+    r[AnimPoseSoA::ROT_Y] = pw * cy - px * cz + py * cw + pz * cx;
+    r[AnimPoseSoA::ROT_Z] = pw * cz + px * cy - py * cx + pz * cw;
+    r[AnimPoseSoA::ROT_W] = pw * cw - px * cx - py * cy - pz * cz;
+
+    r[AnimPoseSoA::SCALE_X] = s * c[AnimPoseSoA::SCALE_X];
+    r[AnimPoseSoA::SCALE_Y] = s * c[AnimPoseSoA::SCALE_Y];
+    r[AnimPoseSoA::SCALE_Z] = s * c[AnimPoseSoA::SCALE_Z];
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+static inline __m128 gather4(const float* component, const int* indices) {
+    return _mm_setr_ps(component[indices[0]], component[indices[1]], component[indices[2]], component[indices[3]]);
+}
+
+// the same as multiplyPose, for the 4 children starting at i
+static inline void multiplyPoses4(float* const* components, int i, const int* parents) {
+    const int* pi = parents + i;
+    __m128 px = gather4(components[AnimPoseSoA::ROT_X], pi);
+    __m128 py = gather4(components[AnimPoseSoA::ROT_Y], pi);
+    __m128 pz = gather4(components[AnimPoseSoA::ROT_Z], pi);
+    __m128 pw = gather4(components[AnimPoseSoA::ROT_W], pi);
+    __m128 s = gather4(components[AnimPoseSoA::SCALE_X], pi);
+
+    __m128 cx = _mm_loadu_ps(components[AnimPoseSoA::ROT_X] + i);
+    __m128 cy = _mm_loadu_ps(components[AnimPoseSoA::ROT_Y] + i);
+    __m128 cz = _mm_loadu_ps(components[AnimPoseSoA::ROT_Z] + i);
+    __m128 cw = _mm_loadu_ps(components[AnimPoseSoA::ROT_W] + i);
+
+    __m128 vx = _mm_mul_ps(s, _mm_loadu_ps(components[AnimPoseSoA::TRANS_X] + i));
+    __m128 vy = _mm_mul_ps(s, _mm_loadu_ps(components[AnimPoseSoA::TRANS_Y] + i));
+    __m128 vz = _mm_mul_ps(s, _mm_loadu_ps(components[AnimPoseSoA::TRANS_Z] + i));
+
+    const __m128 two = _mm_set1_ps(2.0f);
+    __m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(py, vz), _mm_mul_ps(pz, vy)));
+    __m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(pz, vx), _mm_mul_ps(px, vz)));
+    __m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(px, vy), _mm_mul_ps(py, vx)));
+
+    __m128 rtx = _mm_add_ps(_mm_add_ps(gather4(components[AnimPoseSoA::TRANS_X], pi), vx),
+                            _mm_add_ps(_mm_mul_ps(pw, tx), _mm_sub_ps(_mm_mul_ps(py, tz), _mm_mul_ps(pz, ty))));
+    __m128 rty = _mm_add_ps(_mm_add_ps(gather4(components[AnimPoseSoA::TRANS_Y], pi), vy),
+                            _mm_add_ps(_mm_mul_ps(pw, ty), _mm_sub_ps(_mm_mul_ps(pz, tx), _mm_mul_ps(px, tz))));
+    __m128 rtz = _mm_add_ps(_mm_add_ps(gather4(components[AnimPoseSoA::TRANS_Z], pi), vz),
+                            _mm_add_ps(_mm_mul_ps(pw, tz), _mm_sub_ps(_mm_mul_ps(px, ty), _mm_mul_ps(py, tx))));
+
+    __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pw, cx), _mm_mul_ps(px, cw)), _mm_sub_ps(_mm_mul_ps(py, cz), _mm_mul_ps(pz, cy)));
+    __m128 ry = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(pw, cy), _mm_mul_ps(px, cz)), _mm_add_ps(_mm_mul_ps(py, cw), _mm_mul_ps(pz, cx)));
+    __m128 rz = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(pw, cz), _mm_mul_ps(px, cy)), _mm_mul_ps(py, cx)), _mm_mul_ps(pz, cw));
+    __m128 rw = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(pw, cw), _mm_mul_ps(px, cx)), _mm_add_ps(_mm_mul_ps(py, cy), _mm_mul_ps(pz, cz)));
+
+    _mm_storeu_ps(components[AnimPoseSoA::TRANS_X] + i, rtx);
+    _mm_storeu_ps(components[AnimPoseSoA::TRANS_Y] + i, rty);
+    _mm_storeu_ps(components[AnimPoseSoA::TRANS_Z] + i, rtz);
+    _mm_storeu_ps(components[AnimPoseSoA::ROT_X] + i, rx);
+    _mm_storeu_ps(components[AnimPoseSoA::ROT_Y] + i, ry);
+    _mm_storeu_ps(components[AnimPoseSoA::ROT_Z] + i, rz);
+    _mm_storeu_ps(components[AnimPoseSoA::ROT_W] + i, rw);
+    for (int c = AnimPoseSoA::SCALE_X; c <= AnimPoseSoA::SCALE_Z; c++) {
+        _mm_storeu_ps(components[c] + i, _mm_mul_ps(s, _mm_loadu_ps(components[c] + i)));
+    }
+}
+
+#endif
+
+void AnimPoseSoA::multiplyByParents(int begin, int end, const int* parents) {
+    auto isParentScaleUniform = [&](int i) {
+        int parent = parents[i];
+        return isUniformPositiveScale(_components[SCALE_X][parent], _components[SCALE_Y][parent], _components[SCALE_Z][parent]) &&
+            _components[SCALE_X][i] > 0.0f && _components[SCALE_Y][i] > 0.0f && _components[SCALE_Z][i] > 0.0f;
+    };
+
+    auto multiplyOne = [&](int i) {
+        if (isParentScaleUniform(i)) {
+            float p[NUM_COMPONENTS], c[NUM_COMPONENTS], r[NUM_COMPONENTS];
+            for (int k = 0; k < NUM_COMPONENTS; k++) {
+                p[k] = _components[k][parents[i]];
+                c[k] = _components[k][i];
+            }
+            multiplyPose(p, c, r);
+            for (int k = 0; k < NUM_COMPONENTS; k++) {
+                _components[k][i] = r[k];
+            }
+        } else {
+            set(i, get(parents[i]) * get(i));
+        }
+    };
+
+    int i = begin;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    for (; i < end - 3; i += 4) {
+        if (isParentScaleUniform(i) && isParentScaleUniform(i + 1) && isParentScaleUniform(i + 2) && isParentScaleUniform(i + 3)) {
+            multiplyPoses4(_components, i, parents);
+        } else {
+            for (int k = 0; k < 4; k++) {
+                multiplyOne(i + k);
+            }
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        multiplyOne(i);
+    }
+}
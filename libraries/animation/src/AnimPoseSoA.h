@@ -0,0 +1,63 @@
+//
+//  AnimPoseSoA.h
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimPoseSoA
+#define hifi_AnimPoseSoA
+
+#include <vector>
+
+#include "AnimPose.h"
+
+// A buffer of poses stored as a structure of arrays, one array per component of the scales, rotations and
+// translations, so that the poses can be processed four at a time with SSE.
+//   Poses are composed as scale/rotation/translation (TRS) rather than through matrices, which is exact when the
+//   parent scale is uniform and positive. Joints whose parent has a non-uniform or negative scale fall back to
+//   AnimPose::operator*, which composes the matrices and decomposes the result.
+class AnimPoseSoA {
+public:
+    enum Component {
+        SCALE_X = 0, SCALE_Y, SCALE_Z,
+        ROT_X, ROT_Y, ROT_Z, ROT_W,
+        TRANS_X, TRANS_Y, TRANS_Z,
+        NUM_COMPONENTS
+    };
+
+    AnimPoseSoA() {}
+    explicit AnimPoseSoA(int numPoses) { resize(numPoses); }
+
+    void resize(int numPoses);
+    int size() const { return _size; }
+
+    // element i of this becomes poses[i], or poses[order[i]]
+    void load(const AnimPose* poses, int numPoses);
+    void load(const AnimPose* poses, const int* order, int numPoses);
+
+    // poses[i], or poses[order[i]], becomes element i of this
+    void store(AnimPose* poses) const;
+    void store(AnimPose* poses, const int* order) const;
+
+    AnimPose get(int i) const;
+    void set(int i, const AnimPose& pose);
+
+    float* component(Component c) { return _components[c]; }
+    const float* component(Component c) const { return _components[c]; }
+
+    // element i becomes element parents[i] times element i, for i in [begin, end).
+    // The parents must be outside of [begin, end), which is the case for joints of the same depth.
+    void multiplyByParents(int begin, int end, const int* parents);
+
+private:
+    int _size { 0 };
+    int _stride { 0 };  // size rounded up to a multiple of 4
+    std::vector<float> _data;
+    float* _components[NUM_COMPONENTS] {};
+};
+
+#endif
@@ -10,11 +10,14 @@
 
 #include "AnimSkeleton.h"
 
+#include <algorithm>
+
 #include <glm/gtx/transform.hpp>
 
 #include <GLMHelpers.h>
 
 #include "AnimationLogging.h"
+#include "AnimPoseSoA.h"
 
 AnimSkeleton::AnimSkeleton(const HFMModel& hfmModel) {
 
@@ -125,6 +128,10 @@ AnimPose AnimSkeleton::getAbsolutePose(int jointIndex, const AnimPoseVec& relati
 
 void AnimSkeleton::convertRelativePosesToAbsolute(AnimPoseVec& poses) const {
     // poses start off relative and leave in absolute frame
+    if ((int)poses.size() >= _jointsSize && !_depthOrder.empty()) {
+        convertRelativePosesToAbsoluteInDepthOrder(poses.data(), nullptr, poses.data());
+        return;
+    }
     int lastIndex = std::min((int)poses.size(), _jointsSize);
     for (int i = 0; i < lastIndex; ++i) {
         int parentIndex = _parentIndices[i];
@@ -134,6 +141,41 @@ void AnimSkeleton::convertRelativePosesToAbsolute(AnimPoseVec& poses) const {
     }
 }
 
+void AnimSkeleton::convertRelativePosesToAbsolute(const AnimPoseVec& relativePoses, const AnimPose& rootPose,
+                                                  AnimPoseVec& absolutePoses) const {
+    absolutePoses.resize(relativePoses.size());
+    if ((int)relativePoses.size() >= _jointsSize && !_depthOrder.empty()) {
+        convertRelativePosesToAbsoluteInDepthOrder(relativePoses.data(), &rootPose, absolutePoses.data());
+        std::copy(relativePoses.begin() + _jointsSize, relativePoses.end(), absolutePoses.begin() + _jointsSize);
+        return;
+    }
+    for (int i = 0; i < (int)relativePoses.size(); i++) {
+        int parentIndex = (i < _jointsSize) ? _parentIndices[i] : -1;
+        if (parentIndex == -1) {
+            absolutePoses[i] = rootPose * relativePoses[i];
+        } else {
+            absolutePoses[i] = absolutePoses[parentIndex] * relativePoses[i];
+        }
+    }
+}
+
+void AnimSkeleton::convertRelativePosesToAbsoluteInDepthOrder(const AnimPose* relativePoses, const AnimPose* rootPose,
+                                                              AnimPose* absolutePoses) const {
+    // relativePoses and absolutePoses may be the same
+    static thread_local AnimPoseSoA poses;
+    poses.load(relativePoses, _depthOrder.data(), _jointsSize);
+    if (rootPose) {
+        for (int i = 0; i < _depthLevelOffsets[1]; i++) {
+            poses.set(i, *rootPose * poses.get(i));
+        }
+    }
+    // each depth only depends on the depths above it
+    for (int depth = 1; depth < (int)_depthLevelOffsets.size() - 1; depth++) {
+        poses.multiplyByParents(_depthLevelOffsets[depth], _depthLevelOffsets[depth + 1], _depthOrderParents.data());
+    }
+    poses.store(absolutePoses, _depthOrder.data());
+}
+
 void AnimSkeleton::convertAbsolutePosesToRelative(AnimPoseVec& poses) const {
     // poses start off absolute and leave in relative frame
     int lastIndex = std::min((int)poses.size(), _jointsSize);
@@ -196,6 +238,49 @@ void AnimSkeleton::mirrorAbsolutePoses(AnimPoseVec& poses) const {
     }
 }
 
+void AnimSkeleton::buildDepthOrder() {
+    _depthOrder.clear();
+    _depthOrderParents.clear();
+    _depthLevelOffsets.clear();
+
+    std::vector<int> depths(_jointsSize, 0);
+    int maxDepth = 0;
+    for (int i = 0; i < _jointsSize; i++) {
+        int parentIndex = _parentIndices[i];
+        if (parentIndex >= i) {
+            // the joints are not in hierarchy order
+            return;
+        }
+        if (parentIndex >= 0) {
+            depths[i] = depths[parentIndex] + 1;
+            maxDepth = std::max(maxDepth, depths[i]);
+        }
+    }
+    if (_jointsSize == 0) {
+        return;
+    }
+
+    _depthOrder.resize(_jointsSize);
+    for (int i = 0; i < _jointsSize; i++) {
+        _depthOrder[i] = i;
+    }
+    std::stable_sort(_depthOrder.begin(), _depthOrder.end(), [&](int a, int b) {
+        return depths[a] < depths[b];
+    });
+
+    std::vector<int> positions(_jointsSize);
+    for (int i = 0; i < _jointsSize; i++) {
+        positions[_depthOrder[i]] = i;
+    }
+    _depthOrderParents.resize(_jointsSize);
+    _depthLevelOffsets.resize(maxDepth + 2, 0);
+    for (int i = 0; i < _jointsSize; i++) {
+        int parentIndex = _parentIndices[_depthOrder[i]];
+        _depthOrderParents[i] = (parentIndex >= 0) ? positions[parentIndex] : -1;
+        _depthLevelOffsets[depths[_depthOrder[i]] + 1] = i + 1;
+    }
+}
+
 void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints, const QMap<int, glm::quat> jointOffsets) {
 
     _joints = joints;
@@ -208,6 +293,7 @@ void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints,
     }
 
     _jointsSize = (int)joints.size();
+    buildDepthOrder();
     // build a cache of bind poses
 
     // build a chache of default poses
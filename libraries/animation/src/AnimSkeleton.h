@@ -53,6 +53,8 @@ public:
     AnimPose getAbsolutePose(int jointIndex, const AnimPoseVec& relativePoses) const;
 
     void convertRelativePosesToAbsolute(AnimPoseVec& poses) const;
+    // the same as above, with the root joints additionally transformed by rootPose
+    void convertRelativePosesToAbsolute(const AnimPoseVec& relativePoses, const AnimPose& rootPose, AnimPoseVec& absolutePoses) const;
     void convertAbsolutePosesToRelative(AnimPoseVec& poses) const;
 
     void convertRelativeRotationsToAbsolute(std::vector<glm::quat>& rotations) const;
@@ -69,13 +71,24 @@ public:
 
     std::vector<int> lookUpJointIndices(const std::vector<QString>& jointNames) const;
     const HFMCluster getClusterBindMatricesOriginalValues(int skinDeformerIndex, int clusterIndex) const { return _clusterBindMatrixOriginalValues[skinDeformerIndex][clusterIndex]; }
+    int getNumSkinDeformers() const { return (int)_clusterBindMatrixOriginalValues.size(); }
+    int getNumClusters(int skinDeformerIndex) const { return (int)_clusterBindMatrixOriginalValues[skinDeformerIndex].size(); }
 
 protected:
     void buildSkeletonFromJoints(const std::vector<HFMJoint>& joints, const QMap<int, glm::quat> jointOffsets);
+    void buildDepthOrder();
+    void convertRelativePosesToAbsoluteInDepthOrder(const AnimPose* relativePoses, const AnimPose* rootPose, AnimPose* absolutePoses) const;
 
     std::vector<HFMJoint> _joints;
     std::vector<int> _parentIndices;
     int _jointsSize { 0 };
+
+    // the joints sorted by depth in the hierarchy, so that all the joints of one depth can be converted at once.
+    // empty if a parent does not precede its children, in which case poses are converted one joint at a time.
+    std::vector<int> _depthOrder;
+    std::vector<int> _depthOrderParents;  // the position in _depthOrder of each parent, or -1
+    std::vector<int> _depthLevelOffsets;  // the position in _depthOrder of the first joint of each depth, then the size
+
     AnimPoseVec _relativeDefaultPoses;
     AnimPoseVec _absoluteDefaultPoses;
     AnimPoseVec _relativePreRotationPoses;
@@ -13,10 +13,63 @@
 #include <NumericalConstants.h>
 #include <DebugDraw.h>
 
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// the nlerp of safeLerp, for four rotations at a time
+static inline void safeLerp4(const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    // transpose the quats into one register per component.
+    // every component is treated the same, so their order in glm::quat does not matter
+    __m128 a0 = _mm_loadu_ps(&a[0].rot()[0]);
+    __m128 a1 = _mm_loadu_ps(&a[1].rot()[0]);
+    __m128 a2 = _mm_loadu_ps(&a[2].rot()[0]);
+    __m128 a3 = _mm_loadu_ps(&a[3].rot()[0]);
+    __m128 b0 = _mm_loadu_ps(&b[0].rot()[0]);
+    __m128 b1 = _mm_loadu_ps(&b[1].rot()[0]);
+    __m128 b2 = _mm_loadu_ps(&b[2].rot()[0]);
+    __m128 b3 = _mm_loadu_ps(&b[3].rot()[0]);
+    _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+    _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+
+    // adjust signs if necessary
+    __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, b0), _mm_mul_ps(a1, b1)), _mm_add_ps(_mm_mul_ps(a2, b2), _mm_mul_ps(a3, b3)));
+    __m128 flip = _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+
+    const __m128 alpha4 = _mm_set1_ps(alpha);
+    const __m128 beta4 = _mm_set1_ps(1.0f - alpha);
+    __m128 r0 = _mm_add_ps(_mm_mul_ps(a0, beta4), _mm_mul_ps(_mm_xor_ps(b0, flip), alpha4));
+    __m128 r1 = _mm_add_ps(_mm_mul_ps(a1, beta4), _mm_mul_ps(_mm_xor_ps(b1, flip), alpha4));
+    __m128 r2 = _mm_add_ps(_mm_mul_ps(a2, beta4), _mm_mul_ps(_mm_xor_ps(b2, flip), alpha4));
+    __m128 r3 = _mm_add_ps(_mm_mul_ps(a3, beta4), _mm_mul_ps(_mm_xor_ps(b3, flip), alpha4));
+
+    __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, r0), _mm_mul_ps(r1, r1)),
+                                           _mm_add_ps(_mm_mul_ps(r2, r2), _mm_mul_ps(r3, r3))));
+    r0 = _mm_div_ps(r0, length);
+    r1 = _mm_div_ps(r1, length);
+    r2 = _mm_div_ps(r2, length);
+    r3 = _mm_div_ps(r3, length);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(&result[0].rot()[0], r0);
+    _mm_storeu_ps(&result[1].rot()[0], r1);
+    _mm_storeu_ps(&result[2].rot()[0], r2);
+    _mm_storeu_ps(&result[3].rot()[0], r3);
+}
+
+#endif
+
 // TODO: use restrict keyword
-// TODO: excellent candidate for simd vectorization.
 void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
-    for (size_t i = 0; i < numPoses; i++) {
+    size_t i = 0;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    for (; i + 4 <= numPoses; i += 4) {
+        safeLerp4(a + i, b + i, alpha, result + i);
+        for (size_t j = i; j < i + 4; j++) {
+            result[j].scale() = lerp(a[j].scale(), b[j].scale(), alpha);
+            result[j].trans() = lerp(a[j].trans(), b[j].trans(), alpha);
+        }
+    }
+#endif
+    for (; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
         const AnimPose& bPose = b[i];
 
@@ -2545,17 +2545,9 @@ void Rig::buildAbsoluteRigPoses(const AnimPoseVec& relativePoses, AnimPoseVec& a
 
     ASSERT(_animSkeleton->getNumJoints() == (int)relativePoses.size());
 
-    absolutePosesOut.resize(relativePoses.size());
+    // transform all root absolute poses into rig space
     AnimPose geometryToRigTransform(_geometryToRigTransform);
-    for (int i = 0; i < (int)relativePoses.size(); i++) {
-        int parentIndex = _animSkeleton->getParentIndex(i);
-        if (parentIndex == -1) {
-            // transform all root absolute poses into rig space
-            absolutePosesOut[i] = geometryToRigTransform * relativePoses[i];
-        } else {
-            absolutePosesOut[i] = absolutePosesOut[parentIndex] * relativePoses[i];
-        }
-    }
+    _animSkeleton->convertRelativePosesToAbsolute(relativePoses, geometryToRigTransform, absolutePosesOut);
 }
 
 int Rig::getOverrideJointCount() const {
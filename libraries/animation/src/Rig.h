@@ -189,6 +189,7 @@ public:
     // rig space
     glm::mat4 getJointTransform(int jointIndex) const;
     AnimPose getJointPose(int jointIndex) const;
+    const AnimPoseVec& getAbsoluteJointPoses() const { return _internalPoseSet._absolutePoses; }
 
     // Start or stop animations as needed.
     void computeMotionAnimationState(float deltaTime, const glm::vec3& worldPosition, const glm::vec3& worldVelocity,
@@ -0,0 +1,91 @@
+//
+//  SkinClusterBatch.cpp
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SkinClusterBatch.h"
+
+#include <ClusterMatrices.h>
+
+static bool isSamePose(const AnimPose& a, const AnimPose& b) {
+    return a.trans() == b.trans() && a.rot() == b.rot() && a.scale() == b.scale();
+}
+
+void SkinClusterBatch::invalidate() {
+    _skeleton.reset();
+    _jointIndices.clear();
+    _inverseBindMatrices.clear();
+    _inverseBindTransforms.clear();
+    _deformerOffsets.clear();
+    _jointPoses.clear();
+    _jointMatrices.clear();
+}
+
+bool SkinClusterBatch::update(const AnimSkeleton::ConstPointer& skeleton, const AnimPoseVec& jointPoses,
+                              bool useDualQuaternionSkinning) {
+    int numJoints = (int)jointPoses.size();
+    if (skeleton != _skeleton || (int)_jointPoses.size() != numJoints + 1) {
+        invalidate();
+        if (!skeleton) {
+            return true;
+        }
+        _skeleton = skeleton;
+
+        for (int skinDeformerIndex = 0; skinDeformerIndex < skeleton->getNumSkinDeformers(); skinDeformerIndex++) {
+            _deformerOffsets.push_back((uint32_t)_jointIndices.size());
+            int numClusters = skeleton->getNumClusters(skinDeformerIndex);
+            for (int clusterIndex = 0; clusterIndex < numClusters; clusterIndex++) {
+                const auto& cluster = skeleton->getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
+                bool isJointValid = cluster.jointIndex < (uint32_t)numJoints;
+                _jointIndices.push_back(isJointValid ? (int32_t)cluster.jointIndex : numJoints);
+                _inverseBindMatrices.push_back(cluster.inverseBindMatrix);
+                _inverseBindTransforms.push_back(cluster.inverseBindTransform);
+            }
+        }
+        _deformerOffsets.push_back((uint32_t)_jointIndices.size());
+
+        _jointPoses.assign(jointPoses.begin(), jointPoses.end());
+        _jointPoses.push_back(AnimPose::identity);
+        _jointMatrices.assign(numJoints + 1, glm::mat4());
+        for (int i = 0; i < numJoints; i++) {
+            _jointMatrices[i] = _jointPoses[i];
+        }
+        _useDualQuaternionSkinning = useDualQuaternionSkinning;
+        return true;
+    }
+
+    bool changed = false;
+    if (useDualQuaternionSkinning != _useDualQuaternionSkinning) {
+        _useDualQuaternionSkinning = useDualQuaternionSkinning;
+        if (!useDualQuaternionSkinning) {
+            // the matrices weren't kept up to date with the poses
+            for (int i = 0; i < numJoints; i++) {
+                _jointMatrices[i] = _jointPoses[i];
+            }
+        }
+        changed = true;
+    }
+
+    // only the joints that moved are converted to matrices
+    for (int i = 0; i < numJoints; i++) {
+        if (!isSamePose(jointPoses[i], _jointPoses[i])) {
+            _jointPoses[i] = jointPoses[i];
+            if (!_useDualQuaternionSkinning) {
+                _jointMatrices[i] = jointPoses[i];
+            }
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+void SkinClusterBatch::computeClusterMatrices(int skinDeformerIndex, glm::mat4* clusterMatrices) const {
+    uint32_t begin = _deformerOffsets[skinDeformerIndex];
+    ::computeClusterMatrices(_jointMatrices.data(), _jointIndices.data() + begin, _inverseBindMatrices.data() + begin,
+                             (int)getNumClusters(skinDeformerIndex), clusterMatrices);
+}
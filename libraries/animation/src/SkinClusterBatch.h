@@ -0,0 +1,75 @@
+//
+//  SkinClusterBatch.h
+//  libraries/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SkinClusterBatch_h
+#define hifi_SkinClusterBatch_h
+
+#include <vector>
+
+#include <Transform.h>
+
+#include "AnimPose.h"
+#include "AnimSkeleton.h"
+
+// The clusters of all the skin deformers of a skeleton, flattened so that their matrices are computed in one pass, and
+// the joint poses they were last computed from, so that a rig that hasn't moved only costs a comparison per joint.
+//   The clusters are copied out of the skeleton when the skeleton changes, rather than every frame.
+//   There is one batch per model. Only the matrices are computed in a vectorized pass: with dual quaternion skinning,
+//   the caller composes each cluster from getJointPose and getInverseBindTransform, which only benefits from the skip.
+class SkinClusterBatch {
+public:
+    // Forces the next update to copy the clusters again and to report a change
+    void invalidate();
+
+    // Takes the clusters of skeleton, if it is not the skeleton of the last update, and the absolute poses of its joints.
+    // Returns true if the clusters must be recomputed: the skeleton, the skinning method or a joint pose changed since the
+    // last update, or the batch was invalidated.
+    bool update(const AnimSkeleton::ConstPointer& skeleton, const AnimPoseVec& jointPoses, bool useDualQuaternionSkinning);
+
+    int getNumSkinDeformers() const { return _deformerOffsets.empty() ? 0 : (int)_deformerOffsets.size() - 1; }
+    uint32_t getNumClusters(int skinDeformerIndex) const {
+        return _deformerOffsets[skinDeformerIndex + 1] - _deformerOffsets[skinDeformerIndex];
+    }
+
+    // the joint of a cluster, or the number of joints if the cluster has no valid joint
+    int32_t getJointIndex(int skinDeformerIndex, uint32_t clusterIndex) const {
+        return _jointIndices[_deformerOffsets[skinDeformerIndex] + clusterIndex];
+    }
+    const glm::mat4& getInverseBindMatrix(int skinDeformerIndex, uint32_t clusterIndex) const {
+        return _inverseBindMatrices[_deformerOffsets[skinDeformerIndex] + clusterIndex];
+    }
+    const Transform& getInverseBindTransform(int skinDeformerIndex, uint32_t clusterIndex) const {
+        return _inverseBindTransforms[_deformerOffsets[skinDeformerIndex] + clusterIndex];
+    }
+    // the pose of the joint of a cluster as of the last update, the identity if the cluster has no valid joint
+    const AnimPose& getJointPose(int skinDeformerIndex, uint32_t clusterIndex) const {
+        return _jointPoses[getJointIndex(skinDeformerIndex, clusterIndex)];
+    }
+
+    // Computes the matrix of each cluster of a skin deformer, its joint matrix times its inverse bind matrix.
+    // Only valid after an update without dual quaternion skinning.
+    void computeClusterMatrices(int skinDeformerIndex, glm::mat4* clusterMatrices) const;
+
+private:
+    AnimSkeleton::ConstPointer _skeleton;
+    bool _useDualQuaternionSkinning { false };
+
+    std::vector<int32_t> _jointIndices;
+    std::vector<glm::mat4> _inverseBindMatrices;
+    std::vector<Transform> _inverseBindTransforms;
+    std::vector<uint32_t> _deformerOffsets; // where the clusters of each skin deformer begin, followed by the end of the last
+
+    // the joint poses of the last update and their matrices, followed by the identity for clusters with no valid joint.
+    // the matrices are only kept up to date without dual quaternion skinning.
+    AnimPoseVec _jointPoses;
+    std::vector<glm::mat4> _jointMatrices;
+};
+
+#endif // hifi_SkinClusterBatch_h
@@ -313,7 +313,7 @@ static inline float convertToFloat(int16_t sample) {
 AudioClient::AudioClient() {
 
     // avoid putting a lock in the device callback
-    assert(_localSamplesAvailable.is_lock_free());
+    assert(_localInjectorsStream.isLockFree());
 
     // deprecate legacy settings
     {
@@ -1508,7 +1508,7 @@ void AudioClient::prepareLocalAudioInjectors(std::unique_ptr<Lock> localAudioLoc
                 AudioConstants::STEREO;
         }
 
-        samplesNeeded = bufferCapacity - _localSamplesAvailable.load(std::memory_order_relaxed);
+        samplesNeeded = bufferCapacity - _localInjectorsStream.samplesAvailable();
         if (samplesNeeded < maxOutputSamples) {
             // avoid overwriting the buffer to prevent losing frames
             break;
@@ -1541,7 +1541,6 @@ void AudioClient::prepareLocalAudioInjectors(std::unique_ptr<Lock> localAudioLoc
                 AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
         }
 
-        _localSamplesAvailable.fetch_add(samples, std::memory_order_release);
         samplesNeeded -= samples;
     }
 }
@@ -1670,7 +1669,11 @@ void AudioClient::processReceivedSamples(const QByteArray& decodedBuffer, QByteA
     const int16_t* decodedSamples = reinterpret_cast<const int16_t*>(decodedBuffer.data());
     assert(decodedBuffer.size() == AudioConstants::NETWORK_FRAME_BYTES_STEREO);
 
-    outputBuffer.resize(_outputFrameSize * AudioConstants::SAMPLE_SIZE);
+    // the resampler's rate adjustment (see prepareNetworkOutput) varies its output by a frame or so
+    int maxOutputSamples = _networkToOutputResampler ?
+        _networkToOutputResampler->getMaxOutput(AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL) * OUTPUT_CHANNEL_COUNT :
+        _outputFrameSize;
+    outputBuffer.resize(maxOutputSamples * AudioConstants::SAMPLE_SIZE);
     int16_t* outputSamples = reinterpret_cast<int16_t*>(outputBuffer.data());
 
     bool hasReverb = _reverb || _receivedAudioStream.hasReverb();
@@ -1685,7 +1688,9 @@ void AudioClient::processReceivedSamples(const QByteArray& decodedBuffer, QByteA
     // resample to output sample rate
     if (_networkToOutputResampler) {
         const int16_t* inputSamples = hasReverb ? _networkScratchBuffer : decodedSamples;
-        _networkToOutputResampler->render(inputSamples, outputSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        int frames = _networkToOutputResampler->render(inputSamples, outputSamples,
+                                                       AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        outputBuffer.resize(frames * OUTPUT_CHANNEL_COUNT * AudioConstants::SAMPLE_SIZE);
     }
 
     // if no transformations were applied, we still need to copy the buffer
@@ -1694,6 +1699,39 @@ void AudioClient::processReceivedSamples(const QByteArray& decodedBuffer, QByteA
     }
 }
 
+void AudioClient::prepareNetworkOutput() {
+    // in case of a device switch, the pipe is cleared and resized along with the period
+    if (!_audioOutputInitialized.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    // pop a device period at a time, so the jitter buffer sees the device's cadence
+    int samplesPerPop = (_outputPeriod / 2 / OUTPUT_CHANNEL_COUNT) * OUTPUT_CHANNEL_COUNT;
+
+    while (_networkOutputStream.getFreeSpace() >= samplesPerPop) {
+        int samplesPopped = _receivedAudioStream.popSamples(samplesPerPop, false);
+        if (samplesPopped == 0) {
+            break;
+        }
+        AudioRingBuffer::ConstIterator lastPopOutput = _receivedAudioStream.getLastPopOutput();
+        lastPopOutput.readSamples(_networkOutputScratchBuffer, samplesPopped);
+        _networkOutputStream.writeSamples(_networkOutputScratchBuffer, samplesPopped);
+
+        // the level left in the jitter buffer tracks the skew between the mixer and device clocks;
+        // starved pops say nothing about it, so only pops that were served update the estimate
+        if (_networkToOutputResampler) {
+            float framesAvailable = _receivedAudioStream.getSamplesAvailable() / (float)_receivedAudioStream.getNumFrameSamples();
+            float rateAdjustment = _outputClockSkew.update(framesAvailable, _receivedAudioStream.getDesiredJitterBufferFrames());
+            _networkToOutputResampler->setRateAdjustment(rateAdjustment);
+        }
+
+        // a short pop emptied the jitter buffer; popping again would only count a starve
+        if (samplesPopped < samplesPerPop) {
+            break;
+        }
+    }
+}
+
 void AudioClient::sendMuteEnvironmentPacket() {
     auto nodeList = DependencyManager::get<NodeList>();
 
@@ -2065,7 +2103,6 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
     Lock lock(_deviceMutex);
 
     Lock localAudioLock(_localAudioMutex);
-    _localSamplesAvailable.exchange(0, std::memory_order_release);
 
     //wait on local injectors prep to finish running
     if ( !_localPrepInjectorFuture.isFinished()) {
@@ -2095,10 +2132,18 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
 
         delete[] _localOutputMixBuffer;
         _localOutputMixBuffer = NULL;
+
+        delete[] _networkOutputScratchBuffer;
+        _networkOutputScratchBuffer = NULL;
         
         _outputDeviceInfo.setDevice(QAudioDeviceInfo());
     }
 
+    // the device is stopped, so neither pipe has a consumer: they can be cleared
+    // (their producers are this thread, and prepareLocalAudioInjectors, which is excluded by the lock)
+    _localInjectorsStream.clear();
+    _networkOutputStream.clear();
+
     // cleanup any resamplers
     if (_networkToOutputResampler) {
         delete _networkToOutputResampler;
@@ -2139,7 +2184,9 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
                 assert(_desiredOutputFormat.sampleSize() == 16);
                 assert(_outputFormat.sampleSize() == 16);
 
-                _networkToOutputResampler = new AudioSRC(_desiredOutputFormat.sampleRate(), _outputFormat.sampleRate(), OUTPUT_CHANNEL_COUNT);
+                // variable-rate, to compensate for the skew between the mixer and output device clocks
+                _networkToOutputResampler = new AudioSRC(_desiredOutputFormat.sampleRate(), _outputFormat.sampleRate(), OUTPUT_CHANNEL_COUNT,
+                                                         AudioSRC::MEDIUM_QUALITY, true);
                 _localToOutputResampler = new AudioSRC(_desiredOutputFormat.sampleRate(), _outputFormat.sampleRate(), OUTPUT_CHANNEL_COUNT);
 
             } else {
@@ -2147,6 +2194,7 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
             }
 
             outputFormatChanged();
+            _outputClockSkew.reset();
 
             // setup our general output device for audio-mixer audio
             _audioOutput = new QAudioOutput(_outputDeviceInfo.getDevice(), _outputFormat, this);
@@ -2171,6 +2219,10 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
 
             _outputMixBuffer = new float[_outputPeriod];
             _outputScratchBuffer = new int16_t[_outputPeriod];
+            _networkOutputScratchBuffer = new int16_t[_outputPeriod];
+
+            // network output is popped a device period at a time, and kept one period ahead of the device
+            _networkOutputStream.resize(_outputPeriod);
 
             // size local output mix buffer based on resampled network frame size
             int networkPeriod = _localToOutputResampler ?  _localToOutputResampler->getMaxOutput(AudioConstants::NETWORK_FRAME_SAMPLES_STEREO) : AudioConstants::NETWORK_FRAME_SAMPLES_STEREO;
@@ -2182,7 +2234,7 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
             // round up to an exact multiple of networkPeriod
             localPeriod = ((localPeriod + networkPeriod - 1) / networkPeriod) * networkPeriod;
             // this ensures lowest latency without stutter from underrun
-            _localInjectorsStream.resizeForFrameSize(localPeriod);
+            _localInjectorsStream.resize(localPeriod);
 
             _audioOutputInitialized = true;
 
@@ -2314,25 +2366,27 @@ qint64 AudioClient::AudioOutputIODevice::readData(char * data, qint64 maxSize) {
 
     int samplesRequested = maxSamplesRequested;
     int networkSamplesPopped;
-    if ((networkSamplesPopped = _receivedAudioStream.popSamples(samplesRequested, false)) > 0) {
-        qCDebug(audiostream, "Read %d samples from buffer (%d available, %d requested)", networkSamplesPopped, _receivedAudioStream.getSamplesAvailable(), samplesRequested);
-        AudioRingBuffer::ConstIterator lastPopOutput = _receivedAudioStream.getLastPopOutput();
-        lastPopOutput.readSamples(scratchBuffer, networkSamplesPopped);
+    // read the network audio locklessly; prepareNetworkOutput is its only producer, and the received audio stream
+    // is only touched by the thread that runs it
+    if ((networkSamplesPopped = _networkOutputStream.readSamples(scratchBuffer, samplesRequested)) > 0) {
+        qCDebug(audiostream, "Read %d samples from buffer (%d available, %d requested)", networkSamplesPopped, _networkOutputStream.samplesAvailable(), samplesRequested);
         for (int i = 0; i < networkSamplesPopped; i++) {
             mixBuffer[i] = convertToFloat(scratchBuffer[i]);
         }
         samplesRequested = networkSamplesPopped;
     }
 
+    // pop the network audio for the next callback
+    QMetaObject::invokeMethod(_audio, "prepareNetworkOutput", Qt::QueuedConnection);
+
     int injectorSamplesPopped = 0;
     {
         bool append = networkSamplesPopped > 0;
-        // check the samples we have available locklessly; this is possible because only two functions add to the count:
-        // - prepareLocalAudioInjectors will only increase samples count
-        // - switchOutputToAudioDevice will zero samples count,
-        //   stop the device - so that readData will exhaust the existing buffer or see a zeroed samples count,
-        //   and start the device - which can then only see a zeroed samples count
-        int samplesAvailable = _audio->_localSamplesAvailable.load(std::memory_order_acquire);
+        // check the samples we have available locklessly; the ring buffer publishes samples through its indices:
+        // - prepareLocalAudioInjectors is its only producer
+        // - switchOutputToAudioDevice will stop the device, and only then clear it and start the device again
+        //   - so that readData never reads concurrently with the clear
+        int samplesAvailable = _localInjectorsStream.samplesAvailable();
 
         // if we do not have enough samples buffered despite having injectors, buffer them synchronously
         if (samplesAvailable < samplesRequested && _audio->_localInjectorsAvailable.load(std::memory_order_acquire)) {
@@ -2340,13 +2394,12 @@ qint64 AudioClient::AudioOutputIODevice::readData(char * data, qint64 maxSize) {
             std::unique_ptr<Lock> localAudioLock(new Lock(_audio->_localAudioMutex, std::try_to_lock));
             if (localAudioLock->owns_lock()) {
                 _audio->prepareLocalAudioInjectors(std::move(localAudioLock));
-                samplesAvailable = _audio->_localSamplesAvailable.load(std::memory_order_acquire);
+                samplesAvailable = _localInjectorsStream.samplesAvailable();
             }
         }
 
         samplesRequested = std::min(samplesRequested, samplesAvailable);
         if ((injectorSamplesPopped = _localInjectorsStream.appendSamples(mixBuffer, samplesRequested, append)) > 0) {
-            _audio->_localSamplesAvailable.fetch_sub(injectorSamplesPopped, std::memory_order_release);
             qCDebug(audiostream, "Read %d samples from injectors (%d available, %d requested)", injectorSamplesPopped, _localInjectorsStream.samplesAvailable(), samplesRequested);
         }
     }
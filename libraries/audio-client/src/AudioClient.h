@@ -47,6 +47,8 @@
 #include <AudioLimiter.h>
 #include <AudioConstants.h>
 #include <AudioGate.h>
+#include <AudioSPSCRingBuffer.h>
+#include <ClockSkewEstimator.h>
 
 #include <shared/RateCounter.h>
 
@@ -88,7 +90,8 @@ class AudioClient : public AbstractAudioInterface, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
 
-    using LocalInjectorsStream = AudioMixRingBuffer;
+    using LocalInjectorsStream = AudioSPSCMixRingBuffer;
+    using NetworkOutputStream = AudioSPSCRingBuffer;
 public:
     static const int MIN_BUFFER_FRAMES;
     static const int MAX_BUFFER_FRAMES;
@@ -101,9 +104,9 @@ public:
 
     class AudioOutputIODevice : public QIODevice {
     public:
-        AudioOutputIODevice(LocalInjectorsStream& localInjectorsStream, MixedProcessedAudioStream& receivedAudioStream,
+        AudioOutputIODevice(LocalInjectorsStream& localInjectorsStream, NetworkOutputStream& networkOutputStream,
                 AudioClient* audio) :
-            _localInjectorsStream(localInjectorsStream), _receivedAudioStream(receivedAudioStream),
+            _localInjectorsStream(localInjectorsStream), _networkOutputStream(networkOutputStream),
             _audio(audio), _unfulfilledReads(0) {}
 
         void start() { open(QIODevice::ReadOnly | QIODevice::Unbuffered); }
@@ -112,7 +115,7 @@ public:
         int getRecentUnfulfilledReads() { int unfulfilledReads = _unfulfilledReads; _unfulfilledReads = 0; return unfulfilledReads; }
     private:
         LocalInjectorsStream& _localInjectorsStream;
-        MixedProcessedAudioStream& _receivedAudioStream;
+        NetworkOutputStream& _networkOutputStream;
         AudioClient* _audio;
         int _unfulfilledReads;
     };
@@ -233,6 +236,7 @@ public slots:
     virtual void toggleServerEcho() override { _shouldEchoToServer = !_shouldEchoToServer; }
 
     void processReceivedSamples(const QByteArray& inputBuffer, QByteArray& outputBuffer);
+    void prepareNetworkOutput();
     void sendMuteEnvironmentPacket();
 
     int setOutputBufferSize(int numFrames, bool persist = true);
@@ -369,12 +373,14 @@ private:
     QAudioOutput* _loopbackAudioOutput{ nullptr };
     QIODevice* _loopbackOutputDevice{ nullptr };
     AudioRingBuffer _inputRingBuffer{ 0 };
-    LocalInjectorsStream _localInjectorsStream{ 0 , 1 };
-    // In order to use _localInjectorsStream as a lock-free pipe,
-    // use it with a single producer/consumer, and track available samples and injectors
-    std::atomic<int> _localSamplesAvailable { 0 };
+    // a lock-free pipe from prepareLocalAudioInjectors (the single producer) to the output device (the single consumer)
+    LocalInjectorsStream _localInjectorsStream{ 0 };
     std::atomic<bool> _localInjectorsAvailable { false };
     MixedProcessedAudioStream _receivedAudioStream{ RECEIVED_AUDIO_STREAM_CAPACITY_FRAMES };
+    // a lock-free pipe from prepareNetworkOutput (the single producer, which owns _receivedAudioStream)
+    // to the output device (the single consumer)
+    NetworkOutputStream _networkOutputStream{ 0 };
+    ClockSkewEstimator _outputClockSkew;
     bool _isStereoInput{ false };
     std::atomic<bool> _enablePeakValues { false };
 
@@ -416,6 +422,7 @@ private:
 
     // for network audio (used by network audio thread)
     int16_t _networkScratchBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC];
+    int16_t* _networkOutputScratchBuffer { NULL };
 
     // for output audio (used by this thread)
     int _outputPeriod { 0 };
@@ -462,7 +469,7 @@ private:
 
     quint16 _outgoingAvatarAudioSequenceNumber{ 0 };
 
-    AudioOutputIODevice _audioOutputIODevice{ _localInjectorsStream, _receivedAudioStream, this };
+    AudioOutputIODevice _audioOutputIODevice{ _localInjectorsStream, _networkOutputStream, this };
 
     AudioIOStats _stats{ &_receivedAudioStream };
 
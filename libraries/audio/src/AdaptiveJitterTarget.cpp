@@ -0,0 +1,83 @@
+//
+//  AdaptiveJitterTarget.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AdaptiveJitterTarget.h"
+
+#include <algorithm>
+
+#include "AudioConstants.h"
+
+const int AdaptiveJitterTarget::DELAY_WINDOW_PACKETS = 500; // 5s
+const float AdaptiveJitterTarget::DELAY_PERCENTILE = 0.99f;
+const int AdaptiveJitterTarget::MAX_TARGET_FRAMES = 50;
+
+// Time-scaling kicks in once the smoothed number of frames available at pop time is more than
+// TIME_SCALE_HYSTERESIS_FRAMES away from the desired frames (plus padding, when compressing).
+static const float TIME_SCALE_HYSTERESIS_FRAMES = 1.0f;
+static const float FRAMES_AVAILABLE_SMOOTHING = 0.125f;
+
+AdaptiveJitterTarget::AdaptiveJitterTarget() :
+    _minDelay(DELAY_WINDOW_PACKETS, 0.0f),
+    _delayAtPercentile(DELAY_WINDOW_PACKETS, DELAY_PERCENTILE) {}
+
+void AdaptiveJitterTarget::reset() {
+    _arrivalOffset = 0;
+    _minDelay.reset();
+    _delayAtPercentile.reset();
+    _smoothedFramesAvailable = 0.0f;
+    _targetLatencyHistogram.fill(0);
+    _actualLatencyHistogram.fill(0);
+}
+
+void AdaptiveJitterTarget::updateWithArrivalGap(quint64 gapUsecs, int numPackets) {
+    // a packet arriving later than its nominal schedule increases the offset, an early one decreases it.
+    // the offset is only meaningful relative to the window minimum, so clock drift between sender and
+    // receiver is forgotten as the window slides.
+    _arrivalOffset += (qint64)gapUsecs - (qint64)numPackets * AudioConstants::NETWORK_FRAME_USECS;
+
+    _minDelay.updatePercentile(_arrivalOffset);
+    _delayAtPercentile.updatePercentile(_arrivalOffset);
+}
+
+qint64 AdaptiveJitterTarget::getDelayAtPercentile() const {
+    return _delayAtPercentile.getValueAtPercentile() - _minDelay.getValueAtPercentile();
+}
+
+int AdaptiveJitterTarget::getTargetFrames() const {
+    // one frame is always needed, plus enough to cover the delay of the late packets
+    qint64 delay = getDelayAtPercentile();
+    int delayFrames = (int)((delay + AudioConstants::NETWORK_FRAME_USECS - 1) / AudioConstants::NETWORK_FRAME_USECS);
+    return std::min(1 + delayFrames, MAX_TARGET_FRAMES);
+}
+
+int AdaptiveJitterTarget::updateDesiredFrames(int desiredFrames, bool canReduce, bool starvedRecently) const {
+    int targetFrames = getTargetFrames();
+    if (targetFrames > desiredFrames || (canReduce && !starvedRecently)) {
+        return targetFrames;
+    }
+    return desiredFrames;
+}
+
+AdaptiveJitterTarget::TimeScale AdaptiveJitterTarget::updateTimeScale(int framesAvailable, int desiredFrames) {
+    _smoothedFramesAvailable += FRAMES_AVAILABLE_SMOOTHING * (framesAvailable - _smoothedFramesAvailable);
+    updateLatencyHistograms(desiredFrames, framesAvailable);
+
+    if (_smoothedFramesAvailable > desiredFrames + DESIRED_PADDING_FRAMES + TIME_SCALE_HYSTERESIS_FRAMES) {
+        return COMPRESS;
+    } else if (_smoothedFramesAvailable < desiredFrames - TIME_SCALE_HYSTERESIS_FRAMES) {
+        return STRETCH;
+    }
+    return NO_TIME_SCALE;
+}
+
+void AdaptiveJitterTarget::updateLatencyHistograms(int targetFrames, int actualFrames) {
+    ++_targetLatencyHistogram[std::max(0, std::min(targetFrames, LATENCY_HISTOGRAM_BINS - 1))];
+    ++_actualLatencyHistogram[std::max(0, std::min(actualFrames, LATENCY_HISTOGRAM_BINS - 1))];
+}
@@ -0,0 +1,85 @@
+//
+//  AdaptiveJitterTarget.h
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AdaptiveJitterTarget_h
+#define hifi_AdaptiveJitterTarget_h
+
+#include <array>
+
+#include <QtGlobal>
+
+#include <MovingPercentile.h>
+
+// Tracks the delay of arriving packets relative to their nominal schedule (one packet per network frame),
+// and derives the number of jitter buffer frames needed to absorb a percentile of that delay.
+//   Also holds the policy InboundAudioStream follows with it: how its desired jitter buffer frames follow the target,
+//   and when the buffered audio is time-scaled towards them.  Keeps histograms of the target and actual jitter buffer
+//   latency, sampled once per pop.
+class AdaptiveJitterTarget {
+public:
+    static const int DELAY_WINDOW_PACKETS;
+    static const float DELAY_PERCENTILE;
+    static const int MAX_TARGET_FRAMES;
+
+    // frames kept above the desired frames, to absorb the next packet's jitter
+    static const int DESIRED_PADDING_FRAMES = 1;
+    // time-scaling compresses or stretches the buffered audio by 1 / TIME_SCALE_FRACTION of a frame per pop
+    static const int TIME_SCALE_FRACTION = 16;
+
+    enum TimeScale {
+        NO_TIME_SCALE,
+        COMPRESS,
+        STRETCH
+    };
+
+    // latency histograms are binned by frame, with the last bin also counting anything longer
+    static const int LATENCY_HISTOGRAM_BINS = 32;
+    using LatencyHistogram = std::array<quint32, LATENCY_HISTOGRAM_BINS>;
+
+    AdaptiveJitterTarget();
+
+    void reset();
+
+    // update with the time since the previous packet, which may stand in for several (lost) packets
+    void updateWithArrivalGap(quint64 gapUsecs, int numPackets = 1);
+
+    // the frames of buffering needed to absorb DELAY_PERCENTILE of the arrival delay
+    int getTargetFrames() const;
+
+    // relative delay, in usecs, of DELAY_PERCENTILE of the packets in the window
+    qint64 getDelayAtPercentile() const;
+
+    // the desired jitter buffer frames that follow desiredFrames: they grow to the target frames as soon as those call for
+    // more, and shrink to them when canReduce and there was no starve recently
+    int updateDesiredFrames(int desiredFrames, bool canReduce, bool starvedRecently) const;
+
+    // call once per pop, with the frames available before it: which way to time-scale the buffered audio to bring it
+    // towards desiredFrames.  Also samples the latency histograms.
+    TimeScale updateTimeScale(int framesAvailable, int desiredFrames);
+    float getSmoothedFramesAvailable() const { return _smoothedFramesAvailable; }
+
+    void updateLatencyHistograms(int targetFrames, int actualFrames);
+    const LatencyHistogram& getTargetLatencyHistogram() const { return _targetLatencyHistogram; }
+    const LatencyHistogram& getActualLatencyHistogram() const { return _actualLatencyHistogram; }
+
+private:
+    // arrival time minus nominal arrival time, accumulated from gaps (its origin is arbitrary)
+    qint64 _arrivalOffset { 0 };
+
+    MovingPercentile _minDelay;
+    MovingPercentile _delayAtPercentile;
+
+    float _smoothedFramesAvailable { 0.0f };
+
+    LatencyHistogram _targetLatencyHistogram {};
+    LatencyHistogram _actualLatencyHistogram {};
+};
+
+#endif // hifi_AdaptiveJitterTarget_h
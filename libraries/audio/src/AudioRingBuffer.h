@@ -93,6 +93,10 @@ public:
     ///       Use samplesAvailable() to see the distance a valid shift can go
     void shiftReadPosition(unsigned int numSamples) { _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, numSamples); }
 
+    /// Restores the last numSamples read from the ring buffer
+    /// NOTE: This is not checked - the samples are only valid if they have not been overwritten since they were read
+    void unshiftReadPosition(unsigned int numSamples) { _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, -(int)numSamples); }
+
     int samplesAvailable() const;
     int framesAvailable() const { return (_numFrameSamples == 0) ? 0 : samplesAvailable() / _numFrameSamples; }
     float getNextOutputFrameLoudness() const { return getFrameLoudness(_nextOutput); }
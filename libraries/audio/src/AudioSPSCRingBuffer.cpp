@@ -0,0 +1,166 @@
+//
+//  AudioSPSCRingBuffer.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSPSCRingBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+static uint32_t nextPowerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+template <class T>
+AudioSPSCRingBufferTemplate<T>::AudioSPSCRingBufferTemplate(int sampleCapacity) {
+    resize(sampleCapacity);
+}
+
+template <class T>
+AudioSPSCRingBufferTemplate<T>::~AudioSPSCRingBufferTemplate() {
+    delete[] _buffer;
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::resize(int sampleCapacity) {
+    delete[] _buffer;
+    _buffer = nullptr;
+    _sampleCapacity = std::max(sampleCapacity, 0);
+    _mask = 0;
+
+    if (_sampleCapacity) {
+        Index bufferLength = nextPowerOfTwo((Index)_sampleCapacity);
+        _buffer = new Sample[bufferLength];
+        memset(_buffer, 0, bufferLength * SampleSize);
+        _mask = bufferLength - 1;
+    }
+
+    _readIndex.store(0, std::memory_order_relaxed);
+    _writeIndex.store(0, std::memory_order_relaxed);
+    _consumerWriteIndex = 0;
+    _producerReadIndex = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::clear() {
+    // the consumer's copy of the write index is left alone; it is refreshed whenever it is behind the read index
+    _readIndex.store(_writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::samplesAvailable() const {
+    Index readIndex = _readIndex.load(std::memory_order_acquire);
+    Index writeIndex = _writeIndex.load(std::memory_order_acquire);
+    return (int)(writeIndex - readIndex);
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::writeSamples(const Sample* source, int maxSamples) {
+    Index writeIndex = _writeIndex.load(std::memory_order_relaxed);
+
+    // only refresh the read index (and touch the consumer's cache line) when the cached one says we are full
+    int freeSpace = _sampleCapacity - (int)(writeIndex - _producerReadIndex);
+    if (freeSpace < maxSamples) {
+        _producerReadIndex = _readIndex.load(std::memory_order_acquire);
+        freeSpace = _sampleCapacity - (int)(writeIndex - _producerReadIndex);
+    }
+
+    int numSamples = std::min(maxSamples, freeSpace);
+    if (numSamples <= 0) {
+        return 0;
+    }
+
+    Index bufferLength = _mask + 1;
+    Index offset = writeIndex & _mask;
+    int samplesToEnd = (int)(bufferLength - offset);
+    if (numSamples > samplesToEnd) {
+        memcpy(_buffer + offset, source, samplesToEnd * SampleSize);
+        memcpy(_buffer, source + samplesToEnd, (numSamples - samplesToEnd) * SampleSize);
+    } else {
+        memcpy(_buffer + offset, source, numSamples * SampleSize);
+    }
+
+    // publish the samples
+    _writeIndex.store(writeIndex + numSamples, std::memory_order_release);
+    return numSamples;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::consumerSamplesAvailable(int samplesWanted) {
+    Index readIndex = _readIndex.load(std::memory_order_relaxed);
+
+    // only refresh the write index (and touch the producer's cache line) when the cached one says we are empty
+    int available = (int)(_consumerWriteIndex - readIndex);
+    if (available < samplesWanted) {
+        _consumerWriteIndex = _writeIndex.load(std::memory_order_acquire);
+        available = (int)(_consumerWriteIndex - readIndex);
+    }
+    return available;
+}
+
+template <class T>
+template <class Operation>
+int AudioSPSCRingBufferTemplate<T>::consume(int maxSamples, Operation&& operation) {
+    int numSamples = std::min(maxSamples, consumerSamplesAvailable(maxSamples));
+    if (numSamples <= 0) {
+        return 0;
+    }
+
+    Index readIndex = _readIndex.load(std::memory_order_relaxed);
+    Index bufferLength = _mask + 1;
+    Index offset = readIndex & _mask;
+    int samplesToEnd = (int)(bufferLength - offset);
+
+    // operate on at most two contiguous spans
+    if (numSamples > samplesToEnd) {
+        operation(_buffer + offset, 0, samplesToEnd);
+        operation(_buffer, samplesToEnd, numSamples - samplesToEnd);
+    } else {
+        operation(_buffer + offset, 0, numSamples);
+    }
+
+    // free the samples
+    _readIndex.store(readIndex + numSamples, std::memory_order_release);
+    return numSamples;
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::readSamples(Sample* destination, int maxSamples) {
+    return consume(maxSamples, [&](const Sample* span, int destinationOffset, int numSamples) {
+        memcpy(destination + destinationOffset, span, numSamples * SampleSize);
+    });
+}
+
+template <class T>
+int AudioSPSCRingBufferTemplate<T>::appendSamples(Sample* destination, int maxSamples, bool append) {
+    if (!append) {
+        return readSamples(destination, maxSamples);
+    }
+
+    return consume(maxSamples, [&](const Sample* span, int destinationOffset, int numSamples) {
+        Sample* dest = destination + destinationOffset;
+        for (int i = 0; i < numSamples; i++) {
+            dest[i] += span[i];
+        }
+    });
+}
+
+template <class T>
+void AudioSPSCRingBufferTemplate<T>::skipSamples(int maxSamples) {
+    consume(maxSamples, [](const Sample*, int, int) {});
+}
+
+template class AudioSPSCRingBufferTemplate<int16_t>;
+template class AudioSPSCRingBufferTemplate<float>;
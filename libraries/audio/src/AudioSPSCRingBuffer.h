@@ -0,0 +1,113 @@
+//
+//  AudioSPSCRingBuffer.h
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSPSCRingBuffer_h
+#define hifi_AudioSPSCRingBuffer_h
+
+#include <atomic>
+#include <cstdint>
+
+// A lock-free ring buffer for exactly one producer thread and one consumer thread.
+//   Unlike AudioRingBufferTemplate, it never overwrites unread data, and the amount of data in the buffer
+//   is published through the read and write indices themselves:
+//   - the producer writes samples, then publishes them with a release store of the write index
+//   - the consumer reads samples, then frees them with a release store of the read index
+//   each side acquires the other's index before touching the samples it guards.
+//   The indices live on separate cache lines, and each side keeps a private copy of the other's index,
+//   so the two threads only share a cache line when one of them runs out of data or space.
+template <class T>
+class AudioSPSCRingBufferTemplate {
+    using Sample = T;
+    static const int SampleSize = sizeof(Sample);
+
+public:
+    AudioSPSCRingBufferTemplate(int sampleCapacity = 0);
+    ~AudioSPSCRingBufferTemplate();
+
+    // disallow copying
+    AudioSPSCRingBufferTemplate(const AudioSPSCRingBufferTemplate&) = delete;
+    AudioSPSCRingBufferTemplate(AudioSPSCRingBufferTemplate&&) = delete;
+    AudioSPSCRingBufferTemplate& operator=(const AudioSPSCRingBufferTemplate&) = delete;
+
+    /// Resize to hold sampleCapacity samples (causes a clear())
+    /// NOTE: Not thread-safe - neither the producer nor the consumer may be using the buffer
+    void resize(int sampleCapacity);
+
+    /// Discard any data in the buffer
+    /// NOTE: Must be called from the consumer, or while the consumer is not reading
+    void clear();
+
+    // Producer
+
+    /// Write up to maxSamples from source (will only write up to getFreeSpace())
+    /// Returns number of written samples
+    int writeSamples(const Sample* source, int maxSamples);
+
+    /// Returns the number of samples that can be written without overwriting unread data
+    int getFreeSpace() const { return _sampleCapacity - samplesAvailable(); }
+
+    // Consumer
+
+    /// Read up to maxSamples into destination (will only read up to samplesAvailable())
+    /// Returns number of read samples
+    int readSamples(Sample* destination, int maxSamples);
+
+    /// Add up to maxSamples into destination (will only read up to samplesAvailable())
+    /// If append == false, behaves as readSamples
+    /// Returns number of appended samples
+    int appendSamples(Sample* destination, int maxSamples, bool append = true);
+
+    /// Skip up to maxSamples (will only skip up to samplesAvailable())
+    void skipSamples(int maxSamples);
+
+    // Either
+
+    /// Returns the number of published, unread samples (a snapshot, if called from the producer)
+    int samplesAvailable() const;
+
+    int getSampleCapacity() const { return _sampleCapacity; }
+
+    bool isLockFree() const { return _readIndex.is_lock_free() && _writeIndex.is_lock_free(); }
+
+private:
+    static const int CACHE_LINE_SIZE = 64;
+    using Index = uint32_t;
+
+    // returns the number of samples available to the consumer, refreshing its copy of the write index if needed
+    int consumerSamplesAvailable(int samplesWanted);
+
+    template <class Operation>
+    int consume(int maxSamples, Operation&& operation);
+
+    // shared, written only by resize
+    Sample* _buffer { nullptr };
+    int _sampleCapacity { 0 };  // the logical capacity
+    Index _mask { 0 };          // the buffer length, a power of two, minus one
+
+    // the indices are free-running; they are only masked to address the buffer
+    // padding (rather than alignas) keeps them apart even when the buffer is heap allocated without over-alignment
+    char _sharedPadding[CACHE_LINE_SIZE];
+
+    // consumer
+    std::atomic<Index> _readIndex { 0 };
+    Index _consumerWriteIndex { 0 };
+    char _consumerPadding[CACHE_LINE_SIZE];
+
+    // producer
+    std::atomic<Index> _writeIndex { 0 };
+    Index _producerReadIndex { 0 };
+    char _producerPadding[CACHE_LINE_SIZE];
+};
+
+// expose explicit instantiations for scratch/mix buffers
+using AudioSPSCRingBuffer = AudioSPSCRingBufferTemplate<int16_t>;
+using AudioSPSCMixRingBuffer = AudioSPSCRingBufferTemplate<float>;
+
+#endif // hifi_AudioSPSCRingBuffer_h
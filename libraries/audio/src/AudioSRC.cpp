@@ -446,7 +446,8 @@ int AudioSRC::multirateFilter2(const float* input0, const float* input1, float*
 
 int AudioSRC::multirateFilter4(const float* input0, const float* input1, const float* input2, const float* input3, 
                                float* output0, float* output1, float* output2, float* output3, int inputFrames) {
-    static auto f = cpuSupportsAVX2() ? &AudioSRC::multirateFilter4_AVX2 : &AudioSRC::multirateFilter4_ref;
+    static auto f = cpuSupportsAVX512() ? &AudioSRC::multirateFilter4_AVX512 :
+                    (cpuSupportsAVX2() ? &AudioSRC::multirateFilter4_AVX2 : &AudioSRC::multirateFilter4_ref);
     return (this->*f)(input0, input1, input2, input3, output0, output1, output2, output3, inputFrames); // dispatch
 }
 
@@ -911,6 +912,52 @@ void AudioSRC::convertInput(const int16_t* input, float** outputs, int numFrames
             _mm_store_ss(&outputs[2][i], f2);
             _mm_store_ss(&outputs[3][i], f3);
         }
+    } else if (_numChannels == 8) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            __m128i a0 = _mm_loadu_si128((__m128i*)&input[8*i+0]);
+            __m128i a1 = _mm_loadu_si128((__m128i*)&input[8*i+8]);
+            __m128i a2 = _mm_loadu_si128((__m128i*)&input[8*i+16]);
+            __m128i a3 = _mm_loadu_si128((__m128i*)&input[8*i+24]);
+
+            // sign-extend, channels 0-3 and 4-7 of each frame
+            __m128 f0 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(a0, a0), 16)), scale);
+            __m128 f1 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(a1, a1), 16)), scale);
+            __m128 f2 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(a2, a2), 16)), scale);
+            __m128 f3 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(a3, a3), 16)), scale);
+            __m128 f4 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(a0, a0), 16)), scale);
+            __m128 f5 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(a1, a1), 16)), scale);
+            __m128 f6 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(a2, a2), 16)), scale);
+            __m128 f7 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(a3, a3), 16)), scale);
+
+            // deinterleave
+            _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+            _MM_TRANSPOSE4_PS(f4, f5, f6, f7);
+
+            _mm_storeu_ps(&outputs[0][i], f0);
+            _mm_storeu_ps(&outputs[1][i], f1);
+            _mm_storeu_ps(&outputs[2][i], f2);
+            _mm_storeu_ps(&outputs[3][i], f3);
+            _mm_storeu_ps(&outputs[4][i], f4);
+            _mm_storeu_ps(&outputs[5][i], f5);
+            _mm_storeu_ps(&outputs[6][i], f6);
+            _mm_storeu_ps(&outputs[7][i], f7);
+        }
+        for (; i < numFrames; i++) {
+            // deinterleave
+            for (int ch = 0; ch < 8; ch++) {
+                outputs[ch][i] = (float)input[8*i + ch] * (1/32768.0f);
+            }
+        }
+    } else {
+
+        // any other channel count
+        for (int i = 0; i < numFrames; i++) {
+            for (int ch = 0; ch < _numChannels; ch++) {
+                outputs[ch][i] = (float)input[_numChannels*i + ch] * (1/32768.0f);
+            }
+        }
     }
 }
 
@@ -1061,6 +1108,79 @@ void AudioSRC::convertOutput(float** inputs, int16_t* output, int numFrames) {
 
             _mm_storel_epi64((__m128i*)&output[4*i], a0);
         }
+
+    } else if (_numChannels == 8) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            __m128 f0 = _mm_mul_ps(_mm_loadu_ps(&inputs[0][i]), scale);
+            __m128 f1 = _mm_mul_ps(_mm_loadu_ps(&inputs[1][i]), scale);
+            __m128 f2 = _mm_mul_ps(_mm_loadu_ps(&inputs[2][i]), scale);
+            __m128 f3 = _mm_mul_ps(_mm_loadu_ps(&inputs[3][i]), scale);
+            __m128 f4 = _mm_mul_ps(_mm_loadu_ps(&inputs[4][i]), scale);
+            __m128 f5 = _mm_mul_ps(_mm_loadu_ps(&inputs[5][i]), scale);
+            __m128 f6 = _mm_mul_ps(_mm_loadu_ps(&inputs[6][i]), scale);
+            __m128 f7 = _mm_mul_ps(_mm_loadu_ps(&inputs[7][i]), scale);
+
+            __m128 d0 = dither4();
+            f0 = _mm_add_ps(f0, d0);
+            f1 = _mm_add_ps(f1, d0);
+            f2 = _mm_add_ps(f2, d0);
+            f3 = _mm_add_ps(f3, d0);
+            f4 = _mm_add_ps(f4, d0);
+            f5 = _mm_add_ps(f5, d0);
+            f6 = _mm_add_ps(f6, d0);
+            f7 = _mm_add_ps(f7, d0);
+
+            // interleave, channels 0-3 and 4-7 of each frame
+            _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+            _MM_TRANSPOSE4_PS(f4, f5, f6, f7);
+
+            // round and saturate
+            __m128i a0 = _mm_packs_epi32(_mm_cvtps_epi32(f0), _mm_cvtps_epi32(f4));
+            __m128i a1 = _mm_packs_epi32(_mm_cvtps_epi32(f1), _mm_cvtps_epi32(f5));
+            __m128i a2 = _mm_packs_epi32(_mm_cvtps_epi32(f2), _mm_cvtps_epi32(f6));
+            __m128i a3 = _mm_packs_epi32(_mm_cvtps_epi32(f3), _mm_cvtps_epi32(f7));
+
+            _mm_storeu_si128((__m128i*)&output[8*i+0], a0);
+            _mm_storeu_si128((__m128i*)&output[8*i+8], a1);
+            _mm_storeu_si128((__m128i*)&output[8*i+16], a2);
+            _mm_storeu_si128((__m128i*)&output[8*i+24], a3);
+        }
+        for (; i < numFrames; i++) {
+            __m128 f0 = _mm_setr_ps(inputs[0][i], inputs[1][i], inputs[2][i], inputs[3][i]);
+            __m128 f4 = _mm_setr_ps(inputs[4][i], inputs[5][i], inputs[6][i], inputs[7][i]);
+
+            __m128 d0 = dither4();
+            d0 = _mm_shuffle_ps(d0, d0, _MM_SHUFFLE(0,0,0,0));
+            f0 = _mm_add_ps(_mm_mul_ps(f0, scale), d0);
+            f4 = _mm_add_ps(_mm_mul_ps(f4, scale), d0);
+
+            // round and saturate
+            __m128i a0 = _mm_packs_epi32(_mm_cvtps_epi32(f0), _mm_cvtps_epi32(f4));
+
+            _mm_storeu_si128((__m128i*)&output[8*i], a0);
+        }
+
+    } else {
+
+        // any other channel count
+        for (int i = 0; i < numFrames; i++) {
+
+            __m128 d0 = dither4();
+
+            for (int ch = 0; ch < _numChannels; ch++) {
+                __m128 f0 = _mm_mul_ss(_mm_load_ss(&inputs[ch][i]), scale);
+
+                f0 = _mm_add_ss(f0, d0);
+
+                // round and saturate
+                __m128i a0 = _mm_cvtps_epi32(f0);
+                a0 = _mm_packs_epi32(a0, a0);
+
+                output[_numChannels*i + ch] = (int16_t)_mm_extract_epi16(a0, 0);
+            }
+        }
     }
 }
 
@@ -1120,6 +1240,48 @@ void AudioSRC::convertInput(const float* input, float** outputs, int numFrames)
             outputs[2][i] = input[4*i + 2];
             outputs[3][i] = input[4*i + 3];
         }
+
+    } else if (_numChannels == 8) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            __m128 f0 = _mm_loadu_ps(&input[8*i + 0]);
+            __m128 f4 = _mm_loadu_ps(&input[8*i + 4]);
+            __m128 f1 = _mm_loadu_ps(&input[8*i + 8]);
+            __m128 f5 = _mm_loadu_ps(&input[8*i + 12]);
+            __m128 f2 = _mm_loadu_ps(&input[8*i + 16]);
+            __m128 f6 = _mm_loadu_ps(&input[8*i + 20]);
+            __m128 f3 = _mm_loadu_ps(&input[8*i + 24]);
+            __m128 f7 = _mm_loadu_ps(&input[8*i + 28]);
+
+            // deinterleave
+            _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+            _MM_TRANSPOSE4_PS(f4, f5, f6, f7);
+
+            _mm_storeu_ps(&outputs[0][i], f0);
+            _mm_storeu_ps(&outputs[1][i], f1);
+            _mm_storeu_ps(&outputs[2][i], f2);
+            _mm_storeu_ps(&outputs[3][i], f3);
+            _mm_storeu_ps(&outputs[4][i], f4);
+            _mm_storeu_ps(&outputs[5][i], f5);
+            _mm_storeu_ps(&outputs[6][i], f6);
+            _mm_storeu_ps(&outputs[7][i], f7);
+        }
+        for (; i < numFrames; i++) {
+            // deinterleave
+            for (int ch = 0; ch < 8; ch++) {
+                outputs[ch][i] = input[8*i + ch];
+            }
+        }
+
+    } else {
+
+        // any other channel count
+        for (int i = 0; i < numFrames; i++) {
+            for (int ch = 0; ch < _numChannels; ch++) {
+                outputs[ch][i] = input[_numChannels*i + ch];
+            }
+        }
     }
 }
 
@@ -1179,6 +1341,48 @@ void AudioSRC::convertOutput(float** inputs, float* output, int numFrames) {
             output[4*i + 2] = inputs[2][i];
             output[4*i + 3] = inputs[3][i];
         }
+
+    } else if (_numChannels == 8) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            __m128 f0 = _mm_loadu_ps(&inputs[0][i]);
+            __m128 f1 = _mm_loadu_ps(&inputs[1][i]);
+            __m128 f2 = _mm_loadu_ps(&inputs[2][i]);
+            __m128 f3 = _mm_loadu_ps(&inputs[3][i]);
+            __m128 f4 = _mm_loadu_ps(&inputs[4][i]);
+            __m128 f5 = _mm_loadu_ps(&inputs[5][i]);
+            __m128 f6 = _mm_loadu_ps(&inputs[6][i]);
+            __m128 f7 = _mm_loadu_ps(&inputs[7][i]);
+
+            // interleave
+            _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+            _MM_TRANSPOSE4_PS(f4, f5, f6, f7);
+
+            _mm_storeu_ps(&output[8*i + 0], f0);
+            _mm_storeu_ps(&output[8*i + 4], f4);
+            _mm_storeu_ps(&output[8*i + 8], f1);
+            _mm_storeu_ps(&output[8*i + 12], f5);
+            _mm_storeu_ps(&output[8*i + 16], f2);
+            _mm_storeu_ps(&output[8*i + 20], f6);
+            _mm_storeu_ps(&output[8*i + 24], f3);
+            _mm_storeu_ps(&output[8*i + 28], f7);
+        }
+        for (; i < numFrames; i++) {
+            // interleave
+            for (int ch = 0; ch < 8; ch++) {
+                output[8*i + ch] = inputs[ch][i];
+            }
+        }
+
+    } else {
+
+        // any other channel count
+        for (int i = 0; i < numFrames; i++) {
+            for (int ch = 0; ch < _numChannels; ch++) {
+                output[_numChannels*i + ch] = inputs[ch][i];
+            }
+        }
     }
 }
 
@@ -1204,6 +1408,12 @@ void AudioSRC::convertInput(const int16_t* input, float** outputs, int numFrames
             outputs[2][i] = (float)input[4*i + 2] * scale;
             outputs[3][i] = (float)input[4*i + 3] * scale;
         }
+    } else {
+        for (int i = 0; i < numFrames; i++) {
+            for (int ch = 0; ch < _numChannels; ch++) {
+                outputs[ch][i] = (float)input[_numChannels*i + ch] * scale;
+            }
+        }
     }
 }
 
@@ -1283,6 +1493,25 @@ void AudioSRC::convertOutput(float** inputs, int16_t* output, int numFrames) {
             output[4*i + 2] = (int16_t)f2;
             output[4*i + 3] = (int16_t)f3;
         }
+    } else {
+        for (int i = 0; i < numFrames; i++) {
+
+            float d = dither();
+
+            for (int ch = 0; ch < _numChannels; ch++) {
+
+                float f = inputs[ch][i] * scale;
+
+                f += d;
+
+                // round and saturate
+                f += (f < 0.0f ? -0.5f : +0.5f);
+                f = MAX(MIN(f, 32767.0f), -32768.0f);
+
+                // interleave
+                output[_numChannels*i + ch] = (int16_t)f;
+            }
+        }
     }
 }
 
@@ -1307,6 +1536,13 @@ void AudioSRC::convertInput(const float* input, float** outputs, int numFrames)
             outputs[2][i] = input[4*i + 2];
             outputs[3][i] = input[4*i + 3];
         }
+    } else {
+        for (int i = 0; i < numFrames; i++) {
+            // deinterleave
+            for (int ch = 0; ch < _numChannels; ch++) {
+                outputs[ch][i] = input[_numChannels*i + ch];
+            }
+        }
     }
 }
 
@@ -1331,102 +1567,98 @@ void AudioSRC::convertOutput(float** inputs, float* output, int numFrames) {
             output[4*i + 2] = inputs[2][i];
             output[4*i + 3] = inputs[3][i];
         }
+    } else {
+        for (int i = 0; i < numFrames; i++) {
+            // interleave
+            for (int ch = 0; ch < _numChannels; ch++) {
+                output[_numChannels*i + ch] = inputs[ch][i];
+            }
+        }
     }
 }
 
 #endif
 
-int AudioSRC::render(float** inputs, float** outputs, int inputFrames) {
+//
+// Process all channels in groups of 4, 2 and 1, starting each group from the same filter state
+//
+int AudioSRC::multirateFilter(const float** inputs, float** outputs, int inputFrames) {
     int outputFrames = 0;
 
-    int nh = MIN(_numHistory, inputFrames); // number of frames from history buffer
-    int ni = inputFrames - nh;              // number of frames from remaining input
+    int64_t offset = _offset;
+    int phase = _phase;
 
-    if (_numChannels == 1) {
+    int ch = 0;
+    while (ch < _numChannels) {
 
-        // refill history buffers
-        memcpy(_history[0] + _numHistory, inputs[0], nh * sizeof(float));
+        // every group advances the filter state identically
+        _offset = offset;
+        _phase = phase;
 
-        // process history buffer
-        outputFrames += multirateFilter1(_history[0], outputs[0], nh);
-
-        // process remaining input
-        if (ni) {
-            outputFrames += multirateFilter1(inputs[0], outputs[0] + outputFrames, ni);
-        }
+        int numRemaining = _numChannels - ch;
 
-        // shift history buffers
-        if (ni) {
-            memcpy(_history[0], inputs[0] + ni, _numHistory * sizeof(float));
+        if (numRemaining >= 4) {
+            outputFrames = multirateFilter4(inputs[ch + 0], inputs[ch + 1], inputs[ch + 2], inputs[ch + 3],
+                                            outputs[ch + 0],
+                                            outputs[ch + 1],
+                                            outputs[ch + 2],
+                                            outputs[ch + 3], inputFrames);
+            ch += 4;
+        } else if (numRemaining >= 2) {
+            outputFrames = multirateFilter2(inputs[ch + 0], inputs[ch + 1], outputs[ch + 0], outputs[ch + 1], inputFrames);
+            ch += 2;
         } else {
-            memmove(_history[0], _history[0] + nh, _numHistory * sizeof(float));
+            outputFrames = multirateFilter1(inputs[ch + 0], outputs[ch + 0], inputFrames);
+            ch += 1;
         }
+    }
 
-    } else if (_numChannels == 2) {
-
-        // refill history buffers
-        memcpy(_history[0] + _numHistory, inputs[0], nh * sizeof(float));
-        memcpy(_history[1] + _numHistory, inputs[1], nh * sizeof(float));
+    return outputFrames;
+}
 
-        // process history buffer
-        outputFrames += multirateFilter2(_history[0], _history[1], outputs[0], outputs[1], nh);
+int AudioSRC::render(float** inputs, float** outputs, int inputFrames) {
+    int outputFrames = 0;
 
-        // process remaining input
-        if (ni) {
-            outputFrames += multirateFilter2(inputs[0], inputs[1], outputs[0] + outputFrames, outputs[1] + outputFrames, ni);
-        }
+    int nh = MIN(_numHistory, inputFrames); // number of frames from history buffer
+    int ni = inputFrames - nh;              // number of frames from remaining input
 
-        // shift history buffers
-        if (ni) {
-            memcpy(_history[0], inputs[0] + ni, _numHistory * sizeof(float));
-            memcpy(_history[1], inputs[1] + ni, _numHistory * sizeof(float));
-        } else {
-            memmove(_history[0], _history[0] + nh, _numHistory * sizeof(float));
-            memmove(_history[1], _history[1] + nh, _numHistory * sizeof(float));
-        }
+    const float* filterInputs[SRC_MAX_CHANNELS];
+    float* filterOutputs[SRC_MAX_CHANNELS];
 
-    } else if (_numChannels == 4) {
+    // refill history buffers
+    for (int ch = 0; ch < _numChannels; ch++) {
+        memcpy(_history[ch] + _numHistory, inputs[ch], nh * sizeof(float));
 
-        // refill history buffers
-        memcpy(_history[0] + _numHistory, inputs[0], nh * sizeof(float));
-        memcpy(_history[1] + _numHistory, inputs[1], nh * sizeof(float));
-        memcpy(_history[2] + _numHistory, inputs[2], nh * sizeof(float));
-        memcpy(_history[3] + _numHistory, inputs[3], nh * sizeof(float));
+        filterInputs[ch] = _history[ch];
+        filterOutputs[ch] = outputs[ch];
+    }
 
-        // process history buffer
-        outputFrames += multirateFilter4(_history[0], _history[1], _history[2], _history[3], 
-                                         outputs[0], 
-                                         outputs[1], 
-                                         outputs[2], 
-                                         outputs[3], nh);
+    // process history buffer
+    outputFrames += multirateFilter(filterInputs, filterOutputs, nh);
 
-        // process remaining input
-        if (ni) {
-            outputFrames += multirateFilter4(inputs[0], inputs[1], inputs[2], inputs[3], 
-                                             outputs[0] + outputFrames, 
-                                             outputs[1] + outputFrames, 
-                                             outputs[2] + outputFrames, 
-                                             outputs[3] + outputFrames, ni);
+    // process remaining input
+    if (ni) {
+        for (int ch = 0; ch < _numChannels; ch++) {
+            filterInputs[ch] = inputs[ch];
+            filterOutputs[ch] = outputs[ch] + outputFrames;
         }
 
-        // shift history buffers
+        outputFrames += multirateFilter(filterInputs, filterOutputs, ni);
+    }
+
+    // shift history buffers
+    for (int ch = 0; ch < _numChannels; ch++) {
         if (ni) {
-            memcpy(_history[0], inputs[0] + ni, _numHistory * sizeof(float));
-            memcpy(_history[1], inputs[1] + ni, _numHistory * sizeof(float));
-            memcpy(_history[2], inputs[2] + ni, _numHistory * sizeof(float));
-            memcpy(_history[3], inputs[3] + ni, _numHistory * sizeof(float));
+            memcpy(_history[ch], inputs[ch] + ni, _numHistory * sizeof(float));
         } else {
-            memmove(_history[0], _history[0] + nh, _numHistory * sizeof(float));
-            memmove(_history[1], _history[1] + nh, _numHistory * sizeof(float));
-            memmove(_history[2], _history[2] + nh, _numHistory * sizeof(float));
-            memmove(_history[3], _history[3] + nh, _numHistory * sizeof(float));
+            memmove(_history[ch], _history[ch] + nh, _numHistory * sizeof(float));
         }
     }
 
     return outputFrames;
 }
 
-AudioSRC::AudioSRC(int inputSampleRate, int outputSampleRate, int numChannels, Quality quality) {
+AudioSRC::AudioSRC(int inputSampleRate, int outputSampleRate, int numChannels, Quality quality, bool isVariableRate) {
 
     assert(inputSampleRate > 0);
     assert(outputSampleRate > 0);
@@ -1443,8 +1675,8 @@ AudioSRC::AudioSRC(int inputSampleRate, int outputSampleRate, int numChannels, Q
     _downFactor = inputSampleRate / divisor;
     _step = 0;  // rational mode
 
-    // if the number of phases is too large, use irrational mode
-    if (_upFactor > 640) {
+    // if the number of phases is too large, or the ratio can be adjusted, use irrational mode
+    if (_upFactor > 640 || isVariableRate) {
         _upFactor = SRC_PHASES;
         _downFactor = ((int64_t)SRC_PHASES * _inputSampleRate) / _outputSampleRate;
         _step = ((int64_t)_inputSampleRate << 32) / _outputSampleRate;
@@ -1465,8 +1697,16 @@ AudioSRC::AudioSRC(int inputSampleRate, int outputSampleRate, int numChannels, Q
     // filter history size
     _numHistory = _numTaps - 1;
 
+    _baseStep = _step;
+    _isVariableRate = isVariableRate;
+
     // input blocking size, such that input and output are both guaranteed not to exceed SRC_BLOCK frames
+    // (in variable-rate mode, this must hold for the smallest step)
+    if (_isVariableRate) {
+        _step = (int64_t)(_baseStep * (double)(1.0f - SRC_MAX_RATE_ADJUSTMENT));
+    }
     _inputBlock = MIN(SRC_BLOCK, getMaxInput(SRC_BLOCK));
+    _step = _baseStep;
 
     // allocate buffers
     for (int ch = 0; ch < _numChannels; ch++) {
@@ -1498,6 +1738,18 @@ AudioSRC::~AudioSRC() {
     }
 }
 
+void AudioSRC::setRateAdjustment(float ratio) {
+    assert(_isVariableRate);
+    if (!_isVariableRate) {
+        return;
+    }
+
+    ratio = MAX(MIN(ratio, 1.0f + SRC_MAX_RATE_ADJUSTMENT), 1.0f - SRC_MAX_RATE_ADJUSTMENT);
+
+    // the fractional step carries the drift, the phase and offset are continuous across changes
+    _step = (int64_t)(_baseStep * (double)ratio);
+}
+
 //
 // This version handles input/output as interleaved int16_t
 //
@@ -14,7 +14,7 @@
 
 #include <stdint.h>
 
-static const int SRC_MAX_CHANNELS = 4;
+static const int SRC_MAX_CHANNELS = 8;
 
 // polyphase filter
 static const int SRC_PHASEBITS = 9;
@@ -28,6 +28,9 @@ static const float Q32_TO_FLOAT = 1.0f / (1ULL << 32);
 // blocking size in frames, chosen so block processing fits in L1 cache
 static const int SRC_BLOCK = 256;
 
+// max adjustment of the conversion ratio in variable-rate mode, +/-1%
+static const float SRC_MAX_RATE_ADJUSTMENT = 0.01f;
+
 class AudioSRC {
 
 public:
@@ -37,9 +40,15 @@ public:
         HIGH_QUALITY
     };
 
-    AudioSRC(int inputSampleRate, int outputSampleRate, int numChannels, Quality quality = MEDIUM_QUALITY);
+    // variable-rate mode always uses the irrational filter, so the ratio can be adjusted while streaming
+    AudioSRC(int inputSampleRate, int outputSampleRate, int numChannels, Quality quality = MEDIUM_QUALITY,
+             bool isVariableRate = false);
     ~AudioSRC();
 
+    // adjust the conversion ratio to compensate for clock drift between devices,
+    // where ratio > 1.0 consumes input faster (requires variable-rate mode)
+    void setRateAdjustment(float ratio);
+
     // deinterleaved float input/output (native format)
     int render(float** inputs, float** outputs, int inputFrames);
 
@@ -75,10 +84,14 @@ private:
     int _phase;
     int64_t _offset;
     int64_t _step;
+    int64_t _baseStep;
+    bool _isVariableRate;
 
     int createRationalFilter(int upFactor, int downFactor, float gain, Quality quality);
     int createIrrationalFilter(int upFactor, int downFactor, float gain, Quality quality);
 
+    int multirateFilter(const float** inputs, float** outputs, int inputFrames);
+
     int multirateFilter1(const float* input0, float* output0, int inputFrames);
     int multirateFilter2(const float* input0, const float* input1, float* output0, float* output1, int inputFrames);
     int multirateFilter4(const float* input0, const float* input1, const float* input2, const float* input3, 
@@ -94,6 +107,9 @@ private:
     int multirateFilter4_AVX2(const float* input0, const float* input1, const float* input2, const float* input3, 
                               float* output0, float* output1, float* output2, float* output3, int inputFrames);
 
+    int multirateFilter4_AVX512(const float* input0, const float* input1, const float* input2, const float* input3,
+                                float* output0, float* output1, float* output2, float* output3, int inputFrames);
+
     void convertInput(const int16_t* input, float** outputs, int numFrames);
     void convertOutput(float** inputs, int16_t* output, int numFrames);
 
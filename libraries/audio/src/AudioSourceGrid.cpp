@@ -0,0 +1,132 @@
+//
+//  AudioSourceGrid.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSourceGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "AudioHRTF.h"
+
+const float AudioSourceGrid::MIN_AUDIBLE_GAIN = 1.0f / 32768.0f;
+const float AudioSourceGrid::EVICTION_HYSTERESIS = 1.25f;
+const float AudioSourceGrid::CELL_SIZE = 16.0f;
+
+static const int CELL_KEY_BITS = 21;
+static const int64_t CELL_KEY_OFFSET = 1 << (CELL_KEY_BITS - 1);
+static const int64_t CELL_KEY_MASK = (1 << CELL_KEY_BITS) - 1;
+
+static glm::ivec3 cellCoordinates(const glm::vec3& position, float cellSize) {
+    return glm::ivec3(glm::floor(position / cellSize));
+}
+
+static uint64_t cellKey(const glm::ivec3& cell) {
+    uint64_t key = 0;
+    for (int i = 0; i < 3; i++) {
+        key = (key << CELL_KEY_BITS) | (uint64_t)((cell[i] + CELL_KEY_OFFSET) & CELL_KEY_MASK);
+    }
+    return key;
+}
+
+float AudioSourceGrid::computeAudibleRadius(float attenuationPerDoublingInDistance, float maxRadius) {
+    // these mirror the attenuation in computeGain. source gains (injector volume, master gain) are assumed
+    // not to exceed ATTN_GAIN_MAX, which is where the distance attenuated gain is clamped.
+    float radius;
+    if (attenuationPerDoublingInDistance < 0.0f) {
+        // linear attenuation reaches zero at the distance limit
+        const float MIN_DISTANCE_LIMIT = ATTN_DISTANCE_REF + 1.0f;
+        radius = std::max(-attenuationPerDoublingInDistance, MIN_DISTANCE_LIMIT);
+    } else if (attenuationPerDoublingInDistance < 1.0f) {
+        const float MIN_ATTENUATION_COEFFICIENT = 0.001f;
+        float g = glm::clamp(1.0f - attenuationPerDoublingInDistance, MIN_ATTENUATION_COEFFICIENT, 1.0f);
+        if (g >= 1.0f) {
+            return maxRadius;
+        }
+        // solve ATTN_GAIN_MAX * g^log2(distance / ATTN_DISTANCE_REF) = MIN_AUDIBLE_GAIN
+        float doublings = log2f(MIN_AUDIBLE_GAIN / ATTN_GAIN_MAX) / log2f(g);
+        radius = ATTN_DISTANCE_REF * exp2f(doublings);
+    } else {
+        // silent at any distance
+        radius = 0.0f;
+    }
+
+    return std::min(radius, maxRadius);
+}
+
+void AudioSourceGrid::clear() {
+    _sources.clear();
+    _cells.clear();
+}
+
+void AudioSourceGrid::addSource(const glm::vec3& position, int id) {
+    _sources.push_back({ cellKey(cellCoordinates(position, CELL_SIZE)), position, id });
+}
+
+void AudioSourceGrid::build() {
+    _cells.clear();
+
+    std::sort(_sources.begin(), _sources.end(), [](const Source& a, const Source& b) {
+        return a.cellKey < b.cellKey;
+    });
+
+    for (int i = 0; i < (int)_sources.size(); i++) {
+        if (_cells.empty() || _sources[_cells.back().begin].cellKey != _sources[i].cellKey) {
+            glm::vec3 minCorner = glm::vec3(cellCoordinates(_sources[i].position, CELL_SIZE)) * CELL_SIZE;
+            _cells.push_back({ _sources[i].cellKey, minCorner, i, i + 1 });
+        } else {
+            _cells.back().end = i + 1;
+        }
+    }
+}
+
+void AudioSourceGrid::findSources(const glm::vec3& position, float radius, std::vector<int>& ids) const {
+    float radiusSquared = radius * radius;
+
+    glm::ivec3 low = cellCoordinates(position - glm::vec3(radius), CELL_SIZE);
+    glm::ivec3 high = cellCoordinates(position + glm::vec3(radius), CELL_SIZE);
+    int64_t numColumns = (int64_t)(high.x - low.x + 1) * (int64_t)(high.y - low.y + 1);
+    if (!std::isfinite(radius) || numColumns >= (int64_t)_cells.size()) {
+        // there are fewer occupied cells than columns of cells in range, so check them all
+        for (const auto& cell : _cells) {
+            findSourcesInCell(cell, position, radiusSquared, ids);
+        }
+        return;
+    }
+
+    // z varies fastest in the cell keys, so the occupied cells of each column along z are a contiguous range of _cells
+    glm::ivec3 cell;
+    for (cell.x = low.x; cell.x <= high.x; cell.x++) {
+        for (cell.y = low.y; cell.y <= high.y; cell.y++) {
+            uint64_t highKey = cellKey(glm::ivec3(cell.x, cell.y, high.z));
+            auto it = std::lower_bound(_cells.begin(), _cells.end(), cellKey(glm::ivec3(cell.x, cell.y, low.z)),
+                                       [](const Cell& occupiedCell, uint64_t key) { return occupiedCell.key < key; });
+            for (; it != _cells.end() && it->key <= highKey; ++it) {
+                findSourcesInCell(*it, position, radiusSquared, ids);
+            }
+        }
+    }
+}
+
+void AudioSourceGrid::findSourcesInCell(const Cell& cell, const glm::vec3& position, float radiusSquared,
+                                        std::vector<int>& ids) const {
+    glm::vec3 closestPoint = glm::clamp(position, cell.minCorner, cell.minCorner + glm::vec3(CELL_SIZE));
+    glm::vec3 toCell = closestPoint - position;
+    if (glm::dot(toCell, toCell) > radiusSquared) {
+        return;
+    }
+
+    for (int i = cell.begin; i < cell.end; i++) {
+        glm::vec3 toSource = _sources[i].position - position;
+        if (glm::dot(toSource, toSource) <= radiusSquared) {
+            ids.push_back(_sources[i].id);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+//
+//  AudioSourceGrid.h
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSourceGrid_h
+#define hifi_AudioSourceGrid_h
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// Grid of audio source positions, for finding the sources within a radius of a listener.
+//   Sources are bucketed into cubic cells and sorted by cell, so the sources of a cell are a contiguous range,
+//   and a query only visits the occupied cells that overlap the bounding box of its sphere.
+class AudioSourceGrid {
+public:
+    // a gain that does not change a 16-bit mix
+    static const float MIN_AUDIBLE_GAIN;
+
+    // sources are admitted within the audible radius, but only evicted past this multiple of it,
+    // so sources on the edge of the radius do not churn
+    static const float EVICTION_HYSTERESIS;
+
+    static const float CELL_SIZE;
+
+    // the distance at which an attenuation setting falls below MIN_AUDIBLE_GAIN, limited to maxRadius
+    // (infinite when the setting does not attenuate with distance and maxRadius is infinite)
+    static float computeAudibleRadius(float attenuationPerDoublingInDistance, float maxRadius);
+
+    static float computeEvictionRadius(float audibleRadius) { return audibleRadius * EVICTION_HYSTERESIS; }
+
+    void clear();
+    void addSource(const glm::vec3& position, int id);
+
+    // sorts the sources added since clear into cells, must be called before findSources
+    void build();
+
+    // appends the ids of the sources within radius of position
+    void findSources(const glm::vec3& position, float radius, std::vector<int>& ids) const;
+
+    int getNumSources() const { return (int)_sources.size(); }
+    int getNumCells() const { return (int)_cells.size(); }
+
+private:
+    struct Source {
+        uint64_t cellKey;
+        glm::vec3 position;
+        int id;
+    };
+
+    // a contiguous range of _sources sharing a cell
+    struct Cell {
+        uint64_t key;
+        glm::vec3 minCorner;
+        int begin;
+        int end;
+    };
+
+    void findSourcesInCell(const Cell& cell, const glm::vec3& position, float radiusSquared, std::vector<int>& ids) const;
+
+    std::vector<Source> _sources; // sorted by cell
+    std::vector<Cell> _cells; // sorted by key
+};
+
+#endif // hifi_AudioSourceGrid_h
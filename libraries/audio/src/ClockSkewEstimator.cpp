@@ -0,0 +1,36 @@
+//
+//  ClockSkewEstimator.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ClockSkewEstimator.h"
+
+#include <algorithm>
+
+#include "AudioSRC.h"
+
+// With these, the correction is well damped (a damping ratio of ~0.7), and a skew of 100ppm settles
+// with the level 0.1 frames above the desired level.
+const float ClockSkewEstimator::LEVEL_SMOOTHING = 1.0f / 500.0f;
+const float ClockSkewEstimator::ADJUSTMENT_PER_FRAME = 0.001f;
+
+void ClockSkewEstimator::reset() {
+    _smoothedError = 0.0f;
+    _rateAdjustment = 1.0f;
+}
+
+float ClockSkewEstimator::update(float framesAvailable, float desiredFrames) {
+    float error = framesAvailable - desiredFrames;
+    _smoothedError += LEVEL_SMOOTHING * (error - _smoothedError);
+
+    float adjustment = ADJUSTMENT_PER_FRAME * _smoothedError;
+    adjustment = std::max(std::min(adjustment, SRC_MAX_RATE_ADJUSTMENT), -SRC_MAX_RATE_ADJUSTMENT);
+    _rateAdjustment = 1.0f + adjustment;
+
+    return _rateAdjustment;
+}
@@ -0,0 +1,38 @@
+//
+//  ClockSkewEstimator.h
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ClockSkewEstimator_h
+#define hifi_ClockSkewEstimator_h
+
+// Estimates the skew between the clock of a stream's sender and the clock of the device that plays it, from the level
+// of the buffer between them: a faster sender keeps raising the level, a slower one keeps lowering it.
+//   The estimate is the rate adjustment for AudioSRC::setRateAdjustment that holds the smoothed level near the desired
+// level, where > 1.0 means the sender is fast and its audio should be consumed faster.  Smoothing over several seconds
+// averages out the packet jitter, which the jitter buffer absorbs on its own.
+class ClockSkewEstimator {
+public:
+    // weight of each new level in the smoothed level, for a time constant of 500 updates
+    static const float LEVEL_SMOOTHING;
+    // rate adjustment per frame of smoothed level above the desired level
+    static const float ADJUSTMENT_PER_FRAME;
+
+    void reset();
+
+    // call once per device period, with the frames left in the buffer and the frames it should hold
+    float update(float framesAvailable, float desiredFrames);
+
+    float getRateAdjustment() const { return _rateAdjustment; }
+
+private:
+    float _smoothedError { 0.0f };
+    float _rateAdjustment { 1.0f };
+};
+
+#endif // hifi_ClockSkewEstimator_h
@@ -38,7 +38,10 @@ static const int UNPLAYED_MS_WINDOW_SECS = 5;
 // The larger this value is, the less frames we drop when attempting to reduce the jitter buffer length.
 // Setting this to 0 will try to get the jitter buffer to be exactly _desiredJitterBufferFrames when dropping frames,
 // which could lead to a starve soon after.
-static const int DESIRED_JITTER_BUFFER_FRAMES_PADDING = 1;
+static const int DESIRED_JITTER_BUFFER_FRAMES_PADDING = AdaptiveJitterTarget::DESIRED_PADDING_FRAMES;
+
+// Time-scaling crossfades over this fraction of a frame; AdaptiveJitterTarget decides when and how much.
+static const int TIME_SCALE_FADE_FRACTION = 2;
 
 // this controls the length of the window for stats used in the stats packet (not the stats used in
 // _desiredJitterBufferFrames calculation)
@@ -92,6 +95,9 @@ void InboundAudioStream::resetStats() {
     _timeGapStatsForDesiredCalcOnTooManyStarves.reset();
     _timeGapStatsForDesiredReduction.reset();
     _starveHistory.clear();
+    _jitterTarget.reset();
+    _lastPopSamples = 0;
+    _timeScaledSamples = 0;
     _framesAvailableStat.reset();
     _currentJitterBufferFrames = 0;
     _timeGapStatsForStatsPacket.reset();
@@ -126,7 +132,12 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
         _incomingSequenceNumberStats.sequenceNumberReceived(sequence, message.getSourceID());
     QString codecInPacket = message.readString();
 
-    packetReceivedUpdateTimingStats();
+    // packets dropped before an early packet are accounted for in its arrival gap
+    int numPacketsInGap = 1;
+    if (arrivalInfo._status == SequenceNumberStats::Early) {
+        numPacketsInGap += arrivalInfo._seqDiffFromExpected;
+    }
+    packetReceivedUpdateTimingStats(numPacketsInGap);
 
     int networkFrames;
 
@@ -352,6 +363,7 @@ int InboundAudioStream::popSamples(int maxSamples, bool allOrNothing) {
     } else {
         if (samplesAvailable >= maxSamples) {
             // we have enough samples to pop, so we're good to pop
+            timeScaleTowardsDesired(maxSamples);
             popSamplesNoCheck(maxSamples);
             samplesPopped = maxSamples;
         } else if (!allOrNothing && samplesAvailable > 0) {
@@ -397,12 +409,69 @@ int InboundAudioStream::popFrames(int maxFrames, bool allOrNothing) {
     return samplesPopped / numFrameSamples;
 }
 
+void InboundAudioStream::timeScaleTowardsDesired(int samplesToPop) {
+    AdaptiveJitterTarget::TimeScale timeScale = _jitterTarget.updateTimeScale(_ringBuffer.framesAvailable(),
+                                                                              _desiredJitterBufferFrames);
+    if (!_dynamicJitterBufferEnabled) {
+        return;
+    }
+
+    // scale by whole sample frames, so interleaved channels stay aligned
+    int samplesPerChannel = _ringBuffer.getNumFrameSamples() / _numChannels;
+    int scaleSamples = std::max(samplesPerChannel / AdaptiveJitterTarget::TIME_SCALE_FRACTION, 1) * _numChannels;
+    int fadeSamples = std::max(samplesPerChannel / TIME_SCALE_FADE_FRACTION, 1) * _numChannels;
+    int samplesAvailable = _ringBuffer.samplesAvailable();
+
+    if (timeScale == AdaptiveJitterTarget::COMPRESS) {
+        // too much latency, and enough audio to drop some without starving this pop
+        if (samplesAvailable >= samplesToPop + scaleSamples + fadeSamples) {
+            compressSamples(scaleSamples, fadeSamples);
+        }
+    } else if (timeScale == AdaptiveJitterTarget::STRETCH) {
+        // too little latency; replaying the end of the last pop is only safe if it was real audio,
+        // and if it cannot have been overwritten by the writer since
+        bool canReplay = _lastPopSucceeded && _lastPopSamples >= scaleSamples &&
+                         samplesAvailable >= fadeSamples &&
+                         samplesAvailable + scaleSamples <= _ringBuffer.getSampleCapacity() / 2;
+        if (canReplay) {
+            stretchSamples(scaleSamples, fadeSamples);
+        }
+    }
+}
+
+void InboundAudioStream::compressSamples(int numSamples, int fadeSamples) {
+    // crossfade from the audio that would have played next into the audio after the dropped samples,
+    // so the stream stays continuous across the drop
+    for (int i = 0; i < fadeSamples; i++) {
+        float fade = (float)(i / _numChannels + 1) / (float)(fadeSamples / _numChannels + 1);
+        int16_t& sample = _ringBuffer[numSamples + i];
+        sample = (int16_t)((1.0f - fade) * _ringBuffer[i] + fade * sample);
+    }
+    _ringBuffer.shiftReadPosition(numSamples);
+
+    _timeScaledSamples -= numSamples;
+}
+
+void InboundAudioStream::stretchSamples(int numSamples, int fadeSamples) {
+    // replay the end of the last pop, crossfading from the audio that would have played next into the replayed
+    // audio. samples are read ahead of where they are written, so this can be done in-place.
+    _ringBuffer.unshiftReadPosition(numSamples);
+    for (int i = 0; i < fadeSamples; i++) {
+        float fade = (float)(i / _numChannels + 1) / (float)(fadeSamples / _numChannels + 1);
+        int16_t& sample = _ringBuffer[i];
+        sample = (int16_t)((1.0f - fade) * _ringBuffer[numSamples + i] + fade * sample);
+    }
+
+    _timeScaledSamples += numSamples;
+}
+
 void InboundAudioStream::popSamplesNoCheck(int samples) {
     float unplayedMs = (_ringBuffer.samplesAvailable() / (float)_ringBuffer.getNumFrameSamples()) * AudioConstants::NETWORK_FRAME_MSECS;
     _unplayedMs.update(unplayedMs);
 
     _lastPopOutput = _ringBuffer.nextOutput();
     _ringBuffer.shiftReadPosition(samples);
+    _lastPopSamples = samples;
     framesAvailableChanged();
 
     _hasStarted = true;
@@ -484,7 +553,7 @@ void InboundAudioStream::setStaticJitterBufferFrames(int staticJitterBufferFrame
     }
 }
 
-void InboundAudioStream::packetReceivedUpdateTimingStats() {
+void InboundAudioStream::packetReceivedUpdateTimingStats(int numPackets) {
     
     // update our timegap stats and desired jitter buffer frames if necessary
     // discard the first few packets we receive since they usually have gaps that aren't represensative of normal jitter
@@ -497,6 +566,7 @@ void InboundAudioStream::packetReceivedUpdateTimingStats() {
         // update all stats used for desired frames calculations under dynamic jitter buffer mode
         _timeGapStatsForDesiredCalcOnTooManyStarves.update(gap);
         _timeGapStatsForDesiredReduction.update(gap);
+        _jitterTarget.updateWithArrivalGap(gap, numPackets);
 
         if (_timeGapStatsForDesiredCalcOnTooManyStarves.getNewStatsAvailableFlag()) {
             _calculatedJitterBufferFrames = ceilf((float)_timeGapStatsForDesiredCalcOnTooManyStarves.getWindowMax()
@@ -505,17 +575,28 @@ void InboundAudioStream::packetReceivedUpdateTimingStats() {
         }
 
         if (_dynamicJitterBufferEnabled) {
-            // if the max gap in window B (_timeGapStatsForDesiredReduction) corresponds to a smaller number of frames than _desiredJitterBufferFrames,
+            // grow _desiredJitterBufferFrames as soon as the arrival delay percentile calls for it, rather than
+            // waiting for starves. popSamples stretches the buffered audio to reach it.
+            // if the arrival delay percentile corresponds to a smaller number of frames than _desiredJitterBufferFrames,
+            // and there was no starve in window B (_timeGapStatsForDesiredReduction),
             // then reduce _desiredJitterBufferFrames to that number of frames.
-            if (_timeGapStatsForDesiredReduction.getNewStatsAvailableFlag() && _timeGapStatsForDesiredReduction.isWindowFilled()) {
-                int calculatedJitterBufferFrames = ceilf((float)_timeGapStatsForDesiredReduction.getWindowMax()
-                                                         / (float)AudioConstants::NETWORK_FRAME_USECS);
-                if (calculatedJitterBufferFrames < _desiredJitterBufferFrames) {
-                    _desiredJitterBufferFrames = calculatedJitterBufferFrames;
-                    qCInfo(audiostream, "Set desired jitter frames to %d (reduced)", _desiredJitterBufferFrames);
-                }
+            bool canReduce = _timeGapStatsForDesiredReduction.getNewStatsAvailableFlag() &&
+                             _timeGapStatsForDesiredReduction.isWindowFilled();
+            bool starvedInWindow = false;
+            if (canReduce) {
+                const quint64* lastStarve = _starveHistory.getNewestEntry();
+                starvedInWindow = lastStarve &&
+                    (now - *lastStarve) < (quint64)WINDOW_SECONDS_FOR_DESIRED_REDUCTION * USECS_PER_SECOND;
                 _timeGapStatsForDesiredReduction.clearNewStatsAvailableFlag();
             }
+
+            int desiredJitterBufferFrames = _jitterTarget.updateDesiredFrames(_desiredJitterBufferFrames, canReduce,
+                                                                              starvedInWindow);
+            if (desiredJitterBufferFrames != _desiredJitterBufferFrames) {
+                qCInfo(audiostream, "Set desired jitter frames to %d (%s)", desiredJitterBufferFrames,
+                       desiredJitterBufferFrames > _desiredJitterBufferFrames ? "delay percentile" : "reduced");
+                _desiredJitterBufferFrames = desiredJitterBufferFrames;
+            }
         }
     }
 
@@ -21,6 +21,7 @@
 
 #include <plugins/CodecPlugin.h>
 
+#include "AdaptiveJitterTarget.h"
 #include "AudioRingBuffer.h"
 #include "MovingMinMaxAvg.h"
 #include "SequenceNumberStats.h"
@@ -80,6 +81,10 @@ public:
     int getStaticJitterBufferFrames() { return _staticJitterBufferFrames; }
     int getDesiredJitterBufferFrames() { return _desiredJitterBufferFrames; }
 
+    /// the arrival delay percentile tracker, and histograms of target vs. actual jitter buffer latency
+    const AdaptiveJitterTarget& getJitterTarget() const { return _jitterTarget; }
+    int getTimeScaledSamples() const { return _timeScaledSamples; }
+
     int getNumFrameSamples() const { return _ringBuffer.getNumFrameSamples(); }
     int getFrameCapacity() const { return _ringBuffer.getFrameCapacity(); }
     int getFramesAvailable() const { return _ringBuffer.framesAvailable(); }
@@ -115,7 +120,12 @@ public slots:
     void perSecondCallbackForUpdatingStats();
 
 private:
-    void packetReceivedUpdateTimingStats();
+    void packetReceivedUpdateTimingStats(int numPackets);
+
+    // smoothly compress or stretch the buffered audio towards _desiredJitterBufferFrames
+    void timeScaleTowardsDesired(int samplesToPop);
+    void compressSamples(int numSamples, int fadeSamples);
+    void stretchSamples(int numSamples, int fadeSamples);
 
     void popSamplesNoCheck(int samples);
     void framesAvailableChanged();
@@ -171,6 +181,10 @@ protected:
 
     RingBufferHistory<quint64> _starveHistory;
 
+    AdaptiveJitterTarget _jitterTarget;
+    int _lastPopSamples { 0 };
+    int _timeScaledSamples { 0 }; // net samples added (positive) or removed (negative) by time-scaling
+
     TimeWeightedAvg<int> _framesAvailableStat;
     MovingMinMaxAvg<float> _unplayedMs;
 
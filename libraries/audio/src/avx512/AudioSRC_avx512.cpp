@@ -0,0 +1,138 @@
+//
+//  AudioSRC_avx512.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX512F__
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "../AudioSRC.h"
+
+// high/low part of int64_t
+#define LO32(a)   ((uint32_t)(a))
+#define HI32(a)   ((int32_t)((a) >> 32))
+
+// pack two 8-wide vectors into the low and high halves of one 16-wide vector
+static inline __m512 mm512_set_m256(__m256 hi, __m256 lo) {
+    __m512d t = _mm512_castpd256_pd512(_mm256_castps_pd(lo));
+    return _mm512_castpd_ps(_mm512_insertf64x4(t, _mm256_castps_pd(hi), 1));
+}
+
+static inline __m256 mm512_extract_hi(__m512 a) {
+    return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a), 1));
+}
+
+// horizontal sum of each 8-wide half, returned as { sum(acc01.lo), sum(acc01.hi), sum(acc23.lo), sum(acc23.hi) }
+static inline __m128 hsum4(__m512 acc01, __m512 acc23) {
+    __m256 acc0 = _mm256_hadd_ps(_mm512_castps512_ps256(acc01), mm512_extract_hi(acc01));
+    __m256 acc2 = _mm256_hadd_ps(_mm512_castps512_ps256(acc23), mm512_extract_hi(acc23));
+    acc0 = _mm256_hadd_ps(acc0, acc2);
+    return _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+}
+
+// The filter length is only guaranteed to be a multiple of 8, so each 16-wide multiply-add covers
+// 8 taps of two channels at once, sharing the (interpolated) coefficients between both halves.
+int AudioSRC::multirateFilter4_AVX512(const float* input0, const float* input1, const float* input2, const float* input3,
+                                      float* output0, float* output1, float* output2, float* output3, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m512 acc01 = _mm512_setzero_ps();
+            __m512 acc23 = _mm512_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 8) {
+
+                //float coef = c0[j];
+                __m256 coef0 = _mm256_loadu_ps(&c0[j]);
+                __m512 coef = mm512_set_m256(coef0, coef0);
+
+                //acc += input[i + j] * coef;
+                __m512 x01 = mm512_set_m256(_mm256_loadu_ps(&input1[i + j]), _mm256_loadu_ps(&input0[i + j]));
+                __m512 x23 = mm512_set_m256(_mm256_loadu_ps(&input3[i + j]), _mm256_loadu_ps(&input2[i + j]));
+                acc01 = _mm512_fmadd_ps(x01, coef, acc01);
+                acc23 = _mm512_fmadd_ps(x23, coef, acc23);
+            }
+
+            __m128 t0 = hsum4(acc01, acc23);
+
+            _mm_store_ss(&output0[outputFrames], t0);
+            _mm_store_ss(&output1[outputFrames], _mm_shuffle_ps(t0, t0, _MM_SHUFFLE(0,0,0,1)));
+            _mm_store_ss(&output2[outputFrames], _mm_shuffle_ps(t0, t0, _MM_SHUFFLE(0,0,0,2)));
+            _mm_store_ss(&output3[outputFrames], _mm_shuffle_ps(t0, t0, _MM_SHUFFLE(0,0,0,3)));
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            float ftmp = (f & SRC_FRACMASK) * QFRAC_TO_FLOAT;
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m512 acc01 = _mm512_setzero_ps();
+            __m512 acc23 = _mm512_setzero_ps();
+            __m512 frac = _mm512_set1_ps(ftmp);
+
+            for (int j = 0; j < _numTaps; j += 8) {
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                __m256 coef0 = _mm256_loadu_ps(&c0[j]);
+                __m256 coef1 = _mm256_loadu_ps(&c1[j]);
+                __m512 coef = mm512_set_m256(coef0, coef0);
+                __m512 delta = mm512_set_m256(coef1, coef1);
+                delta = _mm512_sub_ps(delta, coef);
+                coef = _mm512_fmadd_ps(delta, frac, coef);
+
+                //acc += input[i + j] * coef;
+                __m512 x01 = mm512_set_m256(_mm256_loadu_ps(&input1[i + j]), _mm256_loadu_ps(&input0[i + j]));
+                __m512 x23 = mm512_set_m256(_mm256_loadu_ps(&input3[i + j]), _mm256_loadu_ps(&input2[i + j]));
+                acc01 = _mm512_fmadd_ps(x01, coef, acc01);
+                acc23 = _mm512_fmadd_ps(x23, coef, acc23);
+            }
+
+            __m128 t0 = hsum4(acc01, acc23);
+
+            _mm_store_ss(&output0[outputFrames], t0);
+            _mm_store_ss(&output1[outputFrames], _mm_shuffle_ps(t0, t0, _MM_SHUFFLE(0,0,0,1)));
+            _mm_store_ss(&output2[outputFrames], _mm_shuffle_ps(t0, t0, _MM_SHUFFLE(0,0,0,2)));
+            _mm_store_ss(&output3[outputFrames], _mm_shuffle_ps(t0, t0, _MM_SHUFFLE(0,0,0,3)));
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+    _mm256_zeroupper();
+
+    return outputFrames;
+}
+
+#endif
@@ -36,10 +36,12 @@
 
 #include "EntitiesRendererLogging.h"
 #include "RenderableEntityItem.h"
+#include "RenderableParticleEffectEntityItem.h"
 
 #include "RenderableWebEntityItem.h"
 
 #include <PointerManager.h>
+#include <TBBHelpers.h>
 
 std::function<bool()> EntityTreeRenderer::_entitiesShouldFadeFunction = []() { return true; };
 
@@ -259,6 +261,7 @@ void EntityTreeRenderer::clearDomainAndNonOwnedEntities() {
 
     _renderablesToUpdate = savedRenderables;
     _entitiesInScene = savedEntities;
+    _containmentIndex.clearDomainAndNonOwnedEntities();
 
     if (_layeredZones.clearDomainAndNonOwnedZones()) {
         applyLayeredZones();
@@ -302,6 +305,8 @@ void EntityTreeRenderer::clear() {
     }
     _entitiesInScene.clear();
     _renderablesToUpdate.clear();
+    _particleRenderers.clear();
+    _containmentIndex.clear();
 
     // reset the zone to the default (while we load the next scene)
     _layeredZones.clear();
@@ -393,6 +398,9 @@ void EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, r
             if (renderable) {
                 _entitiesInScene.insert({ entityID, renderable });
                 processedIds.insert(entityID);
+                if (entity->getType() == EntityTypes::ParticleEffect) {
+                    _particleRenderers.push_back(std::static_pointer_cast<render::entities::ParticleEffectEntityRenderer>(renderable));
+                }
             }
         }
 
@@ -413,6 +421,24 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
         changedEntities.swap(_changedEntities);
     });
 
+    if (!changedEntities.empty()) {
+        PerformanceTimer perfTimer("containmentIndex");
+        auto entityTree = std::static_pointer_cast<EntityTree>(_tree);
+        bool containmentChanged = false;
+        _tree->withReadLock([&] {
+            for (const auto& entityId : changedEntities) {
+                auto entity = entityTree->findEntityByEntityItemID(entityId);
+                if (entity) {
+                    containmentChanged = _containmentIndex.update(entity) || containmentChanged;
+                }
+            }
+        });
+        if (containmentChanged) {
+            // a zone or scripted entity near us moved or changed shape
+            forceRecheckEntities();
+        }
+    }
+
     {
         PROFILE_RANGE_EX(simulation_physics, "CopyRenderables", 0xffff00ff, (uint64_t)changedEntities.size());
         for (const auto& entityId : changedEntities) {
@@ -424,15 +450,14 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
         }
     }
 
+    _numRenderablesUpdated = 0;
     float expectedUpdateCost = _avgRenderableUpdateCost * _renderablesToUpdate.size();
     if (expectedUpdateCost < MAX_UPDATE_RENDERABLES_TIME_BUDGET) {
         // we expect to update all renderables within available time budget
         PROFILE_RANGE_EX(simulation_physics, "UpdateRenderables", 0xffff00ff, (uint64_t)_renderablesToUpdate.size());
         uint64_t updateStart = usecTimestampNow();
-        for (const auto& renderable : _renderablesToUpdate) {
-            assert(renderable); // only valid renderables are added to _renderablesToUpdate
-            renderable->updateInScene(scene, transaction);
-        }
+        std::vector<EntityRendererPointer> renderables(_renderablesToUpdate.begin(), _renderablesToUpdate.end());
+        updateRenderablesInScene(renderables, 0, renderables.size(), scene, transaction);
         size_t numRenderables = _renderablesToUpdate.size() + 1; // add one to avoid divide by zero
         _renderablesToUpdate.clear();
 
@@ -475,6 +500,11 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
 
             // compute remaining time budget
             const auto& sortedRenderablesVector = sortedRenderables.getSortedVector();
+            std::vector<EntityRendererPointer> renderables;
+            renderables.reserve(sortedRenderablesVector.size());
+            for (const auto& sortedRenderable : sortedRenderablesVector) {
+                renderables.push_back(sortedRenderable.getRenderer());
+            }
             uint64_t updateStart = usecTimestampNow();
             uint64_t sortCost = updateStart - sortStart;
             uint64_t timeBudget = MIN_SORTED_UPDATE_RENDERABLES_TIME_BUDGET;
@@ -483,25 +513,54 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
             }
             uint64_t expiry = updateStart + timeBudget;
 
-            // process the sorted renderables
-            for (const auto& sortedRenderable : sortedRenderablesVector) {
-                if (usecTimestampNow() > expiry) {
-                    break;
-                }
-                const auto& renderable = sortedRenderable.getRenderer();
-                renderable->updateInScene(scene, transaction);
-                _renderablesToUpdate.erase(renderable);
+            // process the sorted renderables in slices of about a quarter of the budget, checking the time between them
+            const size_t MIN_RENDERABLES_PER_SLICE = 32;
+            size_t numPerSlice = (size_t)((float)timeBudget / (4.0f * std::max(_avgRenderableUpdateCost, 1.0f)));
+            numPerSlice = std::max(numPerSlice, MIN_RENDERABLES_PER_SLICE);
+            size_t numUpdated = 0;
+            while (numUpdated < renderables.size() && usecTimestampNow() <= expiry) {
+                size_t end = std::min(numUpdated + numPerSlice, renderables.size());
+                updateRenderablesInScene(renderables, numUpdated, end, scene, transaction);
+                numUpdated = end;
+            }
+            for (size_t i = 0; i < numUpdated; ++i) {
+                _renderablesToUpdate.erase(renderables[i]);
             }
 
             // compute average per-renderable update cost
-            size_t numUpdated = sortedRenderables.size() - _renderablesToUpdate.size() + 1; // add one to avoid divide by zero
-            float cost = (float)(usecTimestampNow() - updateStart) / (float)(numUpdated);
+            float cost = (float)(usecTimestampNow() - updateStart) / (float)(numUpdated + 1); // add one to avoid divide by zero
             const float BLEND = 0.1f;
             _avgRenderableUpdateCost = (1.0f - BLEND) * _avgRenderableUpdateCost + BLEND * cost;
         }
     }
 }
 
+// Runs the part of updateInScene that doesn't touch the scene for the renderables in [begin, end) on the worker pool,
+// then commits the ones that need it to the transaction on this thread, in order, as a serial update would.
+void EntityTreeRenderer::updateRenderablesInScene(const std::vector<EntityRendererPointer>& renderables, size_t begin, size_t end,
+                                                  const render::ScenePointer& scene, render::Transaction& transaction) {
+    std::vector<uint8_t> needsCommit(end - begin, 0);
+    {
+        PROFILE_RANGE_EX(simulation_physics, "PrepareRenderables", 0xffff00ff, (uint64_t)(end - begin));
+        const size_t MIN_RENDERABLES_PER_TASK = 8;
+        tbb::parallel_for(tbb::blocked_range<size_t>(begin, end, MIN_RENDERABLES_PER_TASK), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                assert(renderables[i]); // only valid renderables are added to _renderablesToUpdate
+                needsCommit[i - begin] = renderables[i]->prepareUpdateInScene() ? 1 : 0;
+            }
+        });
+    }
+    {
+        PROFILE_RANGE_EX(simulation_physics, "CommitRenderables", 0xffff00ff, (uint64_t)(end - begin));
+        for (size_t i = begin; i < end; ++i) {
+            if (needsCommit[i - begin]) {
+                renderables[i]->commitUpdateInScene(scene, transaction);
+            }
+        }
+    }
+    _numRenderablesUpdated += (int)(end - begin);
+}
+
 void EntityTreeRenderer::preUpdate() {
     if (_tree && !_shuttingDown) {
         _tree->preUpdate();
@@ -531,6 +590,7 @@ void EntityTreeRenderer::update(bool simulate) {
                 updateChangedEntities(scene, transaction);
                 scene->enqueueTransaction(transaction);
             }
+            simulateParticles();
         }
         {
             PerformanceTimer perfTimer("workload::transaction");
@@ -566,60 +626,71 @@ void EntityTreeRenderer::update(bool simulate) {
     }
 }
 
+void EntityTreeRenderer::simulateParticles() {
+    PROFILE_RANGE_EX(simulation_physics, "SimulateParticles", 0xffff00ff, (uint64_t)_particleRenderers.size());
+    PerformanceTimer perfTimer("particles");
+
+    // drop the emitters that left the scene
+    std::vector<std::shared_ptr<render::entities::ParticleEffectEntityRenderer>> renderers;
+    renderers.reserve(_particleRenderers.size());
+    size_t numLive = 0;
+    for (size_t i = 0; i < _particleRenderers.size(); i++) {
+        if (auto renderer = _particleRenderers[i].lock()) {
+            renderers.push_back(renderer);
+            _particleRenderers[numLive++] = _particleRenderers[i];
+        }
+    }
+    _particleRenderers.resize(numLive);
+
+    // one emitter per task, they are independent of each other
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, renderers.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+            renderers[i]->simulate();
+        }
+    });
+}
+
 void EntityTreeRenderer::handleSpaceUpdate(std::pair<int32_t, glm::vec4> proxyUpdate) {
     std::unique_lock<std::mutex> lock(_spaceLock);
     _spaceUpdates.emplace_back(proxyUpdate.first, proxyUpdate.second);
 }
 
 void EntityTreeRenderer::findBestZoneAndMaybeContainingEntities(QSet<EntityItemID>& entitiesContainingAvatar) {
-    float radius = 0.01f; // for now, assume 0.01 meter radius, because we actually check the point inside later
-    QVector<QUuid> entityIDs;
-
-    // find the entities near us
     // don't let someone else change our tree while we search
     _tree->withReadLock([&] {
-        auto entityTree = std::static_pointer_cast<EntityTree>(_tree);
-
-        // FIXME - if EntityTree had a findEntitiesContainingPoint() this could theoretically be a little faster
-        entityTree->evalEntitiesInSphere(_avatarPosition, radius, PickFilter(), entityIDs);
+        {
+            PerformanceTimer perfTimer("containmentIndex");
+            _containmentIndex.updateMovingEntries();
+        }
 
         LayeredZones oldLayeredZones(_layeredZones);
         _layeredZones.clear();
 
-        // create a list of entities that actually contain the avatar's position
-        for (auto& entityID : entityIDs) {
-            auto entity = entityTree->findEntityByID(entityID);
-            if (!entity) {
-                continue;
-            }
-
+        // the index only holds zones and scripted entities, all other entities can be ignored
+        // because they can't have events fired on them, and only the ones near our cell
+        _containmentIndex.forEachCandidateContaining(_avatarPosition, [&](const EntityItemPointer& entity) {
             auto isZone = entity->getType() == EntityTypes::Zone;
             auto hasScript = !entity->getScript().isEmpty();
 
-            // only consider entities that are zones or have scripts, all other entities can
-            // be ignored because they can't have events fired on them.
             // FIXME - this could be optimized further by determining if the script is loaded
             // and if it has either an enterEntity or leaveEntity method
             //
             // also, don't flag a scripted entity as containing the avatar until the script is loaded,
             // so that the script is awake in time to receive the "entityEntity" call (even if the entity is a zone).
-            bool contains = false;
             bool scriptHasLoaded = hasScript && entity->isScriptPreloadFinished();
-            if (isZone || scriptHasLoaded) {
-                contains = entity->contains(_avatarPosition);
+            if (!(isZone || scriptHasLoaded) || !entity->contains(_avatarPosition)) {
+                return;
             }
 
-            if (contains) {
-                // if this entity is a zone and visible, add it to our layered zones
-                if (isZone && entity->getVisible() && renderableIdForEntity(entity) != render::Item::INVALID_ITEM_ID) {
-                    _layeredZones.emplace_back(std::dynamic_pointer_cast<ZoneEntityItem>(entity));
-                }
+            // if this entity is a zone and visible, add it to our layered zones
+            if (isZone && entity->getVisible() && renderableIdForEntity(entity) != render::Item::INVALID_ITEM_ID) {
+                _layeredZones.emplace_back(std::dynamic_pointer_cast<ZoneEntityItem>(entity));
+            }
 
-                if ((!hasScript && isZone) || scriptHasLoaded) {
-                    entitiesContainingAvatar << entity->getEntityItemID();
-                }
+            if ((!hasScript && isZone) || scriptHasLoaded) {
+                entitiesContainingAvatar << entity->getEntityItemID();
             }
-        }
+        });
 
         _layeredZones.sort();
         if (!_layeredZones.equals(oldLayeredZones)) {
@@ -993,6 +1064,7 @@ void EntityTreeRenderer::mouseMoveEvent(QMouseEvent* event) {
 void EntityTreeRenderer::deletingEntity(const EntityItemID& entityID) {
     // If it's in a pending queue, remove it
     _entitiesToAdd.erase(entityID);
+    _containmentIndex.remove(entityID);
 
     auto itr = _entitiesInScene.find(entityID);
     if (_entitiesInScene.end() == itr) {
@@ -1032,11 +1104,20 @@ void EntityTreeRenderer::addingEntity(const EntityItemID& entityID) {
     auto entity = std::static_pointer_cast<EntityTree>(_tree)->findEntityByID(entityID);
     if (entity) {
         _entitiesToAdd.insert({ entity->getEntityItemID(),  entity });
+        _tree->withReadLock([&] {
+            _containmentIndex.update(entity);
+        });
     }
 }
 
 void EntityTreeRenderer::entityScriptChanging(const EntityItemID& entityID, bool reload) {
     checkAndCallPreload(entityID, reload, true);
+    if (auto entity = getTree()->findEntityByEntityItemID(entityID)) {
+        // the script decides whether the entity can receive enter and leave events
+        _tree->withReadLock([&] {
+            _containmentIndex.update(entity);
+        });
+    }
     // Force "re-checking" entities so that the logic inside `checkEnterLeaveEntities()` is run.
     // This will ensure that the `enterEntity()` signal is emitted on clients whose avatars
     // are inside an entity when the script is reloaded.
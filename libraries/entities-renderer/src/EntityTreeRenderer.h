@@ -17,6 +17,7 @@
 #include <QtGui/QMouseEvent>
 
 #include <AudioInjectorManager.h>
+#include <EntityContainmentIndex.h>
 #include <EntityScriptingInterface.h> // for RayToEntityIntersectionResult
 #include <EntityTree.h>
 #include <PointerEvent.h>
@@ -37,6 +38,7 @@ namespace render { namespace entities {
     class EntityRenderer;
     using EntityRendererPointer = std::shared_ptr<EntityRenderer>;
     using EntityRendererWeakPointer = std::weak_ptr<EntityRenderer>;
+    class ParticleEffectEntityRenderer;
 
 } }
 
@@ -82,6 +84,9 @@ public:
     void preUpdate();
     void update(bool simulate);
 
+    // the number of renderables whose updateInScene ran in the last update
+    int getNumRenderablesUpdated() const { return _numRenderablesUpdated; }
+
     EntityTreePointer getTree() { return std::static_pointer_cast<EntityTree>(_tree); }
 
     void processEraseMessage(ReceivedMessage& message, const SharedNodePointer& sourceNode);
@@ -167,6 +172,9 @@ protected:
 private:
     void addPendingEntities(const render::ScenePointer& scene, render::Transaction& transaction);
     void updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction);
+    void updateRenderablesInScene(const std::vector<EntityRendererPointer>& renderables, size_t begin, size_t end,
+                                  const render::ScenePointer& scene, render::Transaction& transaction);
+    void simulateParticles();
     EntityRendererPointer renderableForEntity(const EntityItemPointer& entity) const { return renderableForEntityId(entity->getID()); }
     render::ItemID renderableIdForEntity(const EntityItemPointer& entity) const { return renderableIdForEntityId(entity->getID()); }
 
@@ -241,17 +249,21 @@ private:
     };
 
     LayeredZones _layeredZones;
+    EntityContainmentIndex _containmentIndex;
     uint64_t _lastZoneCheck { 0 };
     const uint64_t ZONE_CHECK_INTERVAL = USECS_PER_MSEC * 100; // ~10hz
     const float ZONE_CHECK_DISTANCE = 0.001f;
 
     float _avgRenderableUpdateCost { 0.0f };
+    int _numRenderablesUpdated { 0 };
 
     ReadWriteLockable _changedEntitiesGuard;
     std::unordered_set<EntityItemID> _changedEntities;
 
     std::unordered_set<EntityRendererPointer> _renderablesToUpdate;
     std::unordered_map<EntityItemID, EntityRendererPointer> _entitiesInScene;
+    // the particle emitters in the scene, which step on worker threads
+    std::vector<std::weak_ptr<render::entities::ParticleEffectEntityRenderer>> _particleRenderers;
     std::unordered_map<EntityItemID, EntityItemWeakPointer> _entitiesToAdd;
 
     // For Scene.shouldRenderEntities
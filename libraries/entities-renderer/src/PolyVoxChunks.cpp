@@ -0,0 +1,244 @@
+//
+//  PolyVoxChunks.cpp
+//  libraries/entities-renderer/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PolyVoxChunks.h"
+
+#include <TBBHelpers.h>
+
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning( disable : 4267 )
+#endif
+#include <PolyVoxCore/CubicSurfaceExtractorWithNormals.h>
+#include <PolyVoxCore/MarchingCubesSurfaceExtractor.h>
+#include <PolyVoxCore/Material.h>
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+
+const int PolyVoxChunks::CHUNK_SIZE = 16;
+
+static const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5f;
+
+// the voxels that a cell depends on reach this far from it, on each side: the normals of the marching cubes surface
+// are central differences, and a cubic hull depends on the voxels next to it
+static const int CELL_DEPENDENCY_RADIUS = 2;
+
+static PolyVox::Vector3DInt32 toPolyVox(const glm::ivec3& v) {
+    return PolyVox::Vector3DInt32(v.x, v.y, v.z);
+}
+
+static bool isMarchingCubes(PolyVoxChunks::SurfaceStyle surfaceStyle) {
+    return surfaceStyle == PolyVoxEntityItem::SURFACE_MARCHING_CUBES ||
+        surfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES;
+}
+
+void PolyVoxChunks::reset() {
+    _chunks.clear();
+    _numChunks = glm::ivec3(0);
+    _upperCorner = glm::ivec3(-1);
+    _numDirtyChunks = 0;
+}
+
+int PolyVoxChunks::getChunkIndex(const glm::ivec3& chunkCoords) const {
+    return (chunkCoords.z * _numChunks.y + chunkCoords.y) * _numChunks.x + chunkCoords.x;
+}
+
+void PolyVoxChunks::markVoxelDirty(const glm::ivec3& v) {
+    if (_chunks.empty()) {
+        // everything is extracted next time anyway
+        return;
+    }
+    glm::ivec3 low = glm::clamp((v - CELL_DEPENDENCY_RADIUS) / CHUNK_SIZE, glm::ivec3(0), _numChunks - 1);
+    glm::ivec3 high = glm::clamp((v + CELL_DEPENDENCY_RADIUS - 1) / CHUNK_SIZE, glm::ivec3(0), _numChunks - 1);
+    glm::ivec3 chunkCoords;
+    for (chunkCoords.z = low.z; chunkCoords.z <= high.z; chunkCoords.z++) {
+        for (chunkCoords.y = low.y; chunkCoords.y <= high.y; chunkCoords.y++) {
+            for (chunkCoords.x = low.x; chunkCoords.x <= high.x; chunkCoords.x++) {
+                Chunk& chunk = _chunks[getChunkIndex(chunkCoords)];
+                if (!chunk.dirty) {
+                    chunk.dirty = true;
+                    _numDirtyChunks++;
+                }
+            }
+        }
+    }
+}
+
+int PolyVoxChunks::extract(Volume& volume, SurfaceStyle surfaceStyle) {
+    // the volumes of polyvox entities always start at the origin
+    const PolyVox::Region& region = volume.getEnclosingRegion();
+    glm::ivec3 upperCorner(region.getUpperX(), region.getUpperY(), region.getUpperZ());
+    if (_chunks.empty() || upperCorner != _upperCorner || surfaceStyle != _surfaceStyle) {
+        _upperCorner = upperCorner;
+        _surfaceStyle = surfaceStyle;
+        _numChunks = glm::max((upperCorner + CHUNK_SIZE - 1) / CHUNK_SIZE, glm::ivec3(1));
+        _chunks.clear();
+        _chunks.resize(_numChunks.x * _numChunks.y * _numChunks.z);
+        _numDirtyChunks = (int)_chunks.size();
+    }
+
+    std::vector<int> dirtyChunks;
+    dirtyChunks.reserve(_numDirtyChunks);
+    for (int i = 0; i < (int)_chunks.size(); i++) {
+        if (_chunks[i].dirty) {
+            dirtyChunks.push_back(i);
+        }
+    }
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, dirtyChunks.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); i++) {
+            extractChunk(volume, dirtyChunks[i]);
+        }
+    });
+    _numDirtyChunks = 0;
+    return (int)dirtyChunks.size();
+}
+
+void PolyVoxChunks::extractChunk(Volume& volume, int index) {
+    glm::ivec3 chunkCoords(index % _numChunks.x, (index / _numChunks.x) % _numChunks.y, index / (_numChunks.x * _numChunks.y));
+    glm::ivec3 lower = chunkCoords * CHUNK_SIZE;
+    glm::ivec3 upper = glm::min(lower + CHUNK_SIZE, _upperCorner);
+
+    // the regions of neighboring chunks share their boundary voxels, as the extractors produce the cells between
+    // the corners of the region
+    PolyVox::Region region(toPolyVox(lower), toPolyVox(upper));
+    PolyVox::SurfaceMesh<Vertex> polyVoxMesh;
+    if (isMarchingCubes(_surfaceStyle)) {
+        PolyVox::MarchingCubesSurfaceExtractor<Volume> surfaceExtractor(&volume, region, &polyVoxMesh);
+        surfaceExtractor.execute();
+    } else {
+        PolyVox::CubicSurfaceExtractorWithNormals<Volume> surfaceExtractor(&volume, region, &polyVoxMesh);
+        surfaceExtractor.execute();
+    }
+
+    Chunk& chunk = _chunks[index];
+    // the extracted positions are relative to the lower corner of the region
+    PolyVox::Vector3DFloat offset((float)lower.x, (float)lower.y, (float)lower.z);
+    chunk.vertices = polyVoxMesh.getRawVertexData();
+    for (auto& vertex : chunk.vertices) {
+        vertex.setPosition(vertex.getPosition() + offset);
+    }
+    chunk.indices = polyVoxMesh.getIndices();
+
+    chunk.hulls.clear();
+    if (isMarchingCubes(_surfaceStyle)) {
+        computeMarchingCubesHulls(chunk);
+    } else {
+        computeCubicHulls(volume, lower, upper, chunk);
+    }
+    chunk.dirty = false;
+}
+
+void PolyVoxChunks::computeMarchingCubesHulls(Chunk& chunk) const {
+    // pull each triangle in the mesh into a polyhedron which can be collided with
+    chunk.hulls.reserve(chunk.indices.size() / 3);
+    for (size_t i = 0; i + 2 < chunk.indices.size(); i += 3) {
+        const auto& position0 = chunk.vertices[chunk.indices[i]].getPosition();
+        const auto& position1 = chunk.vertices[chunk.indices[i + 1]].getPosition();
+        const auto& position2 = chunk.vertices[chunk.indices[i + 2]].getPosition();
+        glm::vec3 p0(position0.getX(), position0.getY(), position0.getZ());
+        glm::vec3 p1(position1.getX(), position1.getY(), position1.getZ());
+        glm::vec3 p2(position2.getX(), position2.getY(), position2.getZ());
+
+        glm::vec3 av = (p0 + p1 + p2) / 3.0f; // center of the triangular face
+        glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+        glm::vec3 p3 = av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET;
+
+        chunk.hulls.push_back({ p0, p1, p2, p3 });
+    }
+}
+
+void PolyVoxChunks::computeCubicHulls(Volume& volume, const glm::ivec3& lower, const glm::ivec3& upper, Chunk& chunk) const {
+    // the voxels the user can set start one in from the lower corner when the volume is edged, and end one before the
+    // upper corner, in both cases
+    int edge = PolyVoxEntityItem::isEdged(_surfaceStyle) ? 1 : 0;
+    glm::ivec3 low = glm::max(lower, glm::ivec3(edge));
+    glm::ivec3 high = upper;
+
+    glm::ivec3 v;
+    for (v.z = low.z; v.z < high.z; v.z++) {
+        for (v.y = low.y; v.y < high.y; v.y++) {
+            for (v.x = low.x; v.x < high.x; v.x++) {
+                if (volume.getVoxelAt(v.x, v.y, v.z) == 0) {
+                    continue;
+                }
+                if (glm::all(glm::greaterThan(v, glm::ivec3(edge))) &&
+                    glm::all(glm::lessThan(v, _upperCorner - 1)) &&
+                    volume.getVoxelAt(v.x - 1, v.y, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y - 1, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y, v.z - 1) > 0 &&
+                    volume.getVoxelAt(v.x + 1, v.y, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y + 1, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y, v.z + 1) > 0) {
+                    // this voxel has neighbors in every cardinal direction, so there's no need
+                    // to include it in the collision hull.
+                    continue;
+                }
+
+                glm::vec3 l(glm::vec3(v) - 0.5f);
+                glm::vec3 h(glm::vec3(v) + 0.5f);
+                chunk.hulls.push_back({
+                    glm::vec3(l.x, l.y, l.z),
+                    glm::vec3(l.x, l.y, h.z),
+                    glm::vec3(l.x, h.y, l.z),
+                    glm::vec3(l.x, h.y, h.z),
+                    glm::vec3(h.x, l.y, l.z),
+                    glm::vec3(h.x, l.y, h.z),
+                    glm::vec3(h.x, h.y, l.z),
+                    glm::vec3(h.x, h.y, h.z)
+                });
+            }
+        }
+    }
+}
+
+void PolyVoxChunks::getMesh(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) const {
+    size_t numVertices = 0;
+    size_t numIndices = 0;
+    for (const auto& chunk : _chunks) {
+        numVertices += chunk.vertices.size();
+        numIndices += chunk.indices.size();
+    }
+    vertices.clear();
+    indices.clear();
+    vertices.reserve(numVertices);
+    indices.reserve(numIndices);
+
+    for (const auto& chunk : _chunks) {
+        uint32_t baseVertex = (uint32_t)vertices.size();
+        vertices.insert(vertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+        for (auto index : chunk.indices) {
+            indices.push_back(baseVertex + index);
+        }
+    }
+}
+
+void PolyVoxChunks::getCollisionHulls(const glm::mat4& voxelToLocal, ShapeInfo::PointCollection& hulls, AABox& box) const {
+    size_t numHulls = 0;
+    for (const auto& chunk : _chunks) {
+        numHulls += chunk.hulls.size();
+    }
+    hulls.clear();
+    hulls.reserve(numHulls);
+
+    for (const auto& chunk : _chunks) {
+        for (const auto& hull : chunk.hulls) {
+            ShapeInfo::PointList points;
+            points.reserve(hull.size());
+            for (const auto& point : hull) {
+                glm::vec3 localPoint = glm::vec3(voxelToLocal * glm::vec4(point, 1.0f));
+                box += localPoint;
+                points.push_back(localPoint);
+            }
+            hulls.push_back(std::move(points));
+        }
+    }
+}
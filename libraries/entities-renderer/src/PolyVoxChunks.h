@@ -0,0 +1,86 @@
+//
+//  PolyVoxChunks.h
+//  libraries/entities-renderer/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PolyVoxChunks_h
+#define hifi_PolyVoxChunks_h
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning( disable : 4267 )
+#endif
+#include <PolyVoxCore/SimpleVolume.h>
+#include <PolyVoxCore/SurfaceMesh.h>
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+
+#include <AABox.h>
+#include <ShapeInfo.h>
+#include <PolyVoxEntityItem.h>
+
+// The surface and collision hulls of a polyvox volume, extracted a chunk of CHUNK_SIZE^3 cells at a time so that an
+//   edit only re-extracts the chunks whose cells it touches.  The dirty chunks are extracted in parallel.
+//   Everything is kept in volume coordinates; the mesh and hulls of the whole volume are stitched together from the
+//   chunks on request, so that the caller can build the next mesh and shape while the current ones are still in use.
+//   Not thread safe: mark under the entity's write lock and extract or read under its read lock, one at a time.
+class PolyVoxChunks {
+public:
+    using Volume = PolyVox::SimpleVolume<uint8_t>;
+    using Vertex = PolyVox::PositionMaterialNormal;
+    using SurfaceStyle = PolyVoxEntityItem::PolyVoxSurfaceStyle;
+
+    // in cells per axis
+    static const int CHUNK_SIZE;
+
+    // Drops all the chunks, so that the next extraction rebuilds them all
+    void reset();
+
+    // Marks the chunks whose surface or hulls depend on the voxel at v, in volume coordinates
+    void markVoxelDirty(const glm::ivec3& v);
+    bool hasDirtyChunks() const { return _chunks.empty() || _numDirtyChunks > 0; }
+
+    // Re-extracts the dirty chunks, and all of them if the size of the volume or the surface style changed.
+    // Returns the number of chunks extracted.
+    int extract(Volume& volume, SurfaceStyle surfaceStyle);
+
+    // The surface of all the chunks, as one indexed triangle list
+    void getMesh(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) const;
+
+    // The collision hulls of all the chunks, transformed by voxelToLocal, and their bounds
+    void getCollisionHulls(const glm::mat4& voxelToLocal, ShapeInfo::PointCollection& hulls, AABox& box) const;
+
+    int getNumChunks() const { return (int)_chunks.size(); }
+    int getNumDirtyChunks() const { return _numDirtyChunks; }
+
+private:
+    struct Chunk {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        ShapeInfo::PointCollection hulls;
+        bool dirty { true };
+    };
+
+    int getChunkIndex(const glm::ivec3& chunkCoords) const;
+    void extractChunk(Volume& volume, int index);
+    void computeMarchingCubesHulls(Chunk& chunk) const;
+    void computeCubicHulls(Volume& volume, const glm::ivec3& lower, const glm::ivec3& upper, Chunk& chunk) const;
+
+    std::vector<Chunk> _chunks;
+    glm::ivec3 _numChunks { 0 };
+    glm::ivec3 _upperCorner { -1 };
+    SurfaceStyle _surfaceStyle { PolyVoxEntityItem::SURFACE_MARCHING_CUBES };
+    int _numDirtyChunks { 0 };
+};
+
+#endif // hifi_PolyVoxChunks_h
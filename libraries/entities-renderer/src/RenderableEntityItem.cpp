@@ -320,17 +320,29 @@ void EntityRenderer::removeFromScene(const ScenePointer& scene, Transaction& tra
 }
 
 void EntityRenderer::updateInScene(const ScenePointer& scene, Transaction& transaction) {
+    if (prepareUpdateInScene()) {
+        commitUpdateInScene(scene, transaction);
+    }
+}
+
+bool EntityRenderer::prepareUpdateInScene() {
     DETAILED_PROFILE_RANGE(simulation_physics, __FUNCTION__);
     if (!isValidRenderItem()) {
-        return;
+        return false;
     }
     _updateTime = usecTimestampNow();
 
     // FIXME is this excessive?
     if (!needsRenderUpdate()) {
-        return;
+        return false;
     }
 
+    doRenderUpdateConcurrent(_entity);
+    return true;
+}
+
+void EntityRenderer::commitUpdateInScene(const ScenePointer& scene, Transaction& transaction) {
+    DETAILED_PROFILE_RANGE(simulation_physics, __FUNCTION__);
     doRenderUpdateSynchronous(scene, transaction, _entity);
     transaction.updateItem<PayloadProxyInterface>(_renderItemID, [this](PayloadProxyInterface& self) {
         if (!isValidRenderItem()) {
@@ -402,12 +414,13 @@ void EntityRenderer::updateModelTransformAndBound() {
     }
 }
 
-void EntityRenderer::doRenderUpdateSynchronous(const ScenePointer& scene, Transaction& transaction, const EntityItemPointer& entity) {
+void EntityRenderer::doRenderUpdateConcurrent(const EntityItemPointer& entity) {
     DETAILED_PROFILE_RANGE(simulation_physics, __FUNCTION__);
     withWriteLock([&] {
         auto transparent = isTransparent();
         auto fading = isFading();
         if (fading || _prevIsTransparent != transparent || !entity->isVisuallyReady()) {
+            // the connection is queued, so this is safe from any thread
             emit requestRenderUpdate();
         }
         if (fading) {
@@ -420,12 +433,19 @@ void EntityRenderer::doRenderUpdateSynchronous(const ScenePointer& scene, Transa
 
         _moving = entity->isMovingRelativeToParent();
         _visible = entity->getVisible();
+        _canCastShadow = entity->getCanCastShadow();
+        _cauterized = entity->getCauterized();
+    });
+}
+
+void EntityRenderer::doRenderUpdateSynchronous(const ScenePointer& scene, Transaction& transaction, const EntityItemPointer& entity) {
+    DETAILED_PROFILE_RANGE(simulation_physics, __FUNCTION__);
+    withWriteLock([&] {
+        // subclasses override these to update their render items
         setIsVisibleInSecondaryCamera(entity->isVisibleInSecondaryCamera());
         setRenderLayer(entity->getRenderLayer());
         setPrimitiveMode(entity->getPrimitiveMode());
-        _canCastShadow = entity->getCanCastShadow();
         setCullWithParent(entity->getCullWithParent());
-        _cauterized = entity->getCauterized();
         entity->setNeedsRenderUpdate(false);
     });
 }
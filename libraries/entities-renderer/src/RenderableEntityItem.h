@@ -50,6 +50,10 @@ public:
     // Handlers for rendering events... executed on the main thread, only called by EntityTreeRenderer, 
     // cannot be overridden or accessed by subclasses
     virtual void updateInScene(const ScenePointer& scene, Transaction& transaction) final;
+    // updateInScene in two parts: prepareUpdateInScene may run on a worker thread, concurrently with other renderers,
+    // and returns true if commitUpdateInScene must then be called on the main thread
+    virtual bool prepareUpdateInScene() final;
+    virtual void commitUpdateInScene(const ScenePointer& scene, Transaction& transaction) final;
     virtual bool addToScene(const ScenePointer& scene, Transaction& transaction) final;
     virtual void removeFromScene(const ScenePointer& scene, Transaction& transaction);
 
@@ -87,6 +91,10 @@ protected:
     // Returns true if the item in question needs to have updateInScene called because of changes in the entity
     virtual bool needsRenderUpdateFromEntity(const EntityItemPointer& entity) const;
 
+    // Will be called from prepareUpdateInScene, on any thread, before doRenderUpdateSynchronous.  This can be used
+    // to copy state from the entity, but not to touch the scene, resource caches or another renderer
+    virtual void doRenderUpdateConcurrent(const EntityItemPointer& entity);
+
     // Will be called on the main thread from updateInScene.  This can be used to fetch things like 
     // network textures or model geometry from resource caches
     virtual void doRenderUpdateSynchronous(const ScenePointer& scene, Transaction& transaction, const EntityItemPointer& entity);
@@ -184,6 +192,11 @@ protected:
         return needsRenderUpdateFromTypedEntity(_typedEntity);
     }
 
+    virtual void doRenderUpdateConcurrent(const EntityItemPointer& entity) override final {
+        Parent::doRenderUpdateConcurrent(entity);
+        doRenderUpdateConcurrentTyped(_typedEntity);
+    }
+
     virtual void doRenderUpdateSynchronous(const ScenePointer& scene, Transaction& transaction, const EntityItemPointer& entity) override final {
         Parent::doRenderUpdateSynchronous(scene, transaction, entity);
         doRenderUpdateSynchronousTyped(scene, transaction, _typedEntity);
@@ -195,6 +208,7 @@ protected:
     }
 
     virtual bool needsRenderUpdateFromTypedEntity(const TypedEntityPointer& entity) const { return false; }
+    virtual void doRenderUpdateConcurrentTyped(const TypedEntityPointer& entity) { }
     virtual void doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) { }
     virtual void doRenderUpdateAsynchronousTyped(const TypedEntityPointer& entity) { }
     virtual void onAddToSceneTyped(const TypedEntityPointer& entity) { }
@@ -40,13 +40,10 @@ static ShapePipelinePointer shapePipelineFactory(const ShapePlumber& plumber, co
     return std::make_shared<render::ShapePipeline>(texturedPipeline, nullptr, nullptr, nullptr);
 }
 
-struct GpuParticle {
-    GpuParticle(const glm::vec3& xyzIn, const glm::vec2& uvIn) : xyz(xyzIn), uv(uvIn) {}
-    glm::vec3 xyz; // Position
-    glm::vec2 uv; // Lifetime + seed
-};
+using GpuParticle = particle::Emitter::Vertex;
 
-using GpuParticles = std::vector<GpuParticle>;
+// emitters not rendered for this long stop simulating until they are rendered again
+static const uint64_t MAX_SIMULATION_AGE_USECS = USECS_PER_SECOND / 10;
 
 ParticleEffectEntityRenderer::ParticleEffectEntityRenderer(const EntityItemPointer& entity) : Parent(entity) {
     ParticleUniforms uniforms;
@@ -64,26 +61,31 @@ ParticleEffectEntityRenderer::ParticleEffectEntityRenderer(const EntityItemPoint
     });
 }
 
-void ParticleEffectEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) {
+void ParticleEffectEntityRenderer::doRenderUpdateConcurrentTyped(const TypedEntityPointer& entity) {
     auto newParticleProperties = entity->getParticleProperties();
     if (!newParticleProperties.valid()) {
         qCWarning(entitiesrenderer) << "Bad particle properties";
     }
 
     if (resultWithReadLock<bool>([&] { return _particleProperties != newParticleProperties; })) {
-        _timeUntilNextEmit = 0;
+        {
+            std::lock_guard<std::mutex> lock(_simulationMutex);
+            _emitter.resetEmitTimer();
+        }
         withWriteLock([&] {
             _particleProperties = newParticleProperties;
-            if (!_prevEmitterShouldTrailInitialized) {
-                _prevEmitterShouldTrailInitialized = true;
-                _prevEmitterShouldTrail = _particleProperties.emission.shouldTrail;
-            }
         });
     }
 
     withWriteLock([&] {
         _pulseProperties = entity->getPulseProperties();
         _shapeType = entity->getShapeType();
+    });
+    _emitting = entity->getIsEmitting();
+}
+
+void ParticleEffectEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) {
+    withWriteLock([&] {
         QString compoundShapeURL = entity->getCompoundShapeURL();
         if (_compoundShapeURL != compoundShapeURL) {
             _compoundShapeURL = compoundShapeURL;
@@ -91,7 +93,6 @@ void ParticleEffectEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePoi
             fetchGeometryResource();
         }
     });
-    _emitting = entity->getIsEmitting();
 
     bool textureEmpty = resultWithReadLock<bool>([&] { return _particleProperties.textures.isEmpty(); });
     if (textureEmpty) {
@@ -176,201 +177,13 @@ Item::Bound ParticleEffectEntityRenderer::getBound() {
     return _bound;
 }
 
-// FIXME: these methods assume uniform emitDimensions, need to importance sample based on dimensions
-float importanceSample2DDimension(float startDim) {
-    float dimension = 1.0f;
-    if (startDim < 1.0f) {
-        float innerDimensionSquared = startDim * startDim;
-        float outerDimensionSquared = 1.0f;  // pow(particle::MAXIMUM_EMIT_RADIUS_START, 2);
-        float randDimensionSquared = randFloatInRange(innerDimensionSquared, outerDimensionSquared);
-        dimension = std::sqrt(randDimensionSquared);
-    }
-    return dimension;
-}
-
-float importanceSample3DDimension(float startDim) {
-    float dimension = 1.0f;
-    if (startDim < 1.0f) {
-        float innerDimensionCubed = startDim * startDim * startDim;
-        float outerDimensionCubed = 1.0f;  // pow(particle::MAXIMUM_EMIT_RADIUS_START, 3);
-        float randDimensionCubed = randFloatInRange(innerDimensionCubed, outerDimensionCubed);
-        dimension = std::cbrt(randDimensionCubed);
-    }
-    return dimension;
-}
-
-ParticleEffectEntityRenderer::CpuParticle ParticleEffectEntityRenderer::createParticle(uint64_t now, const Transform& baseTransform, const particle::Properties& particleProperties,
-                                                                                       const ShapeType& shapeType, const ModelResource::Pointer& geometryResource,
-                                                                                       const TriangleInfo& triangleInfo) {
-    CpuParticle particle;
-
-    const auto& accelerationSpread = particleProperties.emission.acceleration.spread;
-    const auto& azimuthStart = particleProperties.azimuth.start;
-    const auto& azimuthFinish = particleProperties.azimuth.finish;
-    const auto& emitDimensions = particleProperties.emission.dimensions;
-    const auto& emitAcceleration = particleProperties.emission.acceleration.target;
-    auto emitOrientation = baseTransform.getRotation() * particleProperties.emission.orientation;
-    const auto& emitRadiusStart = glm::max(particleProperties.radiusStart, EPSILON); // Avoid math complications at center
-    const auto& emitSpeed = particleProperties.emission.speed.target;
-    const auto& speedSpread = particleProperties.emission.speed.spread;
-    const auto& polarStart = particleProperties.polar.start;
-    const auto& polarFinish = particleProperties.polar.finish;
-
-    particle.seed = randFloatInRange(-1.0f, 1.0f);
-    particle.expiration = now + (uint64_t)(particleProperties.lifespan * USECS_PER_SECOND);
-
-    particle.relativePosition = glm::vec3(0.0f);
-    particle.basePosition = baseTransform.getTranslation();
-
-    // Position, velocity, and acceleration
-    glm::vec3 emitDirection;
-    if (polarStart == 0.0f && polarFinish == 0.0f && emitDimensions.z == 0.0f) {
-        // Emit along z-axis from position
-        emitDirection = Vectors::UNIT_Z;
-    } else {
-        // Emit around point or from ellipsoid
-        // - Distribute directions evenly around point
-        // - Distribute points relatively evenly over ellipsoid surface
-        // - Distribute points relatively evenly within ellipsoid volume
-
-        float elevationMinZ = sinf(PI_OVER_TWO - polarFinish);
-        float elevationMaxZ = sinf(PI_OVER_TWO - polarStart);
-        float elevation = asinf(elevationMinZ + (elevationMaxZ - elevationMinZ) * randFloat());
-
-        float azimuth;
-        if (azimuthFinish >= azimuthStart) {
-            azimuth = azimuthStart + (azimuthFinish - azimuthStart) * randFloat();
-        } else {
-            azimuth = azimuthStart + (TWO_PI + azimuthFinish - azimuthStart) * randFloat();
-        }
-        // TODO: azimuth and elevation are only used for ellipsoids/circles, but could be used for other shapes too
-
-        if (emitDimensions == Vectors::ZERO) {
-            // Point
-            emitDirection = glm::quat(glm::vec3(PI_OVER_TWO - elevation, 0.0f, azimuth)) * Vectors::UNIT_Z;
-        } else {
-            glm::vec3 emitPosition;
-            switch (shapeType) {
-                case SHAPE_TYPE_BOX: {
-                    glm::vec3 dim = importanceSample3DDimension(emitRadiusStart) * 0.5f * emitDimensions;
-
-                    int side = randIntInRange(0, 5);
-                    int axis = side % 3;
-                    float direction = side > 2 ? 1.0f : -1.0f;
-
-                    emitDirection[axis] = direction;
-                    emitPosition[axis] = direction * dim[axis];
-                    axis = (axis + 1) % 3;
-                    emitPosition[axis] = dim[axis] * randFloatInRange(-1.0f, 1.0f);
-                    axis = (axis + 1) % 3;
-                    emitPosition[axis] = dim[axis] * randFloatInRange(-1.0f, 1.0f);
-                    break;
-                }
-
-                case SHAPE_TYPE_CYLINDER_X:
-                case SHAPE_TYPE_CYLINDER_Y:
-                case SHAPE_TYPE_CYLINDER_Z: {
-                    glm::vec3 radii = importanceSample2DDimension(emitRadiusStart) * 0.5f * emitDimensions;
-                    int axis = shapeType - SHAPE_TYPE_CYLINDER_X;
-
-                    emitPosition[axis] = emitDimensions[axis] * randFloatInRange(-0.5f, 0.5f);
-                    emitDirection[axis] = 0.0f;
-                    axis = (axis + 1) % 3;
-                    emitPosition[axis] = radii[axis] * glm::cos(azimuth);
-                    emitDirection[axis] = radii[axis] > 0.0f ? emitPosition[axis] / (radii[axis] * radii[axis]) : 0.0f;
-                    axis = (axis + 1) % 3;
-                    emitPosition[axis] = radii[axis] * glm::sin(azimuth);
-                    emitDirection[axis] = radii[axis] > 0.0f ? emitPosition[axis] / (radii[axis] * radii[axis]) : 0.0f;
-                    emitDirection = glm::normalize(emitDirection);
-                    break;
-                }
-
-                case SHAPE_TYPE_CIRCLE: {
-                    glm::vec2 radii = importanceSample2DDimension(emitRadiusStart) * 0.5f * glm::vec2(emitDimensions.x, emitDimensions.z);
-                    float x = radii.x * glm::cos(azimuth);
-                    float z = radii.y * glm::sin(azimuth);
-                    emitPosition = glm::vec3(x, 0.0f, z);
-                    emitDirection = Vectors::UP;
-                    break;
-                }
-                case SHAPE_TYPE_PLANE: {
-                    glm::vec2 dim = importanceSample2DDimension(emitRadiusStart) * 0.5f * glm::vec2(emitDimensions.x, emitDimensions.z);
-
-                    int side = randIntInRange(0, 3);
-                    int axis = side % 2;
-                    float direction = side > 1 ? 1.0f : -1.0f;
-
-                    glm::vec2 pos;
-                    pos[axis] = direction * dim[axis];
-                    axis = (axis + 1) % 2;
-                    pos[axis] = dim[axis] * randFloatInRange(-1.0f, 1.0f);
-
-                    emitPosition = glm::vec3(pos.x, 0.0f, pos.y);
-                    emitDirection = Vectors::UP;
-                    break;
-                }
-
-                case SHAPE_TYPE_COMPOUND: {
-                    // if we get here we know that geometryResource is loaded
-
-                    size_t index = randFloat() * triangleInfo.totalSamples;
-                    Triangle triangle;
-                    for (size_t i = 0; i < triangleInfo.samplesPerTriangle.size(); i++) {
-                        size_t numSamples = triangleInfo.samplesPerTriangle[i];
-                        if (index < numSamples) {
-                            triangle = triangleInfo.triangles[i];
-                            break;
-                        }
-                        index -= numSamples;
-                    }
-
-                    float edgeLength1 = glm::length(triangle.v1 - triangle.v0);
-                    float edgeLength2 = glm::length(triangle.v2 - triangle.v1);
-                    float edgeLength3 = glm::length(triangle.v0 - triangle.v2);
-
-                    float perimeter = edgeLength1 + edgeLength2 + edgeLength3;
-                    float fraction1 = randFloatInRange(0.0f, 1.0f);
-                    float fractionEdge1 = glm::min(fraction1 * perimeter / edgeLength1, 1.0f);
-                    float fraction2 = fraction1 - edgeLength1 / perimeter;
-                    float fractionEdge2 = glm::clamp(fraction2 * perimeter / edgeLength2, 0.0f, 1.0f);
-                    float fraction3 = fraction2 - edgeLength2 / perimeter;
-                    float fractionEdge3 = glm::clamp(fraction3 * perimeter / edgeLength3, 0.0f, 1.0f);
-
-                    float dim = importanceSample2DDimension(emitRadiusStart);
-                    triangle = triangle * (glm::scale(emitDimensions) * triangleInfo.transform);
-                    glm::vec3 center = (triangle.v0 + triangle.v1 + triangle.v2) / 3.0f;
-                    glm::vec3 v0 = (dim * (triangle.v0 - center)) + center;
-                    glm::vec3 v1 = (dim * (triangle.v1 - center)) + center;
-                    glm::vec3 v2 = (dim * (triangle.v2 - center)) + center;
-
-                    emitPosition = glm::mix(v0, glm::mix(v1, glm::mix(v2, v0, fractionEdge3), fractionEdge2), fractionEdge1);
-                    emitDirection = triangle.getNormal();
-                    break;
-                }
-
-                case SHAPE_TYPE_SPHERE:
-                case SHAPE_TYPE_ELLIPSOID:
-                default: {
-                    glm::vec3 radii = importanceSample3DDimension(emitRadiusStart) * 0.5f * emitDimensions;
-                    float x = radii.x * glm::cos(elevation) * glm::cos(azimuth);
-                    float y = radii.y * glm::cos(elevation) * glm::sin(azimuth);
-                    float z = radii.z * glm::sin(elevation);
-                    emitPosition = glm::vec3(x, y, z);
-                    emitDirection = glm::normalize(glm::vec3(radii.x > 0.0f ? x / (radii.x * radii.x) : 0.0f,
-                                                             radii.y > 0.0f ? y / (radii.y * radii.y) : 0.0f,
-                                                             radii.z > 0.0f ? z / (radii.z * radii.z) : 0.0f));
-                    break;
-                }
-            }
-
-            particle.relativePosition += emitOrientation * emitPosition;
-        }
+void ParticleEffectEntityRenderer::simulate() {
+    if (usecTimestampNow() - _lastRendered > MAX_SIMULATION_AGE_USECS) {
+        return;
     }
-    particle.velocity = (emitSpeed + randFloatInRange(-1.0f, 1.0f) * speedSpread) * (emitOrientation * emitDirection);
-    particle.acceleration = emitAcceleration +
-        glm::vec3(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f)) * accelerationSpread;
-
-    return particle;
+    std::lock_guard<std::mutex> lock(_simulationMutex);
+    stepSimulation();
+    _simulatedSinceRender = true;
 }
 
 void ParticleEffectEntityRenderer::stepSimulation() {
@@ -392,62 +205,17 @@ void ParticleEffectEntityRenderer::stepSimulation() {
         geometryResource = _geometryResource;
     });
 
-    const auto& modelTransform = getModelTransform();
-    if (_emitting && particleProperties.emitting() &&
-        (shapeType != SHAPE_TYPE_COMPOUND || (geometryResource && geometryResource->isLoaded()))) {
-        uint64_t emitInterval = particleProperties.emitIntervalUsecs();
-        if (emitInterval > 0 && interval >= _timeUntilNextEmit) {
-            auto timeRemaining = interval;
-            while (timeRemaining > _timeUntilNextEmit) {
-                if (_shapeType == SHAPE_TYPE_COMPOUND && !_hasComputedTriangles) {
-                    computeTriangles(geometryResource->getHFMModel());
-                }
-                // emit particle
-                _cpuParticles.push_back(createParticle(now, modelTransform, particleProperties, shapeType, geometryResource, _triangleInfo));
-                _timeUntilNextEmit = emitInterval;
-                if (emitInterval < timeRemaining) {
-                    timeRemaining -= emitInterval;
-                }
-            }
-        } else {
-            _timeUntilNextEmit -= interval;
-        }
+    bool canEmit = shapeType != SHAPE_TYPE_COMPOUND || (geometryResource && geometryResource->isLoaded());
+    if (_emitting && canEmit && shapeType == SHAPE_TYPE_COMPOUND && !_hasComputedTriangles) {
+        computeTriangles(geometryResource->getHFMModel());
     }
 
-    // Kill any particles that have expired or are over the max size
-    while (_cpuParticles.size() > particleProperties.maxParticles || (!_cpuParticles.empty() && _cpuParticles.front().expiration <= now)) {
-        _cpuParticles.pop_front();
-    }
-
-    const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
-    // update the particles
-    for (auto& particle : _cpuParticles) {
-        if (_prevEmitterShouldTrail != particleProperties.emission.shouldTrail) {
-            if (_prevEmitterShouldTrail) {
-                particle.relativePosition = particle.relativePosition + particle.basePosition - modelTransform.getTranslation();
-            }
-            particle.basePosition = modelTransform.getTranslation();
-        }
-        particle.integrate(deltaTime);
-    }
-    _prevEmitterShouldTrail = particleProperties.emission.shouldTrail;
+    const auto& modelTransform = getModelTransform();
+    _emitter.step(now, interval, _emitting && canEmit, particleProperties, modelTransform, shapeType, _triangleInfo);
 
     // Build particle primitives
-    static GpuParticles gpuParticles;
-    gpuParticles.clear();
-    gpuParticles.reserve(_cpuParticles.size()); // Reserve space
-    std::transform(_cpuParticles.begin(), _cpuParticles.end(), std::back_inserter(gpuParticles), [&particleProperties, &modelTransform] (const CpuParticle& particle) {
-        glm::vec3 position = particle.relativePosition + (particleProperties.emission.shouldTrail ? particle.basePosition : modelTransform.getTranslation());
-        return GpuParticle(position, glm::vec2(particle.lifetime, particle.seed));
-    });
-
-    // Update particle buffer
-    auto& particleBuffer = _particleBuffer;
-    size_t numBytes = sizeof(GpuParticle) * gpuParticles.size();
-    particleBuffer->resize(numBytes);
-    if (numBytes != 0) {
-        particleBuffer->setData(numBytes, (const gpu::Byte*)gpuParticles.data());
-    }
+    _emitter.getVertices(_vertices, modelTransform.getTranslation(), particleProperties.emission.shouldTrail);
+    _verticesChanged = true;
 }
 
 void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
@@ -455,8 +223,25 @@ void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
         return;
     }
 
-    // FIXME migrate simulation to a compute stage
-    stepSimulation();
+    _lastRendered = usecTimestampNow();
+    {
+        // FIXME migrate simulation to a compute stage
+        std::lock_guard<std::mutex> lock(_simulationMutex);
+        if (!_simulatedSinceRender) {
+            stepSimulation();
+        }
+        _simulatedSinceRender = false;
+
+        // Update particle buffer
+        if (_verticesChanged) {
+            _verticesChanged = false;
+            size_t numBytes = sizeof(GpuParticle) * _vertices.size();
+            _particleBuffer->resize(numBytes);
+            if (numBytes != 0) {
+                _particleBuffer->setData(numBytes, (const gpu::Byte*)_vertices.data());
+            }
+        }
+    }
 
     gpu::Batch& batch = *args->_batch;
     batch.setResourceTexture(0, _networkTexture->getGPUTexture());
@@ -13,6 +13,7 @@
 
 #include "RenderableEntityItem.h"
 #include <ParticleEffectEntityItem.h>
+#include <ParticleEmitter.h>
 #include <TextureCache.h>
 
 namespace render { namespace entities {
@@ -24,7 +25,11 @@ class ParticleEffectEntityRenderer : public TypedEntityRenderer<ParticleEffectEn
 public:
     ParticleEffectEntityRenderer(const EntityItemPointer& entity);
 
+    // Steps the particles of an emitter that was rendered recently, called for all emitters at once on worker threads
+    void simulate();
+
 protected:
+    virtual void doRenderUpdateConcurrentTyped(const TypedEntityPointer& entity) override;
     virtual void doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) override;
     virtual void doRenderUpdateAsynchronousTyped(const TypedEntityPointer& entity) override;
 
@@ -41,27 +46,6 @@ private:
     using Buffer = gpu::Buffer;
     using BufferView = gpu::BufferView;
 
-    // CPU particles
-    // FIXME either switch to GPU compute particles or switch to simd updating of the particles
-    struct CpuParticle {
-        float seed { 0.0f };
-        uint64_t expiration { 0 };
-        float lifetime { 0.0f };
-        glm::vec3 basePosition;
-        glm::vec3 relativePosition;
-        glm::vec3 velocity;
-        glm::vec3 acceleration;
-
-        void integrate(float deltaTime) {
-            glm::vec3 atSquared = (0.5f * deltaTime * deltaTime) * acceleration;
-            relativePosition += velocity * deltaTime + atSquared;
-            velocity += acceleration * deltaTime;
-            lifetime += deltaTime;
-        }
-    };
-    using CpuParticles = std::deque<CpuParticle>;
-
-
     template<typename T>
     struct InterpolationData {
         T start;
@@ -81,27 +65,24 @@ private:
 
     void computeTriangles(const hfm::Model& hfmModel);
     bool _hasComputedTriangles{ false };
-    struct TriangleInfo {
-        std::vector<Triangle> triangles;
-        std::vector<size_t> samplesPerTriangle;
-        size_t totalSamples;
-        glm::mat4 transform;
-    } _triangleInfo;
-
-    static CpuParticle createParticle(uint64_t now, const Transform& baseTransform, const particle::Properties& particleProperties,
-                                      const ShapeType& shapeType, const ModelResource::Pointer& geometryResource,
-                                      const TriangleInfo& triangleInfo);
+    particle::Emitter::TriangleInfo _triangleInfo;
+
+    // with _simulationMutex locked
     void stepSimulation();
 
     particle::Properties _particleProperties;
-    bool _prevEmitterShouldTrail;
-    bool _prevEmitterShouldTrailInitialized { false };
-    CpuParticles _cpuParticles;
     bool _emitting { false };
-    uint64_t _timeUntilNextEmit { 0 };
     BufferPointer _particleBuffer { std::make_shared<Buffer>() };
     BufferView _uniformBuffer;
+
+    // The CPU particles, stepped by simulate() or else by doRender(), and the vertices they last produced
+    std::mutex _simulationMutex;
+    particle::Emitter _emitter;
+    particle::Emitter::Vertices _vertices;
+    bool _verticesChanged { false };
+    bool _simulatedSinceRender { false };
     quint64 _lastSimulated { 0 };
+    std::atomic<quint64> _lastRendered { 0 };
 
     PulsePropertyGroup _pulseProperties;
     ShapeType _shapeType;
@@ -56,8 +56,6 @@
 #pragma warning(push)
 #pragma warning( disable : 4267 )
 #endif
-#include <PolyVoxCore/CubicSurfaceExtractorWithNormals.h>
-#include <PolyVoxCore/MarchingCubesSurfaceExtractor.h>
 #include <PolyVoxCore/SurfaceMesh.h>
 #include <PolyVoxCore/SimpleVolume.h>
 #include <PolyVoxCore/Material.h>
@@ -74,13 +72,12 @@
 #include "RenderablePolyVoxEntityItem.h"
 #include "PhysicalEntitySimulation.h"
 
-const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
-
 /*
   A PolyVoxEntity has several interdependent parts:
 
   _voxelData -- compressed QByteArray representation of which voxels have which values
   _volData -- datastructure from the PolyVox library which holds which voxels have which values
+  _chunks -- surface and collision hulls of _volData, extracted a chunk at a time
   _mesh -- renderable representation of the voxels
   _shape -- used for bullet (physics) collisions
 
@@ -147,6 +144,11 @@ const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
   knit together.  This is handled by tellNeighborsToRecopyEdges and copyUpperEdgesFromNeighbors.  In these functions, variable
   names have XP for x-positive, XN x-negative, etc.
 
+  Every write to _volData marks the chunks of _chunks around the voxel dirty, so baking the mesh only re-extracts the
+  chunks an edit (or a neighbor's edge) touched, on worker threads, and stitches the new _mesh together from all of
+  them.  The shape is stitched together from the hulls of the chunks in the same way.  The new mesh and shape are built
+  aside and swapped in when they are complete, so the render and physics engines keep using the previous ones meanwhile.
+
  */
 
  // FIXME move to GLM helpers
@@ -914,6 +916,7 @@ void RenderablePolyVoxEntityItem::setVoxelVolumeSize(const glm::vec3& voxelVolum
         _voxelDataDirty = true;
         _voxelVolumeSize = voxelVolumeSize;
         _volData.reset();
+        _chunks.reset();
         _onCount = 0;
         _updateFromNeighborXEdge = _updateFromNeighborYEdge = _updateFromNeighborZEdge = true;
         startUpdates();
@@ -992,6 +995,7 @@ uint8_t RenderablePolyVoxEntityItem::getVoxelInternal(const ivec3& v) const {
 
 void RenderablePolyVoxEntityItem::setVoxelMarkNeighbors(int x, int y, int z, uint8_t toValue) {
     _volData->setVoxelAt(x, y, z, toValue);
+    _chunks.markVoxelDirty({ x, y, z });
     if (x == 0) {
         _neighborXNeedsUpdate = true;
         startUpdates();
@@ -1244,6 +1248,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            _chunks.markVoxelDirty({ x, y, z });
                             _volDataDirty = true;
                         }
                     }
@@ -1264,6 +1269,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            _chunks.markVoxelDirty({ x, y, z });
                             _volDataDirty = true;
                         }
                     }
@@ -1284,6 +1290,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            _chunks.markVoxelDirty({ x, y, z });
                             _volDataDirty = true;
                         }
                     }
@@ -1335,38 +1342,21 @@ void RenderablePolyVoxEntityItem::recomputeMesh() {
     QtConcurrent::run([entity, voxelSurfaceStyle] {
         graphics::MeshPointer mesh(new graphics::Mesh());
 
-        // A mesh object to hold the result of surface extraction
-        PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
-
+        // only the chunks that changed since the last bake are extracted again
+        std::vector<PolyVox::PositionMaterialNormal> vecVertices;
+        std::vector<uint32_t> vecIndices;
         entity->withReadLock([&] {
-            PolyVox::SimpleVolume<uint8_t>* volData = entity->getVolData();
-            switch (voxelSurfaceStyle) {
-                case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
-                case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
-                    PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
-                }
-                case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
-                case PolyVoxEntityItem::SURFACE_CUBIC: {
-                    PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
-                }
-            }
+            entity->_chunks.extract(*entity->getVolData(), voxelSurfaceStyle);
+            entity->_chunks.getMesh(vecVertices, vecIndices);
         });
 
         // convert PolyVox mesh to a Sam mesh
-        const std::vector<uint32_t>& vecIndices = polyVoxMesh.getIndices();
         auto indexBuffer = std::make_shared<gpu::Buffer>(vecIndices.size() * sizeof(uint32_t),
                                                          (gpu::Byte*)vecIndices.data());
         auto indexBufferPtr = gpu::BufferPointer(indexBuffer);
         gpu::BufferView indexBufferView(indexBufferPtr, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::INDEX));
         mesh->setIndexBuffer(indexBufferView);
 
-        const std::vector<PolyVox::PositionMaterialNormal>& vecVertices = polyVoxMesh.getRawVertexData();
         auto vertexBuffer = std::make_shared<gpu::Buffer>(vecVertices.size() * sizeof(PolyVox::PositionMaterialNormal),
                                                           (gpu::Byte*)vecVertices.data());
         auto vertexBufferPtr = gpu::BufferPointer(vertexBuffer);
@@ -1412,127 +1402,20 @@ void RenderablePolyVoxEntityItem::setMesh(graphics::MeshPointer mesh) {
 }
 
 void RenderablePolyVoxEntityItem::computeShapeInfoWorker() {
-    // this creates a collision-shape for the physics engine.  The shape comes from
-    // _volData for cubic extractors and from _mesh for marching-cube extractors
+    // this creates a collision-shape for the physics engine.  The hulls come from the chunks of the last mesh bake:
+    // voxel cubes for cubic extractors and surface triangles for marching-cube extractors
 
     EntityItemPointer entity = getThisPointer();
 
-    PolyVoxSurfaceStyle voxelSurfaceStyle;
-    glm::vec3 voxelVolumeSize;
-    graphics::MeshPointer mesh;
-
-    withReadLock([&] {
-        voxelSurfaceStyle = _voxelSurfaceStyle;
-        voxelVolumeSize = _voxelVolumeSize;
-        mesh = _mesh;
-    });
-
-    QtConcurrent::run([entity, voxelSurfaceStyle, voxelVolumeSize, mesh] {
+    QtConcurrent::run([entity] {
         auto polyVoxEntity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(entity);
         ShapeInfo::PointCollection pointCollection;
         AABox box;
-        glm::mat4 vtoM = std::static_pointer_cast<RenderablePolyVoxEntityItem>(entity)->voxelToLocalMatrix();
-
-        if (voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_MARCHING_CUBES ||
-            voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES) {
-            // pull each triangle in the mesh into a polyhedron which can be collided with
-
-            const gpu::BufferView& vertexBufferView = mesh->getVertexBuffer();
-            const gpu::BufferView& indexBufferView = mesh->getIndexBuffer();
-
-            gpu::BufferView::Iterator<const uint32_t> it = indexBufferView.cbegin<uint32_t>();
-            while (it != indexBufferView.cend<uint32_t>()) {
-                uint32_t p0Index = *(it++);
-                uint32_t p1Index = *(it++);
-                uint32_t p2Index = *(it++);
-
-                const glm::vec3& p0 = vertexBufferView.get<const glm::vec3>(p0Index);
-                const glm::vec3& p1 = vertexBufferView.get<const glm::vec3>(p1Index);
-                const glm::vec3& p2 = vertexBufferView.get<const glm::vec3>(p2Index);
-
-                glm::vec3 av = (p0 + p1 + p2) / 3.0f; // center of the triangular face
-                glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
-                glm::vec3 p3 = av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET;
-
-                glm::vec3 p0Model = glm::vec3(vtoM * glm::vec4(p0, 1.0f));
-                glm::vec3 p1Model = glm::vec3(vtoM * glm::vec4(p1, 1.0f));
-                glm::vec3 p2Model = glm::vec3(vtoM * glm::vec4(p2, 1.0f));
-                glm::vec3 p3Model = glm::vec3(vtoM * glm::vec4(p3, 1.0f));
-
-                box += p0Model;
-                box += p1Model;
-                box += p2Model;
-                box += p3Model;
-
-                ShapeInfo::PointList pointsInPart;
-                pointsInPart.push_back(p0Model);
-                pointsInPart.push_back(p1Model);
-                pointsInPart.push_back(p2Model);
-                pointsInPart.push_back(p3Model);
-
-                // add points to a new convex hull
-                pointCollection.push_back(pointsInPart);
-            }
-        } else {
-            polyVoxEntity->forEachVoxelValue(voxelVolumeSize, [&](const ivec3& v, uint8_t value) {
-                if (value > 0) {
-                    const auto& x = v.x;
-                    const auto& y = v.y;
-                    const auto& z = v.z;
-                    if (glm::all(glm::greaterThan(v, ivec3(0))) &&
-                        glm::all(glm::lessThan(v, ivec3(voxelVolumeSize) - 1)) &&
-                        (polyVoxEntity->getVoxelInternal({ x - 1, y, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y - 1, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y, z - 1 }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x + 1, y, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y + 1, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y, z + 1 }) > 0)) {
-                        // this voxel has neighbors in every cardinal direction, so there's no need
-                        // to include it in the collision hull.
-                        return;
-                    }
-
-                    ShapeInfo::PointList pointsInPart;
+        glm::mat4 vtoM = polyVoxEntity->voxelToLocalMatrix();
 
-                    float offL = -0.5f;
-                    float offH = 0.5f;
-                    if (voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_CUBIC) {
-                        offL += 1.0f;
-                        offH += 1.0f;
-                    }
-
-                    glm::vec3 p000 = glm::vec3(vtoM * glm::vec4(x + offL, y + offL, z + offL, 1.0f));
-                    glm::vec3 p001 = glm::vec3(vtoM * glm::vec4(x + offL, y + offL, z + offH, 1.0f));
-                    glm::vec3 p010 = glm::vec3(vtoM * glm::vec4(x + offL, y + offH, z + offL, 1.0f));
-                    glm::vec3 p011 = glm::vec3(vtoM * glm::vec4(x + offL, y + offH, z + offH, 1.0f));
-                    glm::vec3 p100 = glm::vec3(vtoM * glm::vec4(x + offH, y + offL, z + offL, 1.0f));
-                    glm::vec3 p101 = glm::vec3(vtoM * glm::vec4(x + offH, y + offL, z + offH, 1.0f));
-                    glm::vec3 p110 = glm::vec3(vtoM * glm::vec4(x + offH, y + offH, z + offL, 1.0f));
-                    glm::vec3 p111 = glm::vec3(vtoM * glm::vec4(x + offH, y + offH, z + offH, 1.0f));
-
-                    box += p000;
-                    box += p001;
-                    box += p010;
-                    box += p011;
-                    box += p100;
-                    box += p101;
-                    box += p110;
-                    box += p111;
-
-                    pointsInPart.push_back(p000);
-                    pointsInPart.push_back(p001);
-                    pointsInPart.push_back(p010);
-                    pointsInPart.push_back(p011);
-                    pointsInPart.push_back(p100);
-                    pointsInPart.push_back(p101);
-                    pointsInPart.push_back(p110);
-                    pointsInPart.push_back(p111);
-
-                    // add points to a new convex hull
-                    pointCollection.push_back(pointsInPart);
-                }
-            });
-        }
+        polyVoxEntity->withReadLock([&] {
+            polyVoxEntity->_chunks.getCollisionHulls(vtoM, pointCollection, box);
+        });
         polyVoxEntity->setCollisionPoints(pointCollection, box);
     });
 }
@@ -27,6 +27,7 @@
 #include <PolyVoxEntityItem.h>
 
 #include "RenderableEntityItem.h"
+#include "PolyVoxChunks.h"
 
 namespace render { namespace entities {
 class PolyVoxEntityRenderer;
@@ -177,6 +178,7 @@ private:
     ShapeInfo _shapeInfo;
 
     std::shared_ptr<PolyVox::SimpleVolume<uint8_t>> _volData;
+    PolyVoxChunks _chunks; // surface and collision hulls of _volData, re-extracted where it changes
     int _onCount; // how many non-zero voxels are in _volData
 
     bool _neighborXNeedsUpdate { false };
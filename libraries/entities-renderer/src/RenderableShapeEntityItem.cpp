@@ -63,12 +63,14 @@ bool ShapeEntityRenderer::needsRenderUpdateFromTypedEntity(const TypedEntityPoin
     return false;
 }
 
-void ShapeEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) {
+void ShapeEntityRenderer::doRenderUpdateConcurrentTyped(const TypedEntityPointer& entity) {
     withWriteLock([&] {
         _shape = entity->getShape();
         _pulseProperties = entity->getPulseProperties();
     });
+}
 
+void ShapeEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) {
     void* key = (void*)this;
     AbstractViewStateInterface::instance()->pushPostUpdateLambda(key, [this] () {
         withWriteLock([&] {
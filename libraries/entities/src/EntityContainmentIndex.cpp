@@ -0,0 +1,148 @@
+//
+//  EntityContainmentIndex.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityContainmentIndex.h"
+
+const float EntityContainmentIndex::CELL_SCALE = 16.0f;
+
+bool EntityContainmentIndex::isCandidate(const EntityItemPointer& entity) {
+    return entity->getType() == EntityTypes::Zone || !entity->getScript().isEmpty();
+}
+
+glm::ivec3 EntityContainmentIndex::getCellCoordinates(const glm::vec3& point) {
+    return glm::ivec3(glm::floor(point / CELL_SCALE));
+}
+
+bool EntityContainmentIndex::canMove(const EntityItemPointer& entity) {
+    return !entity->getParentID().isNull() || entity->isMovingRelativeToParent();
+}
+
+bool EntityContainmentIndex::touchesCell(const AABox& bounds) const {
+    return _candidatesValid && bounds.touches(_cellBounds);
+}
+
+bool EntityContainmentIndex::invalidateCandidatesIfTouched(const AABox& bounds) {
+    if (touchesCell(bounds)) {
+        _candidatesValid = false;
+        return true;
+    }
+    return false;
+}
+
+bool EntityContainmentIndex::update(const EntityItemPointer& entity) {
+    bool success = false;
+    AABox bounds;
+    if (isCandidate(entity) && !entity->isDead()) {
+        bounds = entity->getAABox(success);
+    }
+    if (!success) {
+        return remove(entity->getEntityItemID());
+    }
+
+    bool moving = canMove(entity);
+    auto itr = _entries.find(entity->getEntityItemID());
+    if (itr == _entries.end()) {
+        _entries[entity->getEntityItemID()] = { entity, bounds, moving };
+        _numMovingEntries += moving ? 1 : 0;
+        return invalidateCandidatesIfTouched(bounds);
+    }
+
+    Entry& entry = itr->second;
+    _numMovingEntries += (moving ? 1 : 0) - (entry.moving ? 1 : 0);
+    entry.moving = moving;
+    if (entry.bounds == bounds) {
+        return false;
+    }
+    bool changed = invalidateCandidatesIfTouched(entry.bounds);
+    entry.bounds = bounds;
+    return invalidateCandidatesIfTouched(bounds) || changed;
+}
+
+bool EntityContainmentIndex::remove(const EntityItemID& id) {
+    auto itr = _entries.find(id);
+    if (itr == _entries.end()) {
+        return false;
+    }
+    _numMovingEntries -= itr->second.moving ? 1 : 0;
+    bool changed = invalidateCandidatesIfTouched(itr->second.bounds);
+    _entries.erase(itr);
+    return changed;
+}
+
+void EntityContainmentIndex::clear() {
+    _entries.clear();
+    _candidates.clear();
+    _candidatesValid = false;
+    _numMovingEntries = 0;
+}
+
+void EntityContainmentIndex::clearDomainAndNonOwnedEntities() {
+    for (auto itr = _entries.begin(); itr != _entries.end(); ) {
+        auto entity = itr->second.entity.lock();
+        if (!entity || !(entity->isLocalEntity() || entity->isMyAvatarEntity())) {
+            _numMovingEntries -= itr->second.moving ? 1 : 0;
+            itr = _entries.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+    _candidates.clear();
+    _candidatesValid = false;
+}
+
+bool EntityContainmentIndex::updateMovingEntries() {
+    if (_numMovingEntries == 0) {
+        return false;
+    }
+    bool changed = false;
+    for (auto itr = _entries.begin(); itr != _entries.end(); ) {
+        Entry& entry = itr->second;
+        auto entity = entry.entity.lock();
+        if (!entity) {
+            _numMovingEntries -= entry.moving ? 1 : 0;
+            changed = invalidateCandidatesIfTouched(entry.bounds) || changed;
+            itr = _entries.erase(itr);
+            continue;
+        }
+        if (entry.moving) {
+            bool success;
+            AABox bounds = entity->getAABox(success);
+            if (success && !(bounds == entry.bounds)) {
+                changed = invalidateCandidatesIfTouched(entry.bounds) || changed;
+                entry.bounds = bounds;
+                changed = invalidateCandidatesIfTouched(bounds) || changed;
+            }
+            if (!canMove(entity)) {
+                entry.moving = false;
+                _numMovingEntries--;
+            }
+        }
+        ++itr;
+    }
+    return changed;
+}
+
+void EntityContainmentIndex::updateCandidates(const glm::vec3& point) {
+    glm::ivec3 cell = getCellCoordinates(point);
+    if (_candidatesValid && cell == _cell) {
+        return;
+    }
+    _cell = cell;
+    _cellBounds = AABox(glm::vec3(cell) * CELL_SCALE, CELL_SCALE);
+    _candidatesValid = true;
+    _numCandidateUpdates++;
+
+    _candidates.clear();
+    for (const auto& entry : _entries) {
+        if (entry.second.bounds.touches(_cellBounds)) {
+            _candidates.push_back(entry.second);
+        }
+    }
+}
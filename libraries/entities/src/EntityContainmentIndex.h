@@ -0,0 +1,84 @@
+//
+//  EntityContainmentIndex.h
+//  libraries/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityContainmentIndex_h
+#define hifi_EntityContainmentIndex_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <AABox.h>
+
+#include "EntityItem.h"
+
+// The bounds of the entities that can receive enter and leave events, zones and scripted entities, for finding the
+//   ones that contain a point without searching the whole tree.
+//   The candidates whose bounds touch the cell of the last point are kept in a list that is only rebuilt when the point
+//   crosses into another cell, or when a candidate that touches the cell is added, moved or removed. The containment
+//   queries test the point against the bounds of that list and leave the exact test to the caller.
+//   Not thread safe: the caller updates and queries it from one thread, with the tree read locked.
+class EntityContainmentIndex {
+public:
+    // in meters
+    static const float CELL_SCALE;
+
+    static bool isCandidate(const EntityItemPointer& entity);
+
+    // Adds, moves or removes the entity according to its type, script and bounds.
+    // Returns true if that changed the candidates of the current cell.
+    bool update(const EntityItemPointer& entity);
+    bool remove(const EntityItemID& id);
+    void clear();
+    void clearDomainAndNonOwnedEntities();
+
+    // Refreshes the bounds of the entries that can move without a change notification: children, and moving entities.
+    // Returns true if that changed the candidates of the current cell.
+    bool updateMovingEntries();
+
+    template <typename F>
+    void forEachCandidateContaining(const glm::vec3& point, F&& f) {
+        updateCandidates(point);
+        for (const auto& candidate : _candidates) {
+            if (candidate.bounds.contains(point)) {
+                if (auto entity = candidate.entity.lock()) {
+                    f(entity);
+                }
+            }
+        }
+    }
+
+    int size() const { return (int)_entries.size(); }
+    int getNumCandidates() const { return (int)_candidates.size(); }
+    int getNumCandidateUpdates() const { return _numCandidateUpdates; }
+
+private:
+    struct Entry {
+        EntityItemWeakPointer entity;
+        AABox bounds;
+        bool moving;
+    };
+
+    static glm::ivec3 getCellCoordinates(const glm::vec3& point);
+    static bool canMove(const EntityItemPointer& entity);
+
+    bool touchesCell(const AABox& bounds) const;
+    bool invalidateCandidatesIfTouched(const AABox& bounds);
+    void updateCandidates(const glm::vec3& point);
+
+    std::unordered_map<EntityItemID, Entry> _entries;
+    std::vector<Entry> _candidates;
+    AABox _cellBounds;
+    glm::ivec3 _cell { 0 };
+    bool _candidatesValid { false };
+    int _numMovingEntries { 0 };
+    int _numCandidateUpdates { 0 };
+};
+
+#endif // hifi_EntityContainmentIndex_h
@@ -0,0 +1,90 @@
+//
+//  EntitySpatialIndex.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySpatialIndex.h"
+
+#include <OctreeConstants.h>
+
+const float EntitySpatialIndex::CELL_SCALE = 16.0f;
+
+static const int CELLS_PER_SIDE = (int)(TREE_SCALE / EntitySpatialIndex::CELL_SCALE);
+static const int CELL_KEY_BITS = 16;
+
+AABox EntitySpatialIndex::getWorldBounds() {
+    return AABox(glm::vec3(-(float)HALF_TREE_SCALE), (float)TREE_SCALE);
+}
+
+glm::ivec3 EntitySpatialIndex::getCellCoordinates(const glm::vec3& point) {
+    glm::ivec3 coordinates = glm::ivec3(glm::floor((point + (float)HALF_TREE_SCALE) / CELL_SCALE));
+    return glm::clamp(coordinates, glm::ivec3(0), glm::ivec3(CELLS_PER_SIDE - 1));
+}
+
+uint64_t EntitySpatialIndex::getCellKey(const glm::ivec3& coordinates) {
+    return (uint64_t)coordinates.x | ((uint64_t)coordinates.y << CELL_KEY_BITS) | ((uint64_t)coordinates.z << (2 * CELL_KEY_BITS));
+}
+
+void EntitySpatialIndex::insert(const EntityItemPointer& entity, const AACube& bounds) {
+    QWriteLocker locker(&_lock);
+    assert(_locations.find(entity.get()) == _locations.end());
+
+    Entry entry { AABox(bounds), entity };
+    glm::ivec3 coordinates = getCellCoordinates(bounds.calcCenter());
+    AABox cellBounds(glm::vec3(coordinates) * CELL_SCALE - (float)HALF_TREE_SCALE, CELL_SCALE);
+    if (bounds.getScale() > CELL_SCALE || !cellBounds.contains(entry.bounds)) {
+        _locations[entity.get()] = { LARGE_ENTRIES, (int32_t)_largeEntries.size() };
+        _largeEntries.push_back(entry);
+        return;
+    }
+
+    int32_t cellIndex;
+    uint64_t key = getCellKey(coordinates);
+    auto itr = _cellIndices.find(key);
+    if (itr != _cellIndices.end()) {
+        cellIndex = itr->second;
+    } else {
+        cellIndex = (int32_t)_cells.size();
+        _cellIndices[key] = cellIndex;
+        _cells.push_back({ cellBounds, std::vector<Entry>() });
+    }
+    std::vector<Entry>& entries = _cells[cellIndex].entries;
+    _locations[entity.get()] = { cellIndex, (int32_t)entries.size() };
+    entries.push_back(entry);
+}
+
+void EntitySpatialIndex::remove(const EntityItemPointer& entity) {
+    QWriteLocker locker(&_lock);
+    auto itr = _locations.find(entity.get());
+    if (itr == _locations.end()) {
+        return;
+    }
+    Location location = itr->second;
+    _locations.erase(itr);
+
+    // swap the last entry into the hole
+    std::vector<Entry>& entries = (location.cell == LARGE_ENTRIES) ? _largeEntries : _cells[location.cell].entries;
+    if (location.entry != (int32_t)entries.size() - 1) {
+        entries[location.entry] = std::move(entries.back());
+        _locations[entries[location.entry].entity.get()].entry = location.entry;
+    }
+    entries.pop_back();
+}
+
+void EntitySpatialIndex::clear() {
+    QWriteLocker locker(&_lock);
+    _cells.clear();
+    _cellIndices.clear();
+    _largeEntries.clear();
+    _locations.clear();
+}
+
+int EntitySpatialIndex::size() const {
+    QReadLocker locker(&_lock);
+    return (int)_locations.size();
+}
@@ -0,0 +1,140 @@
+//
+//  EntitySpatialIndex.h
+//  libraries/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitySpatialIndex_h
+#define hifi_EntitySpatialIndex_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <QReadWriteLock>
+
+#include <AABox.h>
+#include <AACube.h>
+#include <ViewFrustum.h>
+
+#include "EntityTypes.h"
+
+// A flat grid over the bounds of the entities of an EntityTree, for the queries that would otherwise recurse the octree.
+//   The tree inserts an entity with the cube of the element that contains it, and removes it when the entity leaves
+//   that element, so the grid is kept up to date with the octree and the bounds are never tighter than the octree's.
+//   The cells are the elements of one level of the octree: an entity whose bounds fit in a cell is stored in that
+//   cell, and the few larger ones are kept in a list of their own. The forEachEntity* queries call f for every entity
+//   whose bounds touch the query, and leave the exact test to the caller.
+class EntitySpatialIndex {
+public:
+    // in meters, a power of two so that the cells line up with the elements of the octree
+    static const float CELL_SCALE;
+
+    void insert(const EntityItemPointer& entity, const AACube& bounds);
+    void remove(const EntityItemPointer& entity);
+    void clear();
+    int size() const;
+
+    template <typename F>
+    void forEachEntityTouching(const AABox& box, F&& f) const {
+        QReadLocker locker(&_lock);
+        forEachEntityUnlocked(box, [&](const AABox& bounds) { return bounds.touches(box); }, f);
+    }
+
+    template <typename F>
+    void forEachEntityTouchingSphere(const glm::vec3& center, float radius, F&& f) const {
+        QReadLocker locker(&_lock);
+        AABox box(center - glm::vec3(radius), 2.0f * radius);
+        forEachEntityUnlocked(box, [&](const AABox& bounds) { return bounds.touchesSphere(center, radius); }, f);
+    }
+
+    template <typename F>
+    void forEachEntityInView(const ViewFrustum& frustum, F&& f) const {
+        QReadLocker locker(&_lock);
+        forEachEntityUnlocked(getWorldBounds(), [&](const AABox& bounds) {
+            return frustum.boxIntersectsFrustum(bounds) || frustum.boxIntersectsKeyhole(bounds);
+        }, f);
+    }
+
+    // Several boxes under one lock, calls f(boxIndex, entity)
+    template <typename F>
+    void forEachEntityTouching(const AABox* boxes, int numBoxes, F&& f) const {
+        QReadLocker locker(&_lock);
+        for (int i = 0; i < numBoxes; i++) {
+            const AABox& box = boxes[i];
+            forEachEntityUnlocked(box, [&](const AABox& bounds) { return bounds.touches(box); },
+                                  [&](const EntityItemPointer& entity) { f(i, entity); });
+        }
+    }
+
+private:
+    struct Entry {
+        AABox bounds;
+        EntityItemPointer entity;
+    };
+
+    struct Cell {
+        AABox bounds;
+        std::vector<Entry> entries;
+    };
+
+    struct Location {
+        int32_t cell; // LARGE_ENTRIES for _largeEntries
+        int32_t entry;
+    };
+
+    static const int32_t LARGE_ENTRIES = -1;
+
+    static AABox getWorldBounds();
+    static glm::ivec3 getCellCoordinates(const glm::vec3& point);
+    static uint64_t getCellKey(const glm::ivec3& coordinates);
+
+    template <typename BoxTest, typename F>
+    static void forEachEntryIn(const std::vector<Entry>& entries, BoxTest& boxTest, F& f) {
+        for (const auto& entry : entries) {
+            if (boxTest(entry.bounds)) {
+                f(entry.entity);
+            }
+        }
+    }
+
+    template <typename BoxTest, typename F>
+    void forEachEntityUnlocked(const AABox& searchBox, BoxTest&& boxTest, F&& f) const {
+        forEachEntryIn(_largeEntries, boxTest, f);
+
+        glm::ivec3 minimum = getCellCoordinates(searchBox.getMinimumPoint());
+        glm::ivec3 maximum = getCellCoordinates(searchBox.getMaximumPoint());
+        int64_t numSearchCells = (int64_t)(maximum.x - minimum.x + 1) * (int64_t)(maximum.y - minimum.y + 1) *
+            (int64_t)(maximum.z - minimum.z + 1);
+        if (numSearchCells > (int64_t)_cells.size()) {
+            // the search covers more cells than there are occupied cells
+            for (const auto& cell : _cells) {
+                if (!cell.entries.empty() && boxTest(cell.bounds)) {
+                    forEachEntryIn(cell.entries, boxTest, f);
+                }
+            }
+            return;
+        }
+        for (int z = minimum.z; z <= maximum.z; z++) {
+            for (int y = minimum.y; y <= maximum.y; y++) {
+                for (int x = minimum.x; x <= maximum.x; x++) {
+                    auto itr = _cellIndices.find(getCellKey(glm::ivec3(x, y, z)));
+                    if (itr != _cellIndices.end()) {
+                        forEachEntryIn(_cells[itr->second].entries, boxTest, f);
+                    }
+                }
+            }
+        }
+    }
+
+    mutable QReadWriteLock _lock;
+    std::vector<Cell> _cells;
+    std::unordered_map<uint64_t, int32_t> _cellIndices;
+    std::vector<Entry> _largeEntries;
+    std::unordered_map<const EntityItem*, Location> _locations;
+};
+
+#endif // hifi_EntitySpatialIndex_h
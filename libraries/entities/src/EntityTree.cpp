@@ -23,6 +23,8 @@
 
 #include <QtScript/QScriptEngine>
 
+#include <glm/gtx/norm.hpp>
+
 #include <Extents.h>
 #include <PerfStat.h>
 #include <Profile.h>
@@ -952,248 +954,101 @@ EntityItemID EntityTree::evalParabolaIntersection(const PickParabola& parabola,
     return args.entityID;
 }
 
-class FindClosestEntityArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    PickFilter searchFilter;
-
-    // Outputs
-    QUuid closestEntity;
-    float closestEntityDistance;
-};
-
-
-bool evalClosestEntityOperation(const OctreeElementPointer& element, void* extraData) {
-    FindClosestEntityArgs* args = static_cast<FindClosestEntityArgs*>(extraData);
-    EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-
-    glm::vec3 penetration;
-    bool sphereIntersection = entityTreeElement->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this entityTreeElement contains the point, then search it...
-    if (sphereIntersection) {
-        float closestDistanceSquared = FLT_MAX;
-        QUuid thisClosestEntity = entityTreeElement->evalClosetEntity(args->position, args->searchFilter, closestDistanceSquared);
-
-        // we may have gotten NULL back, meaning no entity was available
-        if (!thisClosestEntity.isNull()) {
-            float distanceFromPointToEntity = glm::sqrt(closestDistanceSquared);
-
-            // If we're within our target radius
-            if (distanceFromPointToEntity <= args->targetRadius) {
-                // we are closer than anything else we've found
-                if (distanceFromPointToEntity < args->closestEntityDistance) {
-                    args->closestEntity = thisClosestEntity;
-                    args->closestEntityDistance = distanceFromPointToEntity;
-                }
-            }
-        }
-
-        // we should be able to optimize this...
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of its children can contain the point, so stop searching
-    return false;
-}
-
 // NOTE: assumes caller has handled locking
 QUuid EntityTree::evalClosestEntity(const glm::vec3& position, float targetRadius, PickFilter searchFilter) {
-    FindClosestEntityArgs args = { position, targetRadius, searchFilter, QUuid(), FLT_MAX };
-    recurseTreeWithOperation(evalClosestEntityOperation, &args);
-    return args.closestEntity;
-}
-
-class FindEntitiesInSphereArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    PickFilter searchFilter;
-
-    // Outputs
-    QVector<QUuid> entities;
-};
-
-bool evalInSphereOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereArgs* args = static_cast<FindEntitiesInSphereArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphere(args->position, args->targetRadius, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    QUuid closestEntity;
+    float closestDistanceSquared = FLT_MAX;
+    float targetRadiusSquared = targetRadius * targetRadius;
+    _spatialIndex.forEachEntityTouchingSphere(position, targetRadius, [&](const EntityItemPointer& entity) {
+        if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+            return;
+        }
+        float distanceSquared = glm::distance2(position, entity->getWorldPosition());
+        if (distanceSquared <= targetRadiusSquared && distanceSquared < closestDistanceSquared) {
+            closestEntity = entity->getID();
+            closestDistanceSquared = distanceSquared;
+        }
+    });
+    return closestEntity;
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereArgs args = { center, radius, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInSphereWithTypeArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    EntityTypes::EntityType type;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool evalInSphereWithTypeOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereWithTypeArgs* args = static_cast<FindEntitiesInSphereWithTypeArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphereWithType(args->position, args->targetRadius, args->type, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    _spatialIndex.forEachEntityTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::checkSphereIntersection(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphereWithType(const glm::vec3& center, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereWithTypeArgs args = { center, radius, type, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereWithTypeOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInSphereWithNameArgs {
-public:
-    // Inputs
-    glm::vec3 position;
-    float targetRadius;
-    QString name;
-    bool caseSensitive;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool evalInSphereWithNameOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInSphereWithNameArgs* args = static_cast<FindEntitiesInSphereWithNameArgs*>(extraData);
-    glm::vec3 penetration;
-    bool sphereIntersection = element->getAACube().findSpherePenetration(args->position, args->targetRadius, penetration);
-
-    // If this element contains the point, then search it...
-    if (sphereIntersection) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInSphereWithName(args->position, args->targetRadius, args->name, args->caseSensitive, args->searchFilter, args->entities);
-        return true; // keep searching in case children have closer entities
-    }
-
-    // if this element doesn't contain the point, then none of it's children can contain the point, so stop searching
-    return false;
+    _spatialIndex.forEachEntityTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        if (entity->getType() == type && EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::checkSphereIntersection(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphereWithName(const glm::vec3& center, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInSphereWithNameArgs args = { center, radius, name, caseSensitive, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(evalInSphereWithNameOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInCubeArgs {
-public:
-    // Inputs
-    AACube cube;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
-
-bool findInCubeOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInCubeArgs* args = static_cast<FindEntitiesInCubeArgs*>(extraData);
-    if (element->getAACube().touches(args->cube)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInCube(args->cube, args->searchFilter, args->entities);
-        return true;
-    }
-    return false;
+    Qt::CaseSensitivity caseSensitivity = caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    _spatialIndex.forEachEntityTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            entity->getName().compare(name, caseSensitivity) == 0 &&
+            EntityTreeElement::checkSphereIntersection(entity, center, radius)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInCubeArgs args { cube, searchFilter, QVector<QUuid>() };
-    recurseTreeWithOperation(findInCubeOperation, &args);
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInBoxArgs {
-public:
-    // Inputs
-    AABox box;
-    PickFilter searchFilter;
-
-    // Outputs
-    QVector<QUuid> entities;
-};
-
-bool findInBoxOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInBoxArgs* args = static_cast<FindEntitiesInBoxArgs*>(extraData);
-    if (element->getAACube().touches(args->box)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInBox(args->box, args->searchFilter, args->entities);
-        return true;
-    }
-    return false;
+    evalEntitiesInBox(AABox(cube), searchFilter, foundEntities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInBoxArgs args { box, searchFilter, QVector<QUuid>() };
-    // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInBoxOperation, &args);
-    // swap the two lists of entity pointers instead of copy
-    foundEntities.swap(args.entities);
-}
-
-class FindEntitiesInFrustumArgs {
-public:
-    // Inputs
-    ViewFrustum frustum;
-    PickFilter searchFilter;
-
-    // Outputs
     QVector<QUuid> entities;
-};
+    _spatialIndex.forEachEntityTouching(box, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::checkBoxIntersection(entity, box)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
+}
 
-bool findInFrustumOperation(const OctreeElementPointer& element, void* extraData) {
-    FindEntitiesInFrustumArgs* args = static_cast<FindEntitiesInFrustumArgs*>(extraData);
-    if (element->isInView(args->frustum)) {
-        EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
-        entityTreeElement->evalEntitiesInFrustum(args->frustum, args->searchFilter, args->entities);
-        return true;
-    }
-    return false;
+// NOTE: assumes caller has handled locking
+void EntityTree::evalEntitiesInBoxes(const QVector<AABox>& boxes, PickFilter searchFilter, QVector<QVector<QUuid>>& foundEntities) {
+    QVector<QVector<QUuid>> entities(boxes.size());
+    _spatialIndex.forEachEntityTouching(boxes.constData(), boxes.size(), [&](int i, const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::checkBoxIntersection(entity, boxes[i])) {
+            entities[i].push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
-    FindEntitiesInFrustumArgs args = { frustum, searchFilter, QVector<QUuid>() };
-    // NOTE: This should use recursion, since this is a spatial operation
-    recurseTreeWithOperation(findInFrustumOperation, &args);
-    // swap the two lists of entity pointers instead of copy
-    foundEntities.swap(args.entities);
+    QVector<QUuid> entities;
+    _spatialIndex.forEachEntityInView(frustum, [&](const EntityItemPointer& entity) {
+        if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+            EntityTreeElement::checkFrustumIntersection(entity, frustum)) {
+            entities.push_back(entity->getID());
+        }
+    });
+    foundEntities.swap(entities);
 }
 
 EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
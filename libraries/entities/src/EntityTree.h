@@ -20,6 +20,7 @@
 
 #include "AddEntityOperator.h"
 #include "EntityTreeElement.h"
+#include "EntitySpatialIndex.h"
 #include "DeleteEntityOperator.h"
 #include "MovingEntitiesOperator.h"
 
@@ -136,12 +137,16 @@ public:
 
     EntityItemID assignEntityID(const EntityItemID& entityItemID); /// Assigns a known ID for a creator token ID
 
+    EntitySpatialIndex& getSpatialIndex() { return _spatialIndex; }
+
     QUuid evalClosestEntity(const glm::vec3& position, float targetRadius, PickFilter searchFilter);
     void evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInSphereWithType(const glm::vec3& center, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInSphereWithName(const glm::vec3& center, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities);
+    // evalEntitiesInBox for each of boxes, with one lookup of the index: foundEntities[i] are those in boxes[i]
+    void evalEntitiesInBoxes(const QVector<AABox>& boxes, PickFilter searchFilter, QVector<QVector<QUuid>>& foundEntities);
     void evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities);
 
     void addNewlyCreatedHook(NewlyCreatedEntityHook* hook);
@@ -329,6 +334,9 @@ protected:
     mutable QReadWriteLock _entityMapLock;
     QHash<EntityItemID, EntityItemPointer> _entityMap;
 
+    // the entities of the octree elements, kept by EntityTreeElement as entities are added to and removed from them
+    EntitySpatialIndex _spatialIndex;
+
     mutable QReadWriteLock _entityCertificateIDMapLock;
     QHash<QString, QList<EntityItemID>> _entityCertificateIDMap;
 
@@ -421,263 +421,77 @@ EntityItemID EntityTreeElement::evalDetailedParabolaIntersection(const glm::vec3
     return entityID;
 }
 
-QUuid EntityTreeElement::evalClosetEntity(const glm::vec3& position, PickFilter searchFilter, float& closestDistanceSquared) const {
-    QUuid closestEntity;
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
-        float distanceToEntity = glm::distance2(position, entity->getWorldPosition());
-        if (distanceToEntity < closestDistanceSquared) {
-            closestEntity = entity->getID();
-            closestDistanceSquared = distanceToEntity;
-        }
-    });
-    return closestEntity;
-}
-
-void EntityTreeElement::evalEntitiesInSphere(const glm::vec3& position, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
-        bool success;
-        AABox entityBox = entity->getAABox(success);
-
-        // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
-        glm::vec3 penetration;
-        if (success && entityBox.findSpherePenetration(position, radius, penetration)) {
-
-            glm::vec3 dimensions = entity->getRaycastDimensions();
-
-            // FIXME - consider allowing the entity to determine penetration so that
-            //         entities could presumably do actual hull testing if they wanted to
-            // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better in particular
-            //         can we handle the ellipsoid case better? We only currently handle perfect spheres
-            //         with centered registration points
-            if (entity->getShapeType() == SHAPE_TYPE_SPHERE && (dimensions.x == dimensions.y && dimensions.y == dimensions.z)) {
-
-                // NOTE: entity->getRadius() doesn't return the true radius, it returns the radius of the
-                //       maximum bounding sphere, which is actually larger than our actual radius
-                float entityTrueRadius = dimensions.x / 2.0f;
-
-                bool success;
-                if (findSphereSpherePenetration(position, radius, entity->getCenterPosition(success), entityTrueRadius, penetration)) {
-                    if (success) {
-                        foundEntities.push_back(entity->getID());
-                    }
-                }
-            } else {
-                // determine the worldToEntityMatrix that doesn't include scale because
-                // we're going to use the registration aware aa box in the entity frame
-                glm::mat4 rotation = glm::mat4_cast(entity->getWorldOrientation());
-                glm::mat4 translation = glm::translate(entity->getWorldPosition());
-                glm::mat4 entityToWorldMatrix = translation * rotation;
-                glm::mat4 worldToEntityMatrix = glm::inverse(entityToWorldMatrix);
-
-                glm::vec3 registrationPoint = entity->getRegistrationPoint();
-                glm::vec3 corner = -(dimensions * registrationPoint);
-
-                AABox entityFrameBox(corner, dimensions);
-
-                glm::vec3 entityFrameSearchPosition = glm::vec3(worldToEntityMatrix * glm::vec4(position, 1.0f));
-                if (entityFrameBox.findSpherePenetration(entityFrameSearchPosition, radius, penetration)) {
-                    foundEntities.push_back(entity->getID());
-                }
-            }
-        }
-    });
-}
-
-void EntityTreeElement::evalEntitiesInSphereWithType(const glm::vec3& position, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter) || type != entity->getType()) {
-            return;
-        }
-
-        bool success;
-        AABox entityBox = entity->getAABox(success);
-
-        // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
-        glm::vec3 penetration;
-        if (success && entityBox.findSpherePenetration(position, radius, penetration)) {
-
-            glm::vec3 dimensions = entity->getRaycastDimensions();
-
-            // FIXME - consider allowing the entity to determine penetration so that
-            //         entities could presumably do actual hull testing if they wanted to
-            // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better in particular
-            //         can we handle the ellipsoid case better? We only currently handle perfect spheres
-            //         with centered registration points
-            if (entity->getShapeType() == SHAPE_TYPE_SPHERE && (dimensions.x == dimensions.y && dimensions.y == dimensions.z)) {
-
-                // NOTE: entity->getRadius() doesn't return the true radius, it returns the radius of the
-                //       maximum bounding sphere, which is actually larger than our actual radius
-                float entityTrueRadius = dimensions.x / 2.0f;
-
-                bool success;
-                if (findSphereSpherePenetration(position, radius, entity->getCenterPosition(success), entityTrueRadius, penetration)) {
-                    if (success) {
-                        foundEntities.push_back(entity->getID());
-                    }
-                }
-            } else {
-                // determine the worldToEntityMatrix that doesn't include scale because
-                // we're going to use the registration aware aa box in the entity frame
-                glm::mat4 rotation = glm::mat4_cast(entity->getWorldOrientation());
-                glm::mat4 translation = glm::translate(entity->getWorldPosition());
-                glm::mat4 entityToWorldMatrix = translation * rotation;
-                glm::mat4 worldToEntityMatrix = glm::inverse(entityToWorldMatrix);
-
-                glm::vec3 registrationPoint = entity->getRegistrationPoint();
-                glm::vec3 corner = -(dimensions * registrationPoint);
-
-                AABox entityFrameBox(corner, dimensions);
-
-                glm::vec3 entityFrameSearchPosition = glm::vec3(worldToEntityMatrix * glm::vec4(position, 1.0f));
-                if (entityFrameBox.findSpherePenetration(entityFrameSearchPosition, radius, penetration)) {
-                    foundEntities.push_back(entity->getID());
-                }
-            }
-        }
-    });
-}
-
-void EntityTreeElement::evalEntitiesInSphereWithName(const glm::vec3& position, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
+bool EntityTreeElement::checkSphereIntersection(const EntityItemPointer& entity, const glm::vec3& position, float radius) {
+    bool success;
+    AABox entityBox = entity->getAABox(success);
 
-        QString entityName = entity->getName();
-        if ((caseSensitive && name != entityName) || (!caseSensitive && name.toLower() != entityName.toLower())) {
-            return;
-        }
+    // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
+    glm::vec3 penetration;
+    if (!success || !entityBox.findSpherePenetration(position, radius, penetration)) {
+        return false;
+    }
 
-        bool success;
-        AABox entityBox = entity->getAABox(success);
+    glm::vec3 dimensions = entity->getRaycastDimensions();
 
-        // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
-        glm::vec3 penetration;
-        if (success && entityBox.findSpherePenetration(position, radius, penetration)) {
+    // FIXME - consider allowing the entity to determine penetration so that
+    //         entities could presumably do actual hull testing if they wanted to
+    // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better in particular
+    //         can we handle the ellipsoid case better? We only currently handle perfect spheres
+    //         with centered registration points
+    if (entity->getShapeType() == SHAPE_TYPE_SPHERE && (dimensions.x == dimensions.y && dimensions.y == dimensions.z)) {
 
-            glm::vec3 dimensions = entity->getRaycastDimensions();
+        // NOTE: entity->getRadius() doesn't return the true radius, it returns the radius of the
+        //       maximum bounding sphere, which is actually larger than our actual radius
+        float entityTrueRadius = dimensions.x / 2.0f;
 
-            // FIXME - consider allowing the entity to determine penetration so that
-            //         entities could presumably do actual hull testing if they wanted to
-            // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better in particular
-            //         can we handle the ellipsoid case better? We only currently handle perfect spheres
-            //         with centered registration points
-            if (entity->getShapeType() == SHAPE_TYPE_SPHERE && (dimensions.x == dimensions.y && dimensions.y == dimensions.z)) {
+        return findSphereSpherePenetration(position, radius, entity->getCenterPosition(success), entityTrueRadius, penetration) &&
+            success;
+    }
 
-                // NOTE: entity->getRadius() doesn't return the true radius, it returns the radius of the
-                //       maximum bounding sphere, which is actually larger than our actual radius
-                float entityTrueRadius = dimensions.x / 2.0f;
+    // determine the worldToEntityMatrix that doesn't include scale because
+    // we're going to use the registration aware aa box in the entity frame
+    glm::mat4 rotation = glm::mat4_cast(entity->getWorldOrientation());
+    glm::mat4 translation = glm::translate(entity->getWorldPosition());
+    glm::mat4 entityToWorldMatrix = translation * rotation;
+    glm::mat4 worldToEntityMatrix = glm::inverse(entityToWorldMatrix);
 
-                bool success;
-                if (findSphereSpherePenetration(position, radius, entity->getCenterPosition(success), entityTrueRadius, penetration)) {
-                    if (success) {
-                        foundEntities.push_back(entity->getID());
-                    }
-                }
-            } else {
-                // determine the worldToEntityMatrix that doesn't include scale because
-                // we're going to use the registration aware aa box in the entity frame
-                glm::mat4 rotation = glm::mat4_cast(entity->getWorldOrientation());
-                glm::mat4 translation = glm::translate(entity->getWorldPosition());
-                glm::mat4 entityToWorldMatrix = translation * rotation;
-                glm::mat4 worldToEntityMatrix = glm::inverse(entityToWorldMatrix);
+    glm::vec3 registrationPoint = entity->getRegistrationPoint();
+    glm::vec3 corner = -(dimensions * registrationPoint);
 
-                glm::vec3 registrationPoint = entity->getRegistrationPoint();
-                glm::vec3 corner = -(dimensions * registrationPoint);
+    AABox entityFrameBox(corner, dimensions);
 
-                AABox entityFrameBox(corner, dimensions);
-
-                glm::vec3 entityFrameSearchPosition = glm::vec3(worldToEntityMatrix * glm::vec4(position, 1.0f));
-                if (entityFrameBox.findSpherePenetration(entityFrameSearchPosition, radius, penetration)) {
-                    foundEntities.push_back(entity->getID());
-                }
-            }
-        }
-    });
+    glm::vec3 entityFrameSearchPosition = glm::vec3(worldToEntityMatrix * glm::vec4(position, 1.0f));
+    return entityFrameBox.findSpherePenetration(entityFrameSearchPosition, radius, penetration);
 }
 
-void EntityTreeElement::evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
-        bool success;
-        AABox entityBox = entity->getAABox(success);
-        // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better
-        // FIXME - consider allowing the entity to determine penetration so that
-        //         entities could presumably dull actuall hull testing if they wanted to
-        // FIXME - is there an easy way to translate the search cube into something in the
-        //         entity frame that can be easily tested against?
-        //         simple algorithm is probably:
-        //             if target box is fully inside search box == yes
-        //             if search box is fully inside target box == yes
-        //             for each face of search box:
-        //                 translate the triangles of the face into the box frame
-        //                 test the triangles of the face against the box?
-        //                 if translated search face triangle intersect target box
-        //                     add to result
-        //
-
-        // If the entities AABox touches the search cube then consider it to be found
-        if (success && entityBox.touches(cube)) {
-            foundEntities.push_back(entity->getID());
-        }
-    });
-}
-
-void EntityTreeElement::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
-        bool success;
-        AABox entityBox = entity->getAABox(success);
-        // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better
-        // FIXME - consider allowing the entity to determine penetration so that
-        //         entities could presumably dull actuall hull testing if they wanted to
-        // FIXME - is there an easy way to translate the search cube into something in the
-        //         entity frame that can be easily tested against?
-        //         simple algorithm is probably:
-        //             if target box is fully inside search box == yes
-        //             if search box is fully inside target box == yes
-        //             for each face of search box:
-        //                 translate the triangles of the face into the box frame
-        //                 test the triangles of the face against the box?
-        //                 if translated search face triangle intersect target box
-        //                     add to result
-        //
-
-        // If the entities AABox touches the search cube then consider it to be found
-        if (success && entityBox.touches(box)) {
-            foundEntities.push_back(entity->getID());
-        }
-    });
-}
-
-void EntityTreeElement::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
-    forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
-        bool success;
-        AABox entityBox = entity->getAABox(success);
+bool EntityTreeElement::checkBoxIntersection(const EntityItemPointer& entity, const AABox& box) {
+    bool success;
+    AABox entityBox = entity->getAABox(success);
+    // FIXME - handle entity->getShapeType() == SHAPE_TYPE_SPHERE case better
+    // FIXME - consider allowing the entity to determine penetration so that
+    //         entities could presumably dull actuall hull testing if they wanted to
+    // FIXME - is there an easy way to translate the search cube into something in the
+    //         entity frame that can be easily tested against?
+    //         simple algorithm is probably:
+    //             if target box is fully inside search box == yes
+    //             if search box is fully inside target box == yes
+    //             for each face of search box:
+    //                 translate the triangles of the face into the box frame
+    //                 test the triangles of the face against the box?
+    //                 if translated search face triangle intersect target box
+    //                     add to result
+    //
+
+    // If the entities AABox touches the search box then consider it to be found
+    return success && entityBox.touches(box);
+}
+
+bool EntityTreeElement::checkFrustumIntersection(const EntityItemPointer& entity, const ViewFrustum& frustum) {
+    bool success;
+    AABox entityBox = entity->getAABox(success);
 
-        // FIXME - See FIXMEs for similar methods above.
-        if (success && (frustum.boxIntersectsFrustum(entityBox) || frustum.boxIntersectsKeyhole(entityBox))) {
-            foundEntities.push_back(entity->getID());
-        }
-    });
+    // FIXME - See FIXMEs for similar methods above.
+    return success && (frustum.boxIntersectsFrustum(entityBox) || frustum.boxIntersectsKeyhole(entityBox));
 }
 
 void EntityTreeElement::getEntities(EntityItemFilter& filter,  QVector<EntityItemPointer>& foundEntities) {
@@ -707,6 +521,9 @@ void EntityTreeElement::cleanupDomainAndNonOwnedEntities() {
         foreach(EntityItemPointer entity, _entityItems) {
             if (!(entity->isLocalEntity() || entity->isMyAvatarEntity())) {
                 entity->preDelete();
+                if (_myTree) {
+                    _myTree->getSpatialIndex().remove(entity);
+                }
                 entity->_element = NULL;
             } else {
                 savedEntities.push_back(entity);
@@ -726,6 +543,9 @@ void EntityTreeElement::cleanupEntities() {
             // NOTE: We explicitly don't delete the EntityItem here because since we only
             // access it by smart pointers, when we remove it from the _entityItems
             // we know that it will be deleted.
+            if (_myTree) {
+                _myTree->getSpatialIndex().remove(entity);
+            }
             entity->_element = NULL;
         }
         _entityItems.clear();
@@ -744,6 +564,9 @@ bool EntityTreeElement::removeEntityItem(EntityItemPointer entity, bool deletion
     if (numEntries > 0) {
         // NOTE: only EntityTreeElement should ever be changing the value of entity->_element
         assert(entity->_element.get() == this);
+        if (_myTree) {
+            _myTree->getSpatialIndex().remove(entity);
+        }
         entity->_element = NULL;
         bumpChangedContent();
         return true;
@@ -765,6 +588,9 @@ void EntityTreeElement::addEntityItem(EntityItemPointer entity) {
     });
     bumpChangedContent();
     entity->_element = getThisPointer();
+    if (_myTree) {
+        _myTree->getSpatialIndex().insert(entity, getAACube());
+    }
 }
 
 // will average a "common reduced LOD view" from the the child elements...
@@ -173,13 +173,10 @@ public:
 
     void addEntityItem(EntityItemPointer entity);
 
-    QUuid evalClosetEntity(const glm::vec3& position, PickFilter searchFilter, float& closestDistanceSquared) const;
-    void evalEntitiesInSphere(const glm::vec3& position, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) const;
-    void evalEntitiesInSphereWithType(const glm::vec3& position, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities) const;
-    void evalEntitiesInSphereWithName(const glm::vec3& position, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities) const;
-    void evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) const;
-    void evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) const;
-    void evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) const;
+    // the exact tests of EntityTree::evalEntitiesIn*, once the bounds of the entity are known to touch the query
+    static bool checkSphereIntersection(const EntityItemPointer& entity, const glm::vec3& position, float radius);
+    static bool checkBoxIntersection(const EntityItemPointer& entity, const AABox& box);
+    static bool checkFrustumIntersection(const EntityItemPointer& entity, const ViewFrustum& frustum);
 
     /// finds all entities that match filter
     /// \param filter function that adds matching entities to foundEntities
@@ -0,0 +1,417 @@
+//
+//  ParticleEmitter.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ParticleEmitter.h"
+
+#include <random>
+
+#include <glm/gtx/transform.hpp>
+
+#include <NumericalConstants.h>
+
+using namespace particle;
+
+//
+// Particle integration
+//   positions, velocities and accelerations hold one array per component, lifetimes one value per particle.
+//
+static void integrateParticles_ref(float* const positions[3], float* const velocities[3], const float* const accelerations[3],
+                                   float* lifetimes, int numParticles, float deltaTime) {
+    const float halfDeltaTimeSquared = 0.5f * deltaTime * deltaTime;
+    for (int c = 0; c < 3; c++) {
+        float* position = positions[c];
+        float* velocity = velocities[c];
+        const float* acceleration = accelerations[c];
+        for (int i = 0; i < numParticles; i++) {
+            position[i] += velocity[i] * deltaTime + halfDeltaTimeSquared * acceleration[i];
+            velocity[i] += acceleration[i] * deltaTime;
+        }
+    }
+    for (int i = 0; i < numParticles; i++) {
+        lifetimes[i] += deltaTime;
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void integrateParticles_AVX2(float* const positions[3], float* const velocities[3], const float* const accelerations[3],
+                             float* lifetimes, int numParticles, float deltaTime);
+
+static void integrateParticles(float* const positions[3], float* const velocities[3], const float* const accelerations[3],
+                               float* lifetimes, int numParticles, float deltaTime) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        integrateParticles_AVX2(positions, velocities, accelerations, lifetimes, numParticles, deltaTime);
+    } else {
+        integrateParticles_ref(positions, velocities, accelerations, lifetimes, numParticles, deltaTime);
+    }
+}
+
+#else   // portable reference code
+static auto& integrateParticles = integrateParticles_ref;
+#endif
+
+Emitter::Emitter() : Emitter(std::random_device()()) {
+}
+
+Emitter::Emitter(uint32_t seed) : _random(seed != 0 ? seed : 1) {
+}
+
+float Emitter::randFloat() {
+    // xorshift32, the top 24 bits as a float in [0, 1)
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return (float)(_random >> 8) * (1.0f / 16777216.0f);
+}
+
+int Emitter::randIntInRange(int min, int max) {
+    return std::min(min + (int)(randFloat() * (float)(max - min + 1)), max);
+}
+
+// FIXME: these methods assume uniform emitDimensions, need to importance sample based on dimensions
+float Emitter::importanceSample2DDimension(float startDim) {
+    float dimension = 1.0f;
+    if (startDim < 1.0f) {
+        float innerDimensionSquared = startDim * startDim;
+        float outerDimensionSquared = 1.0f;  // pow(particle::MAXIMUM_EMIT_RADIUS_START, 2);
+        float randDimensionSquared = randFloatInRange(innerDimensionSquared, outerDimensionSquared);
+        dimension = std::sqrt(randDimensionSquared);
+    }
+    return dimension;
+}
+
+float Emitter::importanceSample3DDimension(float startDim) {
+    float dimension = 1.0f;
+    if (startDim < 1.0f) {
+        float innerDimensionCubed = startDim * startDim * startDim;
+        float outerDimensionCubed = 1.0f;  // pow(particle::MAXIMUM_EMIT_RADIUS_START, 3);
+        float randDimensionCubed = randFloatInRange(innerDimensionCubed, outerDimensionCubed);
+        dimension = std::cbrt(randDimensionCubed);
+    }
+    return dimension;
+}
+
+void Emitter::clear() {
+    for (auto& component : _components) {
+        component.clear();
+    }
+    _expirations.clear();
+    _timeUntilNextEmit = 0;
+}
+
+glm::vec3 Emitter::getRelativePosition(int i) const {
+    return glm::vec3(_components[POSITION_X][i], _components[POSITION_Y][i], _components[POSITION_Z][i]);
+}
+
+glm::vec3 Emitter::getVelocity(int i) const {
+    return glm::vec3(_components[VELOCITY_X][i], _components[VELOCITY_Y][i], _components[VELOCITY_Z][i]);
+}
+
+uint32_t Emitter::countEmissions(uint64_t interval, uint64_t emitInterval) {
+    uint32_t numEmissions = 0;
+    if (emitInterval > 0 && interval >= _timeUntilNextEmit) {
+        auto timeRemaining = interval;
+        while (timeRemaining > _timeUntilNextEmit) {
+            numEmissions++;
+            _timeUntilNextEmit = emitInterval;
+            if (emitInterval < timeRemaining) {
+                timeRemaining -= emitInterval;
+            }
+        }
+    } else {
+        _timeUntilNextEmit -= interval;
+    }
+    return numEmissions;
+}
+
+Emitter::Emission Emitter::sampleEmission(const Properties& properties, ShapeType shapeType, const TriangleInfo& triangleInfo) {
+    Emission emission { glm::vec3(0.0f), glm::vec3(0.0f) };
+
+    const auto& azimuthStart = properties.azimuth.start;
+    const auto& azimuthFinish = properties.azimuth.finish;
+    const auto& emitDimensions = properties.emission.dimensions;
+    const auto& emitRadiusStart = glm::max(properties.radiusStart, EPSILON); // Avoid math complications at center
+    const auto& polarStart = properties.polar.start;
+    const auto& polarFinish = properties.polar.finish;
+
+    if (polarStart == 0.0f && polarFinish == 0.0f && emitDimensions.z == 0.0f) {
+        // Emit along z-axis from position
+        emission.direction = Vectors::UNIT_Z;
+        return emission;
+    }
+
+    // Emit around point or from ellipsoid
+    // - Distribute directions evenly around point
+    // - Distribute points relatively evenly over ellipsoid surface
+    // - Distribute points relatively evenly within ellipsoid volume
+
+    float elevationMinZ = sinf(PI_OVER_TWO - polarFinish);
+    float elevationMaxZ = sinf(PI_OVER_TWO - polarStart);
+    float elevation = asinf(elevationMinZ + (elevationMaxZ - elevationMinZ) * randFloat());
+
+    float azimuth;
+    if (azimuthFinish >= azimuthStart) {
+        azimuth = azimuthStart + (azimuthFinish - azimuthStart) * randFloat();
+    } else {
+        azimuth = azimuthStart + (TWO_PI + azimuthFinish - azimuthStart) * randFloat();
+    }
+    // TODO: azimuth and elevation are only used for ellipsoids/circles, but could be used for other shapes too
+
+    if (emitDimensions == Vectors::ZERO) {
+        // Point
+        emission.direction = glm::quat(glm::vec3(PI_OVER_TWO - elevation, 0.0f, azimuth)) * Vectors::UNIT_Z;
+        return emission;
+    }
+
+    glm::vec3& emitPosition = emission.position;
+    glm::vec3& emitDirection = emission.direction;
+    switch (shapeType) {
+        case SHAPE_TYPE_BOX: {
+            glm::vec3 dim = importanceSample3DDimension(emitRadiusStart) * 0.5f * emitDimensions;
+
+            int side = randIntInRange(0, 5);
+            int axis = side % 3;
+            float direction = side > 2 ? 1.0f : -1.0f;
+
+            emitDirection[axis] = direction;
+            emitPosition[axis] = direction * dim[axis];
+            axis = (axis + 1) % 3;
+            emitPosition[axis] = dim[axis] * randFloatInRange(-1.0f, 1.0f);
+            axis = (axis + 1) % 3;
+            emitPosition[axis] = dim[axis] * randFloatInRange(-1.0f, 1.0f);
+            break;
+        }
+
+        case SHAPE_TYPE_CYLINDER_X:
+        case SHAPE_TYPE_CYLINDER_Y:
+        case SHAPE_TYPE_CYLINDER_Z: {
+            glm::vec3 radii = importanceSample2DDimension(emitRadiusStart) * 0.5f * emitDimensions;
+            int axis = shapeType - SHAPE_TYPE_CYLINDER_X;
+
+            emitPosition[axis] = emitDimensions[axis] * randFloatInRange(-0.5f, 0.5f);
+            emitDirection[axis] = 0.0f;
+            axis = (axis + 1) % 3;
+            emitPosition[axis] = radii[axis] * glm::cos(azimuth);
+            emitDirection[axis] = radii[axis] > 0.0f ? emitPosition[axis] / (radii[axis] * radii[axis]) : 0.0f;
+            axis = (axis + 1) % 3;
+            emitPosition[axis] = radii[axis] * glm::sin(azimuth);
+            emitDirection[axis] = radii[axis] > 0.0f ? emitPosition[axis] / (radii[axis] * radii[axis]) : 0.0f;
+            emitDirection = glm::normalize(emitDirection);
+            break;
+        }
+
+        case SHAPE_TYPE_CIRCLE: {
+            glm::vec2 radii = importanceSample2DDimension(emitRadiusStart) * 0.5f * glm::vec2(emitDimensions.x, emitDimensions.z);
+            float x = radii.x * glm::cos(azimuth);
+            float z = radii.y * glm::sin(azimuth);
+            emitPosition = glm::vec3(x, 0.0f, z);
+            emitDirection = Vectors::UP;
+            break;
+        }
+        case SHAPE_TYPE_PLANE: {
+            glm::vec2 dim = importanceSample2DDimension(emitRadiusStart) * 0.5f * glm::vec2(emitDimensions.x, emitDimensions.z);
+
+            int side = randIntInRange(0, 3);
+            int axis = side % 2;
+            float direction = side > 1 ? 1.0f : -1.0f;
+
+            glm::vec2 pos;
+            pos[axis] = direction * dim[axis];
+            axis = (axis + 1) % 2;
+            pos[axis] = dim[axis] * randFloatInRange(-1.0f, 1.0f);
+
+            emitPosition = glm::vec3(pos.x, 0.0f, pos.y);
+            emitDirection = Vectors::UP;
+            break;
+        }
+
+        case SHAPE_TYPE_COMPOUND: {
+            // if we get here we know that the triangles have been computed
+            size_t index = randFloat() * triangleInfo.totalSamples;
+            Triangle triangle;
+            for (size_t i = 0; i < triangleInfo.samplesPerTriangle.size(); i++) {
+                size_t numSamples = triangleInfo.samplesPerTriangle[i];
+                if (index < numSamples) {
+                    triangle = triangleInfo.triangles[i];
+                    break;
+                }
+                index -= numSamples;
+            }
+
+            float edgeLength1 = glm::length(triangle.v1 - triangle.v0);
+            float edgeLength2 = glm::length(triangle.v2 - triangle.v1);
+            float edgeLength3 = glm::length(triangle.v0 - triangle.v2);
+
+            float perimeter = edgeLength1 + edgeLength2 + edgeLength3;
+            float fraction1 = randFloatInRange(0.0f, 1.0f);
+            float fractionEdge1 = glm::min(fraction1 * perimeter / edgeLength1, 1.0f);
+            float fraction2 = fraction1 - edgeLength1 / perimeter;
+            float fractionEdge2 = glm::clamp(fraction2 * perimeter / edgeLength2, 0.0f, 1.0f);
+            float fraction3 = fraction2 - edgeLength2 / perimeter;
+            float fractionEdge3 = glm::clamp(fraction3 * perimeter / edgeLength3, 0.0f, 1.0f);
+
+            float dim = importanceSample2DDimension(emitRadiusStart);
+            triangle = triangle * (glm::scale(emitDimensions) * triangleInfo.transform);
+            glm::vec3 center = (triangle.v0 + triangle.v1 + triangle.v2) / 3.0f;
+            glm::vec3 v0 = (dim * (triangle.v0 - center)) + center;
+            glm::vec3 v1 = (dim * (triangle.v1 - center)) + center;
+            glm::vec3 v2 = (dim * (triangle.v2 - center)) + center;
+
+            emitPosition = glm::mix(v0, glm::mix(v1, glm::mix(v2, v0, fractionEdge3), fractionEdge2), fractionEdge1);
+            emitDirection = triangle.getNormal();
+            break;
+        }
+
+        case SHAPE_TYPE_SPHERE:
+        case SHAPE_TYPE_ELLIPSOID:
+        default: {
+            glm::vec3 radii = importanceSample3DDimension(emitRadiusStart) * 0.5f * emitDimensions;
+            float x = radii.x * glm::cos(elevation) * glm::cos(azimuth);
+            float y = radii.y * glm::cos(elevation) * glm::sin(azimuth);
+            float z = radii.z * glm::sin(elevation);
+            emitPosition = glm::vec3(x, y, z);
+            emitDirection = glm::normalize(glm::vec3(radii.x > 0.0f ? x / (radii.x * radii.x) : 0.0f,
+                                                     radii.y > 0.0f ? y / (radii.y * radii.y) : 0.0f,
+                                                     radii.z > 0.0f ? z / (radii.z * radii.z) : 0.0f));
+            break;
+        }
+    }
+    return emission;
+}
+
+void Emitter::emit(uint32_t numParticles, uint64_t now, const Properties& properties, const Transform& transform,
+                   ShapeType shapeType, const TriangleInfo& triangleInfo) {
+    const size_t begin = _expirations.size();
+    const size_t end = begin + numParticles;
+    for (auto& component : _components) {
+        component.resize(end);
+    }
+    _expirations.resize(end, now + (uint64_t)(properties.lifespan * USECS_PER_SECOND));
+
+    float* seeds = _components[SEED].data();
+    float* lifetimes = _components[LIFETIME].data();
+    float* base[3] = { _components[BASE_X].data(), _components[BASE_Y].data(), _components[BASE_Z].data() };
+    float* positions[3] = { _components[POSITION_X].data(), _components[POSITION_Y].data(), _components[POSITION_Z].data() };
+    float* velocities[3] = { _components[VELOCITY_X].data(), _components[VELOCITY_Y].data(), _components[VELOCITY_Z].data() };
+    float* accelerations[3] = { _components[ACCELERATION_X].data(), _components[ACCELERATION_Y].data(), _components[ACCELERATION_Z].data() };
+
+    // the shape dependent positions and directions, and the random numbers, one particle at a time
+    const glm::quat emitOrientation = transform.getRotation() * properties.emission.orientation;
+    std::vector<float> speedSpreads(numParticles);
+    for (size_t i = begin; i < end; i++) {
+        seeds[i] = randFloatInRange(-1.0f, 1.0f);
+        Emission emission = sampleEmission(properties, shapeType, triangleInfo);
+        glm::vec3 position = emitOrientation * emission.position;
+        glm::vec3 direction = emitOrientation * emission.direction;
+        speedSpreads[i - begin] = randFloatInRange(-1.0f, 1.0f);
+        for (int c = 0; c < 3; c++) {
+            positions[c][i] = position[c];
+            velocities[c][i] = direction[c];
+            accelerations[c][i] = randFloatInRange(-1.0f, 1.0f);
+        }
+    }
+
+    // then the rest of the batch, one component at a time
+    const glm::vec3 basePosition = transform.getTranslation();
+    const float emitSpeed = properties.emission.speed.target;
+    const float speedSpread = properties.emission.speed.spread;
+    const glm::vec3& emitAcceleration = properties.emission.acceleration.target;
+    const glm::vec3& accelerationSpread = properties.emission.acceleration.spread;
+    for (size_t i = begin; i < end; i++) {
+        lifetimes[i] = 0.0f;
+    }
+    for (int c = 0; c < 3; c++) {
+        float* baseComponent = base[c];
+        float* velocity = velocities[c];
+        float* acceleration = accelerations[c];
+        for (size_t i = begin; i < end; i++) {
+            baseComponent[i] = basePosition[c];
+            velocity[i] *= emitSpeed + speedSpreads[i - begin] * speedSpread;
+            acceleration[i] = emitAcceleration[c] + acceleration[i] * accelerationSpread[c];
+        }
+    }
+}
+
+void Emitter::kill(uint64_t now, uint32_t maxParticles) {
+    // the oldest particles are first
+    size_t numParticles = _expirations.size();
+    size_t numKilled = numParticles > maxParticles ? numParticles - maxParticles : 0;
+    while (numKilled < numParticles && _expirations[numKilled] <= now) {
+        numKilled++;
+    }
+    if (numKilled == 0) {
+        return;
+    }
+    for (auto& component : _components) {
+        component.erase(component.begin(), component.begin() + numKilled);
+    }
+    _expirations.erase(_expirations.begin(), _expirations.begin() + numKilled);
+}
+
+void Emitter::switchTrail(bool shouldTrail, const glm::vec3& emitterPosition) {
+    if (!_prevShouldTrailInitialized) {
+        _prevShouldTrailInitialized = true;
+        _prevShouldTrail = shouldTrail;
+    }
+    if (_prevShouldTrail != shouldTrail) {
+        size_t numParticles = _expirations.size();
+        for (int c = 0; c < 3; c++) {
+            float* base = _components[BASE_X + c].data();
+            float* position = _components[POSITION_X + c].data();
+            if (_prevShouldTrail) {
+                for (size_t i = 0; i < numParticles; i++) {
+                    position[i] += base[i] - emitterPosition[c];
+                }
+            }
+            for (size_t i = 0; i < numParticles; i++) {
+                base[i] = emitterPosition[c];
+            }
+        }
+    }
+    _prevShouldTrail = shouldTrail;
+}
+
+void Emitter::step(uint64_t now, uint64_t interval, bool emitting, const Properties& properties, const Transform& transform,
+                   ShapeType shapeType, const TriangleInfo& triangleInfo) {
+    if (emitting && properties.emitting()) {
+        // anything past maxParticles would be killed right away
+        uint32_t numEmissions = std::min(countEmissions(interval, properties.emitIntervalUsecs()), properties.maxParticles);
+        if (numEmissions > 0) {
+            emit(numEmissions, now, properties, transform, shapeType, triangleInfo);
+        }
+    }
+
+    // Kill any particles that have expired or are over the max size
+    kill(now, properties.maxParticles);
+
+    switchTrail(properties.emission.shouldTrail, transform.getTranslation());
+
+    float* positions[3] = { _components[POSITION_X].data(), _components[POSITION_Y].data(), _components[POSITION_Z].data() };
+    float* velocities[3] = { _components[VELOCITY_X].data(), _components[VELOCITY_Y].data(), _components[VELOCITY_Z].data() };
+    const float* accelerations[3] = { _components[ACCELERATION_X].data(), _components[ACCELERATION_Y].data(), _components[ACCELERATION_Z].data() };
+    const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
+    integrateParticles(positions, velocities, accelerations, _components[LIFETIME].data(), size(), deltaTime);
+}
+
+void Emitter::getVertices(Vertices& vertices, const glm::vec3& emitterPosition, bool shouldTrail) const {
+    size_t numParticles = _expirations.size();
+    vertices.clear();
+    vertices.reserve(numParticles);
+    for (size_t i = 0; i < numParticles; i++) {
+        glm::vec3 position(_components[POSITION_X][i], _components[POSITION_Y][i], _components[POSITION_Z][i]);
+        position += shouldTrail ? glm::vec3(_components[BASE_X][i], _components[BASE_Y][i], _components[BASE_Z][i]) : emitterPosition;
+        vertices.emplace_back(position, glm::vec2(_components[LIFETIME][i], _components[SEED][i]));
+    }
+}
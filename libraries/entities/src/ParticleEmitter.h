@@ -0,0 +1,103 @@
+//
+//  ParticleEmitter.h
+//  libraries/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ParticleEmitter_h
+#define hifi_ParticleEmitter_h
+
+#include <vector>
+
+#include <GeometryUtil.h>
+#include <ShapeInfo.h>
+#include <Transform.h>
+
+#include "ParticleEffectEntityItem.h"
+
+namespace particle {
+
+// The CPU simulation of the particles of one emitter, independent of the renderer so that it can run on any thread.
+//   The particles are stored as a structure of arrays in the order they were emitted, so the oldest are always first.
+//   New particles are spawned a batch at a time, and all of them are integrated in one pass over the arrays.
+//   Each emitter has its own random generator, so that several can step at once.
+class Emitter {
+public:
+    // The triangles of a compound shape, sampled in proportion to their area
+    struct TriangleInfo {
+        std::vector<Triangle> triangles;
+        std::vector<size_t> samplesPerTriangle;
+        size_t totalSamples { 0 };
+        glm::mat4 transform;
+    };
+
+    // One per particle, the layout of the particle vertex stream: position, lifetime and seed
+    struct Vertex {
+        Vertex(const glm::vec3& xyzIn, const glm::vec2& uvIn) : xyz(xyzIn), uv(uvIn) {}
+        glm::vec3 xyz;
+        glm::vec2 uv;
+    };
+    using Vertices = std::vector<Vertex>;
+
+    Emitter();
+    Emitter(uint32_t seed);
+
+    // Emits the particles due in interval, kills the expired ones and integrates the others.
+    void step(uint64_t now, uint64_t interval, bool emitting, const Properties& properties, const Transform& transform,
+              ShapeType shapeType, const TriangleInfo& triangleInfo);
+    void getVertices(Vertices& vertices, const glm::vec3& emitterPosition, bool shouldTrail) const;
+
+    // The next step emits right away
+    void resetEmitTimer() { _timeUntilNextEmit = 0; }
+    void clear();
+
+    int size() const { return (int)_expirations.size(); }
+    glm::vec3 getRelativePosition(int i) const;
+    glm::vec3 getVelocity(int i) const;
+    float getLifetime(int i) const { return _components[LIFETIME][i]; }
+
+private:
+    enum Component {
+        SEED = 0,
+        LIFETIME,
+        BASE_X, BASE_Y, BASE_Z,
+        POSITION_X, POSITION_Y, POSITION_Z,
+        VELOCITY_X, VELOCITY_Y, VELOCITY_Z,
+        ACCELERATION_X, ACCELERATION_Y, ACCELERATION_Z,
+        NUM_COMPONENTS
+    };
+
+    // the shape dependent part of a new particle, relative to the emitter
+    struct Emission {
+        glm::vec3 position;
+        glm::vec3 direction;
+    };
+
+    uint32_t countEmissions(uint64_t interval, uint64_t emitInterval);
+    void emit(uint32_t numParticles, uint64_t now, const Properties& properties, const Transform& transform,
+              ShapeType shapeType, const TriangleInfo& triangleInfo);
+    Emission sampleEmission(const Properties& properties, ShapeType shapeType, const TriangleInfo& triangleInfo);
+    void kill(uint64_t now, uint32_t maxParticles);
+    void switchTrail(bool shouldTrail, const glm::vec3& emitterPosition);
+
+    float randFloat();
+    float randFloatInRange(float min, float max) { return min + (max - min) * randFloat(); }
+    int randIntInRange(int min, int max);
+    float importanceSample2DDimension(float startDim);
+    float importanceSample3DDimension(float startDim);
+
+    std::vector<float> _components[NUM_COMPONENTS];
+    std::vector<uint64_t> _expirations;
+    uint64_t _timeUntilNextEmit { 0 };
+    uint32_t _random;
+    bool _prevShouldTrail { false };
+    bool _prevShouldTrailInitialized { false };
+};
+
+} // namespace particle
+
+#endif // hifi_ParticleEmitter_h
@@ -0,0 +1,56 @@
+//
+//  ParticleEmitter_avx2.cpp
+//  entities/src/avx2
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+// 8 particles at a time, see integrateParticles_ref in ParticleEmitter.cpp
+void integrateParticles_AVX2(float* const positions[3], float* const velocities[3], const float* const accelerations[3],
+                             float* lifetimes, int numParticles, float deltaTime) {
+
+    const float halfDeltaTimeSquared = 0.5f * deltaTime * deltaTime;
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 halfDtSquared = _mm256_set1_ps(halfDeltaTimeSquared);
+    const int numBatched = numParticles & ~7;
+
+    for (int c = 0; c < 3; c++) {
+        float* position = positions[c];
+        float* velocity = velocities[c];
+        const float* acceleration = accelerations[c];
+
+        for (int i = 0; i < numBatched; i += 8) {
+            __m256 p = _mm256_loadu_ps(&position[i]);
+            __m256 v = _mm256_loadu_ps(&velocity[i]);
+            __m256 a = _mm256_loadu_ps(&acceleration[i]);
+
+            // p += v * dt + 0.5 * dt^2 * a
+            p = _mm256_add_ps(p, _mm256_add_ps(_mm256_mul_ps(v, dt), _mm256_mul_ps(halfDtSquared, a)));
+            // v += a * dt
+            v = _mm256_add_ps(v, _mm256_mul_ps(a, dt));
+
+            _mm256_storeu_ps(&position[i], p);
+            _mm256_storeu_ps(&velocity[i], v);
+        }
+        for (int i = numBatched; i < numParticles; i++) {
+            position[i] += velocity[i] * deltaTime + halfDeltaTimeSquared * acceleration[i];
+            velocity[i] += acceleration[i] * deltaTime;
+        }
+    }
+
+    for (int i = 0; i < numBatched; i += 8) {
+        _mm256_storeu_ps(&lifetimes[i], _mm256_add_ps(_mm256_loadu_ps(&lifetimes[i]), dt));
+    }
+    for (int i = numBatched; i < numParticles; i++) {
+        lifetimes[i] += deltaTime;
+    }
+}
+
+#endif
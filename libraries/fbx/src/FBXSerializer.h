@@ -124,6 +124,10 @@ public:
 
     FBXNode _rootNode;
     static FBXNode parseFBX(QIODevice* device);
+    /// Parses a binary file in place, without copying data into a stream
+    /// \exception QString if the file is corrupt
+    static FBXNode parseFBX(const hifi::ByteArray& data);
+    static FBXNode parseBinaryFBX(const hifi::ByteArray& data);
 
     HFMModel* extractHFMModel(const hifi::VariantHash& mapping, const QString& url);
 
@@ -11,9 +11,13 @@
 
 #include "FBXSerializer.h"
 
-#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <zlib.h>
+
 #include <QtCore/QBuffer>
-#include <QtCore/QDataStream>
 #include <QtCore/QIODevice>
 #include <QtCore/QStringList>
 #include <QtCore/QTextStream>
@@ -22,188 +26,178 @@
 #include <QtCore/QFileInfo>
 
 #include <shared/NsightHelpers.h>
+#include <TBBHelpers.h>
 #include <hfm/ModelFormatLogging.h>
 
-template<class T>
-int streamSize() {
-    return sizeof(T);
-}
+// Reads little-endian values straight out of the file contents, without copying them into a stream.
+class FBXBinaryReader {
+public:
+    FBXBinaryReader(const hifi::ByteArray& data) :
+        _begin(data.constData()), _cursor(data.constData()), _end(data.constData() + data.size()) {}
 
-template<bool>
-int streamSize() {
-    return 1;
-}
+    qint64 position() const { return _cursor - _begin; }
+    qint64 bytesAvailable() const { return _end - _cursor; }
 
-template<class T>
-QVariant readBinaryArray(QDataStream& in, int& position) {
-    quint32 arrayLength;
-    quint32 encoding;
-    quint32 compressedLength;
+    // returns a pointer to the next length bytes and moves past them
+    const char* skip(qint64 length) {
+        if (length < 0 || length > bytesAvailable()) {
+            throw QString("corrupt fbx file");
+        }
+        const char* data = _cursor;
+        _cursor += length;
+        return data;
+    }
 
-    in >> arrayLength;
+    template<class T>
+    T read() {
+        T value;
+        memcpy(&value, skip(sizeof(T)), sizeof(T));
+        swapBytes((char*)&value, 1, sizeof(T));
+        return value;
+    }
+
+    // converts count little-endian values of elementSize bytes to the host order, in place
+    static void swapBytes(char* data, int count, int elementSize) {
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+        for (char* end = data + count * elementSize; data != end; data += elementSize) {
+            std::reverse(data, data + elementSize);
+        }
+#else
+        Q_UNUSED(data);
+        Q_UNUSED(count);
+        Q_UNUSED(elementSize);
+#endif
+    }
+
+private:
+    const char* _begin;
+    const char* _cursor;
+    const char* _end;
+};
+
+// A compressed array property, which is inflated into its (already allocated) QVector once the whole file is parsed
+struct FBXCompressedArray {
+    const char* source;
+    quint32 sourceLength;
+    char* destination;
+    quint32 destinationLength;
+    int elementSize;
+};
+using FBXCompressedArrays = std::vector<FBXCompressedArray>;
+
+template<class T>
+QVariant readBinaryArray(FBXBinaryReader& reader, FBXCompressedArrays& compressedArrays) {
+    quint32 arrayLength = reader.read<quint32>();
     if (arrayLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: binary data exceeds data limits");
     }
-    in >> encoding;
-    in >> compressedLength;
+    quint32 encoding = reader.read<quint32>();
+    quint32 compressedLength = reader.read<quint32>();
     if (compressedLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: compressed binary data exceeds data limits");
     }
-    position += sizeof(quint32) * 3;
-
-    QVector<T> values;
-    if ((int)QSysInfo::ByteOrder == (int)in.byteOrder()) {
-        values.resize(arrayLength);
-        hifi::ByteArray arrayData;
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            arrayData = qUncompress(compressed);
-            if (arrayData.isEmpty() ||
-                (unsigned int)arrayData.size() != (sizeof(T) * arrayLength)) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
-            }
-        } else {
-            arrayData.resize(sizeof(T) * arrayLength);
-            position += sizeof(T) * arrayLength;
-            in.readRawData(arrayData.data(), arrayData.size());
-        }
 
-        if (arrayData.size() > 0) {
-            memcpy(&values[0], arrayData.constData(), arrayData.size());
+    QVector<T> values(arrayLength);
+    if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
+        const char* compressed = reader.skip(compressedLength);
+        if (arrayLength > 0) {
+            // the QVariant shares the buffer of values, so it can be filled in later
+            compressedArrays.push_back({ compressed, compressedLength, (char*)values.data(),
+                (quint32)(arrayLength * sizeof(T)), (int)sizeof(T) });
         }
     } else {
-        values.reserve(arrayLength);
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            hifi::ByteArray uncompressed = qUncompress(compressed);
-            if (uncompressed.isEmpty()) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
-            }
-            QDataStream uncompressedIn(uncompressed);
-            uncompressedIn.setByteOrder(QDataStream::LittleEndian);
-            uncompressedIn.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                uncompressedIn >> value;
-                values.append(value);
-            }
-        } else {
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                in >> value;
-                position += streamSize<T>();
-                values.append(value);
-            }
+        const char* arrayData = reader.skip(arrayLength * sizeof(T));
+        if (arrayLength > 0) {
+            memcpy(values.data(), arrayData, arrayLength * sizeof(T));
+            FBXBinaryReader::swapBytes((char*)values.data(), arrayLength, sizeof(T));
         }
     }
     return QVariant::fromValue(values);
 }
 
-QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
-    char ch;
-    in.device()->getChar(&ch);
-    position++;
+// Inflates the compressed arrays of a file in parallel: large models have hundreds of them, and they dominate parse time.
+void decompressBinaryArrays(const FBXCompressedArrays& compressedArrays) {
+    std::atomic<bool> isCorrupt { false };
+    tbb::parallel_for((size_t)0, compressedArrays.size(), [&](size_t i) {
+        const FBXCompressedArray& array = compressedArrays[i];
+        uLongf length = array.destinationLength;
+        if (uncompress((Bytef*)array.destination, &length, (const Bytef*)array.source, array.sourceLength) != Z_OK ||
+            length != array.destinationLength) {
+            isCorrupt = true;
+            return;
+        }
+        FBXBinaryReader::swapBytes(array.destination, array.destinationLength / array.elementSize, array.elementSize);
+    });
+    if (isCorrupt) {
+        throw QString("corrupt fbx file");
+    }
+}
+
+QVariant parseBinaryFBXProperty(FBXBinaryReader& reader, FBXCompressedArrays& compressedArrays) {
+    char ch = reader.read<char>();
     switch (ch) {
         case 'Y': {
-            qint16 value;
-            in >> value;
-            position += sizeof(qint16);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(reader.read<qint16>());
         }
         case 'C': {
-            bool value;
-            in >> value;
-            position++;
+            bool value = (reader.read<qint8>() != 0);
             return QVariant::fromValue(value);
         }
         case 'I': {
-            qint32 value;
-            in >> value;
-            position += sizeof(qint32);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(reader.read<qint32>());
         }
         case 'F': {
-            float value;
-            in >> value;
-            position += sizeof(float);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(reader.read<float>());
         }
         case 'D': {
-            double value;
-            in >> value;
-            position += sizeof(double);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(reader.read<double>());
         }
         case 'L': {
-            qint64 value;
-            in >> value;
-            position += sizeof(qint64);
-            return QVariant::fromValue(value);
+            return QVariant::fromValue(reader.read<qint64>());
         }
         case 'f': {
-            return readBinaryArray<float>(in, position);
+            return readBinaryArray<float>(reader, compressedArrays);
         }
         case 'd': {
-            return readBinaryArray<double>(in, position);
+            return readBinaryArray<double>(reader, compressedArrays);
         }
         case 'l': {
-            return readBinaryArray<qint64>(in, position);
+            return readBinaryArray<qint64>(reader, compressedArrays);
         }
         case 'i': {
-            return readBinaryArray<qint32>(in, position);
+            return readBinaryArray<qint32>(reader, compressedArrays);
         }
         case 'b': {
-            return readBinaryArray<bool>(in, position);
+            return readBinaryArray<bool>(reader, compressedArrays);
         }
         case 'S':
         case 'R': {
-            quint32 length;
-            in >> length;
-            position += sizeof(quint32) + length;
-            return QVariant::fromValue(in.device()->read(length));
+            quint32 length = reader.read<quint32>();
+            const char* data = reader.skip(length);
+            return QVariant::fromValue(hifi::ByteArray(data, length));
         }
         default:
             throw QString("Unknown property type: ") + ch;
     }
 }
 
-FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPositions = false) {
+FBXNode parseBinaryFBXNode(FBXBinaryReader& reader, FBXCompressedArrays& compressedArrays, bool has64BitPositions = false) {
     qint64 endOffset;
     quint64 propertyCount;
-    quint64 propertyListLength;
-    quint8 nameLength;
 
     // FBX 2016 and beyond uses 64bit positions in the node headers, pre-2016 used 32bit values
     // our code generally doesn't care about the size that much, so we will use 64bit values
-    // from here on out, but if the file is an older format we read the stream into temp 32bit 
-    // values and then assign to our actual 64bit values.
+    // from here on out, but if the file is an older format we read the 32bit values and widen them.
     if (has64BitPositions) {
-        in >> endOffset;
-        in >> propertyCount;
-        in >> propertyListLength;
-        position += sizeof(quint64) * 3;
+        endOffset = reader.read<qint64>();
+        propertyCount = reader.read<quint64>();
+        reader.read<quint64>(); // propertyListLength
     } else {
-        qint32 tempEndOffset;
-        quint32 tempPropertyCount;
-        quint32 tempPropertyListLength;
-        in >> tempEndOffset;
-        in >> tempPropertyCount;
-        in >> tempPropertyListLength;
-        position += sizeof(quint32) * 3;
-        endOffset = tempEndOffset;
-        propertyCount = tempPropertyCount;
-        propertyListLength = tempPropertyListLength;
-    }
-    in >> nameLength;
-    position += sizeof(quint8);
+        endOffset = reader.read<qint32>();
+        propertyCount = reader.read<quint32>();
+        reader.read<quint32>(); // propertyListLength
+    }
+    quint8 nameLength = reader.read<quint8>();
 
     FBXNode node;
     const int MIN_VALID_OFFSET = 40;
@@ -211,15 +205,15 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
         // use a null name to indicate a null node
         return node;
     }
-    node.name = in.device()->read(nameLength);
-    position += nameLength;
+    const char* name = reader.skip(nameLength);
+    node.name = hifi::ByteArray(name, nameLength);
 
-    for (quint32 i = 0; i < propertyCount; i++) {
-        node.properties.append(parseBinaryFBXProperty(in, position));
+    for (quint64 i = 0; i < propertyCount; i++) {
+        node.properties.append(parseBinaryFBXProperty(reader, compressedArrays));
     }
 
-    while (endOffset > position) {
-        FBXNode child = parseBinaryFBXNode(in, position, has64BitPositions);
+    while (endOffset > reader.position()) {
+        FBXNode child = parseBinaryFBXNode(reader, compressedArrays, has64BitPositions);
         if (!child.name.isNull()) {
             node.children.append(child);
         }
@@ -369,9 +363,21 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
         }
         return top;
     }
-    QDataStream in(device);
-    in.setByteOrder(QDataStream::LittleEndian);
-    in.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
+    return parseBinaryFBX(device->readAll());
+}
+
+FBXNode FBXSerializer::parseFBX(const hifi::ByteArray& data) {
+    if (!data.startsWith(FBX_BINARY_PROLOG)) {
+        QBuffer buffer(const_cast<hifi::ByteArray*>(&data));
+        buffer.open(QIODevice::ReadOnly);
+        return parseFBX(&buffer);
+    }
+    PROFILE_RANGE_EX(resource_parse, __FUNCTION__, 0xff0000ff, data.size());
+    return parseBinaryFBX(data);
+}
+
+FBXNode FBXSerializer::parseBinaryFBX(const hifi::ByteArray& data) {
+    FBXBinaryReader reader(data);
 
     // see http://code.blender.org/index.php/2013/08/fbx-binary-file-format-specification/ for an explanation
     // of the FBX binary format
@@ -380,29 +386,28 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
     //   Bytes 0 - 20: Kaydara FBX Binary  \x00(file - magic, with 2 spaces at the end, then a NULL terminator).
     //   Bytes 21 - 22: [0x1A, 0x00](unknown but all observed files show these bytes).
     //   Bytes 23 - 26 : unsigned int, the version number. 7300 for version 7.3 for example.
-    in.skipRawData(FBX_HEADER_BYTES_BEFORE_VERSION);
-    int position = FBX_HEADER_BYTES_BEFORE_VERSION;
-    quint32 fileVersion;
-    in >> fileVersion;
-    position += sizeof(fileVersion);
+    reader.skip(FBX_HEADER_BYTES_BEFORE_VERSION);
+    quint32 fileVersion = reader.read<quint32>();
     bool has64BitPositions = (fileVersion >= FBX_VERSION_2016);
 
-    // parse the top-level node
+    // parse the node tree, leaving the compressed arrays for last
+    FBXCompressedArrays compressedArrays;
     FBXNode top;
-    while (device->bytesAvailable()) {
-        FBXNode next = parseBinaryFBXNode(in, position, has64BitPositions);
+    while (reader.bytesAvailable()) {
+        FBXNode next = parseBinaryFBXNode(reader, compressedArrays, has64BitPositions);
         if (next.name.isNull()) {
-            return top;
+            break;
 
         } else {
             top.children.append(next);
         }
     }
 
+    decompressBinaryArrays(compressedArrays);
+
     return top;
 }
 
-
 glm::vec3 FBXSerializer::getVec3(const QVariantList& properties, int index) {
     return glm::vec3(properties.at(index).value<double>(), properties.at(index + 1).value<double>(),
         properties.at(index + 2).value<double>());
@@ -410,6 +415,7 @@ glm::vec3 FBXSerializer::getVec3(const QVariantList& properties, int index) {
 
 QVector<glm::vec4> FBXSerializer::createVec4Vector(const QVector<double>& doubleVector) {
     QVector<glm::vec4> values;
+    values.reserve(doubleVector.size() / 4);
     for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 4) * 4); it != end; ) {
         float x = *it++;
         float y = *it++;
@@ -423,6 +429,7 @@ QVector<glm::vec4> FBXSerializer::createVec4Vector(const QVector<double>& double
 
 QVector<glm::vec4> FBXSerializer::createVec4VectorRGBA(const QVector<double>& doubleVector, glm::vec4& average) {
     QVector<glm::vec4> values;
+    values.reserve(doubleVector.size() / 4);
     for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 4) * 4); it != end; ) {
         float x = *it++;
         float y = *it++;
@@ -440,6 +447,7 @@ QVector<glm::vec4> FBXSerializer::createVec4VectorRGBA(const QVector<double>& do
 
 QVector<glm::vec3> FBXSerializer::createVec3Vector(const QVector<double>& doubleVector) {
     QVector<glm::vec3> values;
+    values.reserve(doubleVector.size() / 3);
     for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 3) * 3); it != end; ) {
         float x = *it++;
         float y = *it++;
@@ -451,6 +459,7 @@ QVector<glm::vec3> FBXSerializer::createVec3Vector(const QVector<double>& double
 
 QVector<glm::vec2> FBXSerializer::createVec2Vector(const QVector<double>& doubleVector) {
     QVector<glm::vec2> values;
+    values.reserve(doubleVector.size() / 2);
     for (const double* it = doubleVector.constData(), *end = it + ((doubleVector.size() / 2) * 2); it != end; ) {
         float s = *it++;
         float t = *it++;
@@ -0,0 +1,640 @@
+//
+//  BakedModelFormat.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakedModelFormat.h"
+
+#include <string>
+#include <type_traits>
+
+#include <QDataStream>
+
+#include <gpu/Stream.h>
+#include <graphics/Geometry.h>
+#include <graphics/Material.h>
+
+#include "ModelBakerLogging.h"
+
+namespace baker {
+
+const uint32_t BAKED_MODEL_FORMAT_VERSION = 1;
+
+static const quint32 BAKED_MODEL_MAGIC = 0x4c444d48; // "HMDL"
+
+// Types written as raw bytes, alone or as whole arrays
+template <class T> struct IsRaw : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+template <> struct IsRaw<glm::vec2> : std::true_type {};
+template <> struct IsRaw<glm::vec3> : std::true_type {};
+template <> struct IsRaw<glm::vec4> : std::true_type {};
+template <> struct IsRaw<glm::ivec2> : std::true_type {};
+template <> struct IsRaw<glm::quat> : std::true_type {};
+template <> struct IsRaw<glm::mat4> : std::true_type {};
+template <> struct IsRaw<Extents> : std::true_type {};
+
+// The fields of the hfm types, shared by the writer and the reader so that they cannot get out of sync
+template <class Archive> void serialize(Archive& ar, hfm::Blendshape& blendshape) {
+    ar(blendshape.indices);
+    ar(blendshape.vertices);
+    ar(blendshape.normals);
+    ar(blendshape.tangents);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::JointShapeInfo& shapeInfo) {
+    ar(shapeInfo.avgPoint);
+    ar(shapeInfo.dots);
+    ar(shapeInfo.points);
+    ar(shapeInfo.debugLines);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Joint& joint) {
+    ar(joint.shapeInfo);
+    ar(joint.parentIndex);
+    ar(joint.distanceToParent);
+    ar(joint.translation);
+    ar(joint.preTransform);
+    ar(joint.preRotation);
+    ar(joint.rotation);
+    ar(joint.postRotation);
+    ar(joint.postTransform);
+    ar(joint.transform);
+    ar(joint.rotationMin);
+    ar(joint.rotationMax);
+    ar(joint.inverseDefaultRotation);
+    ar(joint.inverseBindRotation);
+    ar(joint.bindTransform);
+    ar(joint.name);
+    ar(joint.isSkeletonJoint);
+    ar(joint.bindTransformFoundInCluster);
+    ar(joint.geometricOffset);
+    ar(joint.localTransform);
+    ar(joint.globalTransform);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Cluster& cluster) {
+    ar(cluster.jointIndex);
+    ar(cluster.inverseBindMatrix);
+    ar(cluster.inverseBindTransform);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Texture& texture) {
+    ar(texture.id);
+    ar(texture.name);
+    ar(texture.filename);
+    ar(texture.content);
+    ar(texture.sourceChannel);
+    ar(texture.transform);
+    ar(texture.maxNumPixels);
+    ar(texture.texcoordSet);
+    ar(texture.texcoordSetName);
+    ar(texture.isBumpmap);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::MeshPart& part) {
+    ar(part.quadIndices);
+    ar(part.quadTrianglesIndices);
+    ar(part.triangleIndices);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Material& material) {
+    ar(material.diffuseColor);
+    ar(material.diffuseFactor);
+    ar(material.specularColor);
+    ar(material.specularFactor);
+    ar(material.emissiveColor);
+    ar(material.emissiveFactor);
+    ar(material.shininess);
+    ar(material.opacity);
+    ar(material.metallic);
+    ar(material.roughness);
+    ar(material.emissiveIntensity);
+    ar(material.ambientFactor);
+    ar(material.bumpMultiplier);
+    ar(material.alphaMode);
+    ar(material.alphaCutoff);
+    ar(material.materialID);
+    ar(material.name);
+    ar(material.shadingModel);
+    ar(material._material);
+    ar(material.normalTexture);
+    ar(material.albedoTexture);
+    ar(material.opacityTexture);
+    ar(material.glossTexture);
+    ar(material.roughnessTexture);
+    ar(material.specularTexture);
+    ar(material.metallicTexture);
+    ar(material.emissiveTexture);
+    ar(material.occlusionTexture);
+    ar(material.scatteringTexture);
+    ar(material.lightmapTexture);
+    ar(material.lightmapParams);
+    ar(material.isPBSMaterial);
+    ar(material.useNormalMap);
+    ar(material.useAlbedoMap);
+    ar(material.useOpacityMap);
+    ar(material.useRoughnessMap);
+    ar(material.useSpecularMap);
+    ar(material.useMetallicMap);
+    ar(material.useEmissiveMap);
+    ar(material.useOcclusionMap);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::TriangleListMesh& mesh) {
+    ar(mesh.vertices);
+    ar(mesh.indices);
+    ar(mesh.parts);
+    ar(mesh.partExtents);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Mesh& mesh) {
+    ar(mesh.parts);
+    ar(mesh.vertices);
+    ar(mesh.normals);
+    ar(mesh.tangents);
+    ar(mesh.colors);
+    ar(mesh.texCoords);
+    ar(mesh.texCoords1);
+    ar(mesh.meshExtents);
+    ar(mesh.modelTransform);
+    ar(mesh.clusterIndices);
+    ar(mesh.clusterWeights);
+    ar(mesh.clusterWeightsPerVertex);
+    ar(mesh.blendshapes);
+    ar(mesh.triangleListMesh);
+    ar(mesh.originalIndices);
+    ar(mesh.meshIndex);
+    ar(mesh._mesh);
+    ar(mesh.wasCompressed);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::AnimationFrame& frame) {
+    ar(frame.rotations);
+    ar(frame.translations);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::FlowData& flowData) {
+    ar(flowData._physicsConfig);
+    ar(flowData._collisionsConfig);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::SkinDeformer& skinDeformer) {
+    ar(skinDeformer.clusters);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Shape& shape) {
+    ar(shape.mesh);
+    ar(shape.meshPart);
+    ar(shape.material);
+    ar(shape.joint);
+    ar(shape.transformedExtents);
+    ar(shape.skinDeformer);
+}
+
+template <class Archive> void serialize(Archive& ar, hfm::Model& model) {
+    ar(model.originalURL);
+    ar(model.author);
+    ar(model.applicationName);
+    ar(model.shapes);
+    ar(model.meshes);
+    ar(model.materials);
+    ar(model.skinDeformers);
+    ar(model.joints);
+    ar(model.jointIndices);
+    ar(model.hasSkeletonJoints);
+    ar(model.scripts);
+    ar(model.offset);
+    ar(model.neckPivot);
+    ar(model.bindExtents);
+    ar(model.meshExtents);
+    ar(model.animationFrames);
+    ar(model.meshIndicesToModelNames);
+    ar(model.blendshapeChannelNames);
+    ar(model.jointRotationOffsets);
+    ar(model.shapeVertices);
+    ar(model.flowData);
+}
+
+class BakedModelWriter {
+public:
+    BakedModelWriter(hifi::ByteArray& data) : _stream(&data, QIODevice::WriteOnly) {
+        _stream.setVersion(QDataStream::Qt_5_9);
+    }
+
+    template <class T>
+    typename std::enable_if<IsRaw<T>::value>::type operator()(const T& value) { writeRaw(&value, sizeof(T)); }
+
+    template <class T>
+    typename std::enable_if<!IsRaw<T>::value>::type operator()(const T& value) { serialize(*this, const_cast<T&>(value)); }
+
+    void operator()(const QString& value) { _stream << value; }
+    void operator()(const QByteArray& value) { _stream << value; }
+    void operator()(const QVariantMap& value) { _stream << value; }
+    void operator()(const std::string& value) { _stream << QByteArray::fromStdString(value); }
+
+    template <class T>
+    void operator()(const std::vector<T>& values) { writeArray(values.data(), (int)values.size()); }
+
+    template <class T>
+    void operator()(const QVector<T>& values) { writeArray(values.constData(), values.size()); }
+
+    template <class T>
+    void operator()(const QList<T>& values) {
+        (*this)((quint32)values.size());
+        for (const auto& value : values) {
+            (*this)(value);
+        }
+    }
+
+    template <class K, class V>
+    void operator()(const QHash<K, V>& values) { writeMap(values); }
+
+    template <class K, class V>
+    void operator()(const QMap<K, V>& values) { writeMap(values); }
+
+    void operator()(const Transform& transform) {
+        (*this)(transform.getRotation());
+        (*this)(transform.getScale());
+        (*this)(transform.getTranslation());
+    }
+
+    void operator()(const graphics::MaterialPointer& material);
+    void operator()(const graphics::MeshPointer& mesh);
+
+private:
+    void writeRaw(const void* data, size_t size) { _stream.writeRawData((const char*)data, (int)size); }
+
+    template <class T>
+    void writeArray(const T* values, int size) {
+        (*this)((quint32)size);
+        writeElements(values, size, IsRaw<T>());
+    }
+
+    template <class T>
+    void writeElements(const T* values, int size, std::true_type) { writeRaw(values, size * sizeof(T)); }
+
+    template <class T>
+    void writeElements(const T* values, int size, std::false_type) {
+        for (int i = 0; i < size; i++) {
+            (*this)(values[i]);
+        }
+    }
+
+    template <class Map>
+    void writeMap(const Map& values) {
+        (*this)((quint32)values.size());
+        for (auto it = values.cbegin(); it != values.cend(); ++it) {
+            (*this)(it.key());
+            (*this)(it.value());
+        }
+    }
+
+    void writeElement(const gpu::Element& element) {
+        (*this)((quint8)element.getDimension());
+        (*this)((quint8)element.getType());
+        (*this)((quint8)element.getSemantic());
+    }
+
+    void writeBuffer(const gpu::BufferPointer& buffer) {
+        quint64 size = buffer ? buffer->getSize() : 0;
+        (*this)(size);
+        if (size > 0) {
+            writeRaw(buffer->getData(), size);
+        }
+    }
+
+    QDataStream _stream;
+};
+
+// The serializers only set values on the graphics material, the texture maps are added later by NetworkMaterial
+void BakedModelWriter::operator()(const graphics::MaterialPointer& material) {
+    (*this)(material != nullptr);
+    if (!material) {
+        return;
+    }
+    const auto& key = material->getKey();
+    (*this)(material->getName());
+    (*this)(material->getModel());
+    (*this)(key.isAlbedo());
+    (*this)(material->getAlbedo(false));
+    (*this)(material->getEmissive(false));
+    (*this)(material->getOpacity());
+    (*this)(material->getRoughness());
+    (*this)(material->getMetallic());
+    (*this)(material->getScattering());
+    (*this)(material->getOpacityCutoff());
+    (*this)(key.isOpacityMapMode());
+    (*this)(key.getOpacityMapMode());
+    (*this)(key.isUnlit());
+    (*this)(material->getCullFaceMode());
+}
+
+// The layout of the meshes built by BuildGraphicsMeshTask: one vertex stream, a uint32 index buffer and a part buffer
+void BakedModelWriter::operator()(const graphics::MeshPointer& mesh) {
+    bool isValid = mesh && mesh->getVertexFormat();
+    (*this)(isValid);
+    if (!isValid) {
+        return;
+    }
+    (*this)(mesh->modelName);
+    (*this)(mesh->displayName);
+
+    const auto& attributes = mesh->getVertexFormat()->getAttributes();
+    (*this)((quint32)attributes.size());
+    for (const auto& slotAttribute : attributes) {
+        const auto& attribute = slotAttribute.second;
+        (*this)(attribute._slot);
+        (*this)(attribute._channel);
+        writeElement(attribute._element);
+        (*this)((quint64)attribute._offset);
+        (*this)(attribute._frequency);
+    }
+
+    const auto& stream = mesh->getVertexStream();
+    (*this)((quint32)stream.getBuffers().size());
+    for (size_t i = 0; i < stream.getBuffers().size(); i++) {
+        writeBuffer(stream.getBuffers()[i]);
+        (*this)((quint64)stream.getOffsets()[i]);
+        (*this)((quint64)stream.getStrides()[i]);
+    }
+
+    writeElement(mesh->getIndexBuffer()._element);
+    writeBuffer(mesh->getIndexBuffer()._buffer);
+    writeElement(mesh->getPartBuffer()._element);
+    writeBuffer(mesh->getPartBuffer()._buffer);
+}
+
+class BakedModelReader {
+public:
+    BakedModelReader(const hifi::ByteArray& data) : _stream(data) {
+        _stream.setVersion(QDataStream::Qt_5_9);
+    }
+
+    bool isValid() const { return _stream.status() == QDataStream::Ok; }
+    bool atEnd() const { return _stream.atEnd(); }
+
+    template <class T>
+    typename std::enable_if<IsRaw<T>::value>::type operator()(T& value) { readRaw(&value, sizeof(T)); }
+
+    template <class T>
+    typename std::enable_if<!IsRaw<T>::value>::type operator()(T& value) { serialize(*this, value); }
+
+    void operator()(QString& value) { _stream >> value; }
+    void operator()(QByteArray& value) { _stream >> value; }
+    void operator()(QVariantMap& value) { _stream >> value; }
+    void operator()(std::string& value) {
+        QByteArray bytes;
+        _stream >> bytes;
+        value = bytes.toStdString();
+    }
+
+    template <class T>
+    void operator()(std::vector<T>& values) {
+        values.resize(readCount(IsRaw<T>::value ? sizeof(T) : 1));
+        readElements(values.data(), (int)values.size(), IsRaw<T>());
+    }
+
+    template <class T>
+    void operator()(QVector<T>& values) {
+        values.resize(readCount(IsRaw<T>::value ? sizeof(T) : 1));
+        readElements(values.data(), values.size(), IsRaw<T>());
+    }
+
+    template <class T>
+    void operator()(QList<T>& values) {
+        values.clear();
+        for (quint32 i = 0, size = readCount(1); i < size && isValid(); i++) {
+            T value;
+            (*this)(value);
+            values.append(value);
+        }
+    }
+
+    template <class K, class V>
+    void operator()(QHash<K, V>& values) { readMap(values); }
+
+    template <class K, class V>
+    void operator()(QMap<K, V>& values) { readMap(values); }
+
+    void operator()(Transform& transform) {
+        glm::quat rotation;
+        glm::vec3 scale;
+        glm::vec3 translation;
+        (*this)(rotation);
+        (*this)(scale);
+        (*this)(translation);
+        transform = Transform();
+        transform.setRotation(rotation);
+        transform.setScale(scale);
+        transform.setTranslation(translation);
+    }
+
+    void operator()(graphics::MaterialPointer& material);
+    void operator()(graphics::MeshPointer& mesh);
+
+private:
+    void readRaw(void* data, size_t size) {
+        if (_stream.readRawData((char*)data, (int)size) != (int)size) {
+            _stream.setStatus(QDataStream::ReadPastEnd);
+        }
+    }
+
+    // a count of elements, which must fit in the rest of the data
+    quint32 readCount(size_t minElementSize) {
+        quint32 count = 0;
+        (*this)(count);
+        if (!isValid() || (qint64)(count * (quint64)minElementSize) > _stream.device()->bytesAvailable()) {
+            _stream.setStatus(QDataStream::ReadCorruptData);
+            return 0;
+        }
+        return count;
+    }
+
+    template <class T>
+    void readElements(T* values, int size, std::true_type) { readRaw(values, size * sizeof(T)); }
+
+    template <class T>
+    void readElements(T* values, int size, std::false_type) {
+        for (int i = 0; i < size && isValid(); i++) {
+            (*this)(values[i]);
+        }
+    }
+
+    template <class Map>
+    void readMap(Map& values) {
+        values.clear();
+        for (quint32 i = 0, size = readCount(1); i < size && isValid(); i++) {
+            typename Map::key_type key;
+            typename Map::mapped_type value;
+            (*this)(key);
+            (*this)(value);
+            values.insert(key, value);
+        }
+    }
+
+    gpu::Element readElement() {
+        quint8 dimension = 0;
+        quint8 type = 0;
+        quint8 semantic = 0;
+        (*this)(dimension);
+        (*this)(type);
+        (*this)(semantic);
+        if (dimension >= gpu::NUM_DIMENSIONS || type >= gpu::NUM_TYPES || semantic >= gpu::NUM_SEMANTICS) {
+            _stream.setStatus(QDataStream::ReadCorruptData);
+            return gpu::Element();
+        }
+        return gpu::Element((gpu::Dimension)dimension, (gpu::Type)type, (gpu::Semantic)semantic);
+    }
+
+    gpu::BufferPointer readBuffer() {
+        quint64 size = 0;
+        (*this)(size);
+        if (!isValid() || (qint64)size > _stream.device()->bytesAvailable()) {
+            _stream.setStatus(QDataStream::ReadCorruptData);
+            return nullptr;
+        }
+        QByteArray data((int)size, Qt::Uninitialized);
+        readRaw(data.data(), size);
+        auto buffer = std::make_shared<gpu::Buffer>();
+        buffer->setData(size, (const gpu::Byte*)data.constData());
+        return buffer;
+    }
+
+    QDataStream _stream;
+};
+
+void BakedModelReader::operator()(graphics::MaterialPointer& material) {
+    bool hasMaterial = false;
+    (*this)(hasMaterial);
+    if (!hasMaterial) {
+        material.reset();
+        return;
+    }
+
+    std::string name;
+    std::string model;
+    bool isAlbedo = false;
+    glm::vec3 albedo;
+    glm::vec3 emissive;
+    float opacity = 0.0f;
+    float roughness = 0.0f;
+    float metallic = 0.0f;
+    float scattering = 0.0f;
+    float opacityCutoff = 0.0f;
+    bool isOpacityMapMode = false;
+    graphics::MaterialKey::OpacityMapMode opacityMapMode;
+    bool isUnlit = false;
+    graphics::MaterialKey::CullFaceMode cullFaceMode;
+    (*this)(name);
+    (*this)(model);
+    (*this)(isAlbedo);
+    (*this)(albedo);
+    (*this)(emissive);
+    (*this)(opacity);
+    (*this)(roughness);
+    (*this)(metallic);
+    (*this)(scattering);
+    (*this)(opacityCutoff);
+    (*this)(isOpacityMapMode);
+    (*this)(opacityMapMode);
+    (*this)(isUnlit);
+    (*this)(cullFaceMode);
+
+    // the setters derive the same key the serializer's calls did, from the same values
+    material = std::make_shared<graphics::Material>();
+    material->setName(name);
+    material->setModel(model);
+    if (isAlbedo) {
+        material->setAlbedo(albedo, false);
+    }
+    material->setEmissive(emissive, false);
+    material->setOpacity(opacity);
+    material->setRoughness(roughness);
+    material->setMetallic(metallic);
+    material->setScattering(scattering);
+    material->setOpacityCutoff(opacityCutoff);
+    if (isOpacityMapMode) {
+        material->setOpacityMapMode(opacityMapMode);
+    }
+    material->setUnlit(isUnlit);
+    material->setCullFaceMode(cullFaceMode);
+}
+
+void BakedModelReader::operator()(graphics::MeshPointer& mesh) {
+    bool isValidMesh = false;
+    (*this)(isValidMesh);
+    if (!isValidMesh) {
+        mesh.reset();
+        return;
+    }
+    mesh = std::make_shared<graphics::Mesh>();
+    (*this)(mesh->modelName);
+    (*this)(mesh->displayName);
+
+    auto vertexFormat = std::make_shared<gpu::Stream::Format>();
+    for (quint32 i = 0, numAttributes = readCount(1); i < numAttributes && isValid(); i++) {
+        gpu::Stream::Slot slot = 0;
+        gpu::Stream::Slot channel = 0;
+        quint64 offset = 0;
+        gpu::uint32 frequency = 0;
+        (*this)(slot);
+        (*this)(channel);
+        gpu::Element element = readElement();
+        (*this)(offset);
+        (*this)(frequency);
+        vertexFormat->setAttribute(slot, channel, element, (gpu::Offset)offset, (gpu::Stream::Frequency)frequency);
+    }
+
+    auto vertexStream = std::make_shared<gpu::BufferStream>();
+    for (quint32 i = 0, numBuffers = readCount(1); i < numBuffers && isValid(); i++) {
+        auto buffer = readBuffer();
+        quint64 offset = 0;
+        quint64 stride = 0;
+        (*this)(offset);
+        (*this)(stride);
+        vertexStream->addBuffer(buffer, (gpu::Offset)offset, (gpu::Offset)stride);
+    }
+    mesh->setVertexFormatAndStream(vertexFormat, vertexStream);
+
+    auto indexElement = readElement();
+    auto indexBuffer = readBuffer();
+    mesh->setIndexBuffer(gpu::BufferView(indexBuffer, indexElement));
+
+    auto partElement = readElement();
+    auto partBuffer = readBuffer();
+    mesh->setPartBuffer(gpu::BufferView(partBuffer, partElement));
+}
+
+hifi::ByteArray writeBakedModel(const hfm::Model& hfmModel) {
+    hifi::ByteArray data;
+    BakedModelWriter writer(data);
+    writer(BAKED_MODEL_MAGIC);
+    writer(BAKED_MODEL_FORMAT_VERSION);
+    writer(hfmModel);
+    return data;
+}
+
+hfm::Model::Pointer readBakedModel(const hifi::ByteArray& data) {
+    BakedModelReader reader(data);
+    quint32 magic = 0;
+    uint32_t version = 0;
+    reader(magic);
+    reader(version);
+    if (!reader.isValid() || magic != BAKED_MODEL_MAGIC || version != BAKED_MODEL_FORMAT_VERSION) {
+        return nullptr;
+    }
+
+    auto hfmModel = std::make_shared<hfm::Model>();
+    reader(*hfmModel);
+    if (!reader.isValid() || !reader.atEnd()) {
+        qCWarning(model_baker) << "Corrupt baked model" << hfmModel->originalURL;
+        return nullptr;
+    }
+    return hfmModel;
+}
+
+};
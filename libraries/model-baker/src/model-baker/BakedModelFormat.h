@@ -0,0 +1,30 @@
+//
+//  BakedModelFormat.h
+//  model-baker/src/model-baker
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_baker_BakedModelFormat_h
+#define hifi_baker_BakedModelFormat_h
+
+#include <shared/HifiTypes.h>
+#include <hfm/HFM.h>
+
+namespace baker {
+    // Whenever a change is made to the layout written by writeBakedModel, or to the output of the serializers or
+    // the Baker, this value should be incremented so that previously written models are no longer read
+    extern const uint32_t BAKED_MODEL_FORMAT_VERSION;
+
+    // Serializes the output of Baker::getHFMModel(), including the graphics meshes and the graphics materials.
+    // The result is meant for a local cache: arrays are written in the byte order of the host.
+    hifi::ByteArray writeBakedModel(const hfm::Model& hfmModel);
+
+    // Returns nullptr if data was not written by writeBakedModel with the current version, or is corrupt
+    hfm::Model::Pointer readBakedModel(const hifi::ByteArray& data);
+};
+
+#endif // hifi_baker_BakedModelFormat_h
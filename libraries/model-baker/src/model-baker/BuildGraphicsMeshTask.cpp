@@ -14,6 +14,7 @@
 #include <glm/gtc/packing.hpp>
 
 #include <LogHandler.h>
+#include <TBBHelpers.h>
 #include "ModelBakerLogging.h"
 #include <hfm/HFMModelMath.h>
 #include "ModelMath.h"
@@ -392,8 +393,8 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
     auto& graphicsMeshes = output;
 
     int n = (int)meshes.size();
-    for (int i = 0; i < n; i++) {
-        graphicsMeshes.emplace_back();
+    graphicsMeshes.resize(n);
+    tbb::parallel_for(0, n, [&](int i) {
         auto& graphicsMesh = graphicsMeshes[i];
 
         uint16_t numDeformerControllers = 0;
@@ -413,5 +414,5 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
                 graphicsMesh->modelName = meshIndicesToModelNames[i].toStdString();
             }
         }
-    }
+    });
 }
@@ -0,0 +1,99 @@
+//
+//  HFMCache.cpp
+//  libraries/model-networking/src/model-networking
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HFMCache.h"
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QFile>
+
+#include <model-baker/BakedModelFormat.h>
+
+#include "ModelNetworkingLogging.h"
+
+using File = cache::File;
+
+// QVariantHash iteration order changes from one process to the next, so hashes are written with sorted keys
+static void writeVariant(QDataStream& out, const QVariant& value) {
+    if (value.type() == QVariant::Hash) {
+        const QVariantHash hash = value.toHash();
+        QStringList keys = hash.uniqueKeys();
+        keys.sort();
+        out << (quint32)keys.size();
+        for (const auto& key : keys) {
+            out << key;
+            for (const auto& keyValue : hash.values(key)) {
+                writeVariant(out, keyValue);
+            }
+        }
+    } else if (value.type() == QVariant::Map) {
+        const QVariantMap map = value.toMap();
+        out << (quint32)map.size();
+        for (auto it = map.cbegin(); it != map.cend(); ++it) {
+            out << it.key();
+            writeVariant(out, it.value());
+        }
+    } else if (value.type() == QVariant::List) {
+        const QVariantList list = value.toList();
+        out << (quint32)list.size();
+        for (const auto& item : list) {
+            writeVariant(out, item);
+        }
+    } else {
+        out << value;
+    }
+}
+
+HFMCache::HFMCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+HFMCache::Key HFMCache::computeKey(const hifi::ByteArray& data, const hifi::URL& url, const QString& webMediaType,
+                                   const hifi::VariantHash& mapping, const hifi::URL& materialMappingBaseURL) {
+    QByteArray parameters;
+    {
+        QBuffer buffer(&parameters);
+        buffer.open(QIODevice::WriteOnly);
+        QDataStream out(&buffer);
+        out << baker::BAKED_MODEL_FORMAT_VERSION;
+        out << url << webMediaType << materialMappingBaseURL;
+        writeVariant(out, mapping);
+    }
+
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    hasher.addData(parameters);
+    hasher.addData(data);
+    return hasher.result().toHex().toStdString();
+}
+
+hfm::Model::Pointer HFMCache::readModel(const Key& key) {
+    auto file = getFile(key);
+    if (!file) {
+        return nullptr;
+    }
+
+    QFile modelFile(QString::fromStdString(file->getFilepath()));
+    if (!modelFile.open(QIODevice::ReadOnly)) {
+        qCWarning(modelnetworking) << "Failed to open cached model" << key.c_str();
+        return nullptr;
+    }
+    return baker::readBakedModel(modelFile.readAll());
+}
+
+void HFMCache::writeModel(const Key& key, const hfm::Model& hfmModel) {
+    hifi::ByteArray data = baker::writeBakedModel(hfmModel);
+    // overwrite entries that could not be read, such as those from an older version of the format
+    writeFile(data.constData(), Metadata(key, data.size()), true);
+}
+
+std::unique_ptr<File> HFMCache::createFile(Metadata&& metadata, const std::string& filepath) {
+    qCInfo(file_cache) << "Wrote HFM" << metadata.key.c_str();
+    return FileCache::createFile(std::move(metadata), filepath);
+}
@@ -0,0 +1,39 @@
+//
+//  HFMCache.h
+//  libraries/model-networking/src/model-networking
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_HFMCache_h
+#define hifi_HFMCache_h
+
+#include <shared/FileCache.h>
+#include <shared/HifiTypes.h>
+#include <hfm/HFM.h>
+
+// On-disk cache of baked models, so that a model file that was already parsed and baked in a previous session
+// can be loaded without either.
+//   Entries are keyed by the contents of the model file, the parameters it was loaded with and the version of the
+//   baked model format, so changes to any of them simply miss and the old entries age out of the cache.
+class HFMCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    HFMCache(const std::string& dir, const std::string& ext);
+
+    static Key computeKey(const hifi::ByteArray& data, const hifi::URL& url, const QString& webMediaType,
+                          const hifi::VariantHash& mapping, const hifi::URL& materialMappingBaseURL);
+
+    // Returns nullptr if there is no valid entry for key
+    hfm::Model::Pointer readModel(const Key& key);
+    void writeModel(const Key& key, const hfm::Model& hfmModel);
+
+protected:
+    std::unique_ptr<cache::File> createFile(Metadata&& metadata, const std::string& filepath) override final;
+};
+
+#endif // hifi_HFMCache_h
@@ -28,6 +28,7 @@
 #include <OBJSerializer.h>
 #include <GLTFSerializer.h>
 #include <model-baker/Baker.h>
+#include <model-baker/ParseMaterialMappingTask.h>
 
 Q_LOGGING_CATEGORY(trace_resource_parse_geometry, "trace.resource.parse.geometry")
 
@@ -88,8 +89,9 @@ namespace std {
 class GeometryReader : public QRunnable {
 public:
     GeometryReader(const ModelLoader& modelLoader, QWeakPointer<Resource>& resource, const QUrl& url, const GeometryMappingPair& mapping,
-                   const QByteArray& data, bool combineParts, const QString& webMediaType) :
-        _modelLoader(modelLoader), _resource(resource), _url(url), _mapping(mapping), _data(data), _combineParts(combineParts), _webMediaType(webMediaType) {
+                   const QByteArray& data, bool combineParts, const QString& webMediaType, const std::shared_ptr<HFMCache>& hfmCache) :
+        _modelLoader(modelLoader), _resource(resource), _url(url), _mapping(mapping), _data(data), _combineParts(combineParts), _webMediaType(webMediaType),
+        _hfmCache(hfmCache) {
 
         DependencyManager::get<StatTracker>()->incrementStat("PendingProcessing");
     }
@@ -104,6 +106,7 @@ private:
     QByteArray _data;
     bool _combineParts;
     QString _webMediaType;
+    std::shared_ptr<HFMCache> _hfmCache;
 };
 
 void GeometryReader::run() {
@@ -139,47 +142,67 @@ void GeometryReader::run() {
             throw QString("url is invalid");
         }
 
-        HFMModel::Pointer hfmModel;
         QVariantHash serializerMapping = _mapping.second;
         serializerMapping["combineParts"] = _combineParts;
         serializerMapping["deduplicateIndices"] = true;
 
-        if (_url.path().toLower().endsWith(".gz")) {
-            QByteArray uncompressedData;
-            if (!gunzip(_data, uncompressedData)) {
-                throw QString("failed to decompress .gz model");
-            }
-            // Strip the compression extension from the path, so the loader can infer the file type from what remains.
-            // This is okay because we don't expect the serializer to be able to read the contents of a compressed model file.
-            auto strippedUrl = _url;
-            strippedUrl.setPath(_url.path().left(_url.path().size() - 3));
-            hfmModel = _modelLoader.load(uncompressedData, serializerMapping, strippedUrl, "");
-        } else {
-            hfmModel = _modelLoader.load(_data, serializerMapping, _url, _webMediaType.toStdString());
+        HFMCache::Key cacheKey;
+        HFMModel::Pointer processedHFMModel;
+        MaterialMapping materialMapping;
+        if (_hfmCache) {
+            cacheKey = HFMCache::computeKey(_data, _url, _webMediaType, serializerMapping, _mapping.first);
+            processedHFMModel = _hfmCache->readModel(cacheKey);
         }
 
-        if (!hfmModel) {
-            throw QString("unsupported format");
-        }
+        if (processedHFMModel) {
+            // The material mapping refers to network resources rather than to the model, so it is not cached
+            ParseMaterialMappingTask::Input materialMappingInput;
+            materialMappingInput.edit0() = _mapping.second;
+            materialMappingInput.edit1() = _mapping.first;
+            ParseMaterialMappingTask().run(std::make_shared<baker::BakeContext>(), materialMappingInput, materialMapping);
+        } else {
+            HFMModel::Pointer hfmModel;
+            if (_url.path().toLower().endsWith(".gz")) {
+                QByteArray uncompressedData;
+                if (!gunzip(_data, uncompressedData)) {
+                    throw QString("failed to decompress .gz model");
+                }
+                // Strip the compression extension from the path, so the loader can infer the file type from what remains.
+                // This is okay because we don't expect the serializer to be able to read the contents of a compressed model file.
+                auto strippedUrl = _url;
+                strippedUrl.setPath(_url.path().left(_url.path().size() - 3));
+                hfmModel = _modelLoader.load(uncompressedData, serializerMapping, strippedUrl, "");
+            } else {
+                hfmModel = _modelLoader.load(_data, serializerMapping, _url, _webMediaType.toStdString());
+            }
 
-        if (hfmModel->meshes.empty() || hfmModel->joints.empty()) {
-            throw QString("empty geometry, possibly due to an unsupported model version");
-        }
+            if (!hfmModel) {
+                throw QString("unsupported format");
+            }
 
-        // Add scripts to hfmModel
-        if (!serializerMapping.value(SCRIPT_FIELD).isNull()) {
-            QVariantList scripts = serializerMapping.values(SCRIPT_FIELD);
-            for (auto &script : scripts) {
-                hfmModel->scripts.push_back(script.toString());
+            if (hfmModel->meshes.empty() || hfmModel->joints.empty()) {
+                throw QString("empty geometry, possibly due to an unsupported model version");
             }
-        }
 
-        // Do processing on the model
-        baker::Baker modelBaker(hfmModel, _mapping.second, _mapping.first);
-        modelBaker.run();
+            // Add scripts to hfmModel
+            if (!serializerMapping.value(SCRIPT_FIELD).isNull()) {
+                QVariantList scripts = serializerMapping.values(SCRIPT_FIELD);
+                for (auto &script : scripts) {
+                    hfmModel->scripts.push_back(script.toString());
+                }
+            }
 
-        auto processedHFMModel = modelBaker.getHFMModel();
-        auto materialMapping = modelBaker.getMaterialMapping();
+            // Do processing on the model
+            baker::Baker modelBaker(hfmModel, _mapping.second, _mapping.first);
+            modelBaker.run();
+
+            processedHFMModel = modelBaker.getHFMModel();
+            materialMapping = modelBaker.getMaterialMapping();
+
+            if (_hfmCache) {
+                _hfmCache->writeModel(cacheKey, *processedHFMModel);
+            }
+        }
 
         QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
                 Q_ARG(HFMModel::Pointer, processedHFMModel), Q_ARG(MaterialMapping, materialMapping));
@@ -287,7 +310,8 @@ void ModelResource::downloadFinished(const QByteArray& data) {
             _url = _effectiveBaseURL;
             _textureBaseURL = _effectiveBaseURL;
         }
-        QThreadPool::globalInstance()->start(new GeometryReader(_modelLoader, _self, _effectiveBaseURL, _mappingPair, data, _combineParts, _request->getWebMediaType()));
+        QThreadPool::globalInstance()->start(new GeometryReader(_modelLoader, _self, _effectiveBaseURL, _mappingPair, data, _combineParts, _request->getWebMediaType(),
+            DependencyManager::get<ModelCache>()->_hfmCache));
     }
 }
 
@@ -356,7 +380,12 @@ void ModelResource::resetTextures() {
     _materials.clear();
 }
 
+const std::string ModelCache::HFM_DIRNAME { "hfm_cache" };
+const std::string ModelCache::HFM_EXT { "hfm" };
+
 ModelCache::ModelCache() {
+    _hfmCache->initialize();
+
     const qint64 GEOMETRY_DEFAULT_UNUSED_MAX_SIZE = DEFAULT_UNUSED_MAX_SIZE;
     setUnusedResourceCacheSize(GEOMETRY_DEFAULT_UNUSED_MAX_SIZE);
     setObjectName("ModelCache");
@@ -21,6 +21,7 @@
 #include <procedural/ProceduralMaterialCache.h>
 #include <material-networking/TextureCache.h>
 #include "ModelLoader.h"
+#include "HFMCache.h"
 
 using GeometryMappingPair = std::pair<QUrl, QVariantHash>;
 Q_DECLARE_METATYPE(GeometryMappingPair)
@@ -173,7 +174,12 @@ protected:
 private:
     ModelCache();
     virtual ~ModelCache() = default;
+
+    static const std::string HFM_DIRNAME;
+    static const std::string HFM_EXT;
+
     ModelLoader _modelLoader;
+    std::shared_ptr<HFMCache> _hfmCache { std::make_shared<HFMCache>(HFM_DIRNAME, HFM_EXT) };
 };
 
 #endif // hifi_ModelCache_h
@@ -11,6 +11,8 @@
 
 #include "CharacterController.h"
 
+#include <mutex>
+
 #include <AvatarConstants.h>
 #include <NumericalConstants.h>
 #include <PhysicsCollisionGroups.h>
@@ -28,6 +30,8 @@ const btVector3 LOCAL_UP_AXIS(0.0f, 1.0f, 0.0f);
 static bool _appliedStuckRecoveryStrategy = false;
 
 static TemporaryPairwiseCollisionFilter _pairwiseFilter;
+// the narrowphase may run on several threads, see PhysicsEngine::setNumThreads()
+static std::mutex _pairwiseFilterMutex;
 
 // Note: applyPairwiseFilter is registered as a sub-callback to Bullet's gContactAddedCallback feature
 // when we detect MyAvatar is "stuck".  It will disable new ManifoldPoints between MyAvatar and mesh objects with
@@ -36,6 +40,7 @@ static TemporaryPairwiseCollisionFilter _pairwiseFilter;
 bool applyPairwiseFilter(btManifoldPoint& cp,
         const btCollisionObjectWrapper* colObj0Wrap, int partId0, int index0,
         const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1) {
+    std::lock_guard<std::mutex> lock(_pairwiseFilterMutex);
     static int32_t numCalls = 0;
     ++numCalls;
     // This callback is ONLY called on objects with btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK flag
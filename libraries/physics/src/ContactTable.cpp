@@ -0,0 +1,70 @@
+//
+//  ContactTable.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContactTable.h"
+
+static const size_t MIN_NUM_SLOTS = 64;
+
+ContactTable::ContactTable() : _slots(MIN_NUM_SLOTS, EMPTY_SLOT) {
+}
+
+uint32_t ContactTable::hashKey(const ContactKey& key) {
+    // the pointers are aligned, so mix the high bits down
+    uint64_t a = (uint64_t)(uintptr_t)key._a;
+    uint64_t b = (uint64_t)(uintptr_t)key._b;
+    uint64_t hash = (a ^ (b * 0x9e3779b97f4a7c15ULL)) * 0xff51afd7ed558ccdULL;
+    return (uint32_t)(hash >> 32);
+}
+
+uint32_t ContactTable::findSlot(const ContactKey& key) const {
+    uint32_t mask = (uint32_t)_slots.size() - 1;
+    uint32_t slot = hashKey(key) & mask;
+    while (_slots[slot] != EMPTY_SLOT && !(_entries[_slots[slot]].key == key)) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+ContactInfo& ContactTable::operator[](const ContactKey& key) {
+    uint32_t slot = findSlot(key);
+    if (_slots[slot] != EMPTY_SLOT) {
+        return _entries[_slots[slot]].contact;
+    }
+
+    _entries.push_back({ key, ContactInfo() });
+    if (2 * _entries.size() > _slots.size()) {
+        rehash();
+    } else {
+        _slots[slot] = (int32_t)_entries.size() - 1;
+    }
+    return _entries.back().contact;
+}
+
+ContactInfo* ContactTable::find(const ContactKey& key) {
+    int32_t index = _slots[findSlot(key)];
+    return (index == EMPTY_SLOT) ? nullptr : &(_entries[index].contact);
+}
+
+void ContactTable::clear() {
+    _entries.clear();
+    _slots.assign(MIN_NUM_SLOTS, EMPTY_SLOT);
+}
+
+void ContactTable::rehash() {
+    // keep the table between a quarter and a half full, so it shrinks again after a pile has settled
+    size_t numSlots = MIN_NUM_SLOTS;
+    while (numSlots < 4 * _entries.size()) {
+        numSlots *= 2;
+    }
+    _slots.assign(numSlots, EMPTY_SLOT);
+    for (size_t i = 0; i < _entries.size(); ++i) {
+        _slots[findSlot(_entries[i].key)] = (int32_t)i;
+    }
+}
@@ -0,0 +1,91 @@
+//
+//  ContactTable.h
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ContactTable_h
+#define hifi_ContactTable_h
+
+#include <stdint.h>
+#include <vector>
+
+#include "ContactInfo.h"
+
+// simple class for keeping track of contacts
+class ContactKey {
+public:
+    ContactKey() = delete;
+    ContactKey(void* a, void* b) : _a(a), _b(b) {}
+    bool operator<(const ContactKey& other) const { return _a < other._a || (_a == other._a && _b < other._b); }
+    bool operator==(const ContactKey& other) const { return _a == other._a && _b == other._b; }
+    void* _a; // ObjectMotionState pointer
+    void* _b; // ObjectMotionState pointer
+};
+
+// The contacts between pairs of objects, updated every substep.
+//   The contacts are kept in a dense array, in the order they were first seen, and found through an open addressing
+//   hash table of indices into that array.  Each ContactInfo remembers the step it was last updated, so the stale
+//   ones are found by walking the array, and removeIf() prunes any number of them with one compaction and rehash.
+class ContactTable {
+public:
+    ContactTable();
+
+    /// \return the contact for key, added if it wasn't there
+    ContactInfo& operator[](const ContactKey& key);
+    ContactInfo* find(const ContactKey& key);
+
+    int size() const { return (int)_entries.size(); }
+    bool empty() const { return _entries.empty(); }
+    void clear();
+
+    // calls f(key, contact) for every contact
+    template <typename F>
+    void forEach(F&& f) {
+        for (auto& entry : _entries) {
+            f(entry.key, entry.contact);
+        }
+    }
+
+    // calls predicate(key, contact) for every contact, in order, and removes those for which it returns true
+    template <typename Predicate>
+    int removeIf(Predicate&& predicate) {
+        size_t numKept = 0;
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            if (!predicate(_entries[i].key, _entries[i].contact)) {
+                if (numKept != i) {
+                    _entries[numKept] = _entries[i];
+                }
+                ++numKept;
+            }
+        }
+        int numRemoved = (int)(_entries.size() - numKept);
+        if (numRemoved > 0) {
+            _entries.erase(_entries.begin() + numKept, _entries.end());
+            rehash();
+        }
+        return numRemoved;
+    }
+
+private:
+    struct Entry {
+        ContactKey key;
+        ContactInfo contact;
+    };
+
+    static const int32_t EMPTY_SLOT = -1;
+
+    static uint32_t hashKey(const ContactKey& key);
+    // the slot holding key, or the empty slot where it would go
+    uint32_t findSlot(const ContactKey& key) const;
+    void rehash();
+
+    std::vector<Entry> _entries;
+    std::vector<int32_t> _slots; // indices into _entries, a power of two at most half full
+};
+
+#endif // hifi_ContactTable_h
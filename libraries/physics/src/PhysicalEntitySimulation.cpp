@@ -298,7 +298,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
                         // bummer, the hashes are different and we no longer want the shape we've received
                         ObjectMotionState::getShapeManager()->releaseShape(shape);
                         // try again
-                        shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                        shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                         if (shape) {
                             buildMotionState(shape, entity);
                             requestItr = _shapeRequests.erase(requestItr);
@@ -372,7 +372,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
                 ShapeInfo shapeInfo;
                 entity->computeShapeInfo(shapeInfo);
                 uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
-                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                 if (shape) {
                     buildMotionState(shape, entity);
                 } else if (requestCount != ObjectMotionState::getShapeManager()->getWorkRequestCount()) {
@@ -427,41 +427,29 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
 
         bool needsNewShape = object->needsNewShape();
         if (needsNewShape) {
-            ShapeType shapeType = object->getShapeType();
-            if (shapeType == SHAPE_TYPE_STATIC_MESH) {
-                ShapeRequest shapeRequest(object->_entity);
-                ShapeRequests::iterator  requestItr = _shapeRequests.find(shapeRequest);
-                if (requestItr == _shapeRequests.end()) {
-                    ShapeInfo shapeInfo;
-                    object->_entity->computeShapeInfo(shapeInfo);
-                    uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
-                    btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
-                    if (shape) {
-                        object->setShape(shape);
-                        handledFlags |= Simulation::DIRTY_SHAPE;
-                        needsNewShape = false;
-                    } else if (requestCount != ObjectMotionState::getShapeManager()->getWorkRequestCount()) {
-                        // shape doesn't exist but a new worker has been spawned to build it --> add to shapeRequests and wait
-                        shapeRequest.shapeHash = shapeInfo.getHash();
-                        _shapeRequests.insert(shapeRequest);
-                    } else {
-                        // failed to build shape --> will not be added/updated
-                        handledFlags |= Simulation::DIRTY_SHAPE;
-                    }
-                } else {
-                    // continue waiting for shape request
-                }
-            } else {
+            ShapeRequest shapeRequest(object->_entity);
+            ShapeRequests::iterator  requestItr = _shapeRequests.find(shapeRequest);
+            if (requestItr == _shapeRequests.end()) {
                 ShapeInfo shapeInfo;
                 object->_entity->computeShapeInfo(shapeInfo);
-                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
+                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                 if (shape) {
                     object->setShape(shape);
                     handledFlags |= Simulation::DIRTY_SHAPE;
                     needsNewShape = false;
+                } else if (requestCount != ObjectMotionState::getShapeManager()->getWorkRequestCount()) {
+                    // shape doesn't exist but a new worker has been spawned to build it --> add to shapeRequests and wait
+                    shapeRequest.shapeHash = shapeInfo.getHash();
+                    _shapeRequests.insert(shapeRequest);
+                } else if (object->getShapeType() == SHAPE_TYPE_STATIC_MESH) {
+                    // failed to build shape --> will not be added/updated
+                    handledFlags |= Simulation::DIRTY_SHAPE;
                 } else {
-                    // failed to build shape --> will not be added
+                    // failed to build shape --> will not be added, and is tried again next frame
                 }
+            } else {
+                // continue waiting for shape request
             }
         }
         if (!isInPhysicsSimulation) {
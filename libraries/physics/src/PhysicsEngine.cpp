@@ -11,6 +11,7 @@
 
 #include "PhysicsEngine.h"
 
+#include <algorithm>
 #include <functional>
 
 #include <QFile>
@@ -19,6 +20,9 @@
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <LinearMath/btThreads.h>
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
@@ -38,17 +42,45 @@ PhysicsEngine::~PhysicsEngine() {
     delete _collisionDispatcher;
     delete _broadphaseFilter;
     delete _constraintSolver;
+    delete _constraintSolverMt;
     delete _dynamicsWorld;
     delete _ghostPairCallback;
+    if (_taskScheduler) {
+        // the scheduler is global to Bullet, so put back the sequential one before deleting ours
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+        delete _taskScheduler;
+    }
 }
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
+#if BT_THREADSAFE
+        if (_numThreads > 1) {
+            _taskScheduler = btCreateDefaultTaskScheduler();
+        }
+        if (_taskScheduler) {
+            _numThreads = std::min(_numThreads, _taskScheduler->getMaxNumThreads());
+            _taskScheduler->setNumThreads(_numThreads);
+            btSetTaskScheduler(_taskScheduler);
+            _constraintSolverMt = new btSequentialImpulseConstraintSolverMt();
+            qCDebug(physics) << "PhysicsEngine stepping on" << _numThreads << "threads";
+        } else {
+            _numThreads = 1;
+        }
+        // with one thread the scheduler is sequential and this steps like btDiscreteDynamicsWorld
+        _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig);
+        auto constraintSolverPool = new btConstraintSolverPoolMt(_numThreads);
+        _constraintSolver = constraintSolverPool;
+        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, constraintSolverPool,
+                                                     _constraintSolverMt, _collisionConfig);
+#else
+        _numThreads = 1;
+        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _constraintSolver = new btSequentialImpulseConstraintSolver;
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
+#endif
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
         // hook up debug draw renderer
@@ -290,15 +322,9 @@ void PhysicsEngine::processTransaction(PhysicsEngine::Transaction& transaction)
 }
 
 void PhysicsEngine::removeContacts(ObjectMotionState* motionState) {
-    // trigger events for new/existing/old contacts
-    ContactMap::iterator contactItr = _contactMap.begin();
-    while (contactItr != _contactMap.end()) {
-        if (contactItr->first._a == motionState || contactItr->first._b == motionState) {
-            contactItr = _contactMap.erase(contactItr);
-        } else {
-            ++contactItr;
-        }
-    }
+    _contactMap.removeIf([&](const ContactKey& key, const ContactInfo& contact) {
+        return key._a == motionState || key._b == motionState;
+    });
 }
 
 void PhysicsEngine::stepSimulation() {
@@ -549,18 +575,15 @@ void PhysicsEngine::doOwnershipInfectionForConstraints() {
 const CollisionEvents& PhysicsEngine::getCollisionEvents() {
     _collisionEvents.clear();
 
-    // scan known contacts and trigger events
-    ContactMap::iterator contactItr = _contactMap.begin();
-
-    while (contactItr != _contactMap.end()) {
-        ContactInfo& contact = contactItr->second;
+    // scan known contacts and trigger events, and drop those that ended in the same pass
+    _contactMap.removeIf([&](const ContactKey& key, ContactInfo& contact) {
         ContactEventType type = contact.computeType(_numContactFrames);
         const btScalar SIGNIFICANT_DEPTH = -0.002f; // penetrations have negative distance
         if (type != CONTACT_EVENT_TYPE_CONTINUE ||
                 (contact.distance < SIGNIFICANT_DEPTH &&
                  contact.readyForContinue(_numContactFrames))) {
-            ObjectMotionState* motionStateA = static_cast<ObjectMotionState*>(contactItr->first._a);
-            ObjectMotionState* motionStateB = static_cast<ObjectMotionState*>(contactItr->first._b);
+            ObjectMotionState* motionStateA = static_cast<ObjectMotionState*>(key._a);
+            ObjectMotionState* motionStateB = static_cast<ObjectMotionState*>(key._b);
 
             // NOTE: the MyAvatar RigidBody is the only object in the simulation that does NOT have a MotionState
             // which means should we ever want to report ALL collision events against the avatar we can
@@ -594,12 +617,8 @@ const CollisionEvents& PhysicsEngine::getCollisionEvents() {
             }
         }
 
-        if (type == CONTACT_EVENT_TYPE_END) {
-            contactItr = _contactMap.erase(contactItr);
-        } else {
-            ++contactItr;
-        }
-    }
+        return type == CONTACT_EVENT_TYPE_END;
+    });
     return _collisionEvents;
 }
 
@@ -914,6 +933,10 @@ std::vector<ContactTestResult> PhysicsEngine::contactTest(uint16_t mask, const S
     }
 
     auto contactCallback = AllContactsCallback((int32_t)mask, (int32_t)group, regionShapeInfo, regionTransform, myAvatarCollisionObject, threshold);
+    if (!contactCallback.collisionObject.getCollisionShape()) {
+        // the shape is still being built on another thread
+        return contactCallback.contacts;
+    }
     _dynamicsWorld->contactTest(&contactCallback.collisionObject, contactCallback);
 
     return contactCallback.contacts;
@@ -21,7 +21,7 @@
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
 #include "BulletUtil.h"
-#include "ContactInfo.h"
+#include "ContactTable.h"
 #include "ObjectMotionState.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "ObjectAction.h"
@@ -32,17 +32,6 @@ const float HALF_SIMULATION_EXTENT = 512.0f; // meters
 class CharacterController;
 class PhysicsDebugDraw;
 
-// simple class for keeping track of contacts
-class ContactKey {
-public:
-    ContactKey() = delete;
-    ContactKey(void* a, void* b) : _a(a), _b(b) {}
-    bool operator<(const ContactKey& other) const { return _a < other._a || (_a == other._a && _b < other._b); }
-    bool operator==(const ContactKey& other) const { return _a == other._a && _b == other._b; }
-    void* _a; // ObjectMotionState pointer
-    void* _b; // ObjectMotionState pointer
-};
-
 struct ContactTestResult {
     ContactTestResult() = delete;
 
@@ -69,7 +58,6 @@ struct ContactTestResult {
     glm::vec3 collisionNormal;
 };
 
-using ContactMap = std::map<ContactKey, ContactInfo>;
 using CollisionEvents = std::vector<Collision>;
 
 class PhysicsEngine {
@@ -94,6 +82,11 @@ public:
 
     PhysicsEngine(const glm::vec3& offset);
     ~PhysicsEngine();
+
+    /// \brief the number of threads Bullet may use for the narrowphase and the islands, 1 to step on the calling thread only.
+    /// Must be called before init(), and only has an effect when Bullet was built with BT_THREADSAFE.
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    int getNumThreads() const { return _numThreads; }
     void init();
 
     uint32_t getNumSubsteps() const;
@@ -172,12 +165,14 @@ private:
     btDefaultCollisionConfiguration* _collisionConfig = NULL;
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
-    btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolver* _constraintSolverMt = NULL; // for islands too large for one thread, NULL when single threaded
+    btITaskScheduler* _taskScheduler = NULL;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
 
-    ContactMap _contactMap;
+    ContactTable _contactMap;
     CollisionEvents _collisionEvents;
     QHash<QUuid, EntityDynamicPointer> _objectDynamics;
     QHash<btRigidBody*, QSet<QUuid>> _objectDynamicsByBody;
@@ -189,6 +184,7 @@ private:
     CharacterController* _myAvatarController;
 
     uint32_t _numContactFrames { 0 };
+    int _numThreads { 1 };
 
     bool _dumpNextStats { false };
     bool _saveNextStats { false };
@@ -27,7 +27,18 @@ public:
         assert(_dataArray);
     }
 
+    // bvh was deserialized in place in bvhBuffer, which the StaticMeshShape takes
+    StaticMeshShape(btTriangleIndexVertexArray* dataArray, btOptimizedBvh* bvh, void* bvhBuffer)
+    :   btBvhTriangleMeshShape(dataArray, true, false), _dataArray(dataArray), _bvhBuffer(bvhBuffer) {
+        assert(_dataArray);
+        setOptimizedBvh(bvh);
+    }
+
     ~StaticMeshShape() {
+        if (_bvhBuffer) {
+            btAlignedFree(_bvhBuffer);
+            _bvhBuffer = nullptr;
+        }
         assert(_dataArray);
         IndexedMeshArray& meshes = _dataArray->getIndexedMeshArray();
         for (int32_t i = 0; i < meshes.size(); ++i) {
@@ -47,6 +58,7 @@ public:
 private:
     // the StaticMeshShape owns its vertex/index data
     btTriangleIndexVertexArray* _dataArray;
+    void* _bvhBuffer { nullptr };
 };
 
 // the dataArray must be created before we create the StaticMeshShape
@@ -270,7 +282,38 @@ btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     return dataArray;
 }
 
-const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info) {
+// util method
+StaticMeshShape* createStaticMeshShape(const ShapeInfo& info, btTriangleIndexVertexArray* dataArray, StaticMeshCache* cache) {
+    if (!cache) {
+        return new StaticMeshShape(dataArray);
+    }
+
+    // Bullet uses the bvh in place, so it needs a buffer with Bullet's alignment
+    const int BVH_ALIGNMENT = 16;
+    StaticMeshCache::Key key = StaticMeshCache::computeKey(info);
+    QByteArray data = cache->readBvh(key);
+    if (!data.isEmpty()) {
+        void* buffer = btAlignedAlloc(data.size(), BVH_ALIGNMENT);
+        memcpy(buffer, data.constData(), data.size());
+        btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(buffer, (unsigned int)data.size(), false);
+        if (bvh) {
+            return new StaticMeshShape(dataArray, bvh, buffer);
+        }
+        btAlignedFree(buffer);
+    }
+
+    StaticMeshShape* shape = new StaticMeshShape(dataArray);
+    const btOptimizedBvh* bvh = shape->getOptimizedBvh();
+    unsigned int size = bvh->calculateSerializeBufferSize();
+    void* buffer = btAlignedAlloc(size, BVH_ALIGNMENT);
+    if (bvh->serializeInPlace(buffer, size, false)) {
+        cache->writeBvh(key, QByteArray(static_cast<const char*>(buffer), (int)size));
+    }
+    btAlignedFree(buffer);
+    return shape;
+}
+
+const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info, StaticMeshCache* staticMeshCache) {
     btCollisionShape* shape = nullptr;
     int type = info.getType();
     switch(type) {
@@ -431,7 +474,7 @@ const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info)
         case SHAPE_TYPE_STATIC_MESH: {
             btTriangleIndexVertexArray* dataArray = createStaticMeshArray(info);
             if (dataArray) {
-                shape = new StaticMeshShape(dataArray);
+                shape = createStaticMeshShape(info, dataArray, staticMeshCache);
             }
         }
         break;
@@ -489,6 +532,6 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
 }
 
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    shape = ShapeFactory::createShapeFromInfo(shapeInfo, staticMeshCache.get());
     emit submitWork(this);
 }
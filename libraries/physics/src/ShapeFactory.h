@@ -19,10 +19,13 @@
 
 #include <ShapeInfo.h>
 
+#include "StaticMeshCache.h"
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
-    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
+    // staticMeshCache, if any, is where the bvh of a SHAPE_TYPE_STATIC_MESH is looked up before building it
+    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info, StaticMeshCache* staticMeshCache = nullptr);
     void deleteShape(const btCollisionShape* shape);
 
     class Worker : public QObject, public QRunnable {
@@ -31,6 +34,7 @@ namespace ShapeFactory {
         Worker(const ShapeInfo& info) : shapeInfo(info), shape(nullptr) {}
         void run() override;
         ShapeInfo shapeInfo;
+        std::shared_ptr<StaticMeshCache> staticMeshCache;
         const btCollisionShape* shape;
     signals:
         void submitWork(Worker*);
@@ -18,6 +18,30 @@
 
 const int MAX_RING_SIZE = 256;
 
+// hull shapes with at least this many points take long enough to build to be worth a worker
+const size_t MIN_NUM_HULL_POINTS_TO_BUILD_OFF_THREAD = 1024;
+
+static bool shouldBuildOffThread(const ShapeInfo& info, bool allowAsync) {
+    switch (info.getType()) {
+        case SHAPE_TYPE_STATIC_MESH:
+            return true;
+        case SHAPE_TYPE_COMPOUND:
+        case SHAPE_TYPE_SIMPLE_COMPOUND:
+        case SHAPE_TYPE_SIMPLE_HULL: {
+            if (!allowAsync) {
+                return false;
+            }
+            size_t numPoints = 0;
+            for (const auto& points : info.getPointCollection()) {
+                numPoints += points.size();
+            }
+            return numPoints >= MIN_NUM_HULL_POINTS_TO_BUILD_OFF_THREAD;
+        }
+        default:
+            return false;
+    }
+}
+
 ShapeManager::ShapeManager() {
     _garbageRing.reserve(MAX_RING_SIZE);
     _nextOrphanExpiry = std::chrono::steady_clock::now();
@@ -36,7 +60,7 @@ ShapeManager::~ShapeManager() {
     }
 }
 
-const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
+const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info, bool allowAsync) {
     if (info.getType() == SHAPE_TYPE_NONE) {
         return nullptr;
     }
@@ -47,17 +71,17 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    if (shouldBuildOffThread(info, allowAsync)) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
         // starting or waiting on a thread.
         ++_workRequestCount;
 
-        const auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), hash);
-        if (itr == _pendingMeshShapes.end()) {
+        const auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), hash);
+        if (itr == _pendingShapes.end()) {
             // start a worker
-            _pendingMeshShapes.push_back(hash);
+            _pendingShapes.push_back(hash);
             // try to recycle old deadWorker
             ShapeFactory::Worker* worker = _deadWorker;
             if (!worker) {
@@ -66,14 +90,18 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 worker->shapeInfo = info;
                 _deadWorker = nullptr;
             }
+            worker->staticMeshCache = _staticMeshCache;
             // we will delete worker manually later
             worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
             QThreadPool::globalInstance()->start(worker);
         }
         // else we're still waiting for the shape to be created on another thread
+    } else if (std::find(_pendingShapes.begin(), _pendingShapes.end(), info.getHash()) != _pendingShapes.end()) {
+        // a worker is already building this shape for a caller that could wait: building a second copy here would
+        // race with acceptWork(), so this caller gets nothing until the worker delivers
     } else {
-        shape = ShapeFactory::createShapeFromInfo(info);
+        shape = ShapeFactory::createShapeFromInfo(info, _staticMeshCache.get());
         if (shape) {
             ShapeReference newRef;
             newRef.refCount = 1;
@@ -208,8 +236,8 @@ bool ShapeManager::hasShape(const btCollisionShape* shape) const {
 
 // slot: called when ShapeFactory::Worker is done building shape
 void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
-    auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), worker->shapeInfo.getHash());
-    if (itr == _pendingMeshShapes.end()) {
+    auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), worker->shapeInfo.getHash());
+    if (itr == _pendingShapes.end()) {
         // we've received a shape but don't remember asking for it
         // (should not fall in here, but if we do: delete the unwanted shape)
         if (worker->shape) {
@@ -217,11 +245,16 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
         }
     } else {
         // clear pending status
-        *itr = _pendingMeshShapes.back();
-        _pendingMeshShapes.pop_back();
+        *itr = _pendingShapes.back();
+        _pendingShapes.pop_back();
 
-        // cache the new shape
-        if (worker->shape) {
+        HashKey workerHashKey(worker->shapeInfo.getHash());
+        if (worker->shape && _shapeMap.find(workerHashKey)) {
+            // the shape was added to the map while the worker was busy: the entry in the map may already be in use,
+            // so keep it and its refCount and drop the duplicate
+            ShapeFactory::deleteShape(worker->shape);
+        } else if (worker->shape) {
+            // cache the new shape
             ShapeReference newRef;
             // refCount is zero because nothing is using the shape yet
             newRef.refCount = 0;
@@ -276,6 +309,7 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     }
     // save this dead worker for later
     worker->shapeInfo.clear();
+    worker->staticMeshCache.reset();
     worker->shape = nullptr;
     _deadWorker = worker;
     ++_workDeliveryCount;
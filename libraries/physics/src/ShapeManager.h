@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <vector>
 
 #include <QObject>
@@ -23,6 +24,7 @@
 #include <ShapeInfo.h>
 
 #include "ShapeFactory.h"
+#include "StaticMeshCache.h"
 #include "HashKey.h"
 
 // The ShapeManager handles the ref-counting on shared shapes:
@@ -46,6 +48,14 @@
 // doesn't delete it right away.  Instead it puts the shape's key on a list delete
 // later.  When that list grows big enough the ShapeManager will remove any matching
 // entries that still have zero ref-count.
+//
+// Some shapes are too slow to build on the simulation thread: static meshes, whose bvh
+// must be computed, and when the caller can wait, shapes made of many hull points.
+// Those are built by a ShapeFactory::Worker on the global QThreadPool. getShape()
+// returns nullptr and bumps the work request count while the shape is pending, and
+// the work delivery count changes once it has been added to the map.  A caller that
+// can't wait gets nullptr too while a worker is building the same shape, rather than
+// a second copy of it.
 
 
 class ShapeManager : public QObject {
@@ -55,8 +65,8 @@ public:
     ShapeManager();
     ~ShapeManager();
 
-    /// \return pointer to shape
-    const btCollisionShape* getShape(const ShapeInfo& info);
+    /// \return pointer to shape, or nullptr if it is being built on another thread (whatever allowAsync is)
+    const btCollisionShape* getShape(const ShapeInfo& info, bool allowAsync = false);
     const btCollisionShape* getShapeByKey(uint64_t key);
     bool hasShapeWithKey(uint64_t key) const;
 
@@ -73,6 +83,10 @@ public:
     bool hasShape(const btCollisionShape* shape) const;
     uint32_t getWorkRequestCount() const { return _workRequestCount; }
     uint32_t getWorkDeliveryCount() const { return _workDeliveryCount; }
+    int getNumPendingShapes() const { return (int)_pendingShapes.size(); }
+
+    // where to keep the bvh of static meshes between sessions, if anywhere
+    void setStaticMeshCache(const std::shared_ptr<StaticMeshCache>& staticMeshCache) { _staticMeshCache = staticMeshCache; }
 
 protected slots:
     void acceptWork(ShapeFactory::Worker* worker);
@@ -100,9 +114,10 @@ private:
     // btHashMap is required because it supports memory alignment of the btCollisionShapes
     btHashMap<HashKey, ShapeReference> _shapeMap;
     std::vector<uint64_t> _garbageRing;
-    std::vector<uint64_t> _pendingMeshShapes;
+    std::vector<uint64_t> _pendingShapes;
     std::vector<KeyExpiry> _orphans;
     ShapeFactory::Worker* _deadWorker { nullptr };
+    std::shared_ptr<StaticMeshCache> _staticMeshCache;
     TimePoint _nextOrphanExpiry;
     uint32_t _ringIndex { 0 };
     std::atomic_uint _workRequestCount { 0 };
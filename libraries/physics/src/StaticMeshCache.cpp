@@ -0,0 +1,61 @@
+//
+//  StaticMeshCache.cpp
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "StaticMeshCache.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+
+#include "PhysicsLogging.h"
+
+using File = cache::File;
+
+// increment whenever the layout of the entries, or the version of Bullet, changes
+static const uint32_t STATIC_MESH_CACHE_VERSION = 1;
+
+StaticMeshCache::StaticMeshCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+StaticMeshCache::Key StaticMeshCache::computeKey(const ShapeInfo& info) {
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    uint32_t version = STATIC_MESH_CACHE_VERSION;
+    uint64_t hash = info.getHash();
+    hasher.addData(reinterpret_cast<const char*>(&version), sizeof(version));
+    hasher.addData(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    for (const auto& points : info.getPointCollection()) {
+        hasher.addData(reinterpret_cast<const char*>(points.data()), (int)(points.size() * sizeof(glm::vec3)));
+    }
+    const ShapeInfo::TriangleIndices& triangleIndices = info.getTriangleIndices();
+    hasher.addData(reinterpret_cast<const char*>(triangleIndices.data()), (int)(triangleIndices.size() * sizeof(int32_t)));
+    return hasher.result().toHex().toStdString();
+}
+
+QByteArray StaticMeshCache::readBvh(const Key& key) {
+    auto file = getFile(key);
+    if (!file) {
+        return QByteArray();
+    }
+
+    QFile bvhFile(QString::fromStdString(file->getFilepath()));
+    if (!bvhFile.open(QIODevice::ReadOnly)) {
+        qCWarning(physics) << "Failed to open cached static mesh" << key.c_str();
+        return QByteArray();
+    }
+    return bvhFile.readAll();
+}
+
+void StaticMeshCache::writeBvh(const Key& key, const QByteArray& data) {
+    writeFile(data.constData(), Metadata(key, data.size()), true);
+}
+
+std::unique_ptr<File> StaticMeshCache::createFile(Metadata&& metadata, const std::string& filepath) {
+    qCInfo(file_cache) << "Wrote static mesh" << metadata.key.c_str();
+    return FileCache::createFile(std::move(metadata), filepath);
+}
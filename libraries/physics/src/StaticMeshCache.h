@@ -0,0 +1,39 @@
+//
+//  StaticMeshCache.h
+//  libraries/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_StaticMeshCache_h
+#define hifi_StaticMeshCache_h
+
+#include <QByteArray>
+
+#include <shared/FileCache.h>
+#include <ShapeInfo.h>
+
+// On-disk cache of the quantized bounding volume hierarchies of SHAPE_TYPE_STATIC_MESH shapes, which are the slowest
+// part of building them, so that a domain that was visited before gets its mesh colliders back without the wait.
+//   The ShapeInfo hash of a static mesh covers only its url and extents, so entries are keyed by that hash together
+//   with the mesh data itself. The data is Bullet's in-place serialization, in the byte order of the host.
+class StaticMeshCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    StaticMeshCache(const std::string& dir, const std::string& ext);
+
+    static Key computeKey(const ShapeInfo& info);
+
+    // Returns an empty array if there is no valid entry for key
+    QByteArray readBvh(const Key& key);
+    void writeBvh(const Key& key, const QByteArray& data);
+
+protected:
+    std::unique_ptr<cache::File> createFile(Metadata&& metadata, const std::string& filepath) override final;
+};
+
+#endif // hifi_StaticMeshCache_h
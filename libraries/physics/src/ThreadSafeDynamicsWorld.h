@@ -20,6 +20,7 @@
 
 #include <BulletDynamics/Dynamics/btRigidBody.h>
 #include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 
 #include "ObjectMotionState.h"
 
@@ -27,15 +28,33 @@
 
 using SubStepCallback = std::function<void()>;
 
-ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorld {
+// Bullet's multithreaded world only works when Bullet was built with BULLET2_MULTITHREADING, which defines BT_THREADSAFE.
+// It runs the narrowphase and the islands through the task scheduler set with btSetTaskScheduler(), which is
+// sequential unless PhysicsEngine was given more than one thread.
+#if BT_THREADSAFE
+using DiscreteDynamicsWorld = btDiscreteDynamicsWorldMt;
+#else
+using DiscreteDynamicsWorld = btDiscreteDynamicsWorld;
+#endif
+
+ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public DiscreteDynamicsWorld {
 public:
     BT_DECLARE_ALIGNED_ALLOCATOR();
 
+#if BT_THREADSAFE
+    ThreadSafeDynamicsWorld(
+            btDispatcher* dispatcher,
+            btBroadphaseInterface* pairCache,
+            btConstraintSolverPoolMt* constraintSolverPool,
+            btConstraintSolver* constraintSolverMt,
+            btCollisionConfiguration* collisionConfiguration);
+#else
     ThreadSafeDynamicsWorld(
             btDispatcher* dispatcher,
             btBroadphaseInterface* pairCache,
             btConstraintSolver* constraintSolver,
             btCollisionConfiguration* collisionConfiguration);
+#endif
 
     int getNumSubsteps() const { return _numSubsteps; }
     int stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps = 1,
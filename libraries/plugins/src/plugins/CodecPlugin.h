@@ -16,6 +16,10 @@ class Encoder {
 public:
     virtual ~Encoder() { }
     virtual void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) = 0;
+
+    // a stateless encoder's output depends only on its input, so it can be shared between streams.
+    // only worth reporting when encoding costs more than finding a shared output, which is not the case for a copy.
+    virtual bool isStateless() const { return false; }
 };
 
 class Decoder {
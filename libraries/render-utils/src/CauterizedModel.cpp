@@ -88,27 +88,10 @@ void CauterizedModel::updateClusterMatrices() {
 
     _needsUpdateClusterMatrices = false;
 
-    for (int skinDeformerIndex = 0; skinDeformerIndex < (int)_meshStates.size(); skinDeformerIndex++) {
-        MeshState& state = _meshStates[skinDeformerIndex];
-        auto numClusters = state.getNumClusters();
-        for (uint32_t clusterIndex = 0; clusterIndex < numClusters; clusterIndex++) {
-            const auto& cbmov = _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
+    bool clusterMatricesChanged = computeClusterMatricesFromRig();
 
-            if (_useDualQuaternionSkinning) {
-                auto jointPose = _rig.getJointPose(cbmov.jointIndex);
-                Transform jointTransform(jointPose.rot(), jointPose.scale(), jointPose.trans());
-                Transform clusterTransform;
-                Transform::mult(clusterTransform, jointTransform, cbmov.inverseBindTransform);
-                state.clusterDualQuaternions[clusterIndex] = Model::TransformDualQuaternion(clusterTransform);
-            } else {
-                auto jointMatrix = _rig.getJointTransform(cbmov.jointIndex);
-                glm_mat4u_mul(jointMatrix, cbmov.inverseBindMatrix, state.clusterMatrices[clusterIndex]);
-            }
-        }
-    }
-
-    // as an optimization, don't build cautrizedClusterMatrices if the boneSet is empty.
-    if (!_cauterizeBoneSet.empty()) {
+    // as an optimization, don't build cautrizedClusterMatrices if the boneSet is empty, or nothing moved.
+    if (clusterMatricesChanged && !_cauterizeBoneSet.empty()) {
 
         AnimPose cauterizePose = _rig.getJointPose(_rig.indexOfJoint("Neck"));
         cauterizePose.scale() = glm::vec3(0.0001f, 0.0001f, 0.0001f);
@@ -133,17 +116,16 @@ void CauterizedModel::updateClusterMatrices() {
             }
            
             // ANd only cauterize affected joints
-            auto numClusters = state.getNumClusters();
+            auto numClusters = _clusterBatch.getNumClusters(skinDeformerIndex);
             for (uint32_t clusterIndex = 0; clusterIndex < numClusters; clusterIndex++) {
-                const auto& cbmov = _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
-                if (_cauterizeBoneSet.find(cbmov.jointIndex) != _cauterizeBoneSet.end()) {
+                if (_cauterizeBoneSet.find(_clusterBatch.getJointIndex(skinDeformerIndex, clusterIndex)) != _cauterizeBoneSet.end()) {
                     if (_useDualQuaternionSkinning) {
                         Transform clusterTransform;
-                        Transform::mult(clusterTransform, cauterizedDQTransform, cbmov.inverseBindTransform);
+                        Transform::mult(clusterTransform, cauterizedDQTransform, _clusterBatch.getInverseBindTransform(skinDeformerIndex, clusterIndex));
                         state.clusterDualQuaternions[clusterIndex] = Model::TransformDualQuaternion(clusterTransform);
                         state.clusterDualQuaternions[clusterIndex].setCauterizationParameters(1.0f, cauterizePose.trans());
                     } else {
-                        glm_mat4u_mul(cauterizeMatrix, cbmov.inverseBindMatrix, state.clusterMatrices[clusterIndex]);
+                        glm_mat4u_mul(cauterizeMatrix, _clusterBatch.getInverseBindMatrix(skinDeformerIndex, clusterIndex), state.clusterMatrices[clusterIndex]);
                     }
                 }
             }
@@ -26,7 +26,12 @@ public:
     bool getEnableCauterization() const { return _enableCauterization; }
 
     const std::unordered_set<int>& getCauterizeBoneSet() const { return _cauterizeBoneSet; }
-    void setCauterizeBoneSet(const std::unordered_set<int>& boneSet) { _cauterizeBoneSet = boneSet; }
+    void setCauterizeBoneSet(const std::unordered_set<int>& boneSet) {
+        if (boneSet != _cauterizeBoneSet) {
+            _cauterizeBoneSet = boneSet;
+            invalidateClusterMatrices();
+        }
+    }
 
     void deleteGeometry() override;
     bool updateGeometry() override;
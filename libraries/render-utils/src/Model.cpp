@@ -304,6 +304,11 @@ void Model::updateShapeStatesFromRig() {
     }
 }
 
+bool Model::needsGeometryUpdate() const {
+    // TODO: should all Models have a valid _rig?
+    return isLoaded() && _rig.jointStatesEmpty() && getHFMModel().joints.size() > 0;
+}
+
 bool Model::updateGeometry() {
     bool needFullUpdate = false;
 
@@ -313,8 +318,7 @@ bool Model::updateGeometry() {
 
     _needsReload = false;
 
-    // TODO: should all Models have a valid _rig?
-    if (_rig.jointStatesEmpty() && getHFMModel().joints.size() > 0) {
+    if (needsGeometryUpdate()) {
         initJointStates();
         assert(_meshStates.empty());
 
@@ -339,6 +343,7 @@ bool Model::updateGeometry() {
             state.clusterMatrices.resize(dynT.clusters.size());
             _meshStates.push_back(state);
         }
+        invalidateClusterMatrices();
 
         needFullUpdate = true;
         emit rigReady();
@@ -1377,6 +1382,7 @@ void Model::snapToRegistrationPoint() {
 }
 
 void Model::setUseDualQuaternionSkinning(bool value) {
+    // _clusterBatch notices the change, and recomputes the clusters the other way
     _useDualQuaternionSkinning = value;
 }
 
@@ -1420,24 +1426,7 @@ void Model::updateClusterMatrices() {
 
     _needsUpdateClusterMatrices = false;
 
-    for (int skinDeformerIndex = 0; skinDeformerIndex < (int)_meshStates.size(); skinDeformerIndex++) {
-        MeshState& state = _meshStates[skinDeformerIndex];
-        auto numClusters = state.getNumClusters();
-        for (uint32_t clusterIndex = 0; clusterIndex < numClusters; clusterIndex++) {
-            const auto& cbmov = _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
-
-            if (_useDualQuaternionSkinning) {
-                auto jointPose = _rig.getJointPose(cbmov.jointIndex);
-                Transform jointTransform(jointPose.rot(), jointPose.scale(), jointPose.trans());
-                Transform clusterTransform;
-                Transform::mult(clusterTransform, jointTransform, cbmov.inverseBindTransform);
-                state.clusterDualQuaternions[clusterIndex] = Model::TransformDualQuaternion(clusterTransform);
-            } else {
-                auto jointMatrix = _rig.getJointTransform(cbmov.jointIndex);
-                glm_mat4u_mul(jointMatrix, cbmov.inverseBindMatrix, state.clusterMatrices[clusterIndex]);
-            }
-        }
-    }
+    computeClusterMatricesFromRig();
 
     // post the blender if we're not currently waiting for one to finish
     auto modelBlender = DependencyManager::get<ModelBlender>();
@@ -1447,10 +1436,40 @@ void Model::updateClusterMatrices() {
     }
 }
 
+bool Model::computeClusterMatricesFromRig() {
+    if (_meshStates.empty()) {
+        return false;
+    }
+    if (!_clusterBatch.update(_rig.getAnimSkeleton(), _rig.getAbsoluteJointPoses(), _useDualQuaternionSkinning)) {
+        // skip the clusters entirely when the rig hasn't moved
+        return false;
+    }
+
+    int numSkinDeformers = std::min((int)_meshStates.size(), _clusterBatch.getNumSkinDeformers());
+    for (int skinDeformerIndex = 0; skinDeformerIndex < numSkinDeformers; skinDeformerIndex++) {
+        MeshState& state = _meshStates[skinDeformerIndex];
+        if (_useDualQuaternionSkinning) {
+            // composed one cluster at a time, Transform::mult handles non-uniform scale with a polar decomposition
+            uint32_t numClusters = _clusterBatch.getNumClusters(skinDeformerIndex);
+            for (uint32_t clusterIndex = 0; clusterIndex < numClusters; clusterIndex++) {
+                const AnimPose& jointPose = _clusterBatch.getJointPose(skinDeformerIndex, clusterIndex);
+                Transform jointTransform(jointPose.rot(), jointPose.scale(), jointPose.trans());
+                Transform clusterTransform;
+                Transform::mult(clusterTransform, jointTransform, _clusterBatch.getInverseBindTransform(skinDeformerIndex, clusterIndex));
+                state.clusterDualQuaternions[clusterIndex] = Model::TransformDualQuaternion(clusterTransform);
+            }
+        } else {
+            _clusterBatch.computeClusterMatrices(skinDeformerIndex, state.clusterMatrices.data());
+        }
+    }
+    return true;
+}
+
 void Model::deleteGeometry() {
     _deleteGeometryCounter++;
     _shapeStates.clear();
     _meshStates.clear();
+    invalidateClusterMatrices();
     _rig.destroyAnimGraph();
     _blendedBlendshapeCoefficients.clear();
     _renderGeometry.reset();
@@ -1776,72 +1795,77 @@ Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendN
 
 void Blender::run() {
     DETAILED_PROFILE_RANGE_EX(simulation_animation, __FUNCTION__, 0xFFFF0000, 0, { { "url", _model->getURL().toString() } });
+    auto blendshapeDataPerMesh = DependencyManager::get<ModelBlender>()->getBlendshapeAccumulationData(_hfmModel);
+
+    // the unit of work is a chunk of a mesh, so that the many blendshapes of a single face mesh are split across workers
+    struct Chunk {
+        int mesh;
+        int chunk;
+        int offset;     // of the mesh in the blended offsets
+    };
+    std::vector<Chunk> chunks;
+
+    const float* coefficients = _blendshapeCoefficients.constData();
+    int numCoefficients = _blendshapeCoefficients.size();
+
     int numBlendshapeOffsets = 0;  // number of offsets required for all meshes.
-    int maxBlendshapeOffsets = 0;  // number of offsets in the largest mesh.
-    int numMeshes = 0;  // number of meshes in this model.
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        numMeshes++;
-        if (meshIter->blendshapes.isEmpty()) {
+    int numMeshes = (int)_hfmModel->meshes.size();  // number of meshes in this model.
+    QVector<int> blendedMeshSizes;
+    blendedMeshSizes.reserve(numMeshes);
+    std::vector<bool> isMeshActive(numMeshes, false);
+    for (int i = 0; i < numMeshes; i++) {
+        const auto& blendshapeData = (*blendshapeDataPerMesh)[i];
+        if (_hfmModel->meshes[i].blendshapes.isEmpty()) {
+            blendedMeshSizes.push_back(0);
             continue;
         }
-        int numVertsInMesh = meshIter->vertices.size();
+        int numVertsInMesh = blendshapeData.getNumVertices();
+        blendedMeshSizes.push_back(numVertsInMesh);
+
+        isMeshActive[i] = blendshapeData.hasActiveBlendshapes(coefficients, numCoefficients);
+        for (int chunk = 0; chunk < blendshapeData.getNumChunks(); chunk++) {
+            chunks.push_back({ i, chunk, numBlendshapeOffsets });
+        }
         numBlendshapeOffsets += numVertsInMesh;
-        maxBlendshapeOffsets = std::max(maxBlendshapeOffsets, numVertsInMesh);
     }
 
     // allocate the required sizes
-    QVector<int> blendedMeshSizes;
-    blendedMeshSizes.reserve(numMeshes);
-
     QVector<BlendshapeOffset> packedBlendshapeOffsets;
     packedBlendshapeOffsets.resize(numBlendshapeOffsets);
 
     QVector<BlendshapeOffsetUnpacked> unpackedBlendshapeOffsets;
-    unpackedBlendshapeOffsets.resize(maxBlendshapeOffsets);    // reuse for all meshes
-
-    int offset = 0;
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        if (meshIter->blendshapes.isEmpty()) {
-            blendedMeshSizes.push_back(0);
-            continue;
+    unpackedBlendshapeOffsets.resize(numBlendshapeOffsets);
+
+    static_assert(sizeof(BlendshapeOffsetUnpacked) == BlendshapeAccumulationData::NUM_COMPONENTS * sizeof(float),
+        "struct BlendshapeOffsetUnpacked size doesn't match.");
+
+    tbb::parallel_for((size_t)0, chunks.size(), [&](size_t c) {
+        const auto& chunk = chunks[c];
+        const auto& blendshapeData = (*blendshapeDataPerMesh)[chunk.mesh];
+        int begin = chunk.chunk * BlendshapeAccumulationData::CHUNK_SIZE;
+        int end = std::min(begin + BlendshapeAccumulationData::CHUNK_SIZE, blendshapeData.getNumVertices());
+        auto packed = packedBlendshapeOffsets.data() + chunk.offset;
+
+        if (!isMeshActive[chunk.mesh]) {
+            // all the offsets are zero, and so is their packed form
+            BlendshapeOffsetUnpacked zero;
+            memset(&zero, 0, sizeof(zero));
+            packBlendshapeOffsets(&zero, packed + begin, 1);
+            std::fill(packed + begin + 1, packed + end, packed[begin]);
+            return;
         }
-        int numVertsInMesh = meshIter->vertices.size();
-        blendedMeshSizes.push_back(numVertsInMesh);
+
+        auto unpacked = unpackedBlendshapeOffsets.data() + chunk.offset;
 
         // initialize offsets to zero
-        memset(unpackedBlendshapeOffsets.data(), 0, numVertsInMesh * sizeof(BlendshapeOffsetUnpacked));
+        memset(unpacked + begin, 0, (end - begin) * sizeof(BlendshapeOffsetUnpacked));
 
         // for each blendshape in this mesh, accumulate the offsets into unpackedBlendshapeOffsets.
-        const float NORMAL_COEFFICIENT_SCALE = 0.01f;
-        for (int i = 0, n = qMin(_blendshapeCoefficients.size(), meshIter->blendshapes.size()); i < n; i++) {
-            float vertexCoefficient = _blendshapeCoefficients.at(i);
-            const float EPSILON = 0.0001f;
-            if (vertexCoefficient < EPSILON) {
-                continue;
-            }
-
-            float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
-            const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
-            for (int j = 0; j < blendshape.indices.size(); ++j) {
-                int index = blendshape.indices.at(j);
-
-                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
-                currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
-                currentBlendshapeOffset.normalOffset += blendshape.normals.at(j) * normalCoefficient;
-                if (j < blendshape.tangents.size()) {
-                    currentBlendshapeOffset.tangentOffset += blendshape.tangents.at(j) * normalCoefficient;
-                }
-            }
-        }
+        blendshapeData.accumulate(chunk.chunk, coefficients, numCoefficients, (float(*)[BlendshapeAccumulationData::NUM_COMPONENTS])unpacked);
 
         // convert unpackedBlendshapeOffsets into packedBlendshapeOffsets for the gpu.
-        auto unpacked = unpackedBlendshapeOffsets.data();
-        auto packed = packedBlendshapeOffsets.data() + offset;
-        packBlendshapeOffsets(unpacked, packed, numVertsInMesh);
-
-        offset += numVertsInMesh;
-    }
-    Q_ASSERT(offset == numBlendshapeOffsets);
+        packBlendshapeOffsets(unpacked + begin, packed + begin, end - begin);
+    });
 
     // post the result to the ModelBlender, which will dispatch to the model if still alive
     QMetaObject::invokeMethod(DependencyManager::get<ModelBlender>().data(), "setBlendedVertices",
@@ -1866,6 +1890,40 @@ ModelBlender::ModelBlender() :
 ModelBlender::~ModelBlender() {
 }
 
+std::shared_ptr<const ModelBlender::BlendshapeAccumulationDataPerMesh> ModelBlender::getBlendshapeAccumulationData(
+        const HFMModel::ConstPointer& hfmModel) {
+    Lock lock(_blendshapeAccumulationDataMutex);
+
+    auto it = _blendshapeAccumulationData.find(hfmModel.get());
+    if (it != _blendshapeAccumulationData.end() && it->second.hfmModel.lock() == hfmModel) {
+        return it->second.data;
+    }
+
+    auto dataPerMesh = std::make_shared<BlendshapeAccumulationDataPerMesh>();
+    dataPerMesh->reserve(hfmModel->meshes.size());
+    for (const auto& mesh : hfmModel->meshes) {
+        dataPerMesh->emplace_back(mesh.blendshapes.isEmpty() ? 0 : mesh.vertices.size());
+        auto& data = dataPerMesh->back();
+        for (const auto& blendshape : mesh.blendshapes) {
+            int numIndices = std::min(blendshape.indices.size(), blendshape.vertices.size());
+            data.addBlendshape(blendshape.indices.constData(), blendshape.vertices.constData(), numIndices,
+                               blendshape.normals.constData(), blendshape.normals.size(),
+                               blendshape.tangents.constData(), blendshape.tangents.size());
+        }
+    }
+
+    // forget the geometry that has been released since the last one was added
+    for (auto entry = _blendshapeAccumulationData.begin(); entry != _blendshapeAccumulationData.end();) {
+        if (entry->second.hfmModel.expired()) {
+            entry = _blendshapeAccumulationData.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+    _blendshapeAccumulationData[hfmModel.get()] = { hfmModel, dataPerMesh };
+    return dataPerMesh;
+}
+
 void ModelBlender::noteRequiresBlend(ModelPointer model) {
     Lock lock(_mutex);
     if (_modelsRequiringBlendsSet.find(model) == _modelsRequiringBlendsSet.end()) {
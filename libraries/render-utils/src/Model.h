@@ -22,6 +22,7 @@
 #include <functional>
 
 #include <AABox.h>
+#include <BlendshapeAccumulation.h>
 #include <DependencyManager.h>
 #include <GeometryUtil.h>
 #include <gpu/Batch.h>
@@ -37,6 +38,7 @@
 #include "GeometryCache.h"
 #include "TextureCache.h"
 #include "Rig.h"
+#include "SkinClusterBatch.h"
 #include "PrimitiveMode.h"
 
 // Use dual quaternion skinning!
@@ -290,6 +292,8 @@ public:
 
     // returns 'true' if needs fullUpdate after geometry change
     virtual bool updateGeometry();
+    // returns 'true' if the next updateGeometry() will build the joint and mesh states and emit rigReady()
+    bool needsGeometryUpdate() const;
 
     void setLoadingPriority(float priority) { _loadingPriority = priority; }
 
@@ -438,6 +442,15 @@ protected:
 
     std::vector<MeshState> _meshStates;
 
+    // Recomputes the cluster matrices, or dual quaternions, of all the meshes from the rig, unless none of its joints moved
+    // since the last time.  Returns true if they changed.
+    bool computeClusterMatricesFromRig();
+    // Forces the next computeClusterMatricesFromRig to recompute everything
+    void invalidateClusterMatrices() { _clusterBatch.invalidate(); }
+
+    // the clusters of all the meshes, and the joint poses they were last computed from
+    SkinClusterBatch _clusterBatch;
+
     virtual void initJointStates();
 
     void setScaleInternal(const glm::vec3& scale);
@@ -547,6 +560,13 @@ public:
 
     bool shouldComputeBlendshapes() { return _computeBlendshapes; }
 
+    using BlendshapeAccumulationDataPerMesh = std::vector<BlendshapeAccumulationData>;
+
+    /// Returns the blendshapes of each mesh of the model, rearranged for the Blender. They are built on first use
+    /// and shared by all the models with the same geometry, until the geometry is released.
+    /// NOTE: Thread-safe
+    std::shared_ptr<const BlendshapeAccumulationDataPerMesh> getBlendshapeAccumulationData(const HFMModel::ConstPointer& hfmModel);
+
 public slots:
     void setBlendedVertices(ModelPointer model, int blendNumber, QVector<BlendshapeOffset> blendshapeOffsets, QVector<int> blendedMeshSizes);
     void setComputeBlendshapes(bool computeBlendshapes) { _computeBlendshapes = computeBlendshapes; }
@@ -563,6 +583,13 @@ private:
     int _pendingBlenders;
     Mutex _mutex;
 
+    struct BlendshapeAccumulationEntry {
+        std::weak_ptr<const HFMModel> hfmModel;
+        std::shared_ptr<const BlendshapeAccumulationDataPerMesh> data;
+    };
+    std::unordered_map<const HFMModel*, BlendshapeAccumulationEntry> _blendshapeAccumulationData;
+    Mutex _blendshapeAccumulationDataMutex;
+
     bool _computeBlendshapes { true };
 };
 
@@ -0,0 +1,83 @@
+//
+//  CullTask_avx2.cpp
+//  render/src/avx2
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// 8 boxes at a time, see cullBoxes_ref in CullTask.cpp
+void cullBoxes_AVX2(const float* const corners[3], const float* const scales[3], int numBoxes,
+                    const float (*planes)[4], int numPlanes, const float eye[3], float lodAngleHalfTanSq,
+                    uint8_t* inViewMasks, uint8_t* bigEnoughMasks) {
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    const __m256 lod = _mm256_set1_ps(lodAngleHalfTanSq);
+    const __m256 ex = _mm256_set1_ps(eye[0]);
+    const __m256 ey = _mm256_set1_ps(eye[1]);
+    const __m256 ez = _mm256_set1_ps(eye[2]);
+
+    for (int i = 0; i < numBoxes; i += 8) {
+
+        __m256 cx = _mm256_loadu_ps(&corners[0][i]);
+        __m256 cy = _mm256_loadu_ps(&corners[1][i]);
+        __m256 cz = _mm256_loadu_ps(&corners[2][i]);
+        __m256 sx = _mm256_loadu_ps(&scales[0][i]);
+        __m256 sy = _mm256_loadu_ps(&scales[1][i]);
+        __m256 sz = _mm256_loadu_ps(&scales[2][i]);
+
+        if (inViewMasks) {
+            // the corner farthest along each plane normal
+            __m256 mx = _mm256_add_ps(cx, sx);
+            __m256 my = _mm256_add_ps(cy, sy);
+            __m256 mz = _mm256_add_ps(cz, sz);
+
+            __m256 inView = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);   // all ones
+            for (int p = 0; p < numPlanes; p++) {
+                __m256 vx = (planes[p][0] > 0.0f) ? mx : cx;
+                __m256 vy = (planes[p][1] > 0.0f) ? my : cy;
+                __m256 vz = (planes[p][2] > 0.0f) ? mz : cz;
+
+                // distance = d + dot(normal, vertex)
+                __m256 dot = _mm256_mul_ps(vx, _mm256_set1_ps(planes[p][0]));
+                dot = _mm256_add_ps(dot, _mm256_mul_ps(vy, _mm256_set1_ps(planes[p][1])));
+                dot = _mm256_add_ps(dot, _mm256_mul_ps(vz, _mm256_set1_ps(planes[p][2])));
+                __m256 distance = _mm256_add_ps(_mm256_set1_ps(planes[p][3]), dot);
+
+                // out of view only if distance < 0
+                inView = _mm256_and_ps(inView, _mm256_cmp_ps(distance, zero, _CMP_NLT_UQ));
+            }
+            inViewMasks[i >> 3] = (uint8_t)_mm256_movemask_ps(inView);
+        }
+
+        if (bigEnoughMasks) {
+            // eye to box center
+            __m256 px = _mm256_sub_ps(ex, _mm256_add_ps(cx, _mm256_mul_ps(sx, half)));
+            __m256 py = _mm256_sub_ps(ey, _mm256_add_ps(cy, _mm256_mul_ps(sy, half)));
+            __m256 pz = _mm256_sub_ps(ez, _mm256_add_ps(cz, _mm256_mul_ps(sz, half)));
+
+            __m256 adjacentSq = _mm256_mul_ps(px, px);
+            adjacentSq = _mm256_add_ps(adjacentSq, _mm256_mul_ps(py, py));
+            adjacentSq = _mm256_add_ps(adjacentSq, _mm256_mul_ps(pz, pz));
+
+            __m256 oppositeSq = _mm256_mul_ps(sx, sx);
+            oppositeSq = _mm256_add_ps(oppositeSq, _mm256_mul_ps(sy, sy));
+            oppositeSq = _mm256_add_ps(oppositeSq, _mm256_mul_ps(sz, sz));
+            oppositeSq = _mm256_mul_ps(oppositeSq, quarter);
+
+            __m256 bigEnough = _mm256_cmp_ps(oppositeSq, _mm256_mul_ps(lod, adjacentSq), _CMP_GE_OQ);
+            bigEnoughMasks[i >> 3] = (uint8_t)_mm256_movemask_ps(bigEnough);
+        }
+    }
+}
+
+#endif
@@ -16,6 +16,7 @@
 
 #include <PerfStat.h>
 #include <OctreeUtils.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
@@ -64,45 +65,194 @@ bool CullTest::solidAngleTest(const AABox& bound) {
     return true;
 }
 
+bool render::shouldRenderAtLOD(const RenderArgs* args, const AABox& bound) {
+    // To decide if the bound should be rendered or not at the specified Args->lodAngle,
+    // we need to compute the apparent angle of the bound from the frustum origin,
+    // and compare it against the lodAngle, if it is greater or equal we should render the content of that bound.
+    // we abstract the bound as a sphere centered on the bound center and of radius half diagonal of the bound.
+
+    // Instead of comparing  angles, we are comparing the tangent of the half angle which are more efficient to compute:
+    // we are comparing the square of the half tangent apparent angle for the bound against the LODAngle Half tangent square
+    // if smaller, the bound is too small and we should NOT render it, return true otherwise.
+
+    // Tangent Adjacent side is eye to bound center vector length
+    auto pos = args->getViewFrustum().getPosition() - bound.calcCenter();
+    auto halfTanAdjacentSq = glm::dot(pos, pos);
+
+    // Tangent Opposite side is the half length of the dimensions vector of the bound
+    auto dim = bound.getDimensions();
+    auto halfTanOppositeSq = 0.25f * glm::dot(dim, dim);
+
+    // The test is:
+    // isVisible = halfTanSq >= lodHalfTanSq = (halfTanOppositeSq / halfTanAdjacentSq) >= lodHalfTanSq
+    // which we express as below to avoid division
+    // (halfTanOppositeSq) >= lodHalfTanSq * halfTanAdjacentSq
+    return (halfTanOppositeSq >= args->_lodAngleHalfTanSq * halfTanAdjacentSq);
+}
+
+static bool isLODCullFunctor(const CullFunctor& cullFunctor) {
+    using CullFunction = bool(*)(const RenderArgs*, const AABox&);
+    auto function = cullFunctor.target<CullFunction>();
+    return function && *function == &render::shouldRenderAtLOD;
+}
+
+//
+// Batched box tests
+//   corners and scales hold one array per component, padded to a multiple of CullBatch::BATCH_SIZE boxes.
+//   Bit i of mask b is the result for box b * BATCH_SIZE + i; a null mask array skips its test.
+//
+static void cullBoxes_ref(const float* const corners[3], const float* const scales[3], int numBoxes,
+                          const float (*planes)[4], int numPlanes, const float eye[3], float lodAngleHalfTanSq,
+                          uint8_t* inViewMasks, uint8_t* bigEnoughMasks) {
+    for (int i = 0; i < numBoxes; i += CullBatch::BATCH_SIZE) {
+        uint8_t inViewMask = 0;
+        uint8_t bigEnoughMask = 0;
+        for (int j = 0; j < CullBatch::BATCH_SIZE; ++j) {
+            glm::vec3 corner(corners[0][i + j], corners[1][i + j], corners[2][i + j]);
+            glm::vec3 scale(scales[0][i + j], scales[1][i + j], scales[2][i + j]);
+
+            // same as ViewFrustum::boxIntersectsFrustum
+            bool inView = true;
+            for (int p = 0; p < numPlanes; ++p) {
+                glm::vec3 normal(planes[p][0], planes[p][1], planes[p][2]);
+                glm::vec3 farthest = corner + glm::vec3(glm::greaterThan(normal, glm::vec3(0.0f))) * scale;
+                if (planes[p][3] + glm::dot(normal, farthest) < 0.0f) {
+                    inView = false;
+                }
+            }
+            inViewMask |= (uint8_t)inView << j;
+
+            // same as shouldRenderAtLOD
+            glm::vec3 pos = glm::vec3(eye[0], eye[1], eye[2]) - (corner + scale * 0.5f);
+            bool bigEnough = 0.25f * glm::dot(scale, scale) >= lodAngleHalfTanSq * glm::dot(pos, pos);
+            bigEnoughMask |= (uint8_t)bigEnough << j;
+        }
+        if (inViewMasks) {
+            inViewMasks[i / CullBatch::BATCH_SIZE] = inViewMask;
+        }
+        if (bigEnoughMasks) {
+            bigEnoughMasks[i / CullBatch::BATCH_SIZE] = bigEnoughMask;
+        }
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void cullBoxes_AVX2(const float* const corners[3], const float* const scales[3], int numBoxes,
+                    const float (*planes)[4], int numPlanes, const float eye[3], float lodAngleHalfTanSq,
+                    uint8_t* inViewMasks, uint8_t* bigEnoughMasks);
+
+static void cullBoxes(const float* const corners[3], const float* const scales[3], int numBoxes,
+                      const float (*planes)[4], int numPlanes, const float eye[3], float lodAngleHalfTanSq,
+                      uint8_t* inViewMasks, uint8_t* bigEnoughMasks) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        cullBoxes_AVX2(corners, scales, numBoxes, planes, numPlanes, eye, lodAngleHalfTanSq, inViewMasks, bigEnoughMasks);
+    } else {
+        cullBoxes_ref(corners, scales, numBoxes, planes, numPlanes, eye, lodAngleHalfTanSq, inViewMasks, bigEnoughMasks);
+    }
+}
+
+#else   // portable reference code
+static auto& cullBoxes = cullBoxes_ref;
+#endif
+
+void CullBatch::cull(const RenderArgs* args, const CullFunctor& cullFunctor, RenderDetails::Item& details,
+                     const ItemBounds& inItems, ItemBounds& outItems, int tests) {
+    const int numItems = (int)inItems.size();
+    if (numItems == 0) {
+        return;
+    }
+    const int numBatches = (numItems + BATCH_SIZE - 1) / BATCH_SIZE;
+    const int paddedSize = numBatches * BATCH_SIZE;
+
+    // transpose the bounds, padding the last batch with null boxes
+    const int NUM_COMPONENTS = 6;
+    _bounds.resize(NUM_COMPONENTS * paddedSize);
+    float* components[NUM_COMPONENTS];
+    for (int c = 0; c < NUM_COMPONENTS; ++c) {
+        components[c] = _bounds.data() + c * paddedSize;
+    }
+    for (int i = 0; i < numItems; ++i) {
+        const glm::vec3& corner = inItems[i].bound.getCorner();
+        const glm::vec3& scale = inItems[i].bound.getScale();
+        components[0][i] = corner.x;
+        components[1][i] = corner.y;
+        components[2][i] = corner.z;
+        components[3][i] = scale.x;
+        components[4][i] = scale.y;
+        components[5][i] = scale.z;
+    }
+    for (int c = 0; c < NUM_COMPONENTS; ++c) {
+        std::fill(components[c] + numItems, components[c] + paddedSize, 0.0f);
+    }
+
+    const ViewFrustum& frustum = args->getViewFrustum();
+    const bool testFrustum = (tests & FRUSTUM) != 0;
+    const bool testSolidAngle = (tests & SOLID_ANGLE) != 0;
+    // any other functor is called per item, for the items in view
+    const bool batchSolidAngle = testSolidAngle && isLODCullFunctor(cullFunctor);
+
+    float planes[NUM_FRUSTUM_PLANES][4];
+    for (int p = 0; p < NUM_FRUSTUM_PLANES; ++p) {
+        const ::Plane& plane = frustum.getPlanes()[p];
+        planes[p][0] = plane.getNormal().x;
+        planes[p][1] = plane.getNormal().y;
+        planes[p][2] = plane.getNormal().z;
+        planes[p][3] = plane.getDCoefficient();
+    }
+    const glm::vec3& position = frustum.getPosition();
+    const float eye[3] = { position.x, position.y, position.z };
+
+    _inViewMasks.resize(numBatches);
+    _bigEnoughMasks.resize(numBatches);
+    const float* const corners[3] = { components[0], components[1], components[2] };
+    const float* const scales[3] = { components[3], components[4], components[5] };
+    cullBoxes(corners, scales, paddedSize, planes, NUM_FRUSTUM_PLANES, eye, args->_lodAngleHalfTanSq,
+              testFrustum ? _inViewMasks.data() : nullptr, batchSolidAngle ? _bigEnoughMasks.data() : nullptr);
+
+    // compact the items that passed
+    for (int i = 0; i < numItems; ++i) {
+        const ItemBound& item = inItems[i];
+        if ((tests & KEEP_NULL_BOUNDS) && item.bound.isNull()) {
+            outItems.emplace_back(item);
+            continue;
+        }
+
+        const int batch = i / BATCH_SIZE;
+        const uint8_t bit = 1 << (i % BATCH_SIZE);
+        if (testFrustum && !(_inViewMasks[batch] & bit)) {
+            details._outOfView++;
+            continue;
+        }
+        if (testSolidAngle && !(batchSolidAngle ? (_bigEnoughMasks[batch] & bit) : cullFunctor(args, item.bound))) {
+            details._tooSmall++;
+            continue;
+        }
+        outItems.emplace_back(item);
+    }
+}
+
 void render::cullItems(const RenderContextPointer& renderContext, const CullFunctor& cullFunctor, RenderDetails::Item& details,
                        const ItemBounds& inItems, ItemBounds& outItems) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
     RenderArgs* args = renderContext->args;
-    const ViewFrustum& frustum = args->getViewFrustum();
 
     details._considered += (int)inItems.size();
 
     // Culling / LOD
-    for (auto item : inItems) {
-        if (item.bound.isNull()) {
-            outItems.emplace_back(item); // One more Item to render
-            continue;
-        }
+    // TODO: some entity types (like lights) might want to be rendered even
+    // when they are outside of the view frustum...
+    static thread_local CullBatch cullBatch;
+    cullBatch.cull(args, cullFunctor, details, inItems, outItems,
+                   CullBatch::FRUSTUM | CullBatch::SOLID_ANGLE | CullBatch::KEEP_NULL_BOUNDS);
 
-        // TODO: some entity types (like lights) might want to be rendered even
-        // when they are outside of the view frustum...
-        bool inView;
-        {
-            PerformanceTimer perfTimer("boxIntersectsFrustum");
-            inView = frustum.boxIntersectsFrustum(item.bound);
-        }
-        if (inView) {
-            bool bigEnoughToRender;
-            {
-                PerformanceTimer perfTimer("shouldRender");
-                bigEnoughToRender = cullFunctor(args, item.bound);
-            }
-            if (bigEnoughToRender) {
-                outItems.emplace_back(item); // One more Item to render
-            } else {
-                details._tooSmall++;
-            }
-        } else {
-            details._outOfView++;
-        }
-    }
     details._rendered += (int)outItems.size();
 }
 
@@ -127,6 +277,7 @@ void FetchSpatialTree::configure(const Config& config) {
     _justFrozeFrustum = _justFrozeFrustum || (config.freezeFrustum && !_freezeFrustum);
     _freezeFrustum = config.freezeFrustum;
     _lodAngle = config.lodAngle;
+    _parallel = config.parallel;
 }
 
 void FetchSpatialTree::run(const RenderContextPointer& renderContext, const Inputs& inputs, ItemSpatialTree::ItemSelection& outSelection) {
@@ -165,7 +316,7 @@ void FetchSpatialTree::run(const RenderContextPointer& renderContext, const Inpu
             const auto pixelResolution = frustumResolution.x > 0 ? frustumResolution : glm::ivec2(2048, 2048);
             threshold = glm::max(threshold, glm::min(frustumSize.x / pixelResolution.x, frustumSize.y / pixelResolution.y));
         }
-        scene->getSpatialTree().selectCellItems(outSelection, filter, queryFrustum, threshold);
+        scene->getSpatialTree().selectCellItems(outSelection, filter, queryFrustum, threshold, _parallel);
     }
 }
 
@@ -173,6 +324,7 @@ void CullSpatialSelection::configure(const Config& config) {
     _justFrozeFrustum = _justFrozeFrustum || (config.freezeFrustum && !_freezeFrustum);
     _freezeFrustum = config.freezeFrustum;
     _overrideSkipCulling = config.skipCulling;
+    _parallel = config.parallel;
 }
 
 void CullSpatialSelection::run(const RenderContextPointer& renderContext,
@@ -195,8 +347,6 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         args->pushViewFrustum(_frozenFrustum); // replace the true view frustum by the frozen one
     }
 
-    CullTest test(_cullFunctor, args, details);
-
     // Now we have a selection of items to render
     outItems.clear();
     outItems.reserve(inSelection.numItems());
@@ -275,69 +425,26 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
             // inside & fit items: easy, just filter
             {
                 PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
+                filterAndCull(args, *scene, filter, details, inSelection.insideItems, outItems, 0);
             }
 
             // inside & subcell items: filter & distance cull
             {
                 PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
+                filterAndCull(args, *scene, filter, details, inSelection.insideSubcellItems, outItems, CullBatch::SOLID_ANGLE);
             }
 
             // partial & fit items: filter & frustum cull
             {
                 PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
+                filterAndCull(args, *scene, filter, details, inSelection.partialItems, outItems, CullBatch::FRUSTUM);
             }
 
             // partial & subcell items:: filter & frutum cull & solidangle cull
             {
                 PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            if (test.solidAngleTest(itemBound.bound)) {
-                                outItems.emplace_back(itemBound);
-                                if (item.getKey().isMetaCullGroup()) {
-                                    item.fetchMetaSubItemBounds(outItems, (*scene));
-                                }
-                            }
-                        }
-                    }
-                }
+                filterAndCull(args, *scene, filter, details, inSelection.partialSubcellItems, outItems,
+                              CullBatch::FRUSTUM | CullBatch::SOLID_ANGLE);
             }
         }
     }
@@ -352,6 +459,65 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
     std::static_pointer_cast<Config>(renderContext->jobConfig)->numItems = (int)outItems.size();
 }
 
+void CullSpatialSelection::filterAndCull(const RenderArgs* args, Scene& scene, const ItemFilter& filter,
+                                         RenderDetails::Item& details, const ItemIDs& inItems, ItemBounds& outItems, int tests) {
+    // large enough to amortize the task, small enough to balance the threads
+    const size_t ITEMS_PER_RANGE = 4096;
+    size_t numRanges = (inItems.size() + ITEMS_PER_RANGE - 1) / ITEMS_PER_RANGE;
+    if (_ranges.size() < std::max<size_t>(numRanges, 1)) {
+        _ranges.resize(std::max<size_t>(numRanges, 1));
+    }
+
+    if (!_parallel || numRanges <= 1) {
+        filterAndCullRange(args, scene, filter, details, inItems.data(), inItems.data() + inItems.size(), outItems, tests, _ranges[0]);
+        return;
+    }
+
+    tbb::parallel_for(size_t(0), numRanges, [&](size_t i) {
+        auto& range = _ranges[i];
+        range.outItems.clear();
+        range.details = RenderDetails::Item();
+        const ItemID* begin = inItems.data() + i * ITEMS_PER_RANGE;
+        const ItemID* end = inItems.data() + std::min(inItems.size(), (i + 1) * ITEMS_PER_RANGE);
+        filterAndCullRange(args, scene, filter, range.details, begin, end, range.outItems, tests, range);
+    });
+
+    // merge in selection order
+    for (size_t i = 0; i < numRanges; i++) {
+        auto& range = _ranges[i];
+        outItems.insert(outItems.end(), range.outItems.begin(), range.outItems.end());
+        details._outOfView += range.details._outOfView;
+        details._tooSmall += range.details._tooSmall;
+    }
+}
+
+void CullSpatialSelection::filterAndCullRange(const RenderArgs* args, Scene& scene, const ItemFilter& filter,
+                                              RenderDetails::Item& details, const ItemID* begin, const ItemID* end,
+                                              ItemBounds& outItems, int tests, CullRange& range) const {
+    range.filteredItems.clear();
+    for (auto id = begin; id != end; ++id) {
+        auto& item = scene.getItem(*id);
+        if (filter.test(item.getKey())) {
+            range.filteredItems.emplace_back(ItemBound(*id, item.getBound()));
+        }
+    }
+
+    const ItemBounds* culledItems = &range.filteredItems;
+    if (tests) {
+        range.culledItems.clear();
+        range.cullBatch.cull(args, _cullFunctor, details, range.filteredItems, range.culledItems, tests);
+        culledItems = &range.culledItems;
+    }
+
+    for (auto& itemBound : *culledItems) {
+        outItems.emplace_back(itemBound);
+        auto& item = scene.getItem(itemBound.id);
+        if (item.getKey().isMetaCullGroup()) {
+            item.fetchMetaSubItemBounds(outItems, scene);
+        }
+    }
+}
+
 void CullShapeBounds::run(const RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
@@ -19,6 +19,10 @@ namespace render {
 
     using CullFunctor = std::function<bool(const RenderArgs*, const AABox&)>;
 
+    // The solid angle LOD test: is the apparent size of the bound, from the view frustum origin, at least the LOD angle?
+    // When used as the cull functor, it is evaluated a batch of items at a time instead of through the functor.
+    bool shouldRenderAtLOD(const RenderArgs* args, const AABox& bound);
+
     void cullItems(const RenderContextPointer& renderContext, const CullFunctor& cullFunctor, RenderDetails::Item& details,
         const ItemBounds& inItems, ItemBounds& outItems);
 
@@ -38,6 +42,30 @@ namespace render {
         bool solidAngleTest(const AABox& bound);
     };
 
+    // Batched frustum / solidAngle test helper class
+    //   The bounds are copied into a structure of arrays, so that the tests can be evaluated for BATCH_SIZE items at once
+    //   (with AVX2, when the CPU supports it), then the items that pass are compacted into the output.
+    //   The buffers are kept between calls to avoid reallocating them every frame.
+    class CullBatch {
+    public:
+        static const int BATCH_SIZE = 8;
+
+        enum Tests {
+            FRUSTUM = 1 << 0,
+            SOLID_ANGLE = 1 << 1,
+            KEEP_NULL_BOUNDS = 1 << 2, // items with a null bound pass without being tested
+        };
+
+        // append the items that pass the tests to outItems, preserving their order
+        void cull(const RenderArgs* args, const CullFunctor& cullFunctor, RenderDetails::Item& details,
+            const ItemBounds& inItems, ItemBounds& outItems, int tests = FRUSTUM | SOLID_ANGLE);
+
+    private:
+        std::vector<float> _bounds; // corner and scale, one array per component
+        std::vector<uint8_t> _inViewMasks; // one bit per item
+        std::vector<uint8_t> _bigEnoughMasks;
+    };
+
     class FetchNonspatialItems {
     public:
         using JobModel = Job::ModelIO<FetchNonspatialItems, ItemFilter, ItemBounds>;
@@ -49,6 +77,7 @@ namespace render {
         Q_PROPERTY(int numItems READ getNumItems)
         Q_PROPERTY(bool freezeFrustum MEMBER freezeFrustum WRITE setFreezeFrustum)
         Q_PROPERTY(float LODAngle MEMBER lodAngle NOTIFY dirty)
+        Q_PROPERTY(bool parallel MEMBER parallel NOTIFY dirty)
     
     public:
         int numItems{ 0 };
@@ -57,6 +86,8 @@ namespace render {
         bool freezeFrustum{ false };
     
         float lodAngle{ 2.0 };
+
+        bool parallel{ false }; // select the octree cells across threads
     public slots:
         void setFreezeFrustum(bool enabled) { freezeFrustum = enabled; emit dirty(); }
 
@@ -69,6 +100,7 @@ namespace render {
         bool _justFrozeFrustum{ false };
         ViewFrustum _frozenFrustum;
         float _lodAngle;
+        bool _parallel{ false };
 
     public:
         using Config = FetchSpatialTreeConfig;
@@ -86,12 +118,14 @@ namespace render {
         Q_PROPERTY(int numItems READ getNumItems)
         Q_PROPERTY(bool freezeFrustum MEMBER freezeFrustum WRITE setFreezeFrustum)
         Q_PROPERTY(bool skipCulling MEMBER skipCulling WRITE setSkipCulling)
+        Q_PROPERTY(bool parallel MEMBER parallel NOTIFY dirty)
     public:
         int numItems{ 0 };
         int getNumItems() { return numItems; }
 
         bool freezeFrustum{ false };
         bool skipCulling{ false };
+        bool parallel{ false }; // filter and cull ranges of the selection across threads
     public slots:
         void setFreezeFrustum(bool enabled) { freezeFrustum = enabled; emit dirty(); }
         void setSkipCulling(bool enabled) { skipCulling = enabled; emit dirty(); }
@@ -117,10 +151,29 @@ namespace render {
         bool _freezeFrustum { false }; // initialized by Config
         bool _justFrozeFrustum { false };
         bool _overrideSkipCulling { false };
+        bool _parallel { false };
         ViewFrustum _frozenFrustum;
 
         void configure(const Config& config);
         void run(const RenderContextPointer& renderContext, const Inputs& inputs, ItemBounds& outItems);
+
+    private:
+        // the working set of a range of the selection
+        struct CullRange {
+            CullBatch cullBatch;
+            ItemBounds filteredItems;
+            ItemBounds culledItems;
+            ItemBounds outItems;
+            RenderDetails::Item details;
+        };
+
+        // filter the selected items, then cull them in batches
+        void filterAndCull(const RenderArgs* args, Scene& scene, const ItemFilter& filter, RenderDetails::Item& details,
+            const ItemIDs& inItems, ItemBounds& outItems, int tests);
+        void filterAndCullRange(const RenderArgs* args, Scene& scene, const ItemFilter& filter, RenderDetails::Item& details,
+            const ItemID* begin, const ItemID* end, ItemBounds& outItems, int tests, CullRange& range) const;
+
+        std::vector<CullRange> _ranges;
     };
 
     class CullShapeBounds {
@@ -13,6 +13,10 @@
 #include "ShapePipeline.h"
 
 #include <assert.h>
+
+#include <tbb/parallel_sort.h>
+
+#include <TBBHelpers.h>
 #include <ViewFrustum.h>
 
 using namespace render;
@@ -29,19 +33,19 @@ struct ItemBoundSort {
 };
 
 struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
+    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) const {
         return (left._centerDepth < right._centerDepth);
     }
 };
 
 struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
+    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) const {
         return (left._centerDepth > right._centerDepth);
     }
 };
 
 void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
-                            const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
+                            const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds, bool parallel) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
@@ -58,21 +62,40 @@ void render::depthSortItems(const RenderContextPointer& renderContext, bool fron
     std::vector<ItemBoundSort> itemBoundSorts;
     itemBoundSorts.reserve(outItems.size());
 
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound();
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
-
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
-    }
+    if (parallel) {
+        const ViewFrustum& frustum = args->getViewFrustum();
+        itemBoundSorts.resize(inItems.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, inItems.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                auto& bound = inItems[i].bound;
+                float distanceSquared = frustum.distanceToCameraSquared(bound.calcCenter());
+                itemBoundSorts[i] = ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, inItems[i].id, bound);
+            }
+        });
 
-    // sort against Z
-    if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+        // sort against Z
+        if (frontToBack) {
+            tbb::parallel_sort(itemBoundSorts.begin(), itemBoundSorts.end(), FrontToBackSort());
+        } else {
+            tbb::parallel_sort(itemBoundSorts.begin(), itemBoundSorts.end(), BackToFrontSort());
+        }
     } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        for (auto itemDetails : inItems) {
+            auto item = scene->getItem(itemDetails.id);
+            auto bound = itemDetails.bound; // item.getBound();
+            float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
+
+            itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+        }
+
+        // sort against Z
+        if (frontToBack) {
+            FrontToBackSort frontToBackSort;
+            std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+        } else {
+            BackToFrontSort  backToFrontSort;
+            std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        }
     }
 
     // Finally once sorted result to a list of itemID and keep uniques
@@ -155,5 +178,5 @@ void DepthSortShapesAndComputeBounds::run(const RenderContextPointer& renderCont
 }
 
 void DepthSortItems::run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems) {
-    depthSortItems(renderContext, _frontToBack, inItems, outItems);
+    depthSortItems(renderContext, _frontToBack, inItems, outItems, nullptr, _parallel);
 }
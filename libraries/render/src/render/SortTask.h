@@ -15,7 +15,9 @@
 #include "Engine.h"
 
 namespace render {
-    void depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds = nullptr);
+    // if parallel, the depths are evaluated and sorted across threads
+    void depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, const ItemBounds& inItems, ItemBounds& outItems,
+                        AABox* bounds = nullptr, bool parallel = false);
 
     class PipelineSortShapes {
     public:
@@ -44,13 +46,25 @@ namespace render {
         void run(const RenderContextPointer& renderContext, const ShapeBounds& inShapes, Outputs& outputs);
     };
 
+    class DepthSortItemsConfig : public Job::Config {
+        Q_OBJECT
+        Q_PROPERTY(bool parallel MEMBER parallel NOTIFY dirty)
+    public:
+        bool parallel { false };
+    signals:
+        void dirty();
+    };
+
     class DepthSortItems {
     public:
-        using JobModel = Job::ModelIO<DepthSortItems, ItemBounds, ItemBounds>;
+        using Config = DepthSortItemsConfig;
+        using JobModel = Job::ModelIO<DepthSortItems, ItemBounds, ItemBounds, Config>;
 
         bool _frontToBack;
+        bool _parallel { false };
         DepthSortItems(bool frontToBack = true) : _frontToBack(frontToBack) {}
 
+        void configure(const Config& config) { _parallel = config.parallel; }
         void run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems);
     };
 }
@@ -11,6 +11,7 @@
 #include "SpatialTree.h"
 
 #include <ViewFrustum.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
@@ -596,41 +597,43 @@ int Octree::selectCellBrick(Index cellID, CellSelection& selection, bool inside)
     return (int) selection.size() - numSelectedsIn;
 }
 
-int ItemSpatialTree::selectCells(CellSelection& selection, const ViewFrustum& frustum, float threshold) const {
+const Octree::FrustumSelector& ItemSpatialTree::evalSelector(const ViewFrustum& frustum, float threshold,
+        PerspectiveSelector& perspective, OrthographicSelector& orthographic) const {
     auto worldPlanes = frustum.getPlanes();
     if (frustum.isPerspective()) {
-        PerspectiveSelector selector;
         for (int i = 0; i < ViewFrustum::NUM_PLANES; i++) {
             ::Plane octPlane;
             octPlane.setNormalAndPoint(worldPlanes[i].getNormal(), evalCoordf(worldPlanes[i].getPoint(), ROOT_DEPTH));
-            selector.frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
+            perspective.frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
         }
 
-        selector.eyePos = evalCoordf(frustum.getPosition(), ROOT_DEPTH);
-        selector.setAngle(threshold);
+        perspective.eyePos = evalCoordf(frustum.getPosition(), ROOT_DEPTH);
+        perspective.setAngle(threshold);
 
-        return Octree::select(selection, selector);
+        return perspective;
     } else {
-        OrthographicSelector selector;
         for (int i = 0; i < ViewFrustum::NUM_PLANES; i++) {
             ::Plane octPlane;
             octPlane.setNormalAndPoint(worldPlanes[i].getNormal(), evalCoordf(worldPlanes[i].getPoint(), ROOT_DEPTH));
-            selector.frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
+            orthographic.frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
         }
 
         // Divide the threshold (which is in world distance units) by the dimension of the octree
         // as all further computations will be done in normalized octree units
         threshold *= getInvCellWidth(ROOT_DEPTH);
-        selector.setSize(threshold);
+        orthographic.setSize(threshold);
 
-        return Octree::select(selection, selector);
+        return orthographic;
     }
 }
 
-int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
-                                     float threshold) const {
-    selectCells(selection.cellSelection, frustum, threshold);
+int ItemSpatialTree::selectCells(CellSelection& selection, const ViewFrustum& frustum, float threshold) const {
+    PerspectiveSelector perspective;
+    OrthographicSelector orthographic;
+    return Octree::select(selection, evalSelector(frustum, threshold, perspective, orthographic));
+}
 
+void ItemSpatialTree::selectBrickItems(ItemSelection& selection) const {
     // Just grab the items in every selected bricks
     for (auto brickId : selection.cellSelection.insideBricks) {
         auto& brickItems = getConcreteBrick(brickId).items;
@@ -647,9 +650,57 @@ int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter&
         auto& brickSubcellItems = getConcreteBrick(brickId).subcellItems;
         selection.partialSubcellItems.insert(selection.partialSubcellItems.end(), brickSubcellItems.begin(), brickSubcellItems.end());
     }
+}
 
-    return (int) selection.numItems();
+template <class Vector>
+static void appendVector(Vector& to, const Vector& from) {
+    to.insert(to.end(), from.begin(), from.end());
 }
 
+void ItemSpatialTree::ItemSelection::append(const ItemSelection& other) {
+    appendVector(cellSelection.insideCells, other.cellSelection.insideCells);
+    appendVector(cellSelection.insideBricks, other.cellSelection.insideBricks);
+    appendVector(cellSelection.partialCells, other.cellSelection.partialCells);
+    appendVector(cellSelection.partialBricks, other.cellSelection.partialBricks);
+    appendVector(insideItems, other.insideItems);
+    appendVector(insideSubcellItems, other.insideSubcellItems);
+    appendVector(partialItems, other.partialItems);
+    appendVector(partialSubcellItems, other.partialSubcellItems);
+}
 
+int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
+                                     float threshold, bool parallel) const {
+    if (!parallel) {
+        selectCells(selection.cellSelection, frustum, threshold);
+        selectBrickItems(selection);
+        return (int) selection.numItems();
+    }
+
+    PerspectiveSelector perspective;
+    OrthographicSelector orthographic;
+    const auto& selector = evalSelector(frustum, threshold, perspective, orthographic);
+
+    // Same as Octree::select, with each octant of the root cell traversed and collected in its own selection.
+    // Appending them in octant order yields the serial selection.
+    ItemSelection rootSelection;
+    selectCellBrick(ROOT_CELL, rootSelection.cellSelection, false);
+    selectBrickItems(rootSelection);
+    selection.append(rootSelection);
+
+    std::array<ItemSelection, NUM_OCTANTS> octantSelections;
+    auto rootCell = getConcreteCell(ROOT_CELL);
+    tbb::parallel_for(0, (int)NUM_OCTANTS, [&](int octant) {
+        Index subCellID = rootCell.child((Link)octant);
+        if (subCellID != INVALID_CELL) {
+            selectTraverse(subCellID, octantSelections[octant].cellSelection, selector);
+            selectBrickItems(octantSelections[octant]);
+        }
+    });
+
+    for (auto& octantSelection : octantSelections) {
+        selection.append(octantSelection);
+    }
+
+    return (int) selection.numItems();
+}
 
@@ -471,10 +471,23 @@ namespace render {
                 partialItems.clear();
                 partialSubcellItems.clear();
             }
+
+            // append the cells and items of another selection
+            void append(const ItemSelection& other);
         };
 
+        // if parallel, each octant of the root cell is selected on its own thread,
+        // the resulting selection is the same
         int selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
-                            float threshold) const;
+                            float threshold, bool parallel = false) const;
+
+    protected:
+        // build the selector for the frustum in octree coordinates, in whichever of perspective or orthographic applies
+        const FrustumSelector& evalSelector(const ViewFrustum& frustum, float threshold,
+                                            PerspectiveSelector& perspective, OrthographicSelector& orthographic) const;
+
+        // collect the items of the selected bricks
+        void selectBrickItems(ItemSelection& selection) const;
     };
 }
 
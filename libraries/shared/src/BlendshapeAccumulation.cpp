@@ -0,0 +1,152 @@
+//
+//  BlendshapeAccumulation.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BlendshapeAccumulation.h"
+
+#include <algorithm>
+#include <numeric>
+
+const float BlendshapeAccumulationData::MIN_COEFFICIENT = 0.0001f;
+const float BlendshapeAccumulationData::NORMAL_COEFFICIENT_SCALE = 0.01f;
+
+void accumulateBlendshapeOffsets_ref(const int32_t* indices, const float* const* components, int begin, int end,
+                                     float positionCoefficient, float normalCoefficient, float (*unpacked)[9]) {
+    for (int i = begin; i < end; i++) {
+        float* vertex = unpacked[indices[i]];
+        for (int c = 0; c < 3; c++) {
+            vertex[c] += components[c][i] * positionCoefficient;
+        }
+        for (int c = 3; c < 9; c++) {
+            vertex[c] += components[c][i] * normalCoefficient;
+        }
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void accumulateBlendshapeOffsets_AVX2(const int32_t* indices, const float* const* components, int begin, int end,
+                                      float positionCoefficient, float normalCoefficient, float (*unpacked)[9]);
+
+static void accumulateBlendshapeOffsets(const int32_t* indices, const float* const* components, int begin, int end,
+                                        float positionCoefficient, float normalCoefficient, float (*unpacked)[9]) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        accumulateBlendshapeOffsets_AVX2(indices, components, begin, end, positionCoefficient, normalCoefficient, unpacked);
+    } else {
+        accumulateBlendshapeOffsets_ref(indices, components, begin, end, positionCoefficient, normalCoefficient, unpacked);
+    }
+}
+
+#else   // portable reference code
+static auto& accumulateBlendshapeOffsets = accumulateBlendshapeOffsets_ref;
+#endif
+
+BlendshapeAccumulationData::BlendshapeAccumulationData(int numVertices) :
+    _numVertices(numVertices),
+    _numChunks((numVertices + CHUNK_SIZE - 1) / CHUNK_SIZE) {
+}
+
+void BlendshapeAccumulationData::addBlendshape(const int* indices, const glm::vec3* vertices, int numIndices,
+                                               const glm::vec3* normals, int numNormals, const glm::vec3* tangents, int numTangents) {
+    // sort the entries by vertex index, leaving out those that are outside the mesh
+    std::vector<int> order;
+    order.reserve(numIndices);
+    for (int i = 0; i < numIndices; i++) {
+        if (indices[i] >= 0 && indices[i] < _numVertices) {
+            order.push_back(i);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return indices[a] < indices[b];
+    });
+
+    int begin = (int)_indices.size();
+    for (int k = 0; k < (int)order.size(); k++) {
+        int i = order[k];
+        float values[NUM_COMPONENTS] = {
+            vertices[i].x, vertices[i].y, vertices[i].z,
+            0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f
+        };
+        if (i < numNormals) {
+            values[3] = normals[i].x;
+            values[4] = normals[i].y;
+            values[5] = normals[i].z;
+        }
+        if (i < numTangents) {
+            values[6] = tangents[i].x;
+            values[7] = tangents[i].y;
+            values[8] = tangents[i].z;
+        }
+
+        // the kernels require unique indices, so sum the offsets of repeated ones
+        if ((int)_indices.size() > begin && _indices.back() == indices[i]) {
+            for (int c = 0; c < NUM_COMPONENTS; c++) {
+                _components[c].back() += values[c];
+            }
+        } else {
+            _indices.push_back(indices[i]);
+            for (int c = 0; c < NUM_COMPONENTS; c++) {
+                _components[c].push_back(values[c]);
+            }
+        }
+    }
+    int end = (int)_indices.size();
+
+    // find where each chunk begins
+    int entry = begin;
+    for (int chunk = 0; chunk < _numChunks; chunk++) {
+        int chunkStartVertex = chunk * CHUNK_SIZE;
+        while (entry < end && _indices[entry] < chunkStartVertex) {
+            entry++;
+        }
+        _chunkStarts.push_back(entry);
+    }
+    _chunkStarts.push_back(end);
+
+    _numBlendshapes++;
+}
+
+bool BlendshapeAccumulationData::hasActiveBlendshapes(const float* coefficients, int numCoefficients) const {
+    int numActive = std::min(numCoefficients, _numBlendshapes);
+    for (int i = 0; i < numActive; i++) {
+        if (coefficients[i] >= MIN_COEFFICIENT) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BlendshapeAccumulationData::accumulate(int chunk, const float* coefficients, int numCoefficients,
+                                            float (*unpacked)[NUM_COMPONENTS]) const {
+    const float* components[NUM_COMPONENTS];
+    for (int c = 0; c < NUM_COMPONENTS; c++) {
+        components[c] = _components[c].data();
+    }
+
+    int numActive = std::min(numCoefficients, _numBlendshapes);
+    for (int i = 0; i < numActive; i++) {
+        float positionCoefficient = coefficients[i];
+        if (positionCoefficient < MIN_COEFFICIENT) {
+            continue;
+        }
+        const int* chunkStarts = &_chunkStarts[i * (_numChunks + 1)];
+        int begin = chunkStarts[chunk];
+        int end = chunkStarts[chunk + 1];
+        if (begin < end) {
+            accumulateBlendshapeOffsets(_indices.data(), components, begin, end,
+                                        positionCoefficient, positionCoefficient * NORMAL_COEFFICIENT_SCALE, unpacked);
+        }
+    }
+}
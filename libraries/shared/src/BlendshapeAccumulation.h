@@ -0,0 +1,68 @@
+//
+//  BlendshapeAccumulation.h
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BlendshapeAccumulation_h
+#define hifi_BlendshapeAccumulation_h
+
+#include <stdint.h>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// The blendshapes of one mesh, rearranged for weighting and summing their offsets:
+//   the offsets of all blendshapes are stored as one array per component (structure of arrays), and the entries of
+//   each blendshape are sorted by vertex index and split at every CHUNK_SIZE vertices, so that separate chunks of
+//   the mesh can be blended on separate threads.
+class BlendshapeAccumulationData {
+public:
+    static const int NUM_COMPONENTS = 9;    // position, normal and tangent offsets, like BlendshapeOffsetUnpacked
+    static const int CHUNK_SIZE = 4096;
+
+    // Blendshapes with a smaller coefficient are skipped
+    static const float MIN_COEFFICIENT;
+    // The normal and tangent offsets are scaled by the coefficient times this
+    static const float NORMAL_COEFFICIENT_SCALE;
+
+    BlendshapeAccumulationData(int numVertices = 0);
+
+    // Blendshapes are numbered in the order they are added, which must match the order of the coefficients.
+    // normals and tangents may have fewer entries than indices; the missing offsets are zero.
+    void addBlendshape(const int* indices, const glm::vec3* vertices, int numIndices,
+                       const glm::vec3* normals, int numNormals, const glm::vec3* tangents, int numTangents);
+
+    int getNumVertices() const { return _numVertices; }
+    int getNumBlendshapes() const { return _numBlendshapes; }
+    int getNumChunks() const { return _numChunks; }
+
+    // Returns true if any of the first getNumBlendshapes() coefficients is large enough to be blended
+    bool hasActiveBlendshapes(const float* coefficients, int numCoefficients) const;
+
+    // Adds the offsets of the vertices of chunk, weighted by the blendshape coefficients, to unpacked,
+    // which holds the NUM_COMPONENTS floats of each vertex of the mesh
+    void accumulate(int chunk, const float* coefficients, int numCoefficients, float (*unpacked)[NUM_COMPONENTS]) const;
+
+private:
+    int _numVertices { 0 };
+    int _numChunks { 0 };
+    int _numBlendshapes { 0 };
+
+    std::vector<int32_t> _indices;
+    std::vector<float> _components[NUM_COMPONENTS];
+
+    // the position in _indices where each chunk of each blendshape begins, followed by the end of the blendshape
+    std::vector<int> _chunkStarts;
+};
+
+// Adds the offsets of entries [begin, end) to the vertices they index, the position offsets scaled by
+// positionCoefficient and the normal and tangent offsets by normalCoefficient. Indices in the range must be unique.
+void accumulateBlendshapeOffsets_ref(const int32_t* indices, const float* const* components, int begin, int end,
+                                     float positionCoefficient, float normalCoefficient, float (*unpacked)[9]);
+
+#endif // hifi_BlendshapeAccumulation_h
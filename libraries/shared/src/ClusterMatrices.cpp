@@ -0,0 +1,46 @@
+//
+//  ClusterMatrices.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ClusterMatrices.h"
+
+#include "GLMHelpers.h"
+
+void computeClusterMatrices_ref(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                                int numClusters, glm::mat4* clusterMatrices) {
+    for (int i = 0; i < numClusters; i++) {
+        glm_mat4u_mul(jointMatrices[jointIndices[i]], inverseBindMatrices[i], clusterMatrices[i]);
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void computeClusterMatrices_AVX2(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                                 int numClusters, glm::mat4* clusterMatrices);
+
+void computeClusterMatrices(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                            int numClusters, glm::mat4* clusterMatrices) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        computeClusterMatrices_AVX2(jointMatrices, jointIndices, inverseBindMatrices, numClusters, clusterMatrices);
+    } else {
+        computeClusterMatrices_ref(jointMatrices, jointIndices, inverseBindMatrices, numClusters, clusterMatrices);
+    }
+}
+
+#else   // portable reference code
+void computeClusterMatrices(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                            int numClusters, glm::mat4* clusterMatrices) {
+    computeClusterMatrices_ref(jointMatrices, jointIndices, inverseBindMatrices, numClusters, clusterMatrices);
+}
+#endif
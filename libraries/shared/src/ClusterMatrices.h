@@ -0,0 +1,27 @@
+//
+//  ClusterMatrices.h
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ClusterMatrices_h
+#define hifi_ClusterMatrices_h
+
+#include <stdint.h>
+
+#include <glm/glm.hpp>
+
+// Computes the skinning matrix of each of numClusters clusters, the matrix of its joint times its inverse bind matrix:
+//   clusterMatrices[i] = jointMatrices[jointIndices[i]] * inverseBindMatrices[i]
+// The joint indices must be valid indices into jointMatrices.
+void computeClusterMatrices(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                            int numClusters, glm::mat4* clusterMatrices);
+
+void computeClusterMatrices_ref(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                                int numClusters, glm::mat4* clusterMatrices);
+
+#endif // hifi_ClusterMatrices_h
@@ -59,3 +59,11 @@ void MovingPercentile::updatePercentile(qint64 sample) {
     // find new value at percentile
     _valueAtPercentile = _samplesSorted[_indexOfPercentile];
 }
+
+void MovingPercentile::reset() {
+    _samplesSorted.clear();
+    _sampleIds.clear();
+    _newSampleId = 0;
+    _indexOfPercentile = 0;
+    _valueAtPercentile = 0;
+}
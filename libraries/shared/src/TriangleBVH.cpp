@@ -0,0 +1,709 @@
+//
+//  TriangleBVH.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TriangleBVH.h"
+
+#include <assert.h>
+#include <algorithm>
+
+#include "GLMHelpers.h"
+#include "NumericalConstants.h"
+
+namespace {
+
+// the number of bins along the split axis in which the surface area heuristic is evaluated
+const int NUM_SAH_BINS = 16;
+
+struct Bounds {
+    glm::vec3 minimum { FLT_MAX };
+    glm::vec3 maximum { -FLT_MAX };
+
+    void add(const glm::vec3& point) {
+        minimum = glm::min(minimum, point);
+        maximum = glm::max(maximum, point);
+    }
+    void add(const Bounds& other) {
+        minimum = glm::min(minimum, other.minimum);
+        maximum = glm::max(maximum, other.maximum);
+    }
+    float getSurfaceArea() const {
+        if (minimum.x > maximum.x) {
+            return 0.0f;
+        }
+        glm::vec3 dimensions = maximum - minimum;
+        return 2.0f * (dimensions.x * dimensions.y + dimensions.y * dimensions.z + dimensions.z * dimensions.x);
+    }
+};
+
+struct TriangleRef {
+    Bounds bounds;
+    glm::vec3 centroid;
+    int32_t triangle;
+};
+
+}
+
+class TriangleBVH::Builder {
+public:
+    Builder(TriangleBVH& bvh, const std::vector<Triangle>& triangles);
+    void build();
+
+private:
+    Bounds getBounds(int begin, int end) const;
+    // partitions [begin, end) in two non empty ranges and returns where the second one starts
+    int split(int begin, int end);
+    int32_t buildNode(int begin, int end);
+    int32_t buildLeaf(int begin, int end);
+
+    TriangleBVH& _bvh;
+    const std::vector<Triangle>& _triangles;
+    std::vector<TriangleRef> _refs;
+};
+
+TriangleBVH::Builder::Builder(TriangleBVH& bvh, const std::vector<Triangle>& triangles) :
+    _bvh(bvh),
+    _triangles(triangles)
+{
+    _refs.resize(triangles.size());
+    for (size_t i = 0; i < triangles.size(); i++) {
+        TriangleRef& ref = _refs[i];
+        ref.bounds.add(triangles[i].v0);
+        ref.bounds.add(triangles[i].v1);
+        ref.bounds.add(triangles[i].v2);
+        ref.centroid = 0.5f * (ref.bounds.minimum + ref.bounds.maximum);
+        ref.triangle = (int32_t)i;
+    }
+}
+
+void TriangleBVH::Builder::build() {
+    // a full tree has a third as many nodes as leaves
+    _bvh._leaves.reserve(_refs.size() / 2 + 1);
+    _bvh._nodes.reserve(_refs.size() / 6 + 1);
+    buildNode(0, (int)_refs.size());
+}
+
+Bounds TriangleBVH::Builder::getBounds(int begin, int end) const {
+    Bounds bounds;
+    for (int i = begin; i < end; i++) {
+        bounds.add(_refs[i].bounds);
+    }
+    return bounds;
+}
+
+int TriangleBVH::Builder::split(int begin, int end) {
+    Bounds centroidBounds;
+    for (int i = begin; i < end; i++) {
+        centroidBounds.add(_refs[i].centroid);
+    }
+    glm::vec3 extent = centroidBounds.maximum - centroidBounds.minimum;
+    int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : ((extent.y >= extent.z) ? 1 : 2);
+
+    int middle = (begin + end) / 2;
+    if (extent[axis] <= 0.0f) {
+        // all the centroids are the same, so any split is as good as any other
+        return middle;
+    }
+
+    // bin the triangles by centroid
+    struct Bin {
+        Bounds bounds;
+        int count { 0 };
+    };
+    Bin bins[NUM_SAH_BINS];
+    const float binScale = (float)NUM_SAH_BINS / extent[axis];
+    const float binMinimum = centroidBounds.minimum[axis];
+    auto getBin = [&](const TriangleRef& ref) {
+        return std::min(NUM_SAH_BINS - 1, (int)((ref.centroid[axis] - binMinimum) * binScale));
+    };
+    for (int i = begin; i < end; i++) {
+        Bin& bin = bins[getBin(_refs[i])];
+        bin.bounds.add(_refs[i].bounds);
+        bin.count++;
+    }
+
+    // the cost of splitting before bin i is proportional to the area of each side times the number of triangles in it
+    float rightAreas[NUM_SAH_BINS];
+    int rightCounts[NUM_SAH_BINS];
+    Bounds right;
+    int rightCount = 0;
+    for (int i = NUM_SAH_BINS - 1; i > 0; i--) {
+        right.add(bins[i].bounds);
+        rightCount += bins[i].count;
+        rightAreas[i] = right.getSurfaceArea();
+        rightCounts[i] = rightCount;
+    }
+
+    int bestSplit = -1;
+    float bestCost = FLT_MAX;
+    Bounds left;
+    int leftCount = 0;
+    for (int i = 1; i < NUM_SAH_BINS; i++) {
+        left.add(bins[i - 1].bounds);
+        leftCount += bins[i - 1].count;
+        if (leftCount == 0 || rightCounts[i] == 0) {
+            continue;
+        }
+        float cost = left.getSurfaceArea() * (float)leftCount + rightAreas[i] * (float)rightCounts[i];
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSplit = i;
+        }
+    }
+
+    if (bestSplit < 0) {
+        std::nth_element(_refs.begin() + begin, _refs.begin() + middle, _refs.begin() + end,
+            [axis](const TriangleRef& a, const TriangleRef& b) { return a.centroid[axis] < b.centroid[axis]; });
+        return middle;
+    }
+    auto it = std::partition(_refs.begin() + begin, _refs.begin() + end, [&](const TriangleRef& ref) {
+        return getBin(ref) < bestSplit;
+    });
+    return (int)(it - _refs.begin());
+}
+
+int32_t TriangleBVH::Builder::buildNode(int begin, int end) {
+    int32_t nodeIndex = (int32_t)_bvh._nodes.size();
+    _bvh._nodes.emplace_back();
+
+    // split the largest range until there are as many as a node has children, or all of them fit in leaves
+    struct Range {
+        int begin;
+        int end;
+    };
+    Range ranges[WIDTH] = { { begin, end } };
+    int numRanges = 1;
+    while (numRanges < WIDTH) {
+        int largest = -1;
+        for (int i = 0; i < numRanges; i++) {
+            int count = ranges[i].end - ranges[i].begin;
+            if (count > WIDTH && (largest < 0 || count > ranges[largest].end - ranges[largest].begin)) {
+                largest = i;
+            }
+        }
+        if (largest < 0) {
+            break;
+        }
+        int middle = split(ranges[largest].begin, ranges[largest].end);
+        ranges[numRanges++] = { middle, ranges[largest].end };
+        ranges[largest].end = middle;
+    }
+
+    int32_t children[WIDTH];
+    Bounds childBounds[WIDTH];
+    for (int i = 0; i < numRanges; i++) {
+        bool isLeaf = ranges[i].end - ranges[i].begin <= WIDTH;
+        children[i] = isLeaf ? buildLeaf(ranges[i].begin, ranges[i].end) : buildNode(ranges[i].begin, ranges[i].end);
+        childBounds[i] = getBounds(ranges[i].begin, ranges[i].end);
+    }
+
+    // the recursion may have reallocated the nodes
+    Node& node = _bvh._nodes[nodeIndex];
+    node.numChildren = numRanges;
+    for (int i = 0; i < WIDTH; i++) {
+        // unused children have inverted bounds, which no ray intersects
+        const Bounds& bounds = (i < numRanges) ? childBounds[i] : Bounds();
+        node.minX[i] = bounds.minimum.x;
+        node.minY[i] = bounds.minimum.y;
+        node.minZ[i] = bounds.minimum.z;
+        node.maxX[i] = bounds.maximum.x;
+        node.maxY[i] = bounds.maximum.y;
+        node.maxZ[i] = bounds.maximum.z;
+        node.children[i] = (i < numRanges) ? children[i] : ~0;
+    }
+    return nodeIndex;
+}
+
+int32_t TriangleBVH::Builder::buildLeaf(int begin, int end) {
+    int32_t leafIndex = (int32_t)_bvh._leaves.size();
+    _bvh._leaves.emplace_back();
+    Leaf& leaf = _bvh._leaves.back();
+
+    Bounds bounds = getBounds(begin, end);
+    leaf.bounds = AABox(bounds.minimum, bounds.maximum - bounds.minimum);
+    leaf.numTriangles = end - begin;
+    for (int i = 0; i < WIDTH; i++) {
+        // unused lanes are degenerate triangles at the origin, which no ray intersects
+        glm::vec3 v0, e1, e2;
+        int32_t triangleIndex = -1;
+        if (begin + i < end) {
+            triangleIndex = _refs[begin + i].triangle;
+            const Triangle& triangle = _triangles[triangleIndex];
+            v0 = triangle.v0;
+            e1 = triangle.v1 - triangle.v0;
+            e2 = triangle.v2 - triangle.v0;
+        }
+        leaf.v0X[i] = v0.x;
+        leaf.v0Y[i] = v0.y;
+        leaf.v0Z[i] = v0.z;
+        leaf.e1X[i] = e1.x;
+        leaf.e1Y[i] = e1.y;
+        leaf.e1Z[i] = e1.z;
+        leaf.e2X[i] = e2.x;
+        leaf.e2Y[i] = e2.y;
+        leaf.e2Z[i] = e2.z;
+        leaf.triangles[i] = triangleIndex;
+    }
+    return ~leafIndex;
+}
+
+void TriangleBVH::build(const std::vector<Triangle>& triangles) {
+    clear();
+    if (triangles.empty()) {
+        return;
+    }
+    Builder(*this, triangles).build();
+}
+
+void TriangleBVH::clear() {
+    _nodes.clear();
+    _leaves.clear();
+}
+
+AABox TriangleBVH::getChildBounds(const Node& node, int child) {
+    glm::vec3 minimum(node.minX[child], node.minY[child], node.minZ[child]);
+    glm::vec3 maximum(node.maxX[child], node.maxY[child], node.maxZ[child]);
+    return AABox(minimum, maximum - minimum);
+}
+
+int TriangleBVH::intersectChildren(const Node& node, const glm::vec3& origin, const glm::vec3& invDirection,
+                                   float maxDistance, float distances[WIDTH]) {
+    int mask = 0;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    const __m128 ox = _mm_set1_ps(origin.x);
+    const __m128 oy = _mm_set1_ps(origin.y);
+    const __m128 oz = _mm_set1_ps(origin.z);
+    const __m128 ix = _mm_set1_ps(invDirection.x);
+    const __m128 iy = _mm_set1_ps(invDirection.y);
+    const __m128 iz = _mm_set1_ps(invDirection.z);
+
+    // the slabs of the four boxes
+    __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.minX), ox), ix);
+    __m128 t2x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.maxX), ox), ix);
+    __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.minY), oy), iy);
+    __m128 t2y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.maxY), oy), iy);
+    __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.minZ), oz), iz);
+    __m128 t2z = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.maxZ), oz), iz);
+
+    __m128 tmin = _mm_max_ps(_mm_min_ps(t1x, t2x), _mm_max_ps(_mm_min_ps(t1y, t2y), _mm_min_ps(t1z, t2z)));
+    __m128 tmax = _mm_min_ps(_mm_max_ps(t1x, t2x), _mm_min_ps(_mm_max_ps(t1y, t2y), _mm_max_ps(t1z, t2z)));
+    tmin = _mm_max_ps(tmin, _mm_setzero_ps());
+
+    __m128 hit = _mm_and_ps(_mm_cmple_ps(tmin, tmax), _mm_cmplt_ps(tmin, _mm_set1_ps(maxDistance)));
+    _mm_storeu_ps(distances, tmin);
+    mask = _mm_movemask_ps(hit);
+#else
+    const float* minimums[3] = { node.minX, node.minY, node.minZ };
+    const float* maximums[3] = { node.maxX, node.maxY, node.maxZ };
+    for (int i = 0; i < WIDTH; i++) {
+        float tmin = 0.0f;
+        float tmax = FLT_MAX;
+        for (int axis = 0; axis < 3; axis++) {
+            float t1 = (minimums[axis][i] - origin[axis]) * invDirection[axis];
+            float t2 = (maximums[axis][i] - origin[axis]) * invDirection[axis];
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+        }
+        distances[i] = tmin;
+        if (tmin <= tmax && tmin < maxDistance) {
+            mask |= 1 << i;
+        }
+    }
+#endif
+    return mask & ((1 << node.numChildren) - 1);
+}
+
+void TriangleBVH::RayPacket::addRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) {
+    assert(numRays < PACKET_SIZE);
+    glm::vec3 invDirection = 1.0f / direction;
+    int i = numRays++;
+    origins[i] = origin;
+    directions[i] = direction;
+    originX[i] = origin.x;
+    originY[i] = origin.y;
+    originZ[i] = origin.z;
+    invDirectionX[i] = invDirection.x;
+    invDirectionY[i] = invDirection.y;
+    invDirectionZ[i] = invDirection.z;
+    distances[i] = maxDistance;
+}
+
+// the same tests as intersectChildren, one ray at a time
+void TriangleBVH::intersectChildrenWithPacket_ref(const Node& node, const RayPacket& packet, int rayMask,
+                                                  int rayMasks[WIDTH], float distances[WIDTH]) {
+    for (int child = 0; child < node.numChildren; child++) {
+        rayMasks[child] = 0;
+        distances[child] = FLT_MAX;
+        for (int i = 0; i < PACKET_SIZE; i++) {
+            if (!(rayMask & (1 << i))) {
+                continue;
+            }
+            float t1x = (node.minX[child] - packet.originX[i]) * packet.invDirectionX[i];
+            float t2x = (node.maxX[child] - packet.originX[i]) * packet.invDirectionX[i];
+            float t1y = (node.minY[child] - packet.originY[i]) * packet.invDirectionY[i];
+            float t2y = (node.maxY[child] - packet.originY[i]) * packet.invDirectionY[i];
+            float t1z = (node.minZ[child] - packet.originZ[i]) * packet.invDirectionZ[i];
+            float t2z = (node.maxZ[child] - packet.originZ[i]) * packet.invDirectionZ[i];
+
+            float tmin = std::max(std::max(std::min(t1x, t2x), std::max(std::min(t1y, t2y), std::min(t1z, t2z))), 0.0f);
+            float tmax = std::min(std::max(t1x, t2x), std::min(std::max(t1y, t2y), std::max(t1z, t2z)));
+            if (tmin <= tmax && tmin < packet.distances[i]) {
+                rayMasks[child] |= 1 << i;
+                distances[child] = std::min(distances[child], tmin);
+            }
+        }
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void TriangleBVH::intersectChildrenWithPacket(const Node& node, const RayPacket& packet, int rayMask,
+                                              int rayMasks[WIDTH], float distances[WIDTH]) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        intersectChildrenWithPacket_AVX2(node, packet, rayMask, rayMasks, distances);
+    } else {
+        intersectChildrenWithPacket_ref(node, packet, rayMask, rayMasks, distances);
+    }
+}
+
+#else   // portable reference code
+void TriangleBVH::intersectChildrenWithPacket(const Node& node, const RayPacket& packet, int rayMask,
+                                              int rayMasks[WIDTH], float distances[WIDTH]) {
+    intersectChildrenWithPacket_ref(node, packet, rayMask, rayMasks, distances);
+}
+#endif
+
+// Möller-Trumbore, with the same tests as findRayTriangleIntersection in GeometryUtil
+int TriangleBVH::intersectLeaf(const Leaf& leaf, const glm::vec3& origin, const glm::vec3& direction, float& distance,
+                               bool allowBackface) {
+    float distances[WIDTH];
+    int mask = 0;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 epsilon = _mm_set1_ps(EPSILON);
+    const __m128 dx = _mm_set1_ps(direction.x);
+    const __m128 dy = _mm_set1_ps(direction.y);
+    const __m128 dz = _mm_set1_ps(direction.z);
+
+    __m128 e1x = _mm_loadu_ps(leaf.e1X);
+    __m128 e1y = _mm_loadu_ps(leaf.e1Y);
+    __m128 e1z = _mm_loadu_ps(leaf.e1Z);
+    __m128 e2x = _mm_loadu_ps(leaf.e2X);
+    __m128 e2y = _mm_loadu_ps(leaf.e2Y);
+    __m128 e2z = _mm_loadu_ps(leaf.e2Z);
+
+    // P = cross(direction, e2)
+    __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+    __m128 valid;
+    if (allowBackface) {
+        __m128 absDet = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+        valid = _mm_cmpge_ps(absDet, epsilon);
+    } else {
+        valid = _mm_cmpge_ps(det, epsilon);
+    }
+    __m128 invDet = _mm_div_ps(one, det);
+
+    // T = origin - v0
+    __m128 tx = _mm_sub_ps(_mm_set1_ps(origin.x), _mm_loadu_ps(leaf.v0X));
+    __m128 ty = _mm_sub_ps(_mm_set1_ps(origin.y), _mm_loadu_ps(leaf.v0Y));
+    __m128 tz = _mm_sub_ps(_mm_set1_ps(origin.z), _mm_loadu_ps(leaf.v0Z));
+    __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), invDet);
+    valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+    // Q = cross(T, e1)
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+    __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+    valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+    __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+    valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(t, epsilon), _mm_cmplt_ps(t, _mm_set1_ps(distance))));
+
+    _mm_storeu_ps(distances, t);
+    mask = _mm_movemask_ps(valid) & ((1 << leaf.numTriangles) - 1);
+#else
+    for (int i = 0; i < leaf.numTriangles; i++) {
+        glm::vec3 v0(leaf.v0X[i], leaf.v0Y[i], leaf.v0Z[i]);
+        glm::vec3 v1 = v0 + glm::vec3(leaf.e1X[i], leaf.e1Y[i], leaf.e1Z[i]);
+        glm::vec3 v2 = v0 + glm::vec3(leaf.e2X[i], leaf.e2Y[i], leaf.e2Z[i]);
+        if (findRayTriangleIntersection(origin, direction, v0, v1, v2, distances[i], allowBackface) && distances[i] < distance) {
+            mask |= 1 << i;
+        }
+    }
+#endif
+
+    int nearest = -1;
+    for (int i = 0; i < WIDTH; i++) {
+        if ((mask & (1 << i)) && (nearest < 0 || distances[i] < distances[nearest])) {
+            nearest = i;
+        }
+    }
+    if (nearest >= 0) {
+        distance = distances[nearest];
+    }
+    return nearest;
+}
+
+// Visits the children of each node nearest first, skipping those further than distance, which leafTest may reduce.
+template <typename ChildTest, typename LeafTest>
+void TriangleBVH::traverse(float& distance, ChildTest&& childTest, LeafTest&& leafTest) const {
+    if (_nodes.empty()) {
+        return;
+    }
+
+    struct Entry {
+        int32_t child;
+        float distance;
+    };
+    static thread_local std::vector<Entry> stack;
+    stack.clear();
+    stack.push_back({ 0, 0.0f });
+
+    while (!stack.empty()) {
+        Entry entry = stack.back();
+        stack.pop_back();
+        if (entry.distance >= distance) {
+            continue;
+        }
+        if (entry.child < 0) {
+            leafTest(_leaves[~entry.child], distance);
+            continue;
+        }
+
+        const Node& node = _nodes[entry.child];
+        float childDistances[WIDTH];
+        int mask = childTest(node, distance, childDistances);
+
+        // sort the children hit by distance, then push the furthest first
+        Entry hits[WIDTH];
+        int numHits = 0;
+        for (int i = 0; i < WIDTH; i++) {
+            if (mask & (1 << i)) {
+                int j = numHits++;
+                for (; j > 0 && hits[j - 1].distance > childDistances[i]; j--) {
+                    hits[j] = hits[j - 1];
+                }
+                hits[j] = { node.children[i], childDistances[i] };
+            }
+        }
+        for (int i = numHits - 1; i >= 0; i--) {
+            stack.push_back(hits[i]);
+        }
+    }
+}
+
+// Visits each node with the rays that hit it, and its children nearest first. A child is skipped once it is further
+// than every ray that hit it, whose distances leafTest may reduce.
+template <typename LeafTest>
+void TriangleBVH::traversePacket(RayPacket& packet, LeafTest&& leafTest) const {
+    if (_nodes.empty() || packet.numRays == 0) {
+        return;
+    }
+
+    struct Entry {
+        int32_t child;
+        int32_t rayMask;
+        float distance;
+    };
+    static thread_local std::vector<Entry> stack;
+    stack.clear();
+    stack.push_back({ 0, (1 << packet.numRays) - 1, 0.0f });
+
+    while (!stack.empty()) {
+        Entry entry = stack.back();
+        stack.pop_back();
+
+        int rayMask = 0;
+        for (int i = 0; i < packet.numRays; i++) {
+            if ((entry.rayMask & (1 << i)) && entry.distance < packet.distances[i]) {
+                rayMask |= 1 << i;
+            }
+        }
+        if (rayMask == 0) {
+            continue;
+        }
+        if (entry.child < 0) {
+            const Leaf& leaf = _leaves[~entry.child];
+            for (int i = 0; i < packet.numRays; i++) {
+                if (rayMask & (1 << i)) {
+                    leafTest(leaf, i, packet.distances[i]);
+                }
+            }
+            continue;
+        }
+
+        const Node& node = _nodes[entry.child];
+        int childRayMasks[WIDTH];
+        float childDistances[WIDTH];
+        intersectChildrenWithPacket(node, packet, rayMask, childRayMasks, childDistances);
+
+        // sort the children hit by distance, then push the furthest first
+        Entry hits[WIDTH];
+        int numHits = 0;
+        for (int i = 0; i < node.numChildren; i++) {
+            if (childRayMasks[i]) {
+                int j = numHits++;
+                for (; j > 0 && hits[j - 1].distance > childDistances[i]; j--) {
+                    hits[j] = hits[j - 1];
+                }
+                hits[j] = { node.children[i], childRayMasks[i], childDistances[i] };
+            }
+        }
+        for (int i = numHits - 1; i >= 0; i--) {
+            stack.push_back(hits[i]);
+        }
+    }
+}
+
+int TriangleBVH::findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
+                                     float& distance, bool allowBackface) const {
+    int nearestTriangle = -1;
+    traverse(distance,
+        [&](const Node& node, float maxDistance, float childDistances[WIDTH]) {
+            return intersectChildren(node, origin, invDirection, maxDistance, childDistances);
+        },
+        [&](const Leaf& leaf, float& maxDistance) {
+            int lane = intersectLeaf(leaf, origin, direction, maxDistance, allowBackface);
+            if (lane >= 0) {
+                nearestTriangle = leaf.triangles[lane];
+            }
+        });
+    return nearestTriangle;
+}
+
+int TriangleBVH::findRayIntersections(RayPacket& packet, int32_t triangles[PACKET_SIZE], bool allowBackface) const {
+    int hitMask = 0;
+    for (int i = 0; i < PACKET_SIZE; i++) {
+        triangles[i] = -1;
+    }
+    traversePacket(packet, [&](const Leaf& leaf, int ray, float& maxDistance) {
+        int lane = intersectLeaf(leaf, packet.origins[ray], packet.directions[ray], maxDistance, allowBackface);
+        if (lane >= 0) {
+            triangles[ray] = leaf.triangles[lane];
+            hitMask |= 1 << ray;
+        }
+    });
+    return hitMask;
+}
+
+bool TriangleBVH::findRayLeafBoundsIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
+                                                float& distance, BoxFace& face) const {
+    bool intersects = false;
+    traverse(distance,
+        [&](const Node& node, float maxDistance, float childDistances[WIDTH]) {
+            return intersectChildren(node, origin, invDirection, maxDistance, childDistances);
+        },
+        [&](const Leaf& leaf, float& maxDistance) {
+            float leafDistance;
+            BoxFace leafFace;
+            glm::vec3 leafNormal;
+            if (leaf.bounds.findRayIntersection(origin, direction, invDirection, leafDistance, leafFace, leafNormal) &&
+                    leafDistance < maxDistance) {
+                maxDistance = leafDistance;
+                face = leafFace;
+                intersects = true;
+            }
+        });
+    return intersects;
+}
+
+int TriangleBVH::findRayLeafBoundsIntersections(RayPacket& packet, BoxFace faces[PACKET_SIZE]) const {
+    int hitMask = 0;
+    traversePacket(packet, [&](const Leaf& leaf, int ray, float& maxDistance) {
+        float leafDistance;
+        BoxFace leafFace;
+        glm::vec3 leafNormal;
+        glm::vec3 invDirection(packet.invDirectionX[ray], packet.invDirectionY[ray], packet.invDirectionZ[ray]);
+        if (leaf.bounds.findRayIntersection(packet.origins[ray], packet.directions[ray], invDirection,
+                                            leafDistance, leafFace, leafNormal) && leafDistance < maxDistance) {
+            maxDistance = leafDistance;
+            faces[ray] = leafFace;
+            hitMask |= 1 << ray;
+        }
+    });
+    return hitMask;
+}
+
+int TriangleBVH::intersectChildrenWithParabola(const Node& node, const glm::vec3& origin, const glm::vec3& velocity,
+                                               const glm::vec3& acceleration, float maxDistance, float distances[WIDTH]) {
+    int mask = 0;
+    for (int i = 0; i < node.numChildren; i++) {
+        AABox bounds = getChildBounds(node, i);
+        float childDistance = FLT_MAX;
+        if (bounds.contains(origin)) {
+            childDistance = 0.0f;
+        } else {
+            BoxFace childFace;
+            glm::vec3 childNormal;
+            if (!bounds.findParabolaIntersection(origin, velocity, acceleration, childDistance, childFace, childNormal)) {
+                continue;
+            }
+        }
+        if (childDistance < maxDistance) {
+            distances[i] = childDistance;
+            mask |= 1 << i;
+        }
+    }
+    return mask;
+}
+
+int TriangleBVH::findParabolaIntersection(const std::vector<Triangle>& triangles, const glm::vec3& origin,
+                                          const glm::vec3& velocity, const glm::vec3& acceleration,
+                                          float& parabolicDistance, bool allowBackface) const {
+    // the parabola tests are not vectorized, but the tree still culls most of the triangles
+    int nearestTriangle = -1;
+    traverse(parabolicDistance,
+        [&](const Node& node, float maxDistance, float childDistances[WIDTH]) {
+            return intersectChildrenWithParabola(node, origin, velocity, acceleration, maxDistance, childDistances);
+        },
+        [&](const Leaf& leaf, float& maxDistance) {
+            for (int i = 0; i < leaf.numTriangles; i++) {
+                float triangleDistance;
+                const Triangle& triangle = triangles[leaf.triangles[i]];
+                if (findParabolaTriangleIntersection(origin, velocity, acceleration, triangle, triangleDistance, allowBackface) &&
+                        triangleDistance < maxDistance) {
+                    maxDistance = triangleDistance;
+                    nearestTriangle = leaf.triangles[i];
+                }
+            }
+        });
+    return nearestTriangle;
+}
+
+bool TriangleBVH::findParabolaLeafBoundsIntersection(const glm::vec3& origin, const glm::vec3& velocity,
+                                                     const glm::vec3& acceleration, float& parabolicDistance,
+                                                     BoxFace& face) const {
+    bool intersects = false;
+    traverse(parabolicDistance,
+        [&](const Node& node, float maxDistance, float childDistances[WIDTH]) {
+            return intersectChildrenWithParabola(node, origin, velocity, acceleration, maxDistance, childDistances);
+        },
+        [&](const Leaf& leaf, float& maxDistance) {
+            float leafDistance;
+            BoxFace leafFace;
+            glm::vec3 leafNormal;
+            if (leaf.bounds.findParabolaIntersection(origin, velocity, acceleration, leafDistance, leafFace, leafNormal) &&
+                    leafDistance < maxDistance) {
+                maxDistance = leafDistance;
+                face = leafFace;
+                intersects = true;
+            }
+        });
+    return intersects;
+}
@@ -0,0 +1,119 @@
+//
+//  TriangleBVH.h
+//  libraries/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TriangleBVH_h
+#define hifi_TriangleBVH_h
+
+#include <cfloat>
+#include <vector>
+
+#include "AABox.h"
+#include "GeometryUtil.h"
+
+// A bounding volume hierarchy over a set of triangles, built with the surface area heuristic.
+//   Every node has up to WIDTH children and every leaf up to WIDTH triangles, each stored as a structure of arrays
+//   so that a ray is tested against the four child boxes, or the four triangles of a leaf, at once with SSE.
+//   Packets of rays are traced together, with each child box tested against eight rays at once with AVX2.
+//   The triangles themselves are owned by the caller, which passes them to build and to the parabola queries.
+class TriangleBVH {
+public:
+    static const int WIDTH = 4;
+    static const int PACKET_SIZE = 8;
+
+    // Up to PACKET_SIZE rays traced through the tree together: each node is fetched once for all of them, and each of
+    // its child boxes tested against all the rays at once. Rays that start near each other and point the same way,
+    // such as the picks of a frame, share most of their traversal.
+    struct RayPacket {
+        glm::vec3 origins[PACKET_SIZE];
+        glm::vec3 directions[PACKET_SIZE];
+        // the same rays, one lane per ray, for the box tests
+        float originX[PACKET_SIZE] {}, originY[PACKET_SIZE] {}, originZ[PACKET_SIZE] {};
+        float invDirectionX[PACKET_SIZE] {}, invDirectionY[PACKET_SIZE] {}, invDirectionZ[PACKET_SIZE] {};
+        // the maximum distance of each ray, reduced to that of its nearest hit
+        float distances[PACKET_SIZE] {};
+        int numRays { 0 };
+
+        void clear() { numRays = 0; }
+        void addRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance = FLT_MAX);
+    };
+
+    void build(const std::vector<Triangle>& triangles);
+    void clear();
+    bool isEmpty() const { return _nodes.empty(); }
+    int getNumNodes() const { return (int)_nodes.size(); }
+    int getNumLeaves() const { return (int)_leaves.size(); }
+
+    // Returns the index of the nearest triangle hit closer than distance, and its distance, or -1.
+    int findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
+                            float& distance, bool allowBackface = false) const;
+    int findParabolaIntersection(const std::vector<Triangle>& triangles, const glm::vec3& origin, const glm::vec3& velocity,
+                                 const glm::vec3& acceleration, float& parabolicDistance, bool allowBackface = false) const;
+
+    // The same for each ray of the packet, returning the mask of the rays that hit a triangle and the index of each one's
+    // nearest triangle, or -1. The distances of the packet are reduced to those of the hits.
+    int findRayIntersections(RayPacket& packet, int32_t triangles[PACKET_SIZE], bool allowBackface = false) const;
+
+    // Find the nearest bounds of a leaf hit closer than distance, without testing the triangles
+    bool findRayLeafBoundsIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
+                                       float& distance, BoxFace& face) const;
+    bool findParabolaLeafBoundsIntersection(const glm::vec3& origin, const glm::vec3& velocity, const glm::vec3& acceleration,
+                                            float& parabolicDistance, BoxFace& face) const;
+    int findRayLeafBoundsIntersections(RayPacket& packet, BoxFace faces[PACKET_SIZE]) const;
+
+private:
+    // the bounds of the children, one lane per child
+    struct Node {
+        float minX[WIDTH], minY[WIDTH], minZ[WIDTH];
+        float maxX[WIDTH], maxY[WIDTH], maxZ[WIDTH];
+        // >= 0: the index of a child node, < 0: the bitwise not of the index of a leaf
+        int32_t children[WIDTH];
+        int32_t numChildren;
+    };
+
+    // one triangle per lane, with the edges precomputed for Möller-Trumbore. Unused lanes are degenerate.
+    struct Leaf {
+        float v0X[WIDTH], v0Y[WIDTH], v0Z[WIDTH];
+        float e1X[WIDTH], e1Y[WIDTH], e1Z[WIDTH];
+        float e2X[WIDTH], e2Y[WIDTH], e2Z[WIDTH];
+        int32_t triangles[WIDTH];
+        int32_t numTriangles;
+        AABox bounds;
+    };
+
+    class Builder;
+
+    static AABox getChildBounds(const Node& node, int child);
+
+    // the intersections of the ray with the child boxes closer than maxDistance, as a mask of children, or 0
+    static int intersectChildren(const Node& node, const glm::vec3& origin, const glm::vec3& invDirection,
+                                 float maxDistance, float distances[WIDTH]);
+    static int intersectChildrenWithParabola(const Node& node, const glm::vec3& origin, const glm::vec3& velocity,
+                                             const glm::vec3& acceleration, float maxDistance, float distances[WIDTH]);
+    // the intersections of the rays of rayMask with each child box closer than their distances, as a mask of rays per child,
+    // and the nearest of each child's intersections
+    static void intersectChildrenWithPacket(const Node& node, const RayPacket& packet, int rayMask,
+                                            int rayMasks[WIDTH], float distances[WIDTH]);
+    static void intersectChildrenWithPacket_ref(const Node& node, const RayPacket& packet, int rayMask,
+                                                int rayMasks[WIDTH], float distances[WIDTH]);
+    static void intersectChildrenWithPacket_AVX2(const Node& node, const RayPacket& packet, int rayMask,
+                                                 int rayMasks[WIDTH], float distances[WIDTH]);
+    static int intersectLeaf(const Leaf& leaf, const glm::vec3& origin, const glm::vec3& direction, float& distance,
+                             bool allowBackface);
+
+    template <typename ChildTest, typename LeafTest>
+    void traverse(float& distance, ChildTest&& childTest, LeafTest&& leafTest) const;
+    template <typename LeafTest>
+    void traversePacket(RayPacket& packet, LeafTest&& leafTest) const;
+
+    std::vector<Node> _nodes;
+    std::vector<Leaf> _leaves;
+};
+
+#endif // hifi_TriangleBVH_h
@@ -12,68 +12,42 @@
 #pragma once
 
 #include <vector>
-#include <memory>
 
 #include "AABox.h"
 #include "GeometryUtil.h"
+#include "TriangleBVH.h"
 
 class TriangleSet {
-
-    class TriangleTreeCell {
+public:
+    // a ray for findRayIntersections, and where it hit
+    class RayPick {
     public:
-        TriangleTreeCell(std::vector<Triangle>& allTriangles) : _allTriangles(allTriangles) {}
-        TriangleTreeCell(std::vector<Triangle>& allTriangles, const AABox& bounds, int depth);
-
-        void insert(size_t triangleIndex);
-        void reset(const AABox& bounds, int depth = 0);
-        void clear();
-
-        bool findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
-            float& distance, BoxFace& face, Triangle& triangle, bool precision, int& trianglesTouched,
-            bool allowBackface = false);
-        bool findParabolaIntersection(const glm::vec3& origin, const glm::vec3& velocity, const glm::vec3& acceleration,
-            float& parabolicDistance, BoxFace& face, Triangle& triangle, bool precision, int& trianglesTouched,
-            bool allowBackface = false);
-
-        const AABox& getBounds() const { return _bounds; }
-
-        void debugDump();
+        RayPick() {}
+        RayPick(const glm::vec3& origin, const glm::vec3& direction) : origin(origin), direction(direction) {}
 
-    protected:
-        // checks our internal list of triangles
-        bool findRayIntersectionInternal(const glm::vec3& origin, const glm::vec3& direction,
-            float& distance, BoxFace& face, Triangle& triangle, bool precision, int& trianglesTouched,
-            bool allowBackface = false);
-        bool findParabolaIntersectionInternal(const glm::vec3& origin, const glm::vec3& velocity, const glm::vec3& acceleration,
-            float& parabolicDistance, BoxFace& face, Triangle& triangle, bool precision, int& trianglesTouched,
-            bool allowBackface = false);
+        glm::vec3 origin;
+        glm::vec3 direction;
 
-        std::pair<AABox, AABox> getTriangleTreeCellChildBounds();
-
-        std::vector<Triangle>& _allTriangles;
-        std::pair<std::shared_ptr<TriangleTreeCell>, std::shared_ptr<TriangleTreeCell>> _children;
-        int _depth { 0 };
-        int _population { 0 };
-        AABox _bounds;
-        std::vector<size_t> _triangleIndices;
-
-        friend class TriangleSet;
+        bool intersects { false };
+        float distance { FLT_MAX };
+        BoxFace face { UNKNOWN_FACE };
+        Triangle triangle;
     };
 
-    using SortedTriangleCell = std::pair<float, std::shared_ptr<TriangleTreeCell>>;
-
-public:
-    TriangleSet() : _triangleTree(_triangles) {}
-
     void debugDump();
 
     void insert(const Triangle& t);
 
+    // if !precision, the distance and face are those of the bounds of the nearest group of triangles hit
     bool findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection,
         float& distance, BoxFace& face, Triangle& triangle, bool precision, bool allowBackface = false);
     bool findParabolaIntersection(const glm::vec3& origin, const glm::vec3& velocity, const glm::vec3& acceleration,
         float& parabolicDistance, BoxFace& face, Triangle& triangle, bool precision, bool allowBackface = false);
 
+    // the same as findRayIntersection for many rays at once, such as those of all the pointers in a frame,
+    // traced through the tree in packets that share their traversal
+    void findRayIntersections(RayPick* picks, size_t numPicks, bool precision, bool allowBackface = false);
+
     void balanceTree();
 
     void reserve(size_t size) { _triangles.reserve(size); } // reserve space in the datastructure for size number of triangles
@@ -89,6 +63,6 @@ public:
 protected:
     bool _isBalanced { false };
     std::vector<Triangle> _triangles;
-    TriangleTreeCell _triangleTree;
+    TriangleBVH _bvh;
     AABox _bounds;
 };
@@ -0,0 +1,58 @@
+//
+//  BlendshapeAccumulation_avx2.cpp
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// 8 entries at a time, see accumulateBlendshapeOffsets_ref in BlendshapeAccumulation.cpp
+void accumulateBlendshapeOffsets_AVX2(const int32_t* indices, const float* const* components, int begin, int end,
+                                      float positionCoefficient, float normalCoefficient, float (*unpacked)[9]) {
+
+    const __m256 positionScale = _mm256_set1_ps(positionCoefficient);
+    const __m256 normalScale = _mm256_set1_ps(normalCoefficient);
+    const __m256i stride = _mm256_set1_epi32(9);
+    const float* base = &unpacked[0][0];
+
+    int i = begin;
+    for (; i < end - 7; i += 8) {  // blocks of 8
+
+        // gather the current sums of the 8 vertices, one component at a time
+        __m256i offsets = _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)&indices[i]), stride);
+
+        float sums[9][8];
+        for (int c = 0; c < 9; c++) {
+            __m256 sum = _mm256_i32gather_ps(base + c, offsets, 4);
+            __m256 offset = _mm256_loadu_ps(&components[c][i]);
+            sum = _mm256_fmadd_ps(offset, (c < 3) ? positionScale : normalScale, sum);
+            _mm256_storeu_ps(sums[c], sum);
+        }
+
+        // scatter, which is safe because the indices are unique
+        for (int k = 0; k < 8; k++) {
+            float* vertex = unpacked[indices[i + k]];
+            for (int c = 0; c < 9; c++) {
+                vertex[c] = sums[c][k];
+            }
+        }
+    }
+
+    for (; i < end; i++) {  // remainder
+        float* vertex = unpacked[indices[i]];
+        for (int c = 0; c < 3; c++) {
+            vertex[c] += components[c][i] * positionCoefficient;
+        }
+        for (int c = 3; c < 9; c++) {
+            vertex[c] += components[c][i] * normalCoefficient;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,50 @@
+//
+//  ClusterMatrices_avx2.cpp
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <glm/glm.hpp>
+
+// Two columns of a cluster matrix at a time, see computeClusterMatrices_ref in ClusterMatrices.cpp
+void computeClusterMatrices_AVX2(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                                 int numClusters, glm::mat4* clusterMatrices) {
+
+    for (int i = 0; i < numClusters; i++) {
+        const float* joint = &jointMatrices[jointIndices[i]][0][0];
+        const float* inverseBind = &inverseBindMatrices[i][0][0];
+        float* cluster = &clusterMatrices[i][0][0];
+
+        // each column of the joint matrix, in both lanes
+        __m256 j0 = _mm256_broadcast_ps((const __m128*)&joint[0]);
+        __m256 j1 = _mm256_broadcast_ps((const __m128*)&joint[4]);
+        __m256 j2 = _mm256_broadcast_ps((const __m128*)&joint[8]);
+        __m256 j3 = _mm256_broadcast_ps((const __m128*)&joint[12]);
+
+        // columns 0 and 1, then 2 and 3: each is the sum of the joint columns weighted by its elements
+        __m256 b = _mm256_loadu_ps(&inverseBind[0]);
+        __m256 r = _mm256_mul_ps(j0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm256_fmadd_ps(j1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)), r);
+        r = _mm256_fmadd_ps(j2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)), r);
+        r = _mm256_fmadd_ps(j3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)), r);
+        _mm256_storeu_ps(&cluster[0], r);
+
+        b = _mm256_loadu_ps(&inverseBind[8]);
+        r = _mm256_mul_ps(j0, _mm256_permute_ps(b, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm256_fmadd_ps(j1, _mm256_permute_ps(b, _MM_SHUFFLE(1, 1, 1, 1)), r);
+        r = _mm256_fmadd_ps(j2, _mm256_permute_ps(b, _MM_SHUFFLE(2, 2, 2, 2)), r);
+        r = _mm256_fmadd_ps(j3, _mm256_permute_ps(b, _MM_SHUFFLE(3, 3, 3, 3)), r);
+        _mm256_storeu_ps(&cluster[8], r);
+    }
+    _mm256_zeroupper();
+}
+
+#endif
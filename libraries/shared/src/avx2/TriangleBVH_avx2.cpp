@@ -0,0 +1,66 @@
+//
+//  TriangleBVH_avx2.cpp
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+#include "../TriangleBVH.h"
+
+// Each child box against the eight rays of the packet at once, with the same tests as intersectChildren
+void TriangleBVH::intersectChildrenWithPacket_AVX2(const Node& node, const RayPacket& packet, int rayMask,
+                                                   int rayMasks[WIDTH], float distances[WIDTH]) {
+    const __m256 ox = _mm256_loadu_ps(packet.originX);
+    const __m256 oy = _mm256_loadu_ps(packet.originY);
+    const __m256 oz = _mm256_loadu_ps(packet.originZ);
+    const __m256 ix = _mm256_loadu_ps(packet.invDirectionX);
+    const __m256 iy = _mm256_loadu_ps(packet.invDirectionY);
+    const __m256 iz = _mm256_loadu_ps(packet.invDirectionZ);
+    const __m256 maxDistance = _mm256_loadu_ps(packet.distances);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 noHit = _mm256_set1_ps(FLT_MAX);
+
+    // the rays of rayMask, one lane per ray
+    const __m256i rayBits = _mm256_setr_epi32(1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7);
+    const __m256 active = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(rayMask), rayBits), rayBits));
+
+    for (int child = 0; child < node.numChildren; child++) {
+
+        // the slabs of the box, for each ray
+        __m256 t1x = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.minX[child]), ox), ix);
+        __m256 t2x = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.maxX[child]), ox), ix);
+        __m256 t1y = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.minY[child]), oy), iy);
+        __m256 t2y = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.maxY[child]), oy), iy);
+        __m256 t1z = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.minZ[child]), oz), iz);
+        __m256 t2z = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.maxZ[child]), oz), iz);
+
+        __m256 tmin = _mm256_max_ps(_mm256_min_ps(t1x, t2x), _mm256_max_ps(_mm256_min_ps(t1y, t2y), _mm256_min_ps(t1z, t2z)));
+        __m256 tmax = _mm256_min_ps(_mm256_max_ps(t1x, t2x), _mm256_min_ps(_mm256_max_ps(t1y, t2y), _mm256_max_ps(t1z, t2z)));
+        tmin = _mm256_max_ps(tmin, zero);
+
+        __m256 hit = _mm256_and_ps(_mm256_cmp_ps(tmin, tmax, _CMP_LE_OQ), _mm256_cmp_ps(tmin, maxDistance, _CMP_LT_OQ));
+        hit = _mm256_and_ps(hit, active);
+        int mask = _mm256_movemask_ps(hit);
+        rayMasks[child] = mask;
+        if (mask == 0) {
+            distances[child] = FLT_MAX;
+            continue;
+        }
+
+        // the nearest of the rays that hit
+        __m256 t = _mm256_blendv_ps(noHit, tmin, hit);
+        __m128 t4 = _mm_min_ps(_mm256_castps256_ps128(t), _mm256_extractf128_ps(t, 1));
+        t4 = _mm_min_ps(t4, _mm_movehl_ps(t4, t4));
+        t4 = _mm_min_ss(t4, _mm_shuffle_ps(t4, t4, _MM_SHUFFLE(1, 1, 1, 1)));
+        distances[child] = _mm_cvtss_f32(t4);
+    }
+    _mm256_zeroupper();
+}
+
+#endif
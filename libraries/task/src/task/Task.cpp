@@ -10,8 +10,16 @@
 //
 #include "Task.h"
 
+#include <TBBHelpers.h>
+
 using namespace task;
 
+void task::runConcurrently(const std::vector<std::function<void()>>& functions) {
+    tbb::parallel_for((size_t)0, functions.size(), [&](size_t i) {
+        functions[i]();
+    });
+}
+
 JobContext::JobContext() {
 }
 
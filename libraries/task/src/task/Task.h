@@ -15,6 +15,8 @@
 #include "Config.h"
 #include "Varying.h"
 
+#include <functional>
+#include <type_traits>
 #include <unordered_map>
 
 namespace task {
@@ -64,6 +66,21 @@ protected:
 };
 using JobContextPointer = std::shared_ptr<JobContext>;
 
+// Runs each of the functions on the worker threads of the shared work-stealing pool, and returns once all of them have returned
+void runConcurrently(const std::vector<std::function<void()>>& functions);
+
+// Jobs run concurrently each get their own copy of the context, so that they don't race on its jobConfig and taskFlow.
+// Returns nullptr if the context type can't be copied, in which case the jobs are run one after the other.
+template <class JC> std::shared_ptr<JC> copyJobContext(const std::shared_ptr<JC>& jobContext, std::true_type) {
+    auto copy = std::make_shared<JC>(*jobContext);
+    copy->jobConfig.reset();
+    copy->taskFlow.reset();
+    return copy;
+}
+template <class JC> std::shared_ptr<JC> copyJobContext(const std::shared_ptr<JC>& jobContext, std::false_type) {
+    return nullptr;
+}
+
 // The guts of a job
 class JobConcept {
 public:
@@ -250,12 +267,97 @@ public:
         Varying _output;
         Jobs _jobs;
 
+        // The [begin, end) ranges of _jobs that may run concurrently
+        std::vector<std::pair<size_t, size_t>> _parallelStages;
+        bool _isBuildingParallelStage { false };
+
         const Varying getInput() const override { return _input; }
         const Varying getOutput() const override { return _output; }
         Varying& editInput() override { return _input; }
 
         TaskConcept(const std::string& name, const Varying& input, QConfigPointer config) : Concept(name, config), _input(input) {config->_isTask = true;}
 
+        // The jobs added between beginParallelStage and endParallelStage are run concurrently.
+        // None of them may consume the output of another, or write to the shared state of the context:
+        // each is given its own copy of the context, and changes to that copy are lost.
+        // If one of them aborts the task, the others still run to completion.
+        void beginParallelStage() {
+            assert(!_isBuildingParallelStage);
+            _isBuildingParallelStage = true;
+            _parallelStages.emplace_back(_jobs.size(), _jobs.size());
+        }
+        void endParallelStage() {
+            assert(_isBuildingParallelStage);
+            _isBuildingParallelStage = false;
+            if (_parallelStages.back().first == _jobs.size()) {
+                _parallelStages.pop_back();
+            } else {
+                _parallelStages.back().second = _jobs.size();
+            }
+        }
+
+        // Returns false if one of the jobs aborted the task
+        bool runJobs(const ContextPointer& jobContext) {
+            auto stageIt = _parallelStages.cbegin();
+            size_t i = 0;
+            while (i < _jobs.size()) {
+                if (stageIt != _parallelStages.cend() && stageIt->first == i) {
+                    if (!runParallelStage(jobContext, stageIt->first, stageIt->second)) {
+                        return false;
+                    }
+                    i = stageIt->second;
+                    ++stageIt;
+                    continue;
+                }
+
+                _jobs[i].run(jobContext);
+                if (jobContext->taskFlow.doAbortTask()) {
+                    return false;
+                }
+                i++;
+            }
+            return true;
+        }
+
+        bool runParallelStage(const ContextPointer& jobContext, size_t begin, size_t end) {
+            std::vector<ContextPointer> jobContexts;
+            if (end - begin > 1) {
+                for (size_t i = begin; i < end; i++) {
+                    auto jobContextCopy = copyJobContext(jobContext, std::is_copy_constructible<Context>());
+                    if (!jobContextCopy) {
+                        break;
+                    }
+                    jobContexts.push_back(jobContextCopy);
+                }
+            }
+
+            if (jobContexts.size() != end - begin) {
+                for (size_t i = begin; i < end; i++) {
+                    _jobs[i].run(jobContext);
+                    if (jobContext->taskFlow.doAbortTask()) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            std::vector<std::function<void()>> functions;
+            functions.reserve(end - begin);
+            for (size_t i = begin; i < end; i++) {
+                auto& job = _jobs[i];
+                auto& context = jobContexts[i - begin];
+                functions.push_back([&job, &context] { job.run(context); });
+            }
+            runConcurrently(functions);
+
+            for (const auto& context : jobContexts) {
+                if (context->taskFlow.doAbortTask()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         // Create a new job in the container's queue; returns the job's output
         template <class NT, class... NA> const Varying addJob(std::string name, const Varying& input, NA&&... args) {
             _jobs.emplace_back((NT::JobModel::create(name, input, std::forward<NA>(args)...)));
@@ -330,12 +432,8 @@ public:
         void run(const ContextPointer& jobContext) override {
             auto config = std::static_pointer_cast<C>(Concept::_config);
             if (config->isEnabled()) {
-                for (auto job : TaskConcept::_jobs) {
-                    job.run(jobContext);
-                    if (jobContext->taskFlow.doAbortTask()) {
-                        jobContext->taskFlow.reset();
-                        return;
-                    }
+                if (!TaskConcept::runJobs(jobContext)) {
+                    jobContext->taskFlow.reset();
                 }
             }
         }
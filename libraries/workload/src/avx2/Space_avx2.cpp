@@ -0,0 +1,79 @@
+//
+//  Space_avx2.cpp
+//  workload/src/avx2
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "../workload/Region.h"
+
+using namespace workload;
+
+// 8 proxies at a time, see classifyProxies_ref in Space.cpp
+void classifyProxies_AVX2(const float* const spheres[4], int numProxies,
+                          const float (*viewRegions)[4], const uint8_t* viewRegionNames, int numViewRegions,
+                          uint8_t* regions, uint8_t* prevRegions, uint8_t* changeMasks) {
+
+    const __m256i invalid = _mm256_set1_epi32(Region::INVALID);
+    const __m256 outside = _mm256_set1_ps((float)Region::R4);
+
+    // the low byte of each 32-bit lane, gathered in the low 4 bytes of each 128-bit half, then both halves together
+    const __m256i packBytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                               0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i packHalves = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+
+    for (int i = 0; i < numProxies; i += 8) {
+
+        __m256i current = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&regions[i]));
+        __m256i valid = _mm256_cmpgt_epi32(invalid, current);
+        if (_mm256_testz_si256(valid, valid)) {
+            // removed or unallocated proxies
+            changeMasks[i >> 3] = 0;
+            continue;
+        }
+
+        __m256 px = _mm256_loadu_ps(&spheres[0][i]);
+        __m256 py = _mm256_loadu_ps(&spheres[1][i]);
+        __m256 pz = _mm256_loadu_ps(&spheres[2][i]);
+        __m256 pr = _mm256_loadu_ps(&spheres[3][i]);
+
+        // the nearest region touched, or R4
+        __m256 region = outside;
+        for (int v = 0; v < numViewRegions; v++) {
+            __m256 dx = _mm256_sub_ps(px, _mm256_set1_ps(viewRegions[v][0]));
+            __m256 dy = _mm256_sub_ps(py, _mm256_set1_ps(viewRegions[v][1]));
+            __m256 dz = _mm256_sub_ps(pz, _mm256_set1_ps(viewRegions[v][2]));
+            __m256 distanceSq = _mm256_mul_ps(dx, dx);
+            distanceSq = _mm256_add_ps(distanceSq, _mm256_mul_ps(dy, dy));
+            distanceSq = _mm256_add_ps(distanceSq, _mm256_mul_ps(dz, dz));
+
+            __m256 touchDistance = _mm256_add_ps(pr, _mm256_set1_ps(viewRegions[v][3]));
+            __m256 touches = _mm256_cmp_ps(distanceSq, _mm256_mul_ps(touchDistance, touchDistance), _CMP_LT_OQ);
+            __m256 name = _mm256_blendv_ps(outside, _mm256_set1_ps((float)viewRegionNames[v]), touches);
+            region = _mm256_min_ps(region, name);
+        }
+
+        // valid proxies take the new region and remember the previous one, the others are left alone
+        __m256i next = _mm256_blendv_epi8(current, _mm256_cvttps_epi32(region), valid);
+        __m256i changed = _mm256_andnot_si256(_mm256_cmpeq_epi32(next, current), valid);
+        changeMasks[i >> 3] = (uint8_t)_mm256_movemask_ps(_mm256_castsi256_ps(changed));
+
+        __m256i previous = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&prevRegions[i]));
+        previous = _mm256_blendv_epi8(previous, current, valid);
+
+        next = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(next, packBytes), packHalves);
+        previous = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(previous, packBytes), packHalves);
+        _mm_storel_epi64((__m128i*)&regions[i], _mm256_castsi256_si128(next));
+        _mm_storel_epi64((__m128i*)&prevRegions[i], _mm256_castsi256_si128(previous));
+    }
+}
+
+#endif
@@ -13,24 +13,109 @@
 //
 
 #include "Space.h"
-#include <cstring>
 #include <algorithm>
 
 #include <glm/gtx/quaternion.hpp>
 
+#include <TBBHelpers.h>
+
 using namespace workload;
 
+//
+// Batched proxy classification
+//   spheres holds the x, y, z and radius arrays of numProxies proxies, a multiple of Space::CLASSIFY_BATCH_SIZE.
+//   viewRegions holds the spheres of the regions of all views, and viewRegionNames the region of each.
+//   Every valid proxy gets the nearest region it touches in any view, or R4, and its previous region.
+//   Bit i of changeMasks[b] is set when proxy b * CLASSIFY_BATCH_SIZE + i changed region.
+//
+static void classifyProxies_ref(const float* const spheres[4], int numProxies,
+                                const float (*viewRegions)[4], const uint8_t* viewRegionNames, int numViewRegions,
+                                uint8_t* regions, uint8_t* prevRegions, uint8_t* changeMasks) {
+    for (int i = 0; i < numProxies; i += Space::CLASSIFY_BATCH_SIZE) {
+        uint8_t changeMask = 0;
+        for (uint32_t j = 0; j < Space::CLASSIFY_BATCH_SIZE; ++j) {
+            int k = i + j;
+            if (regions[k] >= Region::INVALID) {
+                continue;
+            }
+            glm::vec3 proxyCenter(spheres[0][k], spheres[1][k], spheres[2][k]);
+            float proxyRadius = spheres[3][k];
+            uint8_t region = Region::R4;
+            for (int v = 0; v < numViewRegions; ++v) {
+                if (viewRegionNames[v] < region) {
+                    glm::vec3 regionCenter(viewRegions[v][0], viewRegions[v][1], viewRegions[v][2]);
+                    float touchDistance = proxyRadius + viewRegions[v][3];
+                    if (distance2(proxyCenter, regionCenter) < touchDistance * touchDistance) {
+                        region = viewRegionNames[v];
+                    }
+                }
+            }
+            prevRegions[k] = regions[k];
+            if (region != regions[k]) {
+                regions[k] = region;
+                changeMask |= (uint8_t)(1 << j);
+            }
+        }
+        changeMasks[i / Space::CLASSIFY_BATCH_SIZE] = changeMask;
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void classifyProxies_AVX2(const float* const spheres[4], int numProxies,
+                          const float (*viewRegions)[4], const uint8_t* viewRegionNames, int numViewRegions,
+                          uint8_t* regions, uint8_t* prevRegions, uint8_t* changeMasks);
+
+static void classifyProxies(const float* const spheres[4], int numProxies,
+                            const float (*viewRegions)[4], const uint8_t* viewRegionNames, int numViewRegions,
+                            uint8_t* regions, uint8_t* prevRegions, uint8_t* changeMasks) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        classifyProxies_AVX2(spheres, numProxies, viewRegions, viewRegionNames, numViewRegions, regions, prevRegions, changeMasks);
+    } else {
+        classifyProxies_ref(spheres, numProxies, viewRegions, viewRegionNames, numViewRegions, regions, prevRegions, changeMasks);
+    }
+}
+
+#else   // portable reference code
+static auto& classifyProxies = classifyProxies_ref;
+#endif
+
+const uint32_t Space::CLASSIFY_BATCH_SIZE;
+const uint32_t Space::CLASSIFY_CHUNK_SIZE;
+
 Space::Space() : Collection() {
 }
 
+void Space::resizeProxies(uint32_t numProxies) {
+    uint32_t paddedSize = (numProxies + CLASSIFY_BATCH_SIZE - 1) / CLASSIFY_BATCH_SIZE * CLASSIFY_BATCH_SIZE;
+    _proxyX.resize(paddedSize, 0.0f);
+    _proxyY.resize(paddedSize, 0.0f);
+    _proxyZ.resize(paddedSize, 0.0f);
+    _proxyRadius.resize(paddedSize, 0.0f);
+    _proxyRegion.resize(paddedSize, Region::INVALID);
+    _proxyPrevRegion.resize(paddedSize, Region::INVALID);
+    _owners.resize(numProxies);
+}
+
+Proxy Space::getProxy(Index proxyID) const {
+    Proxy proxy(Sphere(_proxyX[proxyID], _proxyY[proxyID], _proxyZ[proxyID], _proxyRadius[proxyID]));
+    proxy.region = _proxyRegion[proxyID];
+    proxy.prevRegion = _proxyPrevRegion[proxyID];
+    return proxy;
+}
+
 void Space::processTransactionFrame(const Transaction& transaction) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     // Here we should be able to check the value of last ProxyID allocated
     // and allocate new proxies accordingly
     ProxyID maxID = _IDAllocator.getNumAllocatedIndices();
-    if (maxID > (Index) _proxies.size()) {
-        _proxies.resize(maxID + 100); // allocate the maxId and more
-        _owners.resize(maxID + 100);
+    if (maxID > (Index) _owners.size()) {
+        resizeProxies(maxID + 100); // allocate the maxId and more
     }
     // Now we know for sure that we have enough items in the array to
     // capture anything coming from the transaction
@@ -49,11 +134,13 @@ void Space::processResets(const Transaction::Resets& transactions) {
         if (!_IDAllocator.checkIndex(proxyID)) {
             continue;
         }
-        auto& item = _proxies[proxyID];
-
         // Reset the item with a new payload
-        item.sphere = (std::get<1>(reset));
-        item.prevRegion = item.region = Region::UNKNOWN;
+        const Sphere& sphere = std::get<1>(reset);
+        _proxyX[proxyID] = sphere.x;
+        _proxyY[proxyID] = sphere.y;
+        _proxyZ[proxyID] = sphere.z;
+        _proxyRadius[proxyID] = sphere.w;
+        _proxyPrevRegion[proxyID] = _proxyRegion[proxyID] = Region::UNKNOWN;
 
         _owners[proxyID] = (std::get<2>(reset));
     }
@@ -66,11 +153,8 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         }
         _IDAllocator.freeIndex(removedID);
 
-        // Access the true item
-        auto& item = _proxies[removedID];
-
         // Kill it
-        item.prevRegion = item.region = Region::INVALID;
+        _proxyPrevRegion[removedID] = _proxyRegion[removedID] = Region::INVALID;
         _owners[removedID] = Owner();
     }
 }
@@ -82,48 +166,82 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
             continue;
         }
 
-        // Access the true item
-        auto& item = _proxies[updateID];
-
         // Update the item
-        item.sphere = (std::get<1>(update));
+        const Sphere& sphere = std::get<1>(update);
+        _proxyX[updateID] = sphere.x;
+        _proxyY[updateID] = sphere.y;
+        _proxyZ[updateID] = sphere.z;
+        _proxyRadius[updateID] = sphere.w;
     }
 }
 
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
-    uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
-        if (proxy.region < Region::INVALID) {
-            glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
-            float proxyRadius = proxy.sphere.w;
-            uint8_t region = Region::R4;
-            for (uint32_t j = 0; j < numViews; ++j) {
-                auto& view = _views[j];
-                // for each 'view' we need only increment 'k' below the current value of 'region'
-                for (uint8_t k = 0; k < region; ++k) {
-                    float touchDistance = proxyRadius + view.regions[k].w;
-                    if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
-                        region = k;
-                        break;
-                    }
-                }
+
+    // flatten the regions of all views, a proxy only needs the nearest one it touches
+    std::vector<Sphere> viewRegions;
+    std::vector<uint8_t> viewRegionNames;
+    for (uint8_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+        for (const auto& view : _views) {
+            viewRegions.push_back(view.regions[k]);
+            viewRegionNames.push_back(k);
+        }
+    }
+    const float (*regionSpheres)[4] = reinterpret_cast<const float (*)[4]>(viewRegions.data());
+    int numViewRegions = (int)viewRegions.size();
+
+    // each chunk collects its own changes, merged in order below
+    uint32_t numProxies = (uint32_t)_proxyRegion.size();
+    uint32_t numChunks = (numProxies + CLASSIFY_CHUNK_SIZE - 1) / CLASSIFY_CHUNK_SIZE;
+    std::vector<std::vector<Change>> chunkChanges(numChunks);
+    auto classifyChunk = [&](uint32_t chunk) {
+        uint32_t begin = chunk * CLASSIFY_CHUNK_SIZE;
+        uint32_t numChunkProxies = std::min(CLASSIFY_CHUNK_SIZE, numProxies - begin);
+        const float* spheres[4] = { &_proxyX[begin], &_proxyY[begin], &_proxyZ[begin], &_proxyRadius[begin] };
+        uint8_t changeMasks[CLASSIFY_CHUNK_SIZE / CLASSIFY_BATCH_SIZE];
+        classifyProxies(spheres, (int)numChunkProxies, regionSpheres, viewRegionNames.data(), numViewRegions,
+                        &_proxyRegion[begin], &_proxyPrevRegion[begin], changeMasks);
+
+        auto& outChanges = chunkChanges[chunk];
+        for (uint32_t b = 0; b < numChunkProxies / CLASSIFY_BATCH_SIZE; ++b) {
+            if (changeMasks[b] == 0) {
+                continue;
             }
-            proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
+            for (uint32_t j = 0; j < CLASSIFY_BATCH_SIZE; ++j) {
+                if (changeMasks[b] & (1 << j)) {
+                    uint32_t i = begin + b * CLASSIFY_BATCH_SIZE + j;
+                    outChanges.emplace_back(Space::Change((int32_t)i, _proxyRegion[i], _proxyPrevRegion[i]));
+                }
             }
         }
+    };
+
+    if (numChunks > 1) {
+        tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numChunks), [&](const tbb::blocked_range<uint32_t>& range) {
+            for (uint32_t chunk = range.begin(); chunk != range.end(); ++chunk) {
+                classifyChunk(chunk);
+            }
+        });
+    } else if (numChunks == 1) {
+        classifyChunk(0);
+    }
+
+    size_t numChanges = changes.size();
+    for (const auto& outChanges : chunkChanges) {
+        numChanges += outChanges.size();
+    }
+    changes.reserve(numChanges);
+    for (const auto& outChanges : chunkChanges) {
+        changes.insert(changes.end(), outChanges.begin(), outChanges.end());
     }
 }
 
 uint32_t Space::copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    auto numCopied = std::min(numDestProxies, (uint32_t)_proxies.size());
-    memcpy(proxies, _proxies.data(), numCopied * sizeof(Proxy));
+    auto numCopied = std::min(numDestProxies, (uint32_t)_owners.size());
+    for (uint32_t i = 0; i < numCopied; ++i) {
+        proxies[i] = getProxy((Index)i);
+    }
     return numCopied;
 }
 
@@ -131,8 +249,8 @@ uint32_t Space::copySelectedProxyValues(Proxy::Vector& proxies, const workload::
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     uint32_t numCopied = 0;
     for (auto index : indices) {
-        if (isAllocatedID(index) && (index < (Index)_proxies.size())) {
-            proxies.push_back(_proxies[index]);
+        if (isAllocatedID(index) && (index < (Index)_owners.size())) {
+            proxies.push_back(getProxy(index));
             ++numCopied;
         }
     }
@@ -141,7 +259,7 @@ uint32_t Space::copySelectedProxyValues(Proxy::Vector& proxies, const workload::
 
 const Owner Space::getOwner(int32_t proxyID) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxies.size())) {
+    if (isAllocatedID(proxyID) && (proxyID < (Index)_owners.size())) {
         return _owners[proxyID];
     }
     return Owner();
@@ -149,8 +267,8 @@ const Owner Space::getOwner(int32_t proxyID) const {
 
 uint8_t Space::getRegion(int32_t proxyID) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxies.size())) {
-        return _proxies[proxyID].region;
+    if (isAllocatedID(proxyID) && (proxyID < (Index)_owners.size())) {
+        return _proxyRegion[proxyID];
     }
     return (uint8_t)Region::INVALID;
 }
@@ -159,8 +277,7 @@ void Space::clear() {
     Collection::clear();
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     _IDAllocator.clear();
-    _proxies.clear();
-    _owners.clear();
+    resizeProxies(0);
     _views.clear();
 }
 
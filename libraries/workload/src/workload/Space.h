@@ -35,6 +35,10 @@ public:
         uint8_t prevRegion { 0 };
     };
 
+    // Proxies are classified in batches as wide as an AVX2 register, and in chunks spread across worker threads
+    static const uint32_t CLASSIFY_BATCH_SIZE = 8;
+    static const uint32_t CLASSIFY_CHUNK_SIZE = 8192;
+
     Space();
 
     void setViews(const Views& views);
@@ -60,9 +64,19 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
-    // The database of proxies is protected for editing by a mutex
+    void resizeProxies(uint32_t numProxies);
+    Proxy getProxy(Index proxyID) const;
+
+    // The database of proxies is protected for editing by a mutex.
+    // It is stored as a structure of arrays, padded to a multiple of CLASSIFY_BATCH_SIZE with INVALID proxies,
+    // so that the classification only streams through the spheres and regions.
     mutable std::mutex _proxiesMutex;
-    Proxy::Vector _proxies;
+    std::vector<float> _proxyX;
+    std::vector<float> _proxyY;
+    std::vector<float> _proxyZ;
+    std::vector<float> _proxyRadius;
+    std::vector<uint8_t> _proxyRegion;
+    std::vector<uint8_t> _proxyPrevRegion;
     std::vector<Owner> _owners;
 
     Views _views;
@@ -58,6 +58,16 @@ Column {
                         Render.getConfig("RenderMainView.CullSceneSelection").freezeFrustum = checked;
                     }
                 }
+                CheckBox {
+                    text: "Parallel Fetch, Cull & Sort"
+                    checked: Render.getConfig("RenderMainView.CullSceneSelection").parallel
+                    onCheckedChanged: {
+                        Render.getConfig("RenderMainView.FetchSceneSelection").parallel = checked;
+                        Render.getConfig("RenderMainView.CullSceneSelection").parallel = checked;
+                        Render.getConfig("RenderMainView.DepthSortOpaque").parallel = checked;
+                        Render.getConfig("RenderMainView.DepthSortTransparent").parallel = checked;
+                    }
+                }
                 Label {
                     text: "Octree"
                 }
@@ -0,0 +1,237 @@
+//
+//  AnimPoseSoATests.cpp
+//  tests/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseSoATests.h"
+
+#include <random>
+#include <vector>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+#include <AnimPoseSoA.h>
+#include <AnimSkeleton.h>
+#include <AnimUtil.h>
+
+QTEST_MAIN(AnimPoseSoATests)
+
+const float TEST_EPSILON = 0.001f;
+const float TEST_ANGLE = 0.001f;
+
+// about the size of a full body avatar with fingers, and the number of avatars in a crowded domain
+static const int NUM_JOINTS = 100;
+static const int NUM_AVATARS = 100;
+
+// a random hierarchy in which each joint hangs off one of the few joints before it, like the limbs and fingers of an avatar
+static std::vector<HFMJoint> makeJoints(int numJoints, std::mt19937& random) {
+    std::vector<HFMJoint> joints(numJoints);
+    for (int i = 0; i < numJoints; i++) {
+        HFMJoint& joint = joints[i];
+        joint.parentIndex = (i == 0) ? -1 : std::uniform_int_distribution<int>(std::max(0, i - 4), i - 1)(random);
+        joint.translation = glm::vec3(0.0f, 0.1f, 0.0f);
+        joint.preTransform = glm::mat4();
+        joint.preRotation = glm::quat();
+        joint.rotation = glm::quat();
+        joint.postRotation = glm::quat();
+        joint.postTransform = glm::mat4();
+        joint.name = QString("joint%1").arg(i);
+        joint.isSkeletonJoint = true;
+    }
+    return joints;
+}
+
+static AnimPose makePose(std::mt19937& random, bool uniformScale = true) {
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    glm::quat rot = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+    glm::vec3 trans(unit(random), unit(random), unit(random));
+    float s = scale(random);
+    return AnimPose(uniformScale ? glm::vec3(s) : glm::vec3(s, scale(random), scale(random)), rot, trans);
+}
+
+static AnimPoseVec makePoses(int numPoses, std::mt19937& random) {
+    AnimPoseVec poses;
+    for (int i = 0; i < numPoses; i++) {
+        poses.push_back(makePose(random));
+    }
+    return poses;
+}
+
+// the conversion before AnimSkeleton batched joints by depth
+static void convertRelativePosesToAbsolute_ref(const std::vector<HFMJoint>& joints, AnimPoseVec& poses) {
+    for (int i = 0; i < (int)poses.size(); i++) {
+        int parentIndex = joints[i].parentIndex;
+        if (parentIndex != -1) {
+            poses[i] = poses[parentIndex] * poses[i];
+        }
+    }
+}
+
+static void comparePoses(const AnimPoseVec& result, const AnimPoseVec& expected) {
+    QCOMPARE(result.size(), expected.size());
+    for (size_t i = 0; i < result.size(); i++) {
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), expected[i].scale(), TEST_EPSILON);
+        QCOMPARE_QUATS(result[i].rot(), expected[i].rot(), TEST_ANGLE);
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), expected[i].trans(), TEST_EPSILON);
+    }
+}
+
+void AnimPoseSoATests::testLoadStore() {
+    std::mt19937 random(1);
+    const int NUM_POSES = 7;
+    AnimPoseVec poses = makePoses(NUM_POSES, random);
+    std::vector<int> order = { 3, 0, 6, 1, 5, 2, 4 };
+
+    AnimPoseSoA soa;
+    soa.load(poses.data(), order.data(), NUM_POSES);
+    QCOMPARE(soa.size(), NUM_POSES);
+    for (int i = 0; i < NUM_POSES; i++) {
+        QCOMPARE(soa.get(i).trans(), poses[order[i]].trans());
+    }
+
+    AnimPoseVec stored(NUM_POSES);
+    soa.store(stored.data(), order.data());
+    for (int i = 0; i < NUM_POSES; i++) {
+        QCOMPARE(stored[i].scale(), poses[i].scale());
+        QCOMPARE(stored[i].rot(), poses[i].rot());
+        QCOMPARE(stored[i].trans(), poses[i].trans());
+    }
+}
+
+void AnimPoseSoATests::testConvertRelativePosesToAbsolute() {
+    std::mt19937 random(2);
+    auto joints = makeJoints(NUM_JOINTS, random);
+    AnimSkeleton skeleton(joints, QMap<int, glm::quat>());
+
+    AnimPoseVec poses = makePoses(NUM_JOINTS, random);
+    AnimPoseVec expected = poses;
+    convertRelativePosesToAbsolute_ref(joints, expected);
+
+    skeleton.convertRelativePosesToAbsolute(poses);
+    comparePoses(poses, expected);
+}
+
+void AnimPoseSoATests::testConvertWithNonUniformScale() {
+    std::mt19937 random(3);
+    auto joints = makeJoints(NUM_JOINTS, random);
+    AnimSkeleton skeleton(joints, QMap<int, glm::quat>());
+
+    // the children of these joints take the scalar path
+    AnimPoseVec poses = makePoses(NUM_JOINTS, random);
+    for (int i = 0; i < NUM_JOINTS; i += 7) {
+        poses[i] = makePose(random, false);
+    }
+    AnimPoseVec expected = poses;
+    convertRelativePosesToAbsolute_ref(joints, expected);
+
+    skeleton.convertRelativePosesToAbsolute(poses);
+    comparePoses(poses, expected);
+}
+
+void AnimPoseSoATests::testConvertWithRootPose() {
+    std::mt19937 random(4);
+    auto joints = makeJoints(NUM_JOINTS, random);
+    AnimSkeleton skeleton(joints, QMap<int, glm::quat>());
+
+    AnimPoseVec relativePoses = makePoses(NUM_JOINTS, random);
+    AnimPose rootPose = makePose(random);
+
+    AnimPoseVec expected = relativePoses;
+    expected[0] = rootPose * expected[0];
+    convertRelativePosesToAbsolute_ref(joints, expected);
+
+    AnimPoseVec absolutePoses;
+    skeleton.convertRelativePosesToAbsolute(relativePoses, rootPose, absolutePoses);
+    comparePoses(absolutePoses, expected);
+}
+
+void AnimPoseSoATests::testBlend() {
+    std::mt19937 random(5);
+    // not a multiple of 4, to cover the remainder
+    const int NUM_POSES = NUM_JOINTS + 3;
+    AnimPoseVec a = makePoses(NUM_POSES, random);
+    AnimPoseVec b = makePoses(NUM_POSES, random);
+
+    for (float alpha : { 0.0f, 0.25f, 0.5f, 1.0f }) {
+        AnimPoseVec expected(NUM_POSES);
+        for (int i = 0; i < NUM_POSES; i++) {
+            expected[i] = AnimPose(lerp(a[i].scale(), b[i].scale(), alpha), safeLerp(a[i].rot(), b[i].rot(), alpha),
+                                   lerp(a[i].trans(), b[i].trans(), alpha));
+        }
+
+        AnimPoseVec result(NUM_POSES);
+        ::blend(NUM_POSES, a.data(), b.data(), alpha, result.data());
+        comparePoses(result, expected);
+
+        // in place, as AnimBlendLinear does
+        result = a;
+        ::blend(NUM_POSES, result.data(), b.data(), alpha, result.data());
+        comparePoses(result, expected);
+    }
+}
+
+void AnimPoseSoATests::benchmarkConvert_ref() {
+    std::mt19937 random(7);
+    auto joints = makeJoints(NUM_JOINTS, random);
+    std::vector<AnimPoseVec> avatars(NUM_AVATARS, makePoses(NUM_JOINTS, random));
+    AnimPoseVec poses;
+
+    QBENCHMARK {
+        for (const auto& relativePoses : avatars) {
+            poses = relativePoses;
+            convertRelativePosesToAbsolute_ref(joints, poses);
+        }
+    }
+}
+
+void AnimPoseSoATests::benchmarkConvert() {
+    std::mt19937 random(7);
+    auto joints = makeJoints(NUM_JOINTS, random);
+    AnimSkeleton skeleton(joints, QMap<int, glm::quat>());
+    std::vector<AnimPoseVec> avatars(NUM_AVATARS, makePoses(NUM_JOINTS, random));
+    AnimPoseVec poses;
+
+    QBENCHMARK {
+        for (const auto& relativePoses : avatars) {
+            poses = relativePoses;
+            skeleton.convertRelativePosesToAbsolute(poses);
+        }
+    }
+}
+
+void AnimPoseSoATests::benchmarkBlend_ref() {
+    std::mt19937 random(8);
+    AnimPoseVec a = makePoses(NUM_JOINTS, random);
+    AnimPoseVec b = makePoses(NUM_JOINTS, random);
+    AnimPoseVec result(NUM_JOINTS);
+
+    QBENCHMARK {
+        for (int avatar = 0; avatar < NUM_AVATARS; avatar++) {
+            for (int i = 0; i < NUM_JOINTS; i++) {
+                result[i].scale() = lerp(a[i].scale(), b[i].scale(), 0.5f);
+                result[i].rot() = safeLerp(a[i].rot(), b[i].rot(), 0.5f);
+                result[i].trans() = lerp(a[i].trans(), b[i].trans(), 0.5f);
+            }
+        }
+    }
+}
+
+void AnimPoseSoATests::benchmarkBlend() {
+    std::mt19937 random(8);
+    AnimPoseVec a = makePoses(NUM_JOINTS, random);
+    AnimPoseVec b = makePoses(NUM_JOINTS, random);
+    AnimPoseVec result(NUM_JOINTS);
+
+    QBENCHMARK {
+        for (int avatar = 0; avatar < NUM_AVATARS; avatar++) {
+            ::blend(NUM_JOINTS, a.data(), b.data(), 0.5f, result.data());
+        }
+    }
+}
@@ -0,0 +1,30 @@
+//
+//  AnimPoseSoATests.h
+//  tests/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimPoseSoATests_h
+#define hifi_AnimPoseSoATests_h
+
+#include <QtTest/QtTest>
+
+class AnimPoseSoATests : public QObject {
+    Q_OBJECT
+private slots:
+    void testLoadStore();
+    void testConvertRelativePosesToAbsolute();
+    void testConvertWithNonUniformScale();
+    void testConvertWithRootPose();
+    void testBlend();
+    void benchmarkConvert_ref();
+    void benchmarkConvert();
+    void benchmarkBlend_ref();
+    void benchmarkBlend();
+};
+
+#endif // hifi_AnimPoseSoATests_h
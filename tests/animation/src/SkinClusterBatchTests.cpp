@@ -0,0 +1,288 @@
+//
+//  SkinClusterBatchTests.cpp
+//  tests/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SkinClusterBatchTests.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+#include <GLMHelpers.h>
+#include <Rig.h>
+#include <SkinClusterBatch.h>
+
+QTEST_MAIN(SkinClusterBatchTests)
+
+const float TEST_EPSILON = 1.0e-5f;
+
+// a crowd of avatars of the usual size, each skinned by a body and a head mesh
+static const int NUM_AVATARS = 100;
+static const int NUM_JOINTS = 150;
+static const int NUM_CLUSTERS_PER_DEFORMER[] = { 150, 50 };
+
+static HFMModel makeModel(int numJoints, std::mt19937& random) {
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    HFMModel hfmModel;
+    for (int i = 0; i < numJoints; i++) {
+        HFMJoint joint;
+        joint.parentIndex = (i == 0) ? -1 : std::uniform_int_distribution<int>(std::max(0, i - 4), i - 1)(random);
+        joint.translation = glm::vec3(0.0f, 0.1f, 0.0f);
+        joint.preTransform = glm::mat4();
+        joint.preRotation = glm::quat();
+        joint.rotation = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+        joint.postRotation = glm::quat();
+        joint.postTransform = glm::mat4();
+        joint.name = QString("joint%1").arg(i);
+        joint.isSkeletonJoint = true;
+        hfmModel.joints.push_back(joint);
+    }
+
+    std::uniform_int_distribution<uint32_t> jointIndex(0, numJoints - 1);
+    for (int numClusters : NUM_CLUSTERS_PER_DEFORMER) {
+        HFMSkinDeformer deformer;
+        for (int i = 0; i < numClusters; i++) {
+            HFMCluster cluster;
+            // a cluster without a valid joint is skinned by the identity
+            cluster.jointIndex = (i == numClusters / 2) ? HFMCluster::INVALID_JOINT_INDEX : jointIndex(random);
+            glm::quat rotation = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+            cluster.inverseBindMatrix = glm::inverse(createMatFromQuatAndPos(rotation, glm::vec3(unit(random), unit(random), unit(random))));
+            deformer.clusters.push_back(cluster);
+        }
+        hfmModel.skinDeformers.push_back(deformer);
+    }
+    return hfmModel;
+}
+
+static AnimPose makePose(std::mt19937& random) {
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    glm::quat rot = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+    return AnimPose(glm::vec3(1.0f), rot, glm::vec3(unit(random), unit(random), unit(random)));
+}
+
+struct TestAvatar {
+    HFMModel hfmModel;
+    std::unique_ptr<Rig> rig;
+    AnimPoseVec movedPoses; // the rig's poses with every joint moved
+    SkinClusterBatch batch;
+};
+
+static std::vector<TestAvatar> crowd;
+
+// the cluster matrices as Model::updateClusterMatrices computed them before batching: the cluster copied out of the
+// skeleton and the joint pose converted to a matrix for every cluster
+static void computeClusterMatricesPerCluster(const AnimSkeleton& skeleton, const AnimPoseVec& jointPoses,
+                                             int skinDeformerIndex, std::vector<glm::mat4>& clusterMatrices) {
+    for (int clusterIndex = 0; clusterIndex < (int)clusterMatrices.size(); clusterIndex++) {
+        const auto& cbmov = skeleton.getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
+        glm::mat4 jointMatrix = cbmov.jointIndex < jointPoses.size() ? (glm::mat4)jointPoses[cbmov.jointIndex] : glm::mat4();
+        glm_mat4u_mul(jointMatrix, cbmov.inverseBindMatrix, clusterMatrices[clusterIndex]);
+    }
+}
+
+static void verifyClusterMatrices(const SkinClusterBatch& batch, const AnimSkeleton& skeleton, const AnimPoseVec& jointPoses) {
+    QCOMPARE(batch.getNumSkinDeformers(), skeleton.getNumSkinDeformers());
+    for (int skinDeformerIndex = 0; skinDeformerIndex < batch.getNumSkinDeformers(); skinDeformerIndex++) {
+        int numClusters = (int)batch.getNumClusters(skinDeformerIndex);
+        QCOMPARE(numClusters, skeleton.getNumClusters(skinDeformerIndex));
+        std::vector<glm::mat4> matrices(numClusters), expected(numClusters);
+        batch.computeClusterMatrices(skinDeformerIndex, matrices.data());
+        computeClusterMatricesPerCluster(skeleton, jointPoses, skinDeformerIndex, expected);
+        for (int i = 0; i < numClusters; i++) {
+            QCOMPARE_WITH_ABS_ERROR(matrices[i], expected[i], TEST_EPSILON);
+        }
+    }
+}
+
+void SkinClusterBatchTests::initTestCase() {
+    std::mt19937 random(1);
+    crowd.resize(NUM_AVATARS);
+    for (auto& avatar : crowd) {
+        avatar.hfmModel = makeModel(NUM_JOINTS, random);
+        avatar.rig.reset(new Rig());
+        avatar.rig->initJointStates(avatar.hfmModel, glm::mat4());
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            avatar.movedPoses.push_back(makePose(random));
+        }
+    }
+}
+
+void SkinClusterBatchTests::cleanupTestCase() {
+    // before the rig registry goes away
+    crowd.clear();
+}
+
+void SkinClusterBatchTests::testClusterMatrices() {
+    const TestAvatar& avatar = crowd.front();
+    auto skeleton = avatar.rig->getAnimSkeleton();
+    const AnimPoseVec& poses = avatar.rig->getAbsoluteJointPoses();
+    QCOMPARE((int)poses.size(), NUM_JOINTS);
+
+    SkinClusterBatch batch;
+    QVERIFY(batch.update(skeleton, poses, false));
+    verifyClusterMatrices(batch, *skeleton, poses);
+
+    // the dual quaternion path reads the joint poses and inverse bind transforms
+    for (int skinDeformerIndex = 0; skinDeformerIndex < batch.getNumSkinDeformers(); skinDeformerIndex++) {
+        for (uint32_t clusterIndex = 0; clusterIndex < batch.getNumClusters(skinDeformerIndex); clusterIndex++) {
+            const auto& cbmov = skeleton->getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
+            const AnimPose& expected = cbmov.jointIndex < poses.size() ? poses[cbmov.jointIndex] : AnimPose::identity;
+            QVERIFY(batch.getJointPose(skinDeformerIndex, clusterIndex).trans() == expected.trans());
+            QVERIFY(batch.getJointPose(skinDeformerIndex, clusterIndex).rot() == expected.rot());
+            QVERIFY(batch.getInverseBindMatrix(skinDeformerIndex, clusterIndex) == cbmov.inverseBindMatrix);
+        }
+    }
+}
+
+void SkinClusterBatchTests::testSkipUnchangedJoints() {
+    const TestAvatar& avatar = crowd.front();
+    auto skeleton = avatar.rig->getAnimSkeleton();
+    AnimPoseVec poses = avatar.rig->getAbsoluteJointPoses();
+
+    SkinClusterBatch batch;
+    QVERIFY(batch.update(skeleton, poses, false));
+    QVERIFY(!batch.update(skeleton, poses, false));
+
+    // a copy of the same poses is not a change
+    AnimPoseVec samePoses = poses;
+    QVERIFY(!batch.update(skeleton, samePoses, false));
+
+    // each joint that moves is a change, once
+    std::mt19937 random(2);
+    for (int jointIndex : { 0, NUM_JOINTS / 2, NUM_JOINTS - 1 }) {
+        poses[jointIndex] = makePose(random);
+        QVERIFY(batch.update(skeleton, poses, false));
+        verifyClusterMatrices(batch, *skeleton, poses);
+        QVERIFY(!batch.update(skeleton, poses, false));
+    }
+
+    // and so is a change of scale alone
+    poses[1].scale() *= 2.0f;
+    QVERIFY(batch.update(skeleton, poses, false));
+    verifyClusterMatrices(batch, *skeleton, poses);
+    QVERIFY(!batch.update(skeleton, poses, false));
+}
+
+void SkinClusterBatchTests::testSkinningMethodChange() {
+    const TestAvatar& avatar = crowd.front();
+    auto skeleton = avatar.rig->getAnimSkeleton();
+    AnimPoseVec poses = avatar.rig->getAbsoluteJointPoses();
+
+    SkinClusterBatch batch;
+    QVERIFY(batch.update(skeleton, poses, false));
+
+    // as Model::setUseDualQuaternionSkinning does
+    QVERIFY(batch.update(skeleton, poses, true));
+    QVERIFY(!batch.update(skeleton, poses, true));
+
+    // joints that move with dual quaternion skinning are still picked up by the matrices after switching back
+    poses = avatar.movedPoses;
+    QVERIFY(batch.update(skeleton, poses, true));
+    QVERIFY(batch.update(skeleton, poses, false));
+    verifyClusterMatrices(batch, *skeleton, poses);
+    QVERIFY(!batch.update(skeleton, poses, false));
+}
+
+void SkinClusterBatchTests::testInvalidate() {
+    const TestAvatar& avatar = crowd.front();
+    auto skeleton = avatar.rig->getAnimSkeleton();
+    const AnimPoseVec& poses = avatar.rig->getAbsoluteJointPoses();
+
+    // as CauterizedModel::setCauterizeBoneSet does when the bones change, and Model::deleteGeometry
+    SkinClusterBatch batch;
+    QVERIFY(batch.update(skeleton, poses, false));
+    batch.invalidate();
+    QCOMPARE(batch.getNumSkinDeformers(), 0);
+    QVERIFY(batch.update(skeleton, poses, false));
+    verifyClusterMatrices(batch, *skeleton, poses);
+    QVERIFY(!batch.update(skeleton, poses, false));
+
+    // without a skeleton there is nothing to skin
+    batch.invalidate();
+    QVERIFY(batch.update(AnimSkeleton::ConstPointer(), AnimPoseVec(), false));
+    QCOMPARE(batch.getNumSkinDeformers(), 0);
+}
+
+void SkinClusterBatchTests::testGeometryChange() {
+    std::mt19937 random(3);
+    HFMModel hfmModel = makeModel(NUM_JOINTS, random);
+    Rig rig;
+    rig.initJointStates(hfmModel, glm::mat4());
+
+    SkinClusterBatch batch;
+    QVERIFY(batch.update(rig.getAnimSkeleton(), rig.getAbsoluteJointPoses(), false));
+    QVERIFY(!batch.update(rig.getAnimSkeleton(), rig.getAbsoluteJointPoses(), false));
+
+    // Model::updateGeometry reinitializes the rig, which builds a new skeleton even for the same model
+    rig.initJointStates(hfmModel, glm::mat4());
+    QVERIFY(batch.update(rig.getAnimSkeleton(), rig.getAbsoluteJointPoses(), false));
+    QVERIFY(!batch.update(rig.getAnimSkeleton(), rig.getAbsoluteJointPoses(), false));
+
+    // a model with other clusters and fewer joints
+    HFMModel otherModel = makeModel(NUM_JOINTS / 2, random);
+    otherModel.skinDeformers.pop_back();
+    rig.initJointStates(otherModel, glm::mat4());
+    QVERIFY(batch.update(rig.getAnimSkeleton(), rig.getAbsoluteJointPoses(), false));
+    verifyClusterMatrices(batch, *rig.getAnimSkeleton(), rig.getAbsoluteJointPoses());
+    QVERIFY(!batch.update(rig.getAnimSkeleton(), rig.getAbsoluteJointPoses(), false));
+}
+
+void SkinClusterBatchTests::benchmarkPerCluster_ref() {
+    std::vector<glm::mat4> matrices(NUM_CLUSTERS_PER_DEFORMER[0]);
+    QBENCHMARK {
+        for (const auto& avatar : crowd) {
+            const Rig& rig = *avatar.rig;
+            for (int skinDeformerIndex = 0; skinDeformerIndex < (int)avatar.hfmModel.skinDeformers.size(); skinDeformerIndex++) {
+                int numClusters = (int)avatar.hfmModel.skinDeformers[skinDeformerIndex].clusters.size();
+                for (int clusterIndex = 0; clusterIndex < numClusters; clusterIndex++) {
+                    const auto& cbmov = rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(skinDeformerIndex, clusterIndex);
+                    auto jointMatrix = rig.getJointTransform(cbmov.jointIndex);
+                    glm_mat4u_mul(jointMatrix, cbmov.inverseBindMatrix, matrices[clusterIndex]);
+                }
+            }
+        }
+    }
+}
+
+// every joint of every avatar moves every frame
+void SkinClusterBatchTests::benchmarkBatch() {
+    std::vector<glm::mat4> matrices(NUM_CLUSTERS_PER_DEFORMER[0]);
+    bool moved = false;
+    QBENCHMARK {
+        moved = !moved;
+        for (auto& avatar : crowd) {
+            const AnimPoseVec& poses = moved ? avatar.movedPoses : avatar.rig->getAbsoluteJointPoses();
+            if (avatar.batch.update(avatar.rig->getAnimSkeleton(), poses, false)) {
+                for (int skinDeformerIndex = 0; skinDeformerIndex < avatar.batch.getNumSkinDeformers(); skinDeformerIndex++) {
+                    avatar.batch.computeClusterMatrices(skinDeformerIndex, matrices.data());
+                }
+            }
+        }
+    }
+}
+
+// no joint moves
+void SkinClusterBatchTests::benchmarkBatchUnchanged() {
+    std::vector<glm::mat4> matrices(NUM_CLUSTERS_PER_DEFORMER[0]);
+    for (auto& avatar : crowd) {
+        avatar.batch.update(avatar.rig->getAnimSkeleton(), avatar.rig->getAbsoluteJointPoses(), false);
+    }
+    QBENCHMARK {
+        for (auto& avatar : crowd) {
+            if (avatar.batch.update(avatar.rig->getAnimSkeleton(), avatar.rig->getAbsoluteJointPoses(), false)) {
+                for (int skinDeformerIndex = 0; skinDeformerIndex < avatar.batch.getNumSkinDeformers(); skinDeformerIndex++) {
+                    avatar.batch.computeClusterMatrices(skinDeformerIndex, matrices.data());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+//
+//  SkinClusterBatchTests.h
+//  tests/animation/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SkinClusterBatchTests_h
+#define hifi_SkinClusterBatchTests_h
+
+#include <QtTest/QtTest>
+
+class SkinClusterBatchTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void testClusterMatrices();
+    void testSkipUnchangedJoints();
+    void testSkinningMethodChange();
+    void testInvalidate();
+    void testGeometryChange();
+    void benchmarkPerCluster_ref();
+    void benchmarkBatch();
+    void benchmarkBatchUnchanged();
+};
+
+#endif // hifi_SkinClusterBatchTests_h
@@ -0,0 +1,154 @@
+//
+//  AudioSPSCRingBufferTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSPSCRingBufferTests.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "AudioSPSCRingBuffer.h"
+
+QTEST_MAIN(AudioSPSCRingBufferTests)
+
+void AudioSPSCRingBufferTests::wrapAround() {
+    // not a power of two, so the logical capacity is smaller than the buffer
+    AudioSPSCRingBuffer ringBuffer(100);
+    QCOMPARE(ringBuffer.getSampleCapacity(), 100);
+    QVERIFY(ringBuffer.isLockFree());
+
+    int16_t writeData[10000];
+    int16_t readData[10000];
+    for (int i = 0; i < 10000; i++) {
+        writeData[i] = (int16_t)i;
+    }
+
+    int writeIndexAt = 0;
+    int readIndexAt = 0;
+    for (int T = 0; T < 100; T++) {
+        writeIndexAt += ringBuffer.writeSamples(&writeData[writeIndexAt], 73);
+        QCOMPARE(ringBuffer.samplesAvailable(), 73);
+
+        readIndexAt += ringBuffer.readSamples(&readData[readIndexAt], 43);
+        QCOMPARE(ringBuffer.samplesAvailable(), 30);
+
+        writeIndexAt += ringBuffer.writeSamples(&writeData[writeIndexAt], 70);
+        QCOMPARE(ringBuffer.samplesAvailable(), 100);
+        QCOMPARE(ringBuffer.getFreeSpace(), 0);
+
+        readIndexAt += ringBuffer.readSamples(&readData[readIndexAt], 100);
+        QCOMPARE(ringBuffer.samplesAvailable(), 0);
+        QCOMPARE(writeIndexAt, readIndexAt);
+
+        if (writeIndexAt > 9000) {
+            for (int i = 0; i < readIndexAt; i++) {
+                QCOMPARE(readData[i], writeData[i]);
+            }
+            writeIndexAt = readIndexAt = 0;
+        }
+    }
+}
+
+void AudioSPSCRingBufferTests::neverOverwrites() {
+    AudioSPSCRingBuffer ringBuffer(64);
+    std::vector<int16_t> data(100, 1);
+
+    QCOMPARE(ringBuffer.writeSamples(data.data(), 100), 64);
+    QCOMPARE(ringBuffer.writeSamples(data.data(), 1), 0);
+    QCOMPARE(ringBuffer.samplesAvailable(), 64);
+
+    std::vector<int16_t> readData(100, 0);
+    QCOMPARE(ringBuffer.readSamples(readData.data(), 100), 64);
+    QCOMPARE(ringBuffer.readSamples(readData.data(), 100), 0);
+}
+
+void AudioSPSCRingBufferTests::appendAndSkip() {
+    AudioSPSCMixRingBuffer ringBuffer(10);
+    float source[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+
+    // wrap the read position first
+    ringBuffer.writeSamples(source, 7);
+    ringBuffer.skipSamples(7);
+    QCOMPARE(ringBuffer.samplesAvailable(), 0);
+
+    ringBuffer.writeSamples(source, 8);
+    float destination[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    QCOMPARE(ringBuffer.appendSamples(destination, 6), 6);
+    for (int i = 0; i < 6; i++) {
+        QCOMPARE(destination[i], source[i] + 1.0f);
+    }
+    QCOMPARE(destination[6], 1.0f);
+
+    QCOMPARE(ringBuffer.appendSamples(destination, 8, false), 2);
+    QCOMPARE(destination[0], source[6]);
+    QCOMPARE(destination[1], source[7]);
+}
+
+void AudioSPSCRingBufferTests::clearAndResize() {
+    AudioSPSCRingBuffer ringBuffer;
+    QCOMPARE(ringBuffer.getSampleCapacity(), 0);
+
+    int16_t data[16] = {};
+    QCOMPARE(ringBuffer.writeSamples(data, 16), 0);
+
+    ringBuffer.resize(16);
+    QCOMPARE(ringBuffer.writeSamples(data, 16), 16);
+    ringBuffer.clear();
+    QCOMPARE(ringBuffer.samplesAvailable(), 0);
+    QCOMPARE(ringBuffer.getFreeSpace(), 16);
+
+    ringBuffer.writeSamples(data, 8);
+    ringBuffer.resize(48);
+    QCOMPARE(ringBuffer.samplesAvailable(), 0);
+    QCOMPARE(ringBuffer.getFreeSpace(), 48);
+}
+
+void AudioSPSCRingBufferTests::producerConsumer() {
+    const int NUM_SAMPLES = 1 << 22;
+    const int MAX_BLOCK = 480;
+    AudioSPSCRingBuffer ringBuffer(MAX_BLOCK * 3);
+
+    std::thread producer([&] {
+        int16_t block[MAX_BLOCK];
+        int written = 0;
+        int blockSize = 1;
+        while (written < NUM_SAMPLES) {
+            int numSamples = std::min(blockSize, NUM_SAMPLES - written);
+            for (int i = 0; i < numSamples; i++) {
+                block[i] = (int16_t)(written + i);
+            }
+            int offset = 0;
+            while (offset < numSamples) {
+                offset += ringBuffer.writeSamples(block + offset, numSamples - offset);
+            }
+            written += numSamples;
+            blockSize = (blockSize * 7 + 3) % MAX_BLOCK + 1;
+        }
+    });
+
+    // the consumer must see every sample, in order, exactly once
+    int16_t block[MAX_BLOCK];
+    int read = 0;
+    int errors = 0;
+    int blockSize = 1;
+    while (read < NUM_SAMPLES) {
+        int numSamples = ringBuffer.readSamples(block, blockSize);
+        for (int i = 0; i < numSamples; i++) {
+            errors += (block[i] != (int16_t)(read + i));
+        }
+        read += numSamples;
+        blockSize = (blockSize * 5 + 1) % MAX_BLOCK + 1;
+    }
+    producer.join();
+
+    QCOMPARE(errors, 0);
+    QCOMPARE(read, NUM_SAMPLES);
+    QCOMPARE(ringBuffer.samplesAvailable(), 0);
+}
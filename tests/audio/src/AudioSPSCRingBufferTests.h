@@ -0,0 +1,26 @@
+//
+//  AudioSPSCRingBufferTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSPSCRingBufferTests_h
+#define hifi_AudioSPSCRingBufferTests_h
+
+#include <QtTest/QtTest>
+
+class AudioSPSCRingBufferTests : public QObject {
+    Q_OBJECT
+private slots:
+    void wrapAround();
+    void neverOverwrites();
+    void appendAndSkip();
+    void clearAndResize();
+    void producerConsumer();
+};
+
+#endif // hifi_AudioSPSCRingBufferTests_h
@@ -0,0 +1,184 @@
+//
+//  AudioSRCTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSRCTests.h"
+
+#include <cmath>
+#include <vector>
+
+#include "AudioSRC.h"
+
+QTEST_MAIN(AudioSRCTests)
+
+static const int NUM_FRAMES = 4800;
+static const int BLOCK_FRAMES = 333;    // deliberately not a multiple of SRC_BLOCK
+
+static void addRateAndChannelRows() {
+    QTest::addColumn<int>("inputRate");
+    QTest::addColumn<int>("outputRate");
+    QTest::addColumn<int>("numChannels");
+
+    const int RATES[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 16000, 48000 }, { 48000, 16000 } };
+    const int CHANNELS[] = { 1, 2, 4, 8 };
+
+    for (auto& rate : RATES) {
+        for (int numChannels : CHANNELS) {
+            QString name = QString("%1->%2 x%3").arg(rate[0]).arg(rate[1]).arg(numChannels);
+            QTest::newRow(name.toLatin1().constData()) << rate[0] << rate[1] << numChannels;
+        }
+    }
+}
+
+static std::vector<float> createSignal(int numFrames, int numChannels) {
+    std::vector<float> signal(numFrames * numChannels);
+    for (int i = 0; i < numFrames; i++) {
+        for (int ch = 0; ch < numChannels; ch++) {
+            signal[i * numChannels + ch] = 0.5f * sinf(0.01f * (ch + 1) * i);
+        }
+    }
+    return signal;
+}
+
+static int renderInBlocks(AudioSRC& src, const float* input, float* output, int numFrames, int numChannels) {
+    int outputFrames = 0;
+    for (int i = 0; i < numFrames; i += BLOCK_FRAMES) {
+        int n = std::min(BLOCK_FRAMES, numFrames - i);
+        outputFrames += src.render(input + i * numChannels, output + outputFrames * numChannels, n);
+    }
+    return outputFrames;
+}
+
+void AudioSRCTests::multichannelMatchesMono_data() {
+    addRateAndChannelRows();
+}
+
+void AudioSRCTests::multichannelMatchesMono() {
+    QFETCH(int, inputRate);
+    QFETCH(int, outputRate);
+    QFETCH(int, numChannels);
+
+    std::vector<float> input = createSignal(NUM_FRAMES, numChannels);
+
+    AudioSRC src(inputRate, outputRate, numChannels);
+    std::vector<float> output(src.getMaxOutput(NUM_FRAMES) * numChannels);
+    int outputFrames = renderInBlocks(src, input.data(), output.data(), NUM_FRAMES, numChannels);
+
+    // every channel must be filtered exactly as a mono stream would be
+    for (int ch = 0; ch < numChannels; ch++) {
+        std::vector<float> monoInput(NUM_FRAMES);
+        for (int i = 0; i < NUM_FRAMES; i++) {
+            monoInput[i] = input[i * numChannels + ch];
+        }
+
+        AudioSRC monoSrc(inputRate, outputRate, 1);
+        std::vector<float> monoOutput(monoSrc.getMaxOutput(NUM_FRAMES));
+        int monoFrames = renderInBlocks(monoSrc, monoInput.data(), monoOutput.data(), NUM_FRAMES, 1);
+
+        QCOMPARE(outputFrames, monoFrames);
+        for (int i = 0; i < outputFrames; i++) {
+            QVERIFY(fabsf(output[i * numChannels + ch] - monoOutput[i]) < 1e-5f);
+        }
+    }
+}
+
+void AudioSRCTests::interleavedInt16MatchesMono_data() {
+    addRateAndChannelRows();
+}
+
+void AudioSRCTests::interleavedInt16MatchesMono() {
+    QFETCH(int, inputRate);
+    QFETCH(int, outputRate);
+    QFETCH(int, numChannels);
+
+    // quantize the signal first, so the float reference sees exactly the int16_t input
+    std::vector<float> signal = createSignal(NUM_FRAMES, numChannels);
+    std::vector<int16_t> input(signal.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = (int16_t)(signal[i] * 32767.0f);
+    }
+
+    AudioSRC src(inputRate, outputRate, numChannels);
+    std::vector<int16_t> output(src.getMaxOutput(NUM_FRAMES) * numChannels);
+    int outputFrames = 0;
+    for (int i = 0; i < NUM_FRAMES; i += BLOCK_FRAMES) {
+        int n = std::min(BLOCK_FRAMES, NUM_FRAMES - i);
+        outputFrames += src.render(&input[i * numChannels], &output[outputFrames * numChannels], n);
+    }
+
+    for (int ch = 0; ch < numChannels; ch++) {
+        std::vector<float> monoInput(NUM_FRAMES);
+        for (int i = 0; i < NUM_FRAMES; i++) {
+            monoInput[i] = input[i * numChannels + ch] * (1 / 32768.0f);
+        }
+
+        AudioSRC monoSrc(inputRate, outputRate, 1);
+        std::vector<float> monoOutput(monoSrc.getMaxOutput(NUM_FRAMES));
+        int monoFrames = renderInBlocks(monoSrc, monoInput.data(), monoOutput.data(), NUM_FRAMES, 1);
+
+        // within the rounding and the TPDF dither of the int16_t output
+        QCOMPARE(outputFrames, monoFrames);
+        for (int i = 0; i < outputFrames; i++) {
+            QVERIFY(fabsf(output[i * numChannels + ch] - monoOutput[i] * 32768.0f) <= 2.0f);
+        }
+    }
+}
+
+void AudioSRCTests::rateAdjustment() {
+    const int SAMPLE_RATE = 48000;
+    const int NUM_CHANNELS = 2;
+    const int FRAMES_PER_BLOCK = 480;
+
+    AudioSRC src(SAMPLE_RATE, SAMPLE_RATE, NUM_CHANNELS, AudioSRC::MEDIUM_QUALITY, true);
+    std::vector<float> input(FRAMES_PER_BLOCK * NUM_CHANNELS, 0.1f);
+    std::vector<float> output(src.getMaxOutput(2 * FRAMES_PER_BLOCK) * NUM_CHANNELS);
+
+    auto renderOneSecond = [&] {
+        int outputFrames = 0;
+        for (int i = 0; i < SAMPLE_RATE / FRAMES_PER_BLOCK; i++) {
+            outputFrames += src.render(input.data(), output.data(), FRAMES_PER_BLOCK);
+        }
+        return outputFrames;
+    };
+
+    // consuming input 0.5% faster produces 0.5% less output
+    src.setRateAdjustment(1.005f);
+    QVERIFY(abs(renderOneSecond() - (int)(SAMPLE_RATE / 1.005f)) <= 1);
+
+    // adjustments are clamped to SRC_MAX_RATE_ADJUSTMENT
+    src.setRateAdjustment(0.5f);
+    QVERIFY(abs(renderOneSecond() - (int)(SAMPLE_RATE / (1.0f - SRC_MAX_RATE_ADJUSTMENT))) <= 1);
+}
+
+void AudioSRCTests::benchmarkInterleaved_data() {
+    addRateAndChannelRows();
+}
+
+void AudioSRCTests::benchmarkInterleaved() {
+    QFETCH(int, inputRate);
+    QFETCH(int, outputRate);
+    QFETCH(int, numChannels);
+
+    std::vector<float> floatInput = createSignal(inputRate, numChannels);
+    std::vector<int16_t> input(floatInput.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = (int16_t)(floatInput[i] * 32767.0f);
+    }
+
+    AudioSRC src(inputRate, outputRate, numChannels);
+    std::vector<int16_t> output(src.getMaxOutput(inputRate) * numChannels);
+
+    // one second of audio, in 10ms network frames
+    int framesPerBlock = inputRate / 100;
+    QBENCHMARK {
+        for (int i = 0; i < inputRate; i += framesPerBlock) {
+            src.render(&input[i * numChannels], output.data(), framesPerBlock);
+        }
+    }
+}
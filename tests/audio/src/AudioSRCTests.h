@@ -0,0 +1,29 @@
+//
+//  AudioSRCTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSRCTests_h
+#define hifi_AudioSRCTests_h
+
+#include <QtTest/QtTest>
+
+class AudioSRCTests : public QObject {
+    Q_OBJECT
+private slots:
+    void multichannelMatchesMono_data();
+    void multichannelMatchesMono();
+    void interleavedInt16MatchesMono_data();
+    void interleavedInt16MatchesMono();
+    void rateAdjustment();
+
+    void benchmarkInterleaved_data();
+    void benchmarkInterleaved();
+};
+
+#endif // hifi_AudioSRCTests_h
@@ -0,0 +1,160 @@
+//
+//  AudioSourceGridTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioSourceGridTests.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "AudioSourceGrid.h"
+
+QTEST_MAIN(AudioSourceGridTests)
+
+static const float INFINITE_RADIUS = std::numeric_limits<float>::infinity();
+static const float MAX_AUDIBLE_DISTANCE = 1000.0f;
+
+void AudioSourceGridTests::audibleRadius() {
+    // the default attenuation (-6dB per doubling) is audible further than any domain, so the limit applies
+    QCOMPARE(AudioSourceGrid::computeAudibleRadius(0.5f, MAX_AUDIBLE_DISTANCE), MAX_AUDIBLE_DISTANCE);
+    QVERIFY(AudioSourceGrid::computeAudibleRadius(0.5f, INFINITE_RADIUS) > 1.0e6f);
+
+    // no attenuation is audible at any distance
+    QCOMPARE(AudioSourceGrid::computeAudibleRadius(0.0f, MAX_AUDIBLE_DISTANCE), MAX_AUDIBLE_DISTANCE);
+    QVERIFY(std::isinf(AudioSourceGrid::computeAudibleRadius(0.0f, INFINITE_RADIUS)));
+
+    // strong attenuation falls below the limit, and full attenuation is silent
+    float radius = AudioSourceGrid::computeAudibleRadius(0.9f, MAX_AUDIBLE_DISTANCE);
+    QVERIFY(radius > 2.0f && radius < MAX_AUDIBLE_DISTANCE);
+    QCOMPARE(AudioSourceGrid::computeAudibleRadius(1.0f, MAX_AUDIBLE_DISTANCE), 0.0f);
+
+    // linear attenuation reaches zero at the distance limit
+    QCOMPARE(AudioSourceGrid::computeAudibleRadius(-50.0f, MAX_AUDIBLE_DISTANCE), 50.0f);
+}
+
+void AudioSourceGridTests::findSources_data() {
+    QTest::addColumn<float>("radius");
+
+    // few columns are walked cell by cell, many fall back to checking every occupied cell
+    QTest::newRow("within a cell") << 5.0f;
+    QTest::newRow("few cells") << 40.0f;
+    QTest::newRow("many cells") << 300.0f;
+    QTest::newRow("unlimited") << INFINITE_RADIUS;
+}
+
+void AudioSourceGridTests::findSources() {
+    QFETCH(float, radius);
+
+    const int NUM_SOURCES = 2000;
+    const int NUM_QUERIES = 200;
+    const float EXTENT = 500.0f;
+
+    std::mt19937 generator(29);
+    std::uniform_real_distribution<float> coordinate(-EXTENT, EXTENT);
+    auto randomPosition = [&] {
+        return glm::vec3(coordinate(generator), coordinate(generator) * 0.1f, coordinate(generator));
+    };
+
+    // clustered and spread sources, including ones on cell boundaries and at negative coordinates
+    std::vector<glm::vec3> positions;
+    for (int i = 0; i < NUM_SOURCES; i++) {
+        glm::vec3 position = randomPosition();
+        if (i % 4 == 0) {
+            position = glm::vec3(10.0f) + position * 0.01f;
+        } else if (i % 4 == 1) {
+            position = glm::floor(position / AudioSourceGrid::CELL_SIZE) * AudioSourceGrid::CELL_SIZE;
+        }
+        positions.push_back(position);
+    }
+
+    AudioSourceGrid grid;
+    for (int i = 0; i < NUM_SOURCES; i++) {
+        grid.addSource(positions[i], i);
+    }
+    grid.build();
+    QCOMPARE(grid.getNumSources(), NUM_SOURCES);
+
+    std::vector<int> ids;
+    std::vector<int> expectedIds;
+    for (int query = 0; query < NUM_QUERIES; query++) {
+        glm::vec3 listener = (query % 2) ? randomPosition() : positions[query];
+
+        expectedIds.clear();
+        for (int i = 0; i < NUM_SOURCES; i++) {
+            glm::vec3 toSource = positions[i] - listener;
+            if (glm::dot(toSource, toSource) <= radius * radius) {
+                expectedIds.push_back(i);
+            }
+        }
+
+        ids.clear();
+        grid.findSources(listener, radius, ids);
+        std::sort(ids.begin(), ids.end());
+        QCOMPARE(ids, expectedIds);
+    }
+
+    // sources are found again after the grid is rebuilt
+    grid.clear();
+    QCOMPARE(grid.getNumCells(), 0);
+    grid.addSource(positions[0], 0);
+    grid.build();
+    ids.clear();
+    grid.findSources(positions[0], radius, ids);
+    QCOMPARE(ids, std::vector<int>({ 0 }));
+}
+
+void AudioSourceGridTests::edgeSourcesDoNotChurn() {
+    const float RADIUS = 100.0f;
+    const int NUM_FRAMES = 1000;
+
+    const glm::vec3 listener(3.0f, 1.0f, -7.0f);
+    float evictionRadius = AudioSourceGrid::computeEvictionRadius(RADIUS);
+    QVERIFY(evictionRadius > RADIUS);
+
+    // like the mixer, a distant source is readmitted when the grid finds it within the radius,
+    // and an admitted source is only made distant past the eviction radius
+    bool isDistant = true;
+    int numTransitions = 0;
+    auto update = [&](const glm::vec3& position) {
+        AudioSourceGrid grid;
+        grid.addSource(position, 0);
+        grid.build();
+        std::vector<int> ids;
+        grid.findSources(listener, RADIUS, ids);
+
+        if (isDistant && !ids.empty()) {
+            isDistant = false;
+            numTransitions++;
+        } else if (!isDistant && glm::length(position - listener) > evictionRadius) {
+            isDistant = true;
+            numTransitions++;
+        }
+    };
+
+    // a source wandering back and forth across the edge is admitted once, and stays
+    const glm::vec3 direction = glm::normalize(glm::vec3(1.0f, 0.2f, -0.5f));
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        float distance = RADIUS * (1.0f + 0.1f * sinf(frame * 0.1f));
+        update(listener + direction * distance);
+    }
+    QVERIFY(!isDistant);
+    QCOMPARE(numTransitions, 1);
+
+    // it leaves past the eviction radius, and is not readmitted until it is back within the radius
+    update(listener + direction * (evictionRadius * 1.01f));
+    QVERIFY(isDistant);
+    update(listener + direction * (RADIUS * 1.1f));
+    QVERIFY(isDistant);
+    update(listener + direction * (RADIUS * 0.9f));
+    QVERIFY(!isDistant);
+    QCOMPARE(numTransitions, 3);
+}
@@ -0,0 +1,25 @@
+//
+//  AudioSourceGridTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioSourceGridTests_h
+#define hifi_AudioSourceGridTests_h
+
+#include <QtTest/QtTest>
+
+class AudioSourceGridTests : public QObject {
+    Q_OBJECT
+private slots:
+    void audibleRadius();
+    void findSources_data();
+    void findSources();
+    void edgeSourcesDoNotChurn();
+};
+
+#endif // hifi_AudioSourceGridTests_h
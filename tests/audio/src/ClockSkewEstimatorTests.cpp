@@ -0,0 +1,126 @@
+//
+//  ClockSkewEstimatorTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ClockSkewEstimatorTests.h"
+
+#include <cmath>
+#include <vector>
+
+#include "AudioSRC.h"
+#include "ClockSkewEstimator.h"
+
+QTEST_MAIN(ClockSkewEstimatorTests)
+
+static const int SAMPLE_RATE = 48000;
+static const int FRAME_SAMPLES = 480;           // 10ms, mono
+static const float DESIRED_FRAMES = 3.0f;
+static const int NUM_READS = 6 * 60 * 100;      // six minutes of 10ms device reads
+
+struct SkewResult {
+    float minLevel;
+    float maxLevel;
+    double meanRateAdjustment;
+};
+
+// the buffer only gains whole packets, so its level steps by a frame whenever the sender gets a packet ahead
+static const float LEVEL_TOLERANCE_FRAMES = 1.5f;
+
+// A sender whose clock runs (1 + skew) times as fast as the device's delivers frames through a variable-rate
+// resampler into a buffer, which the device drains by one frame per read.  Returns the range of the buffer level,
+// in frames, once the estimate has settled, and the mean rate adjustment over that time.
+static SkewResult simulate(float skew) {
+    AudioSRC src(SAMPLE_RATE, SAMPLE_RATE, 1, AudioSRC::MEDIUM_QUALITY, true);
+    ClockSkewEstimator estimator;
+
+    std::vector<float> input(FRAME_SAMPLES, 0.0f);
+    std::vector<float> output(src.getMaxOutput(FRAME_SAMPLES) * 2);
+
+    SkewResult result { DESIRED_FRAMES, DESIRED_FRAMES, 0.0 };
+    int numSettledReads = 0;
+    int samplesAvailable = (int)DESIRED_FRAMES * FRAME_SAMPLES;
+    double packetClock = 0.0;
+
+    for (int read = 0; read < NUM_READS; read++) {
+
+        // deliver the packets sent during this read
+        packetClock += 1.0 + skew;
+        while (packetClock >= 1.0) {
+            src.setRateAdjustment(estimator.getRateAdjustment());
+            samplesAvailable += src.render(input.data(), output.data(), FRAME_SAMPLES);
+            packetClock -= 1.0;
+        }
+
+        // arrivals alternate early and late by half a frame
+        float jitter = (read & 1) ? 0.5f : -0.5f;
+
+        samplesAvailable -= std::min(samplesAvailable, FRAME_SAMPLES);
+        estimator.update(samplesAvailable / (float)FRAME_SAMPLES + jitter, DESIRED_FRAMES);
+
+        if (read > NUM_READS / 2) {
+            float level = samplesAvailable / (float)FRAME_SAMPLES;
+            result.minLevel = std::min(result.minLevel, level);
+            result.maxLevel = std::max(result.maxLevel, level);
+            result.meanRateAdjustment += estimator.getRateAdjustment();
+            numSettledReads++;
+        }
+    }
+    result.meanRateAdjustment /= numSettledReads;
+    return result;
+}
+
+void ClockSkewEstimatorTests::noSkew() {
+    ClockSkewEstimator estimator;
+    for (int i = 0; i < NUM_READS; i++) {
+        estimator.update(DESIRED_FRAMES, DESIRED_FRAMES);
+    }
+    QCOMPARE(estimator.getRateAdjustment(), 1.0f);
+
+    SkewResult result = simulate(0.0f);
+    QVERIFY(fabs(result.meanRateAdjustment - 1.0) < 1e-5);
+    QVERIFY(result.minLevel > DESIRED_FRAMES - LEVEL_TOLERANCE_FRAMES);
+    QVERIFY(result.maxLevel < DESIRED_FRAMES + LEVEL_TOLERANCE_FRAMES);
+}
+
+void ClockSkewEstimatorTests::tracksSkew_data() {
+    QTest::addColumn<float>("skew");
+
+    QTest::newRow("+500ppm") << 0.0005f;
+    QTest::newRow("-500ppm") << -0.0005f;
+    QTest::newRow("+50ppm") << 0.00005f;
+    QTest::newRow("-50ppm") << -0.00005f;
+}
+
+void ClockSkewEstimatorTests::tracksSkew() {
+    QFETCH(float, skew);
+
+    // uncompensated, the level would drift by 18 frames over the run at 500ppm
+    SkewResult result = simulate(skew);
+
+    // the estimate converges on the skew, and holds the level near the desired level
+    QVERIFY(fabs(result.meanRateAdjustment - (1.0 + skew)) < 1e-5);
+    QVERIFY(result.minLevel > DESIRED_FRAMES - LEVEL_TOLERANCE_FRAMES);
+    QVERIFY(result.maxLevel < DESIRED_FRAMES + LEVEL_TOLERANCE_FRAMES);
+}
+
+void ClockSkewEstimatorTests::clampsAdjustment() {
+    ClockSkewEstimator estimator;
+    for (int i = 0; i < NUM_READS; i++) {
+        estimator.update(DESIRED_FRAMES + 1000.0f, DESIRED_FRAMES);
+    }
+    QCOMPARE(estimator.getRateAdjustment(), 1.0f + SRC_MAX_RATE_ADJUSTMENT);
+
+    estimator.reset();
+    QCOMPARE(estimator.getRateAdjustment(), 1.0f);
+
+    for (int i = 0; i < NUM_READS; i++) {
+        estimator.update(0.0f, DESIRED_FRAMES + 1000.0f);
+    }
+    QCOMPARE(estimator.getRateAdjustment(), 1.0f - SRC_MAX_RATE_ADJUSTMENT);
+}
@@ -0,0 +1,25 @@
+//
+//  ClockSkewEstimatorTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ClockSkewEstimatorTests_h
+#define hifi_ClockSkewEstimatorTests_h
+
+#include <QtTest/QtTest>
+
+class ClockSkewEstimatorTests : public QObject {
+    Q_OBJECT
+private slots:
+    void noSkew();
+    void tracksSkew_data();
+    void tracksSkew();
+    void clampsAdjustment();
+};
+
+#endif // hifi_ClockSkewEstimatorTests_h
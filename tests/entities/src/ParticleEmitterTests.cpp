@@ -0,0 +1,188 @@
+//
+//  ParticleEmitterTests.cpp
+//  tests/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ParticleEmitterTests.h"
+
+#include <QElapsedTimer>
+
+#include <NumericalConstants.h>
+#include <ParticleEmitter.h>
+
+QTEST_MAIN(ParticleEmitterTests)
+
+static const uint64_t FRAME_USECS = USECS_PER_SECOND / 60;
+static const uint64_t START_USECS = 1000 * USECS_PER_SECOND;
+
+static particle::Properties createProperties(float rate, float lifespan, uint32_t maxParticles) {
+    particle::Properties properties;
+    properties.emission.rate = rate;
+    properties.emission.speed = { 1.0f, 0.0f };
+    properties.emission.acceleration = { glm::vec3(0.0f), glm::vec3(0.0f) };
+    properties.emission.dimensions = glm::vec3(0.0f);
+    properties.emission.shouldTrail = false;
+    properties.polar = { 0.0f, 0.0f };
+    properties.lifespan = lifespan;
+    properties.maxParticles = maxParticles;
+    return properties;
+}
+
+static void stepFrames(particle::Emitter& emitter, const particle::Properties& properties, int numFrames, uint64_t& now,
+                       const Transform& transform = Transform(), ShapeType shapeType = SHAPE_TYPE_ELLIPSOID) {
+    particle::Emitter::TriangleInfo triangleInfo;
+    for (int i = 0; i < numFrames; i++) {
+        now += FRAME_USECS;
+        emitter.step(now, FRAME_USECS, true, properties, transform, shapeType, triangleInfo);
+    }
+}
+
+void ParticleEmitterTests::emitsAtRate() {
+    particle::Emitter emitter(1234);
+    particle::Properties properties = createProperties(600.0f, 10.0f, 10000);
+    uint64_t now = START_USECS;
+    stepFrames(emitter, properties, 60, now);
+    QVERIFY(emitter.size() >= 540 && emitter.size() <= 660);
+
+    // not emitting
+    int numParticles = emitter.size();
+    particle::Emitter::TriangleInfo triangleInfo;
+    now += FRAME_USECS;
+    emitter.step(now, FRAME_USECS, false, properties, Transform(), SHAPE_TYPE_ELLIPSOID, triangleInfo);
+    QCOMPARE(emitter.size(), numParticles);
+
+    // the oldest particles are first
+    for (int i = 1; i < emitter.size(); i++) {
+        QVERIFY(emitter.getLifetime(i - 1) >= emitter.getLifetime(i));
+    }
+}
+
+void ParticleEmitterTests::killsExpiredAndExtraParticles() {
+    particle::Emitter emitter(1234);
+    uint64_t now = START_USECS;
+
+    // half a second of lifespan
+    particle::Properties properties = createProperties(600.0f, 0.5f, 10000);
+    stepFrames(emitter, properties, 120, now);
+    QVERIFY(emitter.size() > 0 && emitter.size() <= 310);
+    for (int i = 0; i < emitter.size(); i++) {
+        QVERIFY(emitter.getLifetime(i) <= 0.5f + 1.0f / 60.0f);
+    }
+
+    // fewer particles than emitted
+    properties = createProperties(600.0f, 10.0f, 100);
+    emitter.clear();
+    stepFrames(emitter, properties, 60, now);
+    QCOMPARE(emitter.size(), 100);
+}
+
+void ParticleEmitterTests::integratesBallistically() {
+    particle::Emitter emitter(1234);
+    uint64_t now = START_USECS;
+
+    // one particle a second along z, falling
+    particle::Properties properties = createProperties(1.0f, 10.0f, 10000);
+    properties.emission.speed = { 5.0f, 0.0f };
+    properties.emission.acceleration = { glm::vec3(0.0f, -10.0f, 0.0f), glm::vec3(0.0f) };
+    stepFrames(emitter, properties, 150, now);
+    QVERIFY(emitter.size() > 1);
+
+    const glm::vec3 EMIT_VELOCITY(0.0f, 0.0f, 5.0f);
+    const glm::vec3 ACCELERATION(0.0f, -10.0f, 0.0f);
+    const float EPSILON_DISTANCE = 0.01f;
+    for (int i = 0; i < emitter.size(); i++) {
+        float t = emitter.getLifetime(i);
+        glm::vec3 expectedPosition = EMIT_VELOCITY * t + 0.5f * ACCELERATION * t * t;
+        QVERIFY(glm::distance(emitter.getRelativePosition(i), expectedPosition) < EPSILON_DISTANCE);
+        QVERIFY(glm::distance(emitter.getVelocity(i), EMIT_VELOCITY + ACCELERATION * t) < EPSILON_DISTANCE);
+    }
+
+    // the vertices are in world space, or left behind when trailing
+    Transform transform;
+    transform.setTranslation(glm::vec3(1.0f, 2.0f, 3.0f));
+    particle::Emitter::Vertices vertices;
+    emitter.getVertices(vertices, transform.getTranslation(), false);
+    QCOMPARE((int)vertices.size(), emitter.size());
+    for (int i = 0; i < emitter.size(); i++) {
+        QVERIFY(glm::distance(vertices[i].xyz, emitter.getRelativePosition(i) + transform.getTranslation()) < EPSILON_DISTANCE);
+        QCOMPARE(vertices[i].uv.x, emitter.getLifetime(i));
+    }
+    emitter.getVertices(vertices, transform.getTranslation(), true);
+    for (int i = 0; i < emitter.size(); i++) {
+        QVERIFY(glm::distance(vertices[i].xyz, emitter.getRelativePosition(i)) < EPSILON_DISTANCE);
+    }
+}
+
+void ParticleEmitterTests::emitsFromShapes() {
+    // particles start on the surface of the shape, or inside it when radiusStart < 1
+    particle::Properties properties = createProperties(600.0f, 10.0f, 10000);
+    properties.emission.speed = { 0.0f, 0.0f };
+    properties.emission.dimensions = glm::vec3(2.0f, 4.0f, 6.0f);
+    properties.polar = { 0.0f, PI };
+    properties.radiusStart = 1.0f;
+
+    const ShapeType SHAPE_TYPES[] = { SHAPE_TYPE_BOX, SHAPE_TYPE_SPHERE, SHAPE_TYPE_ELLIPSOID,
+                                      SHAPE_TYPE_CYLINDER_Y, SHAPE_TYPE_CIRCLE, SHAPE_TYPE_PLANE };
+    const float EPSILON_DISTANCE = 0.001f;
+    for (ShapeType shapeType : SHAPE_TYPES) {
+        particle::Emitter emitter(1234);
+        uint64_t now = START_USECS;
+        stepFrames(emitter, properties, 10, now, Transform(), shapeType);
+        QVERIFY(emitter.size() > 0);
+        glm::vec3 halfDimensions = 0.5f * properties.emission.dimensions + glm::vec3(EPSILON_DISTANCE);
+        for (int i = 0; i < emitter.size(); i++) {
+            glm::vec3 position = emitter.getRelativePosition(i);
+            QVERIFY(glm::all(glm::lessThanEqual(glm::abs(position), halfDimensions)));
+        }
+    }
+}
+
+void ParticleEmitterTests::benchmarkStep() {
+    // dozens of emitters at thousands of particles each
+    const int NUM_EMITTERS = 50;
+    const uint32_t MAX_PARTICLES = 5000;
+    const int NUM_FRAMES = 100;
+
+    particle::Properties properties = createProperties(2000.0f, 3.0f, MAX_PARTICLES);
+    properties.emission.speed = { 1.0f, 0.5f };
+    properties.emission.acceleration = { glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.5f) };
+    properties.emission.dimensions = glm::vec3(1.0f);
+    properties.polar = { 0.0f, PI };
+
+    std::vector<particle::Emitter> emitters;
+    for (int i = 0; i < NUM_EMITTERS; i++) {
+        emitters.emplace_back(i + 1);
+    }
+    uint64_t now = START_USECS;
+    for (auto& emitter : emitters) {
+        uint64_t emitterNow = START_USECS;
+        stepFrames(emitter, properties, 300, emitterNow);
+        now = emitterNow;
+    }
+
+    particle::Emitter::Vertices vertices;
+    particle::Emitter::TriangleInfo triangleInfo;
+    Transform transform;
+    uint64_t numParticlesStepped = 0;
+    QElapsedTimer timer;
+    timer.start();
+    QBENCHMARK {
+        for (int frame = 0; frame < NUM_FRAMES; frame++) {
+            now += FRAME_USECS;
+            for (auto& emitter : emitters) {
+                emitter.step(now, FRAME_USECS, true, properties, transform, SHAPE_TYPE_ELLIPSOID, triangleInfo);
+                emitter.getVertices(vertices, transform.getTranslation(), false);
+                numParticlesStepped += emitter.size();
+            }
+        }
+    }
+    qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+    qDebug() << "particles/ms:" << numParticlesStepped / (uint64_t)elapsed << "with" << NUM_EMITTERS << "emitters of"
+        << emitters[0].size() << "particles";
+    QVERIFY(numParticlesStepped > 0);
+}
@@ -0,0 +1,28 @@
+//
+//  ParticleEmitterTests.h
+//  tests/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ParticleEmitterTests_h
+#define hifi_ParticleEmitterTests_h
+
+#include <QtTest/QtTest>
+
+class ParticleEmitterTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void emitsAtRate();
+    void killsExpiredAndExtraParticles();
+    void integratesBallistically();
+    void emitsFromShapes();
+
+    void benchmarkStep();
+};
+
+#endif // hifi_ParticleEmitterTests_h
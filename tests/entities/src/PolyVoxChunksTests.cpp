@@ -0,0 +1,364 @@
+//
+//  PolyVoxChunksTests.cpp
+//  tests/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PolyVoxChunksTests.h"
+
+#include <algorithm>
+#include <array>
+#include <set>
+
+#include <QElapsedTimer>
+
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning( disable : 4267 )
+#endif
+#include <PolyVoxCore/CubicSurfaceExtractorWithNormals.h>
+#include <PolyVoxCore/MarchingCubesSurfaceExtractor.h>
+#include <PolyVoxCore/Material.h>
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+
+#include <NumericalConstants.h>
+#include <PolyVoxChunks.h>
+
+QTEST_MAIN(PolyVoxChunksTests)
+
+using Volume = PolyVoxChunks::Volume;
+using Vertex = PolyVoxChunks::Vertex;
+using SurfaceStyle = PolyVoxChunks::SurfaceStyle;
+
+static const int VOLUME_SIZE = 64;
+// above the threshold of the marching cubes extractor, as voxels set from scripts are
+static const uint8_t SOLID = 255;
+static const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5f;
+
+static std::unique_ptr<Volume> createVolume() {
+    // the same layout as a non-edged polyvox entity of VOLUME_SIZE^3 voxels
+    std::unique_ptr<Volume> volume(new Volume(PolyVox::Region(PolyVox::Vector3DInt32(0, 0, 0),
+                                                              PolyVox::Vector3DInt32(VOLUME_SIZE, VOLUME_SIZE, VOLUME_SIZE))));
+    volume->setBorderValue(255);
+    return volume;
+}
+
+// sets the voxels of a sphere, and marks them like RenderablePolyVoxEntityItem does
+static void setSphere(Volume& volume, PolyVoxChunks* chunks, const glm::vec3& center, float radius, uint8_t value) {
+    glm::ivec3 low = glm::max(glm::ivec3(glm::floor(center - radius)), glm::ivec3(0));
+    glm::ivec3 high = glm::min(glm::ivec3(glm::ceil(center + radius)), glm::ivec3(VOLUME_SIZE - 1));
+    glm::ivec3 v;
+    for (v.z = low.z; v.z <= high.z; v.z++) {
+        for (v.y = low.y; v.y <= high.y; v.y++) {
+            for (v.x = low.x; v.x <= high.x; v.x++) {
+                if (glm::distance(glm::vec3(v), center) <= radius && volume.getVoxelAt(v.x, v.y, v.z) != value) {
+                    volume.setVoxelAt(v.x, v.y, v.z, value);
+                    if (chunks) {
+                        chunks->markVoxelDirty(v);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// rolling terrain, filled up to a height that varies over x and z
+static void setTerrain(Volume& volume) {
+    for (int z = 0; z < VOLUME_SIZE; z++) {
+        for (int x = 0; x < VOLUME_SIZE; x++) {
+            int height = VOLUME_SIZE / 2 + (int)(8.0f * sinf(0.2f * x) * cosf(0.15f * z));
+            for (int y = 0; y < height; y++) {
+                volume.setVoxelAt(x, y, z, SOLID);
+            }
+        }
+    }
+}
+
+static glm::vec3 toGlm(const PolyVox::Vector3DFloat& v) {
+    return glm::vec3(v.getX(), v.getY(), v.getZ());
+}
+
+static bool isMarchingCubes(SurfaceStyle surfaceStyle) {
+    return surfaceStyle == PolyVoxEntityItem::SURFACE_MARCHING_CUBES ||
+        surfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES;
+}
+
+// the surface as RenderablePolyVoxEntityItem::recomputeMesh extracted it before chunking, from the whole volume at once
+static void extractWholeVolume(Volume& volume, SurfaceStyle surfaceStyle,
+                               std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    PolyVox::SurfaceMesh<Vertex> polyVoxMesh;
+    if (isMarchingCubes(surfaceStyle)) {
+        PolyVox::MarchingCubesSurfaceExtractor<Volume> surfaceExtractor(&volume, volume.getEnclosingRegion(), &polyVoxMesh);
+        surfaceExtractor.execute();
+    } else {
+        PolyVox::CubicSurfaceExtractorWithNormals<Volume> surfaceExtractor(&volume, volume.getEnclosingRegion(), &polyVoxMesh);
+        surfaceExtractor.execute();
+    }
+    vertices = polyVoxMesh.getRawVertexData();
+    indices = polyVoxMesh.getIndices();
+}
+
+// the collision hulls as RenderablePolyVoxEntityItem::computeShapeInfoWorker built them before chunking, for a non-edged
+// entity in voxel coordinates
+static void computeWholeVolumeHulls(Volume& volume, SurfaceStyle surfaceStyle, const std::vector<Vertex>& vertices,
+                                    const std::vector<uint32_t>& indices, ShapeInfo::PointCollection& hulls) {
+    hulls.clear();
+    if (isMarchingCubes(surfaceStyle)) {
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            glm::vec3 p0 = toGlm(vertices[indices[i]].getPosition());
+            glm::vec3 p1 = toGlm(vertices[indices[i + 1]].getPosition());
+            glm::vec3 p2 = toGlm(vertices[indices[i + 2]].getPosition());
+            glm::vec3 av = (p0 + p1 + p2) / 3.0f;
+            glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+            hulls.push_back({ p0, p1, p2, av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET });
+        }
+        return;
+    }
+
+    glm::ivec3 v;
+    for (v.z = 0; v.z < VOLUME_SIZE; v.z++) {
+        for (v.y = 0; v.y < VOLUME_SIZE; v.y++) {
+            for (v.x = 0; v.x < VOLUME_SIZE; v.x++) {
+                if (volume.getVoxelAt(v.x, v.y, v.z) == 0) {
+                    continue;
+                }
+                if (glm::all(glm::greaterThan(v, glm::ivec3(0))) &&
+                    glm::all(glm::lessThan(v, glm::ivec3(VOLUME_SIZE - 1))) &&
+                    volume.getVoxelAt(v.x - 1, v.y, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y - 1, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y, v.z - 1) > 0 &&
+                    volume.getVoxelAt(v.x + 1, v.y, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y + 1, v.z) > 0 &&
+                    volume.getVoxelAt(v.x, v.y, v.z + 1) > 0) {
+                    continue;
+                }
+                glm::vec3 l(glm::vec3(v) - 0.5f);
+                glm::vec3 h(glm::vec3(v) + 0.5f);
+                hulls.push_back({
+                    glm::vec3(l.x, l.y, l.z), glm::vec3(l.x, l.y, h.z), glm::vec3(l.x, h.y, l.z), glm::vec3(l.x, h.y, h.z),
+                    glm::vec3(h.x, l.y, l.z), glm::vec3(h.x, l.y, h.z), glm::vec3(h.x, h.y, l.z), glm::vec3(h.x, h.y, h.z)
+                });
+            }
+        }
+    }
+}
+
+// The vertices of both extractors lie on the edges of the voxel grid, at a voxel or between two, so snapping them to a
+// finer grid tells them apart while absorbing the rounding of the chunks, which extract relative to their own corner.
+using GridPoint = std::array<int, 3>;
+static const float GRID_RESOLUTION = 8.0f;
+static const float POINT_EPSILON = 1.0e-4f;
+
+static GridPoint toGridPoint(const glm::vec3& p) {
+    glm::ivec3 q(glm::round(p * GRID_RESOLUTION));
+    return {{ q.x, q.y, q.z }};
+}
+
+struct Triangle {
+    std::array<GridPoint, 3> positions;
+    std::array<glm::vec3, 3> normals;
+    bool operator<(const Triangle& other) const { return positions < other.positions; }
+};
+
+// the triangles of a mesh by the positions of their corners, starting from the lowest one to keep the winding, so that
+// meshes that only differ in how their vertices are shared compare equal
+static std::vector<Triangle> getTriangles(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+    std::vector<Triangle> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        Triangle corners;
+        for (int j = 0; j < 3; j++) {
+            const Vertex& vertex = vertices[indices[i + j]];
+            corners.positions[j] = toGridPoint(toGlm(vertex.getPosition()));
+            corners.normals[j] = toGlm(vertex.getNormal());
+        }
+        int first = (int)(std::min_element(corners.positions.begin(), corners.positions.end()) - corners.positions.begin());
+        Triangle triangle;
+        for (int j = 0; j < 3; j++) {
+            triangle.positions[j] = corners.positions[(first + j) % 3];
+            triangle.normals[j] = corners.normals[(first + j) % 3];
+        }
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+static void compareMeshes(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                          const std::vector<Vertex>& expectedVertices, const std::vector<uint32_t>& expectedIndices) {
+    for (auto index : indices) {
+        QVERIFY(index < vertices.size());
+    }
+    std::vector<Triangle> triangles = getTriangles(vertices, indices);
+    std::vector<Triangle> expectedTriangles = getTriangles(expectedVertices, expectedIndices);
+    QCOMPARE(triangles.size(), expectedTriangles.size());
+    for (size_t i = 0; i < triangles.size(); i++) {
+        QVERIFY(triangles[i].positions == expectedTriangles[i].positions);
+        for (int j = 0; j < 3; j++) {
+            QVERIFY(glm::distance(triangles[i].normals[j], expectedTriangles[i].normals[j]) < POINT_EPSILON);
+        }
+    }
+
+    // the chunks only add the copies of the vertices on their seams
+    std::set<GridPoint> positions, expectedPositions;
+    for (const auto& vertex : vertices) {
+        positions.insert(toGridPoint(toGlm(vertex.getPosition())));
+    }
+    for (const auto& vertex : expectedVertices) {
+        expectedPositions.insert(toGridPoint(toGlm(vertex.getPosition())));
+    }
+    QVERIFY(positions == expectedPositions);
+    QVERIFY(vertices.size() >= expectedVertices.size());
+}
+
+// A marching cubes hull is a triangle of the surface and a point behind it, and a cubic hull is the corners of a voxel,
+// so the first three points of a hull identify it; they are compared in any order, as the triangles are.
+struct Hull {
+    std::array<GridPoint, 3> key;
+    ShapeInfo::PointList points;
+    bool operator<(const Hull& other) const { return key < other.key; }
+};
+
+static std::vector<Hull> getHulls(const ShapeInfo::PointCollection& pointCollection) {
+    std::vector<Hull> hulls;
+    for (const auto& points : pointCollection) {
+        Hull hull;
+        for (int j = 0; j < 3; j++) {
+            hull.key[j] = toGridPoint(points[j]);
+        }
+        std::sort(hull.key.begin(), hull.key.end());
+        hull.points = points;
+        hulls.push_back(hull);
+    }
+    std::sort(hulls.begin(), hulls.end());
+    return hulls;
+}
+
+static void compareHulls(const ShapeInfo::PointCollection& pointCollection,
+                         const ShapeInfo::PointCollection& expectedPointCollection) {
+    std::vector<Hull> hulls = getHulls(pointCollection);
+    std::vector<Hull> expectedHulls = getHulls(expectedPointCollection);
+    QCOMPARE(hulls.size(), expectedHulls.size());
+    for (size_t i = 0; i < hulls.size(); i++) {
+        QVERIFY(hulls[i].key == expectedHulls[i].key);
+        QCOMPARE(hulls[i].points.size(), expectedHulls[i].points.size());
+        for (size_t j = 3; j < hulls[i].points.size(); j++) {
+            QVERIFY(glm::distance(hulls[i].points[j], expectedHulls[i].points[j]) < POINT_EPSILON);
+        }
+    }
+}
+
+void PolyVoxChunksTests::marksOnlyTouchedChunks() {
+    auto volume = createVolume();
+    PolyVoxChunks chunks;
+    QVERIFY(chunks.hasDirtyChunks());
+
+    const int CHUNKS_PER_AXIS = VOLUME_SIZE / PolyVoxChunks::CHUNK_SIZE;
+    const int NUM_CHUNKS = CHUNKS_PER_AXIS * CHUNKS_PER_AXIS * CHUNKS_PER_AXIS;
+    QCOMPARE(chunks.extract(*volume, PolyVoxEntityItem::SURFACE_MARCHING_CUBES), NUM_CHUNKS);
+    QCOMPARE(chunks.getNumChunks(), NUM_CHUNKS);
+    QVERIFY(!chunks.hasDirtyChunks());
+
+    // inside a chunk
+    const int MIDDLE = PolyVoxChunks::CHUNK_SIZE / 2;
+    chunks.markVoxelDirty(glm::ivec3(MIDDLE));
+    QCOMPARE(chunks.getNumDirtyChunks(), 1);
+    QCOMPARE(chunks.extract(*volume, PolyVoxEntityItem::SURFACE_MARCHING_CUBES), 1);
+
+    // on the corner of 8 chunks
+    chunks.markVoxelDirty(glm::ivec3(PolyVoxChunks::CHUNK_SIZE));
+    QCOMPARE(chunks.getNumDirtyChunks(), 8);
+    QCOMPARE(chunks.extract(*volume, PolyVoxEntityItem::SURFACE_MARCHING_CUBES), 8);
+
+    // a change of style extracts everything again
+    QCOMPARE(chunks.extract(*volume, PolyVoxEntityItem::SURFACE_CUBIC), NUM_CHUNKS);
+    QCOMPARE(chunks.extract(*volume, PolyVoxEntityItem::SURFACE_CUBIC), 0);
+}
+
+void PolyVoxChunksTests::incrementalMatchesFullExtraction() {
+    const SurfaceStyle SURFACE_STYLES[] = { PolyVoxEntityItem::SURFACE_MARCHING_CUBES, PolyVoxEntityItem::SURFACE_CUBIC };
+    for (auto surfaceStyle : SURFACE_STYLES) {
+        auto volume = createVolume();
+        setTerrain(*volume);
+        PolyVoxChunks chunks;
+        chunks.extract(*volume, surfaceStyle);
+
+        // dig and fill across chunk boundaries
+        setSphere(*volume, &chunks, glm::vec3(16.0f, 30.0f, 16.0f), 5.0f, 0);
+        setSphere(*volume, &chunks, glm::vec3(40.0f, 40.0f, 24.0f), 3.5f, SOLID);
+        setSphere(*volume, &chunks, glm::vec3(63.0f, 33.0f, 0.0f), 4.0f, 0);
+        QVERIFY(chunks.extract(*volume, surfaceStyle) < chunks.getNumChunks());
+
+        std::vector<Vertex> vertices, expectedVertices;
+        std::vector<uint32_t> indices, expectedIndices;
+        chunks.getMesh(vertices, indices);
+        extractWholeVolume(*volume, surfaceStyle, expectedVertices, expectedIndices);
+        QVERIFY(!expectedIndices.empty());
+        compareMeshes(vertices, indices, expectedVertices, expectedIndices);
+
+        ShapeInfo::PointCollection hulls, expectedHulls;
+        AABox box;
+        chunks.getCollisionHulls(glm::mat4(), hulls, box);
+        computeWholeVolumeHulls(*volume, surfaceStyle, expectedVertices, expectedIndices, expectedHulls);
+        QVERIFY(!expectedHulls.empty());
+        compareHulls(hulls, expectedHulls);
+    }
+}
+
+void PolyVoxChunksTests::benchmarkRemesh() {
+    // small brush strokes over terrain, as an editing tool makes them
+    const int NUM_EDITS = 50;
+    const float BRUSH_RADIUS = 3.0f;
+
+    const SurfaceStyle SURFACE_STYLES[] = { PolyVoxEntityItem::SURFACE_MARCHING_CUBES, PolyVoxEntityItem::SURFACE_CUBIC };
+    const char* SURFACE_STYLE_NAMES[] = { "marching cubes", "cubic" };
+    for (int style = 0; style < 2; style++) {
+        auto surfaceStyle = SURFACE_STYLES[style];
+        auto volume = createVolume();
+        setTerrain(*volume);
+
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        ShapeInfo::PointCollection hulls;
+        AABox box;
+
+        // every edit extracts the whole volume in one pass and rebuilds every hull, as before chunking
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < NUM_EDITS; i++) {
+            glm::vec3 center((float)(i * 7 % VOLUME_SIZE), (float)(VOLUME_SIZE / 2), (float)(i * 13 % VOLUME_SIZE));
+            setSphere(*volume, nullptr, center, BRUSH_RADIUS, i % 2 ? SOLID : 0);
+            extractWholeVolume(*volume, surfaceStyle, vertices, indices);
+            computeWholeVolumeHulls(*volume, surfaceStyle, vertices, indices, hulls);
+        }
+        float fullMsecsPerEdit = (float)timer.nsecsElapsed() / (NUM_EDITS * NSECS_PER_MSEC);
+
+        // only the chunks touched by each edit
+        PolyVoxChunks chunks;
+        auto remesh = [&] {
+            chunks.extract(*volume, surfaceStyle);
+            chunks.getMesh(vertices, indices);
+            chunks.getCollisionHulls(glm::mat4(), hulls, box);
+        };
+        remesh();
+        int numChunksExtracted = 0;
+        timer.restart();
+        for (int i = 0; i < NUM_EDITS; i++) {
+            glm::vec3 center((float)(i * 7 % VOLUME_SIZE), (float)(VOLUME_SIZE / 2), (float)(i * 13 % VOLUME_SIZE));
+            setSphere(*volume, &chunks, center, BRUSH_RADIUS, (i + 1) % 2 ? SOLID : 0);
+            numChunksExtracted += chunks.getNumDirtyChunks();
+            remesh();
+        }
+        float incrementalMsecsPerEdit = (float)timer.nsecsElapsed() / (NUM_EDITS * NSECS_PER_MSEC);
+
+        qDebug() << SURFACE_STYLE_NAMES[style] << "remesh ms/edit, whole volume:" << fullMsecsPerEdit
+            << "incremental:" << incrementalMsecsPerEdit << "chunks/edit:" << (float)numChunksExtracted / NUM_EDITS
+            << "of" << chunks.getNumChunks();
+        QVERIFY(!indices.empty());
+    }
+}
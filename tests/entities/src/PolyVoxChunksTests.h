@@ -0,0 +1,26 @@
+//
+//  PolyVoxChunksTests.h
+//  tests/entities/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PolyVoxChunksTests_h
+#define hifi_PolyVoxChunksTests_h
+
+#include <QtTest/QtTest>
+
+class PolyVoxChunksTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void marksOnlyTouchedChunks();
+    void incrementalMatchesFullExtraction();
+
+    void benchmarkRemesh();
+};
+
+#endif // hifi_PolyVoxChunksTests_h
@@ -0,0 +1,142 @@
+//
+//  FBXParserTests.cpp
+//  tests/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FBXParserTests.h"
+
+#include <FBX.h>
+#include <FBXSerializer.h>
+#include <FBXWriter.h>
+
+QTEST_MAIN(FBXParserTests)
+
+// arrays this large are compressed by FBXWriter
+static const int NUM_VERTICES = 20000;
+
+static FBXNode createGeometry(int id, int numVertices) {
+    QVector<double> vertices;
+    QVector<qint32> indices;
+    QVector<float> weights;
+    for (int i = 0; i < numVertices; i++) {
+        vertices << 0.5 * i << -0.25 * i << (double)(i % 17);
+        indices << ((i % 3 == 2) ? ~i : i);
+        weights << (float)(i % 5) / 4.0f;
+    }
+
+    FBXNode verticesNode;
+    verticesNode.name = "Vertices";
+    verticesNode.properties << QVariant::fromValue(vertices);
+
+    FBXNode indicesNode;
+    indicesNode.name = "PolygonVertexIndex";
+    indicesNode.properties << QVariant::fromValue(indices);
+
+    FBXNode weightsNode;
+    weightsNode.name = "Weights";
+    weightsNode.properties << QVariant::fromValue(weights);
+
+    // small enough to be stored uncompressed
+    FBXNode versionNode;
+    versionNode.name = "GeometryVersion";
+    versionNode.properties << QVariant::fromValue(QVector<double>({ 1.0, 2.0, 3.0 }));
+
+    FBXNode geometry;
+    geometry.name = "Geometry";
+    geometry.properties << QVariant::fromValue((qint64)id) << QByteArray("Geometry::Mesh") << QByteArray("Mesh");
+    geometry.children << verticesNode << indicesNode << weightsNode << versionNode;
+    return geometry;
+}
+
+static QByteArray createFile(int numGeometries, int numVertices) {
+    FBXNode scalars;
+    scalars.name = "Scalars";
+    scalars.properties << QVariant::fromValue((qint16)-7) << true << 42 << 1.5f << 2.25 << QVariant::fromValue((qint64)1 << 40);
+
+    FBXNode objects;
+    objects.name = "Objects";
+    for (int i = 0; i < numGeometries; i++) {
+        objects.children << createGeometry(i, numVertices);
+    }
+
+    FBXNode root;
+    root.children << scalars << objects;
+    return FBXWriter::encodeFBX(root);
+}
+
+template <class T>
+static void compareArrays(const QVariant& actual, const QVariant& expected) {
+    QVERIFY(actual.canConvert<QVector<T>>());
+    QCOMPARE(actual.value<QVector<T>>(), expected.value<QVector<T>>());
+}
+
+void FBXParserTests::roundTrip() {
+    FBXNode root = FBXSerializer::parseFBX(createFile(2, NUM_VERTICES));
+
+    QCOMPARE(root.children.size(), 2);
+    const FBXNode& scalars = root.children.at(0);
+    QCOMPARE(scalars.name, QByteArray("Scalars"));
+    QCOMPARE(scalars.properties.size(), 6);
+    QCOMPARE(scalars.properties.at(0).value<qint16>(), (qint16)-7);
+    QCOMPARE(scalars.properties.at(1).toBool(), true);
+    QCOMPARE(scalars.properties.at(2).toInt(), 42);
+    QCOMPARE(scalars.properties.at(3).toFloat(), 1.5f);
+    QCOMPARE(scalars.properties.at(4).toDouble(), 2.25);
+    QCOMPARE(scalars.properties.at(5).toLongLong(), (qint64)1 << 40);
+
+    const FBXNode& objects = root.children.at(1);
+    QCOMPARE(objects.children.size(), 2);
+    for (int i = 0; i < objects.children.size(); i++) {
+        const FBXNode& actual = objects.children.at(i);
+        FBXNode expected = createGeometry(i, NUM_VERTICES);
+        QCOMPARE(actual.name, expected.name);
+        QCOMPARE(actual.properties.at(0).toLongLong(), (qint64)i);
+        QCOMPARE(actual.properties.at(1).toByteArray(), QByteArray("Geometry::Mesh"));
+        QCOMPARE(actual.children.size(), expected.children.size());
+        compareArrays<double>(actual.children.at(0).properties.at(0), expected.children.at(0).properties.at(0));
+        compareArrays<qint32>(actual.children.at(1).properties.at(0), expected.children.at(1).properties.at(0));
+        compareArrays<float>(actual.children.at(2).properties.at(0), expected.children.at(2).properties.at(0));
+        compareArrays<double>(actual.children.at(3).properties.at(0), expected.children.at(3).properties.at(0));
+
+        // the serializer reads the same arrays
+        QCOMPARE(FBXSerializer::getDoubleVector(actual.children.at(0)).size(), NUM_VERTICES * 3);
+        QCOMPARE(FBXSerializer::getIntVector(actual.children.at(1)).size(), NUM_VERTICES);
+    }
+}
+
+void FBXParserTests::truncatedFile() {
+    QByteArray data = createFile(1, NUM_VERTICES);
+    data.truncate(data.size() / 2);
+    QVERIFY_EXCEPTION_THROWN(FBXSerializer::parseFBX(data), QString);
+}
+
+void FBXParserTests::corruptArray() {
+    QByteArray data = createFile(1, NUM_VERTICES);
+
+    // overwrite the zlib header of the first compressed array
+    int offset = data.indexOf("Vertices");
+    QVERIFY(offset > 0);
+    const int ARRAY_HEADER_SIZE = 1 + 3 * sizeof(quint32);
+    offset += (int)strlen("Vertices") + ARRAY_HEADER_SIZE;
+    data[offset] = 0;
+    data[offset + 1] = 0;
+    QVERIFY_EXCEPTION_THROWN(FBXSerializer::parseFBX(data), QString);
+}
+
+void FBXParserTests::benchmarkParse() {
+    // about the size of a detailed avatar
+    const int NUM_GEOMETRIES = 40;
+    const int NUM_GEOMETRY_VERTICES = 50000;
+    QByteArray data = createFile(NUM_GEOMETRIES, NUM_GEOMETRY_VERTICES);
+
+    FBXNode root;
+    QBENCHMARK {
+        root = FBXSerializer::parseFBX(data);
+    }
+    QCOMPARE(root.children.at(1).children.size(), NUM_GEOMETRIES);
+}
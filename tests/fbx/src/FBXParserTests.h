@@ -0,0 +1,26 @@
+//
+//  FBXParserTests.h
+//  tests/fbx/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_FBXParserTests_h
+#define hifi_FBXParserTests_h
+
+#include <QtTest/QtTest>
+
+class FBXParserTests : public QObject {
+    Q_OBJECT
+private slots:
+    void roundTrip();
+    void truncatedFile();
+    void corruptArray();
+
+    void benchmarkParse();
+};
+
+#endif // hifi_FBXParserTests_h
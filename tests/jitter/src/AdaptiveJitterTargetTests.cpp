@@ -0,0 +1,323 @@
+//
+//  AdaptiveJitterTargetTests.cpp
+//  tests/jitter/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AdaptiveJitterTargetTests.h"
+
+#include <random>
+#include <vector>
+
+#include <AdaptiveJitterTarget.h>
+#include <AudioConstants.h>
+#include <InboundAudioStream.h>
+#include <NumericalConstants.h>
+#include <ReceivedMessage.h>
+#include <SharedUtil.h>
+#include <udt/PacketHeaders.h>
+
+QTEST_MAIN(AdaptiveJitterTargetTests)
+
+static const quint64 FRAME_USECS = AudioConstants::NETWORK_FRAME_USECS;
+static const int TRACE_PACKETS = 6000; // ~64s
+
+static const float TIME_SCALE_FRAMES = 1.0f / AdaptiveJitterTarget::TIME_SCALE_FRACTION;
+// InboundAudioStream completes the intervals of its reduction window once per second
+static const quint64 REDUCTION_INTERVAL_USECS = USECS_PER_SECOND;
+static const quint64 NO_STARVE_WINDOW_USECS = InboundAudioStream::WINDOW_SECONDS_FOR_DESIRED_REDUCTION * USECS_PER_SECOND;
+
+// An arrival trace is the receive timestamp of each packet, in usecs. A lost packet is recorded as 0.
+using ArrivalTrace = std::vector<quint64>;
+
+struct ReplayResult {
+    int starves { 0 };
+    int starvesInSecondHalf { 0 };
+    int maxDesiredFrames { 0 };
+    int finalDesiredFrames { 0 };
+    float averageFramesInLastQuarter { 0.0f };
+};
+
+// Replays a trace through AdaptiveJitterTarget, with a playout clock popping one frame per FRAME_USECS.
+// The desired frames and the time-scaling come from the policy InboundAudioStream uses; only the buffer is modeled.
+static ReplayResult replayTrace(const ArrivalTrace& trace, AdaptiveJitterTarget* jitterTargetOut = nullptr) {
+    AdaptiveJitterTarget localJitterTarget;
+    AdaptiveJitterTarget& jitterTarget = jitterTargetOut ? *jitterTargetOut : localJitterTarget;
+
+    ReplayResult result;
+    int desiredFrames = 1;
+    float framesAvailable = 0.0f;
+    bool isStarved = true;
+    quint64 lastStarve = 0;
+    quint64 nextReduction = REDUCTION_INTERVAL_USECS;
+
+    quint64 lastArrival = trace.front();
+    int lostSinceLastArrival = 0;
+    size_t nextPacket = 0;
+
+    quint64 traceEnd = trace.back();
+    float framesSum = 0.0f;
+    int framesSamples = 0;
+
+    for (quint64 now = trace.front(); now < traceEnd; now += FRAME_USECS) {
+        // receive
+        for (; nextPacket < trace.size() && trace[nextPacket] <= now; nextPacket++) {
+            if (trace[nextPacket] == 0) {
+                lostSinceLastArrival++;
+                continue;
+            }
+            if (nextPacket > 0) {
+                jitterTarget.updateWithArrivalGap(trace[nextPacket] - lastArrival, 1 + lostSinceLastArrival);
+            }
+            lastArrival = trace[nextPacket];
+            framesAvailable += 1.0f + lostSinceLastArrival; // lost packets are filled with silence
+            lostSinceLastArrival = 0;
+
+            bool canReduce = now >= nextReduction;
+            bool starvedInWindow = lastStarve != 0 && now - lastStarve < NO_STARVE_WINDOW_USECS;
+            desiredFrames = jitterTarget.updateDesiredFrames(desiredFrames, canReduce, starvedInWindow);
+            if (canReduce) {
+                nextReduction = now + REDUCTION_INTERVAL_USECS;
+            }
+        }
+        result.maxDesiredFrames = std::max(result.maxDesiredFrames, desiredFrames);
+
+        // pop
+        if (isStarved) {
+            if (framesAvailable < desiredFrames) {
+                continue;
+            }
+            isStarved = false;
+        }
+        if (framesAvailable < 1.0f) {
+            isStarved = true;
+            lastStarve = now;
+            result.starves++;
+            if (now - trace.front() > (traceEnd - trace.front()) / 2) {
+                result.starvesInSecondHalf++;
+            }
+            continue;
+        }
+
+        // time-scale, then pop
+        AdaptiveJitterTarget::TimeScale timeScale = jitterTarget.updateTimeScale((int)framesAvailable, desiredFrames);
+        if (timeScale == AdaptiveJitterTarget::COMPRESS && framesAvailable >= 1.0f + TIME_SCALE_FRAMES) {
+            framesAvailable -= TIME_SCALE_FRAMES;
+        } else if (timeScale == AdaptiveJitterTarget::STRETCH) {
+            framesAvailable += TIME_SCALE_FRAMES;
+        }
+        framesAvailable -= 1.0f;
+
+        if (now - trace.front() > 3 * (traceEnd - trace.front()) / 4) {
+            framesSum += framesAvailable;
+            framesSamples++;
+        }
+    }
+
+    result.finalDesiredFrames = desiredFrames;
+    result.averageFramesInLastQuarter = framesSamples ? framesSum / framesSamples : 0.0f;
+    return result;
+}
+
+static ArrivalTrace createTrace(int numPackets, quint64 jitterUsecs, int burstPeriod, quint64 stallUsecs,
+                                int burstyPackets = TRACE_PACKETS) {
+    std::mt19937 generator(numPackets);
+    std::uniform_int_distribution<quint64> jitter(0, jitterUsecs);
+
+    ArrivalTrace trace(numPackets);
+    quint64 stallUntil = 0;
+    for (int i = 0; i < numPackets; i++) {
+        quint64 scheduled = USECS_PER_SECOND + i * FRAME_USECS;
+        if (burstPeriod && i < burstyPackets && i % burstPeriod == 0) {
+            stallUntil = scheduled + stallUsecs;
+        }
+        // a stalled link delivers everything queued during the stall at once
+        trace[i] = std::max(scheduled + jitter(generator), stallUntil);
+        if (i > 0) {
+            trace[i] = std::max(trace[i], trace[i - 1]);
+        }
+    }
+    return trace;
+}
+
+struct StreamReplayResult {
+    int starves { 0 };
+    int starvesInSecondHalf { 0 };
+    int maxDesiredFrames { 0 };
+    int finalDesiredFrames { 0 };
+};
+
+// InboundAudioStream reads the time with usecTimestampNow, so the stream replay moves it with the clock skew
+static void setSimulatedTime(quint64 usecs) {
+    usecTimestampNowForceClockSkew(0);
+    usecTimestampNowForceClockSkew((qint64)usecs - (qint64)usecTimestampNow());
+}
+
+// a mixed audio packet without a codec: sequence number, empty codec name, then a frame of silence
+static QByteArray createMixedAudioPacket(quint16 sequence) {
+    QByteArray packet;
+    packet.append(reinterpret_cast<const char*>(&sequence), sizeof(sequence));
+    uint32_t codecNameSize = 0;
+    packet.append(reinterpret_cast<const char*>(&codecNameSize), sizeof(codecNameSize));
+    packet.append(QByteArray(AudioConstants::NETWORK_FRAME_BYTES_STEREO, 0));
+    return packet;
+}
+
+// Replays a trace through an InboundAudioStream with a dynamic jitter buffer, as the audio client feeds and drains it:
+// every packet is parsed at its arrival time, and a frame is popped every FRAME_USECS.
+static StreamReplayResult replayTraceThroughStream(const ArrivalTrace& trace) {
+    const int STREAM_CAPACITY_FRAMES = 100;
+    InboundAudioStream stream(AudioConstants::STEREO, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL,
+                              STREAM_CAPACITY_FRAMES, -1);
+
+    StreamReplayResult result;
+    quint16 sequence = 0;
+    size_t nextPacket = 0;
+    quint64 traceEnd = trace.back();
+    quint64 traceMiddle = trace.front() + (traceEnd - trace.front()) / 2;
+    quint64 nextSecond = trace.front() + USECS_PER_SECOND;
+    int starvesAtMiddle = -1;
+
+    for (quint64 now = trace.front(); now < traceEnd; now += FRAME_USECS) {
+        for (; nextPacket < trace.size() && trace[nextPacket] <= now; nextPacket++, sequence++) {
+            if (trace[nextPacket] == 0) {
+                continue;
+            }
+            setSimulatedTime(trace[nextPacket]);
+            ReceivedMessage message(createMixedAudioPacket(sequence), PacketType::MixedAudio,
+                                    versionForPacketType(PacketType::MixedAudio), HifiSockAddr());
+            stream.parseData(message);
+        }
+
+        setSimulatedTime(now);
+        if (now >= nextSecond) {
+            stream.perSecondCallbackForUpdatingStats();
+            nextSecond += USECS_PER_SECOND;
+        }
+        stream.popFrames(1, true);
+
+        result.maxDesiredFrames = std::max(result.maxDesiredFrames, stream.getDesiredJitterBufferFrames());
+        if (starvesAtMiddle < 0 && now >= traceMiddle) {
+            starvesAtMiddle = stream.getStarveCount();
+        }
+    }
+    usecTimestampNowForceClockSkew(0);
+
+    result.starves = stream.getStarveCount();
+    result.starvesInSecondHalf = result.starves - starvesAtMiddle;
+    result.finalDesiredFrames = stream.getDesiredJitterBufferFrames();
+    return result;
+}
+
+void AdaptiveJitterTargetTests::steadyTrace() {
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 0, 0, 0);
+    ReplayResult result = replayTrace(trace);
+
+    QCOMPARE(result.starves, 0);
+    QCOMPARE(result.maxDesiredFrames, 1);
+    QVERIFY(result.averageFramesInLastQuarter < 2.0f);
+}
+
+void AdaptiveJitterTargetTests::uniformJitterTrace() {
+    // up to 3 frames of jitter, in-order
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 3 * FRAME_USECS, 0, 0);
+    ReplayResult result = replayTrace(trace);
+
+    QVERIFY(result.maxDesiredFrames >= 3);
+    QVERIFY(result.maxDesiredFrames <= 5);
+    QCOMPARE(result.starvesInSecondHalf, 0);
+}
+
+void AdaptiveJitterTargetTests::burstyTrace() {
+    // a 100ms stall every 2s, as seen on congested WAN links
+    const quint64 STALL_USECS = 100 * USECS_PER_MSEC;
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, FRAME_USECS / 4, 200, STALL_USECS);
+    ReplayResult result = replayTrace(trace);
+
+    // the frame already buffered covers the rest of the stall
+    int stallFrames = (int)(STALL_USECS / FRAME_USECS);
+    QVERIFY(result.finalDesiredFrames >= stallFrames - 1);
+    QVERIFY(result.finalDesiredFrames <= AdaptiveJitterTarget::MAX_TARGET_FRAMES);
+    QCOMPARE(result.starvesInSecondHalf, 0);
+}
+
+void AdaptiveJitterTargetTests::burstsEndTrace() {
+    // bursty for the first third, then steady: latency should come back down
+    const quint64 STALL_USECS = 100 * USECS_PER_MSEC;
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 0, 200, STALL_USECS, TRACE_PACKETS / 3);
+    ReplayResult result = replayTrace(trace);
+
+    QVERIFY(result.maxDesiredFrames >= (int)(STALL_USECS / FRAME_USECS));
+    QCOMPARE(result.finalDesiredFrames, 1);
+    // compression stops within the hysteresis band above desired + padding
+    QVERIFY(result.averageFramesInLastQuarter <= 1 + AdaptiveJitterTarget::DESIRED_PADDING_FRAMES + 1);
+}
+
+void AdaptiveJitterTargetTests::lostPacketsTrace() {
+    // losing 1 in 50 packets should not look like jitter. the first loss is a starve, since a lost packet
+    // is only known to be lost when the next one arrives.
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 0, 0, 0);
+    for (size_t i = 25; i < trace.size() - 1; i += 50) {
+        trace[i] = 0;
+    }
+    ReplayResult result = replayTrace(trace);
+
+    QCOMPARE(result.maxDesiredFrames, 1);
+    QCOMPARE(result.starvesInSecondHalf, 0);
+}
+
+void AdaptiveJitterTargetTests::latencyHistograms() {
+    AdaptiveJitterTarget jitterTarget;
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 3 * FRAME_USECS, 0, 0);
+    replayTrace(trace, &jitterTarget);
+
+    quint32 targetTotal = 0;
+    quint32 actualTotal = 0;
+    for (int i = 0; i < AdaptiveJitterTarget::LATENCY_HISTOGRAM_BINS; i++) {
+        targetTotal += jitterTarget.getTargetLatencyHistogram()[i];
+        actualTotal += jitterTarget.getActualLatencyHistogram()[i];
+    }
+    QVERIFY(targetTotal > 0);
+    QCOMPARE(targetTotal, actualTotal);
+    QCOMPARE(jitterTarget.getTargetLatencyHistogram()[0], (quint32)0);
+
+    jitterTarget.reset();
+    QCOMPARE(jitterTarget.getTargetLatencyHistogram()[3], (quint32)0);
+    QCOMPARE(jitterTarget.getTargetFrames(), 1);
+}
+
+void AdaptiveJitterTargetTests::streamSteadyTrace() {
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 0, 0, 0);
+    StreamReplayResult result = replayTraceThroughStream(trace);
+
+    QCOMPARE(result.starves, 0);
+    QCOMPARE(result.maxDesiredFrames, 1);
+}
+
+void AdaptiveJitterTargetTests::streamUniformJitterTrace() {
+    // up to 3 frames of jitter, in-order. the stream only measures arrivals after its first 1000 packets,
+    // so it starves until then, and must settle well before the second half.
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, 3 * FRAME_USECS, 0, 0);
+    StreamReplayResult result = replayTraceThroughStream(trace);
+
+    QVERIFY(result.starves > 0);
+    QVERIFY(result.maxDesiredFrames >= 3);
+    QVERIFY(result.maxDesiredFrames <= 6);
+    QCOMPARE(result.starvesInSecondHalf, 0);
+}
+
+void AdaptiveJitterTargetTests::streamBurstyTrace() {
+    // a 100ms stall every 2s
+    const quint64 STALL_USECS = 100 * USECS_PER_MSEC;
+    ArrivalTrace trace = createTrace(TRACE_PACKETS, FRAME_USECS / 4, 200, STALL_USECS);
+    StreamReplayResult result = replayTraceThroughStream(trace);
+
+    int stallFrames = (int)(STALL_USECS / FRAME_USECS);
+    QVERIFY(result.finalDesiredFrames >= stallFrames - 1);
+    QVERIFY(result.finalDesiredFrames <= AdaptiveJitterTarget::MAX_TARGET_FRAMES);
+    QCOMPARE(result.starvesInSecondHalf, 0);
+}
@@ -0,0 +1,30 @@
+//
+//  AdaptiveJitterTargetTests.h
+//  tests/jitter/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AdaptiveJitterTargetTests_h
+#define hifi_AdaptiveJitterTargetTests_h
+
+#include <QtTest/QtTest>
+
+class AdaptiveJitterTargetTests : public QObject {
+    Q_OBJECT
+private slots:
+    void steadyTrace();
+    void uniformJitterTrace();
+    void burstyTrace();
+    void burstsEndTrace();
+    void lostPacketsTrace();
+    void latencyHistograms();
+    void streamSteadyTrace();
+    void streamUniformJitterTrace();
+    void streamBurstyTrace();
+};
+
+#endif // hifi_AdaptiveJitterTargetTests_h
@@ -0,0 +1,369 @@
+//
+//  BakedModelFormatTests.cpp
+//  tests/model-serializers/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakedModelFormatTests.h"
+
+#include <cstring>
+
+#include <GLMHelpers.h>
+#include <graphics/Geometry.h>
+#include <graphics/Material.h>
+#include <hfm/HFM.h>
+#include <model-baker/BakedModelFormat.h>
+
+QTEST_MAIN(BakedModelFormatTests)
+
+static const int NUM_JOINTS = 3;
+static const int NUM_VERTICES = 300;
+
+// the offset of the version in the header, after the magic number
+static const int VERSION_OFFSET = 4;
+
+static hfm::Joint createJoint(int index) {
+    hfm::Joint joint;
+    joint.parentIndex = index - 1;
+    joint.distanceToParent = 0.5f * index;
+    joint.translation = glm::vec3(0.0f, 0.5f * index, 0.0f);
+    joint.preRotation = glm::angleAxis(0.25f * index, glm::vec3(1.0f, 0.0f, 0.0f));
+    joint.rotation = glm::angleAxis(0.5f * index, glm::vec3(0.0f, 1.0f, 0.0f));
+    joint.transform = glm::translate(glm::mat4(), joint.translation);
+    joint.rotationMin = glm::vec3(-1.0f);
+    joint.rotationMax = glm::vec3(1.0f);
+    joint.bindTransform = glm::scale(glm::mat4(), glm::vec3(1.0f + index));
+    joint.name = QString("joint%1").arg(index);
+    joint.isSkeletonJoint = true;
+    joint.bindTransformFoundInCluster = (index % 2) == 0;
+    joint.globalTransform = joint.transform;
+    joint.shapeInfo.avgPoint = glm::vec3(0.1f * index);
+    joint.shapeInfo.dots = { 1.0f, 2.0f, 3.0f };
+    joint.shapeInfo.points = { glm::vec3(1.0f), glm::vec3(-1.0f) };
+    return joint;
+}
+
+static hfm::Mesh createMesh() {
+    hfm::Mesh mesh;
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+    for (int i = 0; i < NUM_VERTICES; i++) {
+        glm::vec3 position(0.5f * i, -0.25f * i, (float)(i % 17));
+        positions.push_back(position);
+        indices.push_back((uint32_t)((i * 7) % NUM_VERTICES));
+        mesh.vertices << position;
+        mesh.normals << glm::vec3(0.0f, 1.0f, 0.0f);
+        mesh.texCoords << glm::vec2((float)i / NUM_VERTICES, 1.0f);
+        mesh.originalIndices << i;
+        mesh.clusterIndices.push_back((uint16_t)(i % NUM_JOINTS));
+        mesh.clusterWeights.push_back((uint16_t)0xffff);
+    }
+    mesh.clusterWeightsPerVertex = 1;
+
+    hfm::MeshPart part;
+    part.triangleIndices = QVector<int>::fromStdVector(std::vector<int>(indices.begin(), indices.end()));
+    mesh.parts.push_back(part);
+
+    hfm::Blendshape blendshape;
+    blendshape.indices << 0 << 5 << 9;
+    blendshape.vertices << glm::vec3(0.1f) << glm::vec3(0.2f) << glm::vec3(0.3f);
+    blendshape.normals << glm::vec3(0.0f, 0.0f, 1.0f) << glm::vec3(0.0f, 1.0f, 0.0f) << glm::vec3(1.0f, 0.0f, 0.0f);
+    mesh.blendshapes << blendshape;
+
+    mesh.triangleListMesh.vertices = positions;
+    mesh.triangleListMesh.indices = indices;
+    mesh.triangleListMesh.parts.push_back(glm::ivec2(0, (int)indices.size()));
+    mesh.triangleListMesh.partExtents.push_back(Extents(glm::vec3(-1.0f), glm::vec3(1.0f)));
+
+    mesh.meshExtents = Extents(glm::vec3(-2.0f), glm::vec3(2.0f));
+    mesh.modelTransform = glm::translate(glm::mat4(), glm::vec3(1.0f, 2.0f, 3.0f));
+    mesh.meshIndex = 0;
+    mesh._mesh = graphics::Mesh::createIndexedTriangles_P3F((uint32_t)positions.size(), (uint32_t)indices.size(),
+                                                            positions.data(), indices.data());
+    mesh._mesh->modelName = "model";
+    mesh._mesh->displayName = "mesh";
+    return mesh;
+}
+
+static hfm::Material createMaterial() {
+    hfm::Material material(glm::vec3(0.5f, 0.25f, 0.125f), glm::vec3(0.1f), glm::vec3(0.0f, 0.0f, 1.0f), 12.0f, 0.75f);
+    material.materialID = "material";
+    material.name = "Material";
+    material.roughness = 0.3f;
+    material.metallic = 0.6f;
+    material.alphaMode = graphics::MaterialKey::OPACITY_MAP_MASK;
+    material.isPBSMaterial = true;
+    material.useAlbedoMap = true;
+    material.albedoTexture.id = "albedo";
+    material.albedoTexture.name = "albedo";
+    material.albedoTexture.filename = "textures/albedo.png";
+    material.albedoTexture.content = QByteArray("\x89PNG\0\1\2", 7);
+    material.albedoTexture.sourceChannel = image::ColorChannel::RED;
+    material.albedoTexture.texcoordSet = 1;
+    material.albedoTexture.transform.setTranslation(glm::vec3(0.5f, 0.0f, 0.0f));
+
+    material._material = std::make_shared<graphics::Material>();
+    material._material->setName("Material");
+    material._material->setAlbedo(material.diffuseColor, false);
+    material._material->setRoughness(material.roughness);
+    material._material->setMetallic(material.metallic);
+    material._material->setOpacity(material.opacity);
+    material._material->setUnlit(true);
+    return material;
+}
+
+static hfm::Model createModel() {
+    hfm::Model model;
+    model.originalURL = "file:///model.fbx";
+    model.author = "author";
+    model.applicationName = "test";
+
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        model.joints.push_back(createJoint(i));
+        model.jointIndices.insert(model.joints.back().name, i + 1);
+    }
+    model.hasSkeletonJoints = true;
+
+    model.meshes.push_back(createMesh());
+    model.materials.push_back(createMaterial());
+
+    hfm::SkinDeformer skinDeformer;
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        hfm::Cluster cluster;
+        cluster.jointIndex = (uint32_t)i;
+        cluster.inverseBindMatrix = glm::inverse(model.joints[i].bindTransform);
+        cluster.inverseBindTransform = Transform(cluster.inverseBindMatrix);
+        skinDeformer.clusters.push_back(cluster);
+    }
+    model.skinDeformers.push_back(skinDeformer);
+
+    hfm::Shape shape;
+    shape.mesh = 0;
+    shape.meshPart = 0;
+    shape.material = 0;
+    shape.joint = 1;
+    shape.skinDeformer = 0;
+    shape.transformedExtents = Extents(glm::vec3(-3.0f), glm::vec3(3.0f));
+    model.shapes.push_back(shape);
+
+    model.scripts << "script.js";
+    model.offset = glm::scale(glm::mat4(), glm::vec3(0.01f));
+    model.neckPivot = glm::vec3(0.0f, 1.5f, 0.0f);
+    model.bindExtents = Extents(glm::vec3(-1.0f), glm::vec3(1.0f));
+    model.meshExtents = Extents(glm::vec3(-2.0f), glm::vec3(2.0f));
+
+    hfm::AnimationFrame frame;
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        frame.rotations << model.joints[i].rotation;
+        frame.translations << model.joints[i].translation;
+    }
+    model.animationFrames << frame;
+
+    model.meshIndicesToModelNames.insert(0, "model");
+    model.blendshapeChannelNames << "EyeBlink_L";
+    model.jointRotationOffsets.insert(1, glm::angleAxis(0.5f, glm::vec3(0.0f, 0.0f, 1.0f)));
+    model.shapeVertices.push_back({ glm::vec3(1.0f), glm::vec3(2.0f) });
+    model.flowData._physicsConfig.insert("joint1", QVariantMap({ { "stiffness", 0.5 } }));
+    return model;
+}
+
+static void compareExtents(const Extents& actual, const Extents& expected) {
+    QCOMPARE(actual.minimum, expected.minimum);
+    QCOMPARE(actual.maximum, expected.maximum);
+}
+
+static void compareBuffers(const gpu::BufferView& actual, const gpu::BufferView& expected) {
+    QCOMPARE(actual._element, expected._element);
+    QVERIFY(actual._buffer && expected._buffer);
+    QCOMPARE(actual._buffer->getSize(), expected._buffer->getSize());
+    QVERIFY(memcmp(actual._buffer->getData(), expected._buffer->getData(), expected._buffer->getSize()) == 0);
+}
+
+static void compareJoints(const hfm::Joint& actual, const hfm::Joint& expected) {
+    QCOMPARE(actual.name, expected.name);
+    QCOMPARE(actual.parentIndex, expected.parentIndex);
+    QCOMPARE(actual.distanceToParent, expected.distanceToParent);
+    QCOMPARE(actual.translation, expected.translation);
+    QCOMPARE(actual.preRotation, expected.preRotation);
+    QCOMPARE(actual.rotation, expected.rotation);
+    QCOMPARE(actual.transform, expected.transform);
+    QCOMPARE(actual.rotationMin, expected.rotationMin);
+    QCOMPARE(actual.rotationMax, expected.rotationMax);
+    QCOMPARE(actual.bindTransform, expected.bindTransform);
+    QCOMPARE(actual.isSkeletonJoint, expected.isSkeletonJoint);
+    QCOMPARE(actual.bindTransformFoundInCluster, expected.bindTransformFoundInCluster);
+    QCOMPARE(actual.globalTransform, expected.globalTransform);
+    QCOMPARE(actual.shapeInfo.avgPoint, expected.shapeInfo.avgPoint);
+    QCOMPARE(actual.shapeInfo.dots, expected.shapeInfo.dots);
+    QCOMPARE(actual.shapeInfo.points, expected.shapeInfo.points);
+}
+
+static void compareMeshes(const hfm::Mesh& actual, const hfm::Mesh& expected) {
+    QCOMPARE(actual.parts.size(), expected.parts.size());
+    QCOMPARE(actual.parts[0].triangleIndices, expected.parts[0].triangleIndices);
+    QCOMPARE(actual.vertices, expected.vertices);
+    QCOMPARE(actual.normals, expected.normals);
+    QCOMPARE(actual.texCoords, expected.texCoords);
+    QCOMPARE(actual.originalIndices, expected.originalIndices);
+    QCOMPARE(actual.clusterIndices, expected.clusterIndices);
+    QCOMPARE(actual.clusterWeights, expected.clusterWeights);
+    QCOMPARE(actual.clusterWeightsPerVertex, expected.clusterWeightsPerVertex);
+    QCOMPARE(actual.blendshapes.size(), expected.blendshapes.size());
+    QCOMPARE(actual.blendshapes[0].indices, expected.blendshapes[0].indices);
+    QCOMPARE(actual.blendshapes[0].vertices, expected.blendshapes[0].vertices);
+    QCOMPARE(actual.blendshapes[0].normals, expected.blendshapes[0].normals);
+    QCOMPARE(actual.triangleListMesh.vertices, expected.triangleListMesh.vertices);
+    QCOMPARE(actual.triangleListMesh.indices, expected.triangleListMesh.indices);
+    QCOMPARE(actual.triangleListMesh.parts, expected.triangleListMesh.parts);
+    compareExtents(actual.triangleListMesh.partExtents[0], expected.triangleListMesh.partExtents[0]);
+    compareExtents(actual.meshExtents, expected.meshExtents);
+    QCOMPARE(actual.modelTransform, expected.modelTransform);
+    QCOMPARE(actual.meshIndex, expected.meshIndex);
+
+    QVERIFY(actual._mesh);
+    QCOMPARE(actual._mesh->modelName, expected._mesh->modelName);
+    QCOMPARE(actual._mesh->displayName, expected._mesh->displayName);
+    QCOMPARE(actual._mesh->getNumVertices(), expected._mesh->getNumVertices());
+    QCOMPARE(actual._mesh->getNumIndices(), expected._mesh->getNumIndices());
+    QCOMPARE(actual._mesh->getNumParts(), expected._mesh->getNumParts());
+    compareBuffers(actual._mesh->getVertexBuffer(), expected._mesh->getVertexBuffer());
+    compareBuffers(actual._mesh->getIndexBuffer(), expected._mesh->getIndexBuffer());
+    compareBuffers(actual._mesh->getPartBuffer(), expected._mesh->getPartBuffer());
+}
+
+static void compareMaterials(const hfm::Material& actual, const hfm::Material& expected) {
+    QCOMPARE(actual.materialID, expected.materialID);
+    QCOMPARE(actual.name, expected.name);
+    QCOMPARE(actual.diffuseColor, expected.diffuseColor);
+    QCOMPARE(actual.specularColor, expected.specularColor);
+    QCOMPARE(actual.emissiveColor, expected.emissiveColor);
+    QCOMPARE(actual.shininess, expected.shininess);
+    QCOMPARE(actual.opacity, expected.opacity);
+    QCOMPARE(actual.roughness, expected.roughness);
+    QCOMPARE(actual.metallic, expected.metallic);
+    QCOMPARE(actual.alphaMode, expected.alphaMode);
+    QCOMPARE(actual.isPBSMaterial, expected.isPBSMaterial);
+    QCOMPARE(actual.useAlbedoMap, expected.useAlbedoMap);
+
+    const auto& actualTexture = actual.albedoTexture;
+    const auto& expectedTexture = expected.albedoTexture;
+    QCOMPARE(actualTexture.id, expectedTexture.id);
+    QCOMPARE(actualTexture.name, expectedTexture.name);
+    QCOMPARE(actualTexture.filename, expectedTexture.filename);
+    QCOMPARE(actualTexture.content, expectedTexture.content);
+    QCOMPARE(actualTexture.sourceChannel, expectedTexture.sourceChannel);
+    QCOMPARE(actualTexture.texcoordSet, expectedTexture.texcoordSet);
+    QCOMPARE(actualTexture.transform.getTranslation(), expectedTexture.transform.getTranslation());
+    QVERIFY(actual.normalTexture.isNull());
+
+    QVERIFY(actual._material);
+    QCOMPARE(actual._material->getName(), expected._material->getName());
+    QCOMPARE(actual._material->getAlbedo(false), expected._material->getAlbedo(false));
+    QCOMPARE(actual._material->getRoughness(), expected._material->getRoughness());
+    QCOMPARE(actual._material->getMetallic(), expected._material->getMetallic());
+    QCOMPARE(actual._material->getOpacity(), expected._material->getOpacity());
+    QCOMPARE(actual._material->isUnlit(), expected._material->isUnlit());
+    QCOMPARE(actual._material->getKey().isAlbedo(), expected._material->getKey().isAlbedo());
+}
+
+void BakedModelFormatTests::roundTrip() {
+    hfm::Model expected = createModel();
+    auto actual = baker::readBakedModel(baker::writeBakedModel(expected));
+    QVERIFY(actual);
+
+    QCOMPARE(actual->originalURL, expected.originalURL);
+    QCOMPARE(actual->author, expected.author);
+    QCOMPARE(actual->applicationName, expected.applicationName);
+
+    QCOMPARE(actual->joints.size(), expected.joints.size());
+    for (size_t i = 0; i < expected.joints.size(); i++) {
+        compareJoints(actual->joints[i], expected.joints[i]);
+    }
+    QCOMPARE(actual->jointIndices, expected.jointIndices);
+    QCOMPARE(actual->hasSkeletonJoints, expected.hasSkeletonJoints);
+
+    QCOMPARE(actual->meshes.size(), expected.meshes.size());
+    compareMeshes(actual->meshes[0], expected.meshes[0]);
+
+    QCOMPARE(actual->materials.size(), expected.materials.size());
+    compareMaterials(actual->materials[0], expected.materials[0]);
+
+    QCOMPARE(actual->skinDeformers.size(), expected.skinDeformers.size());
+    const auto& actualClusters = actual->skinDeformers[0].clusters;
+    const auto& expectedClusters = expected.skinDeformers[0].clusters;
+    QCOMPARE(actualClusters.size(), expectedClusters.size());
+    for (size_t i = 0; i < expectedClusters.size(); i++) {
+        QCOMPARE(actualClusters[i].jointIndex, expectedClusters[i].jointIndex);
+        QCOMPARE(actualClusters[i].inverseBindMatrix, expectedClusters[i].inverseBindMatrix);
+        QCOMPARE(actualClusters[i].inverseBindTransform.getTranslation(), expectedClusters[i].inverseBindTransform.getTranslation());
+        QCOMPARE(actualClusters[i].inverseBindTransform.getRotation(), expectedClusters[i].inverseBindTransform.getRotation());
+        QCOMPARE(actualClusters[i].inverseBindTransform.getScale(), expectedClusters[i].inverseBindTransform.getScale());
+    }
+
+    QCOMPARE(actual->shapes.size(), expected.shapes.size());
+    QCOMPARE(actual->shapes[0].mesh, expected.shapes[0].mesh);
+    QCOMPARE(actual->shapes[0].meshPart, expected.shapes[0].meshPart);
+    QCOMPARE(actual->shapes[0].material, expected.shapes[0].material);
+    QCOMPARE(actual->shapes[0].joint, expected.shapes[0].joint);
+    QCOMPARE(actual->shapes[0].skinDeformer, expected.shapes[0].skinDeformer);
+    compareExtents(actual->shapes[0].transformedExtents, expected.shapes[0].transformedExtents);
+
+    QCOMPARE(actual->scripts, expected.scripts);
+    QCOMPARE(actual->offset, expected.offset);
+    QCOMPARE(actual->neckPivot, expected.neckPivot);
+    compareExtents(actual->bindExtents, expected.bindExtents);
+    compareExtents(actual->meshExtents, expected.meshExtents);
+
+    QCOMPARE(actual->animationFrames.size(), expected.animationFrames.size());
+    QCOMPARE(actual->animationFrames[0].rotations, expected.animationFrames[0].rotations);
+    QCOMPARE(actual->animationFrames[0].translations, expected.animationFrames[0].translations);
+
+    QCOMPARE(actual->meshIndicesToModelNames, expected.meshIndicesToModelNames);
+    QCOMPARE(actual->blendshapeChannelNames, expected.blendshapeChannelNames);
+    QCOMPARE(actual->jointRotationOffsets, expected.jointRotationOffsets);
+    QCOMPARE(actual->shapeVertices, expected.shapeVertices);
+    QCOMPARE(actual->flowData._physicsConfig, expected.flowData._physicsConfig);
+    QCOMPARE(actual->flowData._collisionsConfig, expected.flowData._collisionsConfig);
+
+    // writing the model read back gives the same bytes
+    QCOMPARE(baker::writeBakedModel(*actual), baker::writeBakedModel(expected));
+}
+
+void BakedModelFormatTests::emptyModel() {
+    hfm::Model expected;
+    expected.originalURL = "file:///empty.fbx";
+    expected.hasSkeletonJoints = false;
+    auto actual = baker::readBakedModel(baker::writeBakedModel(expected));
+    QVERIFY(actual);
+    QCOMPARE(actual->originalURL, expected.originalURL);
+    QVERIFY(actual->meshes.empty());
+    QVERIFY(actual->joints.empty());
+}
+
+void BakedModelFormatTests::otherVersion() {
+    hifi::ByteArray data = baker::writeBakedModel(createModel());
+    uint32_t version = baker::BAKED_MODEL_FORMAT_VERSION + 1;
+    memcpy(data.data() + VERSION_OFFSET, &version, sizeof(version));
+    QVERIFY(!baker::readBakedModel(data));
+
+    // not a baked model at all
+    QVERIFY(!baker::readBakedModel(hifi::ByteArray("Kaydara FBX Binary  ")));
+    QVERIFY(!baker::readBakedModel(hifi::ByteArray()));
+}
+
+void BakedModelFormatTests::truncatedData() {
+    hifi::ByteArray data = baker::writeBakedModel(createModel());
+    for (int size = 0; size < data.size(); size += 1 + size / 8) {
+        QVERIFY2(!baker::readBakedModel(data.left(size)), qPrintable(QString("truncated to %1 bytes").arg(size)));
+    }
+}
+
+void BakedModelFormatTests::trailingData() {
+    hifi::ByteArray data = baker::writeBakedModel(createModel());
+    data.append('\0');
+    QVERIFY(!baker::readBakedModel(data));
+}
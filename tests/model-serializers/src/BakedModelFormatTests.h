@@ -0,0 +1,26 @@
+//
+//  BakedModelFormatTests.h
+//  tests/model-serializers/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakedModelFormatTests_h
+#define hifi_BakedModelFormatTests_h
+
+#include <QtTest/QtTest>
+
+class BakedModelFormatTests : public QObject {
+    Q_OBJECT
+private slots:
+    void roundTrip();
+    void emptyModel();
+    void otherVersion();
+    void truncatedData();
+    void trailingData();
+};
+
+#endif // hifi_BakedModelFormatTests_h
@@ -0,0 +1,178 @@
+//
+//  CullBatchTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CullBatchTests.h"
+
+#include <random>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <NumericalConstants.h>
+#include <ViewFrustum.h>
+#include <render/CullTask.h>
+
+QTEST_MAIN(CullBatchTests)
+
+using namespace render;
+
+// a large scene around a camera, with items of very different sizes so that all the tests matter
+static const int NUM_ITEMS = 50000;
+static const float SCENE_SIZE = 1000.0f;
+
+static ItemBounds createItems(int numItems) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> position(-SCENE_SIZE / 2.0f, SCENE_SIZE / 2.0f);
+    std::uniform_real_distribution<float> logSize(-2.0f, 1.5f);
+
+    ItemBounds items;
+    items.reserve(numItems);
+    for (int i = 0; i < numItems; i++) {
+        glm::vec3 corner(position(generator), position(generator), position(generator));
+        glm::vec3 dimensions(powf(10.0f, logSize(generator)), powf(10.0f, logSize(generator)), powf(10.0f, logSize(generator)));
+        items.emplace_back(ItemBound(i, AABox(corner, dimensions)));
+    }
+    return items;
+}
+
+static void setupArgs(RenderArgs& args) {
+    ViewFrustum view;
+    view.setProjection(glm::perspective(PI / 2.0f, 16.0f / 9.0f, 0.1f, SCENE_SIZE));
+    view.setPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    view.setOrientation(glm::angleAxis(PI / 7.0f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))));
+    view.calculate();
+    args.setViewFrustum(view);
+
+    const float LOD_ANGLE_HALF_TAN = 0.005f;
+    args._lodAngleHalfTan = LOD_ANGLE_HALF_TAN;
+    args._lodAngleHalfTanSq = LOD_ANGLE_HALF_TAN * LOD_ANGLE_HALF_TAN;
+}
+
+// the item at a time culling that CullBatch replaces
+static void cullPerItem(const RenderArgs* args, const CullFunctor& cullFunctor, RenderDetails::Item& details,
+                        const ItemBounds& inItems, ItemBounds& outItems) {
+    const ViewFrustum& frustum = args->getViewFrustum();
+    for (auto& item : inItems) {
+        if (!frustum.boxIntersectsFrustum(item.bound)) {
+            details._outOfView++;
+        } else if (!cullFunctor(args, item.bound)) {
+            details._tooSmall++;
+        } else {
+            outItems.emplace_back(item);
+        }
+    }
+}
+
+static void compareItems(const ItemBounds& expected, const ItemBounds& actual) {
+    QCOMPARE(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        QCOMPARE(actual[i].id, expected[i].id);
+    }
+}
+
+void CullBatchTests::matchesPerItemTests() {
+    RenderArgs args;
+    setupArgs(args);
+    ItemBounds items = createItems(NUM_ITEMS + 3); // leave a partial batch
+
+    RenderDetails::Item expectedDetails;
+    ItemBounds expected;
+    cullPerItem(&args, shouldRenderAtLOD, expectedDetails, items, expected);
+
+    RenderDetails::Item details;
+    ItemBounds culled;
+    CullBatch cullBatch;
+    cullBatch.cull(&args, shouldRenderAtLOD, details, items, culled);
+
+    compareItems(expected, culled);
+    QCOMPARE(details._outOfView, expectedDetails._outOfView);
+    QCOMPARE(details._tooSmall, expectedDetails._tooSmall);
+
+    // the scene is large enough for every test to remove items
+    QVERIFY(expectedDetails._outOfView > 0);
+    QVERIFY(expectedDetails._tooSmall > 0);
+    QVERIFY(expected.size() > 0);
+}
+
+void CullBatchTests::customFunctor() {
+    RenderArgs args;
+    setupArgs(args);
+    ItemBounds items = createItems(1000);
+
+    // functors other than shouldRenderAtLOD are called for the items in view
+    int numCalls = 0;
+    CullFunctor oddItems = [&](const RenderArgs*, const AABox& bound) {
+        numCalls++;
+        return ((int)bound.getCorner().x % 2) != 0;
+    };
+
+    RenderDetails::Item expectedDetails;
+    ItemBounds expected;
+    cullPerItem(&args, oddItems, expectedDetails, items, expected);
+    int expectedCalls = numCalls;
+
+    numCalls = 0;
+    RenderDetails::Item details;
+    ItemBounds culled;
+    CullBatch cullBatch;
+    cullBatch.cull(&args, oddItems, details, items, culled);
+
+    compareItems(expected, culled);
+    QCOMPARE(numCalls, expectedCalls);
+    QCOMPARE(details._tooSmall, expectedDetails._tooSmall);
+}
+
+void CullBatchTests::nullBounds() {
+    RenderArgs args;
+    setupArgs(args);
+
+    // a null bound is kept, while a bound that small is culled anywhere
+    ItemBounds items;
+    items.emplace_back(ItemBound(1, AABox()));
+    items.emplace_back(ItemBound(2, AABox(glm::vec3(SCENE_SIZE / 2.0f), 0.001f)));
+
+    RenderDetails::Item details;
+    ItemBounds culled;
+    CullBatch cullBatch;
+    cullBatch.cull(&args, shouldRenderAtLOD, details, items, culled,
+                   CullBatch::FRUSTUM | CullBatch::SOLID_ANGLE | CullBatch::KEEP_NULL_BOUNDS);
+
+    QCOMPARE((int)culled.size(), 1);
+    QCOMPARE(culled[0].id, (ItemID)1);
+}
+
+void CullBatchTests::benchmarkPerItem() {
+    RenderArgs args;
+    setupArgs(args);
+    ItemBounds items = createItems(NUM_ITEMS);
+    ItemBounds culled;
+    culled.reserve(items.size());
+
+    QBENCHMARK {
+        RenderDetails::Item details;
+        culled.clear();
+        cullPerItem(&args, shouldRenderAtLOD, details, items, culled);
+    }
+}
+
+void CullBatchTests::benchmarkBatch() {
+    RenderArgs args;
+    setupArgs(args);
+    ItemBounds items = createItems(NUM_ITEMS);
+    ItemBounds culled;
+    culled.reserve(items.size());
+    CullBatch cullBatch;
+
+    QBENCHMARK {
+        RenderDetails::Item details;
+        culled.clear();
+        cullBatch.cull(&args, shouldRenderAtLOD, details, items, culled);
+    }
+}
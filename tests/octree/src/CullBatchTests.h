@@ -0,0 +1,28 @@
+//
+//  CullBatchTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CullBatchTests_h
+#define hifi_CullBatchTests_h
+
+#include <QtTest/QtTest>
+
+class CullBatchTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void matchesPerItemTests();
+    void customFunctor();
+    void nullBounds();
+
+    void benchmarkPerItem();
+    void benchmarkBatch();
+};
+
+#endif // hifi_CullBatchTests_h
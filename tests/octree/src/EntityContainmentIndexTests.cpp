@@ -0,0 +1,200 @@
+//
+//  EntityContainmentIndexTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityContainmentIndexTests.h"
+
+#include <random>
+#include <set>
+
+#include <EntityContainmentIndex.h>
+#include <ShapeEntityItem.h>
+#include <ZoneEntityItem.h>
+
+QTEST_MAIN(EntityContainmentIndexTests)
+
+// a zone-heavy domain, with an avatar walking through it
+static const int NUM_ENTITIES = 10000;
+static const int NUM_STEPS = 1000;
+static const float DOMAIN_SIZE = 1000.0f;
+
+static EntityItemPointer createZone(const glm::vec3& position, const glm::vec3& dimensions) {
+    EntityItemPointer zone = ZoneEntityItem::factory(EntityItemID(QUuid::createUuid()), EntityItemProperties());
+    zone->setWorldPosition(position);
+    zone->setUnscaledDimensions(dimensions);
+    return zone;
+}
+
+static EntityItemPointer createBox(const glm::vec3& position, const glm::vec3& dimensions, const QString& script = QString()) {
+    EntityItemPointer box = ShapeEntityItem::boxFactory(EntityItemID(QUuid::createUuid()), EntityItemProperties());
+    box->setWorldPosition(position);
+    box->setUnscaledDimensions(dimensions);
+    box->setScript(script);
+    return box;
+}
+
+static std::set<EntityItemID> findContaining(EntityContainmentIndex& index, const glm::vec3& point) {
+    std::set<EntityItemID> result;
+    index.forEachCandidateContaining(point, [&](const EntityItemPointer& entity) {
+        result.insert(entity->getEntityItemID());
+    });
+    return result;
+}
+
+void EntityContainmentIndexTests::onlyIndexesZonesAndScriptedEntities() {
+    EntityContainmentIndex index;
+    EntityItemPointer zone = createZone(glm::vec3(0.0f), glm::vec3(10.0f));
+    EntityItemPointer scripted = createBox(glm::vec3(0.0f), glm::vec3(2.0f), "http://localhost/script.js");
+    EntityItemPointer box = createBox(glm::vec3(0.0f), glm::vec3(2.0f));
+
+    QCOMPARE(index.update(zone), false);
+    QCOMPARE(index.update(scripted), false);
+    QCOMPARE(index.update(box), false);
+    QCOMPARE(index.size(), 2);
+
+    std::set<EntityItemID> containing = findContaining(index, glm::vec3(0.5f));
+    QCOMPARE(containing.size(), (size_t)2);
+    QVERIFY(containing.count(zone->getEntityItemID()) == 1);
+    QVERIFY(containing.count(scripted->getEntityItemID()) == 1);
+
+    // outside of the box, inside of the zone
+    containing = findContaining(index, glm::vec3(3.0f));
+    QCOMPARE(containing.size(), (size_t)1);
+    QVERIFY(containing.count(zone->getEntityItemID()) == 1);
+
+    // removing the script removes the entity
+    scripted->setScript(QString());
+    QCOMPARE(index.update(scripted), true);
+    QCOMPARE(index.size(), 1);
+    QCOMPARE(findContaining(index, glm::vec3(0.5f)).size(), (size_t)1);
+
+    QCOMPARE(index.remove(zone->getEntityItemID()), true);
+    QCOMPARE(index.size(), 0);
+    QVERIFY(findContaining(index, glm::vec3(0.5f)).empty());
+}
+
+void EntityContainmentIndexTests::updatesCandidatesOnCellCrossing() {
+    EntityContainmentIndex index;
+    const float CELL = EntityContainmentIndex::CELL_SCALE;
+    EntityItemPointer near = createZone(glm::vec3(0.5f * CELL), glm::vec3(2.0f));
+    EntityItemPointer far = createZone(glm::vec3(10.5f * CELL), glm::vec3(2.0f));
+    index.update(near);
+    index.update(far);
+
+    // walking inside of a cell doesn't update the candidates
+    for (int i = 0; i < 10; i++) {
+        findContaining(index, glm::vec3(0.1f * CELL * (float)i + 0.01f));
+    }
+    QCOMPARE(index.getNumCandidateUpdates(), 1);
+    QCOMPARE(index.getNumCandidates(), 1);
+
+    // crossing into the next cell does
+    findContaining(index, glm::vec3(1.5f * CELL));
+    QCOMPARE(index.getNumCandidateUpdates(), 2);
+    QCOMPARE(index.getNumCandidates(), 0);
+
+    findContaining(index, glm::vec3(10.5f * CELL));
+    QCOMPARE(index.getNumCandidateUpdates(), 3);
+    QCOMPARE(index.getNumCandidates(), 1);
+    QCOMPARE(findContaining(index, glm::vec3(10.5f * CELL)).size(), (size_t)1);
+}
+
+void EntityContainmentIndexTests::updatesCandidatesOnNearbyChanges() {
+    EntityContainmentIndex index;
+    const float CELL = EntityContainmentIndex::CELL_SCALE;
+    EntityItemPointer near = createZone(glm::vec3(0.5f * CELL), glm::vec3(2.0f));
+    EntityItemPointer far = createZone(glm::vec3(10.5f * CELL), glm::vec3(2.0f));
+    index.update(near);
+    index.update(far);
+    QVERIFY(findContaining(index, glm::vec3(0.5f * CELL)).size() == 1);
+    QCOMPARE(index.getNumCandidateUpdates(), 1);
+
+    // a change far from the cell keeps the candidates
+    far->setWorldPosition(glm::vec3(20.5f * CELL));
+    QCOMPARE(index.update(far), false);
+    QVERIFY(findContaining(index, glm::vec3(0.5f * CELL)).size() == 1);
+    QCOMPARE(index.getNumCandidateUpdates(), 1);
+
+    // a zone that moves into the cell updates them
+    far->setWorldPosition(glm::vec3(0.5f * CELL));
+    QCOMPARE(index.update(far), true);
+    QVERIFY(findContaining(index, glm::vec3(0.5f * CELL)).size() == 2);
+    QCOMPARE(index.getNumCandidateUpdates(), 2);
+
+    // and so does one that moves out of it
+    near->setWorldPosition(glm::vec3(-10.5f * CELL));
+    QCOMPARE(index.update(near), true);
+    QVERIFY(findContaining(index, glm::vec3(0.5f * CELL)).size() == 1);
+    QCOMPARE(index.getNumCandidateUpdates(), 3);
+
+    // an unchanged entity doesn't
+    QCOMPARE(index.update(far), false);
+    QCOMPARE(index.getNumCandidateUpdates(), 3);
+}
+
+static std::vector<EntityItemPointer> createDomain() {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> position(-DOMAIN_SIZE / 2.0f, DOMAIN_SIZE / 2.0f);
+    std::uniform_real_distribution<float> size(1.0f, 50.0f);
+
+    std::vector<EntityItemPointer> entities;
+    entities.reserve(NUM_ENTITIES);
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        glm::vec3 center(position(generator), 0.0f, position(generator));
+        glm::vec3 dimensions(size(generator), size(generator), size(generator));
+        if (i % 2 == 0) {
+            entities.push_back(createZone(center, dimensions));
+        } else {
+            entities.push_back(createBox(center, dimensions, "http://localhost/script.js"));
+        }
+    }
+    return entities;
+}
+
+static glm::vec3 getAvatarPosition(int step) {
+    // a walk at about 4 m/s, at 60 frames per second
+    return glm::vec3(-DOMAIN_SIZE / 4.0f + 0.07f * (float)step, 1.0f, 0.0f);
+}
+
+void EntityContainmentIndexTests::benchmarkLinearSearch() {
+    std::vector<EntityItemPointer> entities = createDomain();
+    int numFound = 0;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_STEPS; i++) {
+            glm::vec3 avatarPosition = getAvatarPosition(i);
+            for (const auto& entity : entities) {
+                bool success;
+                if (entity->getAABox(success).contains(avatarPosition) && entity->contains(avatarPosition)) {
+                    numFound++;
+                }
+            }
+        }
+    }
+    QVERIFY(numFound > 0);
+}
+
+void EntityContainmentIndexTests::benchmarkIndex() {
+    std::vector<EntityItemPointer> entities = createDomain();
+    EntityContainmentIndex index;
+    for (const auto& entity : entities) {
+        index.update(entity);
+    }
+
+    int numFound = 0;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_STEPS; i++) {
+            index.forEachCandidateContaining(getAvatarPosition(i), [&](const EntityItemPointer& entity) {
+                if (entity->contains(getAvatarPosition(i))) {
+                    numFound++;
+                }
+            });
+        }
+    }
+    QVERIFY(numFound > 0);
+}
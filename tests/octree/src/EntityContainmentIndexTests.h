@@ -0,0 +1,28 @@
+//
+//  EntityContainmentIndexTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityContainmentIndexTests_h
+#define hifi_EntityContainmentIndexTests_h
+
+#include <QtTest/QtTest>
+
+class EntityContainmentIndexTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void onlyIndexesZonesAndScriptedEntities();
+    void updatesCandidatesOnCellCrossing();
+    void updatesCandidatesOnNearbyChanges();
+
+    void benchmarkLinearSearch();
+    void benchmarkIndex();
+};
+
+#endif // hifi_EntityContainmentIndexTests_h
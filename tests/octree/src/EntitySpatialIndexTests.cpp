@@ -0,0 +1,183 @@
+//
+//  EntitySpatialIndexTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySpatialIndexTests.h"
+
+#include <random>
+#include <set>
+
+#include <EntitySpatialIndex.h>
+#include <ShapeEntityItem.h>
+
+QTEST_MAIN(EntitySpatialIndexTests)
+
+// a domain with most entities in a few kilometers, and some that are much larger than a cell
+static const int NUM_ENTITIES = 100000;
+static const int NUM_QUERIES = 1000;
+static const float DOMAIN_SIZE = 2000.0f;
+
+struct TestEntity {
+    EntityItemPointer entity;
+    AACube bounds;
+};
+
+static std::vector<TestEntity> entities;
+static std::vector<AABox> queries;
+
+using EntitySet = std::set<const EntityItem*>;
+
+void EntitySpatialIndexTests::initTestCase() {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> position(-DOMAIN_SIZE / 2.0f, DOMAIN_SIZE / 2.0f);
+    std::uniform_real_distribution<float> logSize(-1.0f, 2.5f);
+
+    entities.reserve(NUM_ENTITIES);
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        EntityItemPointer entity = ShapeEntityItem::boxFactory(EntityItemID(QUuid::createUuid()), EntityItemProperties());
+        glm::vec3 corner(position(generator), position(generator), position(generator));
+        entities.push_back({ entity, AACube(corner, powf(10.0f, logSize(generator))) });
+    }
+
+    std::uniform_real_distribution<float> querySize(1.0f, 50.0f);
+    for (int i = 0; i < NUM_QUERIES; i++) {
+        glm::vec3 corner(position(generator), position(generator), position(generator));
+        queries.push_back(AABox(corner, glm::vec3(querySize(generator), querySize(generator), querySize(generator))));
+    }
+}
+
+void EntitySpatialIndexTests::cleanupTestCase() {
+    entities.clear();
+    queries.clear();
+}
+
+static EntitySet findLinear(const AABox& box, int stride = 1) {
+    EntitySet result;
+    for (size_t i = 0; i < entities.size(); i += stride) {
+        if (AABox(entities[i].bounds).touches(box)) {
+            result.insert(entities[i].entity.get());
+        }
+    }
+    return result;
+}
+
+static EntitySet findIndexed(const EntitySpatialIndex& index, const AABox& box) {
+    EntitySet result;
+    index.forEachEntityTouching(box, [&](const EntityItemPointer& entity) {
+        result.insert(entity.get());
+    });
+    return result;
+}
+
+static void insertAll(EntitySpatialIndex& index) {
+    for (const auto& testEntity : entities) {
+        index.insert(testEntity.entity, testEntity.bounds);
+    }
+}
+
+void EntitySpatialIndexTests::matchesLinearSearch() {
+    EntitySpatialIndex index;
+    insertAll(index);
+    QCOMPARE(index.size(), NUM_ENTITIES);
+
+    for (const auto& query : queries) {
+        QCOMPARE(findIndexed(index, query), findLinear(query));
+    }
+
+    // a sphere is found through its bounding box, and then tested more tightly
+    glm::vec3 center(10.0f, 20.0f, 30.0f);
+    float radius = 100.0f;
+    EntitySet inSphere;
+    index.forEachEntityTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+        inSphere.insert(entity.get());
+    });
+    for (const auto& testEntity : entities) {
+        if (AABox(testEntity.bounds).touchesSphere(center, radius)) {
+            QVERIFY(inSphere.count(testEntity.entity.get()) == 1);
+        }
+    }
+}
+
+void EntitySpatialIndexTests::matchesLinearSearchAfterRemove() {
+    EntitySpatialIndex index;
+    insertAll(index);
+
+    // remove every other entity, and move the ones that remain through a remove and insert
+    for (size_t i = 1; i < entities.size(); i += 2) {
+        index.remove(entities[i].entity);
+    }
+    for (size_t i = 0; i < entities.size(); i += 2) {
+        index.remove(entities[i].entity);
+        index.insert(entities[i].entity, entities[i].bounds);
+    }
+    QCOMPARE(index.size(), NUM_ENTITIES / 2);
+
+    for (const auto& query : queries) {
+        QCOMPARE(findIndexed(index, query), findLinear(query, 2));
+    }
+
+    index.clear();
+    QCOMPARE(index.size(), 0);
+    QVERIFY(findIndexed(index, queries[0]).empty());
+}
+
+void EntitySpatialIndexTests::batchedBoxes() {
+    EntitySpatialIndex index;
+    insertAll(index);
+
+    std::vector<EntitySet> results(queries.size());
+    index.forEachEntityTouching(queries.data(), (int)queries.size(), [&](int i, const EntityItemPointer& entity) {
+        results[i].insert(entity.get());
+    });
+    for (size_t i = 0; i < queries.size(); i++) {
+        QCOMPARE(results[i], findIndexed(index, queries[i]));
+    }
+}
+
+void EntitySpatialIndexTests::benchmarkLinearSearch() {
+    int numFound = 0;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_QUERIES / 10; i++) {
+            for (const auto& testEntity : entities) {
+                if (AABox(testEntity.bounds).touches(queries[i])) {
+                    numFound++;
+                }
+            }
+        }
+    }
+    QVERIFY(numFound > 0);
+}
+
+void EntitySpatialIndexTests::benchmarkIndex() {
+    EntitySpatialIndex index;
+    insertAll(index);
+
+    int numFound = 0;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_QUERIES / 10; i++) {
+            index.forEachEntityTouching(queries[i], [&](const EntityItemPointer& entity) {
+                numFound++;
+            });
+        }
+    }
+    QVERIFY(numFound > 0);
+}
+
+void EntitySpatialIndexTests::benchmarkIndexBatched() {
+    EntitySpatialIndex index;
+    insertAll(index);
+
+    int numFound = 0;
+    QBENCHMARK {
+        index.forEachEntityTouching(queries.data(), NUM_QUERIES / 10, [&](int i, const EntityItemPointer& entity) {
+            numFound++;
+        });
+    }
+    QVERIFY(numFound > 0);
+}
@@ -0,0 +1,229 @@
+//
+//  EntityTreeQueryTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityTreeQueryTests.h"
+
+#include <random>
+#include <set>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <NodeList.h>
+#include <ViewFrustum.h>
+
+QTEST_MAIN(EntityTreeQueryTests)
+
+static const int NUM_ENTITIES = 2000;
+static const int NUM_QUERIES = 200;
+static const float DOMAIN_SIZE = 1000.0f;
+static const QString TARGET_NAME = "target";
+
+using EntitySet = std::set<QUuid>;
+
+static EntitySet toSet(const QVector<QUuid>& entities) {
+    return EntitySet(entities.begin(), entities.end());
+}
+
+// the queries as EntityTree answered them before the spatial index: a walk down the octree through the elements
+// that pass elementTest, testing each of their entities with entityTest
+template <typename ElementTest, typename EntityTest>
+static EntitySet findInOctree(EntityTree& tree, ElementTest elementTest, EntityTest entityTest) {
+    EntitySet result;
+    tree.recurseTreeWithOperation([&](const OctreeElementPointer& element, void*) {
+        if (!elementTest(element)) {
+            return false;
+        }
+        std::static_pointer_cast<EntityTreeElement>(element)->forEachEntity([&](EntityItemPointer entity) {
+            if (EntityTreeElement::checkFilterSettings(entity, PickFilter()) && entityTest(entity)) {
+                result.insert(entity->getID());
+            }
+        });
+        return true;
+    });
+    return result;
+}
+
+struct Queries {
+    std::vector<AABox> boxes;
+    std::vector<std::pair<glm::vec3, float>> spheres;
+    ViewFrustum frustum;
+};
+
+static Queries createQueries(std::mt19937& generator) {
+    std::uniform_real_distribution<float> position(-DOMAIN_SIZE / 2.0f, DOMAIN_SIZE / 2.0f);
+    std::uniform_real_distribution<float> size(1.0f, 100.0f);
+
+    Queries queries;
+    for (int i = 0; i < NUM_QUERIES; i++) {
+        glm::vec3 corner(position(generator), position(generator), position(generator));
+        queries.boxes.push_back(AABox(corner, glm::vec3(size(generator), size(generator), size(generator))));
+        queries.spheres.emplace_back(glm::vec3(position(generator), position(generator), position(generator)), size(generator));
+    }
+
+    queries.frustum.setProjection(glm::perspective(PI / 3.0f, 16.0f / 9.0f, 0.1f, DOMAIN_SIZE / 2.0f));
+    queries.frustum.setPosition(glm::vec3(10.0f, 20.0f, 30.0f));
+    queries.frustum.setOrientation(glm::angleAxis(PI / 5.0f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))));
+    queries.frustum.calculate();
+    return queries;
+}
+
+static EntityItemProperties createProperties(std::mt19937& generator) {
+    std::uniform_real_distribution<float> position(-DOMAIN_SIZE / 2.0f, DOMAIN_SIZE / 2.0f);
+    std::uniform_real_distribution<float> logSize(-1.0f, 2.0f);
+    std::uniform_int_distribution<int> choice(0, 3);
+
+    EntityItemProperties properties;
+    properties.setType(choice(generator) == 0 ? EntityTypes::Sphere : EntityTypes::Box);
+    properties.setPosition(glm::vec3(position(generator), position(generator), position(generator)));
+    float size = powf(10.0f, logSize(generator));
+    properties.setDimensions(glm::vec3(size, choice(generator) == 0 ? size : 0.5f * size, size));
+    properties.setName(choice(generator) == 0 ? TARGET_NAME : "other");
+    properties.setVisible(choice(generator) != 0);
+    return properties;
+}
+
+static void compareWithOctreeWalk(EntityTree& tree, const Queries& queries) {
+    PickFilter filter;
+    QVector<QUuid> found;
+
+    QVector<AABox> boxes;
+    for (const auto& box : queries.boxes) {
+        tree.evalEntitiesInBox(box, filter, found);
+        EntitySet expected = findInOctree(tree, [&](const OctreeElementPointer& element) {
+            return element->getAACube().touches(box);
+        }, [&](const EntityItemPointer& entity) {
+            return EntityTreeElement::checkBoxIntersection(entity, box);
+        });
+        QCOMPARE(toSet(found), expected);
+
+        AACube cube(box.getCorner(), box.getLargestDimension());
+        tree.evalEntitiesInCube(cube, filter, found);
+        QCOMPARE(toSet(found), findInOctree(tree, [&](const OctreeElementPointer& element) {
+            return element->getAACube().touches(cube);
+        }, [&](const EntityItemPointer& entity) {
+            bool success;
+            AABox entityBox = entity->getAABox(success);
+            return success && entityBox.touches(cube);
+        }));
+        boxes.push_back(box);
+    }
+
+    // the batched boxes give the same answer as one box at a time
+    QVector<QVector<QUuid>> foundInBoxes;
+    tree.evalEntitiesInBoxes(boxes, filter, foundInBoxes);
+    QCOMPARE(foundInBoxes.size(), boxes.size());
+    for (int i = 0; i < boxes.size(); i++) {
+        tree.evalEntitiesInBox(boxes[i], filter, found);
+        QCOMPARE(toSet(foundInBoxes[i]), toSet(found));
+    }
+
+    for (const auto& sphere : queries.spheres) {
+        const glm::vec3& center = sphere.first;
+        float radius = sphere.second;
+        auto elementTest = [&](const OctreeElementPointer& element) {
+            glm::vec3 penetration;
+            return element->getAACube().findSpherePenetration(center, radius, penetration);
+        };
+
+        tree.evalEntitiesInSphere(center, radius, filter, found);
+        QCOMPARE(toSet(found), findInOctree(tree, elementTest, [&](const EntityItemPointer& entity) {
+            return EntityTreeElement::checkSphereIntersection(entity, center, radius);
+        }));
+
+        tree.evalEntitiesInSphereWithType(center, radius, EntityTypes::Sphere, filter, found);
+        QCOMPARE(toSet(found), findInOctree(tree, elementTest, [&](const EntityItemPointer& entity) {
+            return entity->getType() == EntityTypes::Sphere && EntityTreeElement::checkSphereIntersection(entity, center, radius);
+        }));
+
+        tree.evalEntitiesInSphereWithName(center, radius, TARGET_NAME.toUpper(), false, filter, found);
+        QCOMPARE(toSet(found), findInOctree(tree, elementTest, [&](const EntityItemPointer& entity) {
+            return entity->getName() == TARGET_NAME && EntityTreeElement::checkSphereIntersection(entity, center, radius);
+        }));
+    }
+
+    tree.evalEntitiesInFrustum(queries.frustum, filter, found);
+    EntitySet expectedInView = findInOctree(tree, [&](const OctreeElementPointer& element) {
+        return element->isInView(queries.frustum);
+    }, [&](const EntityItemPointer& entity) {
+        return EntityTreeElement::checkFrustumIntersection(entity, queries.frustum);
+    });
+    QVERIFY(!expectedInView.empty());
+    QCOMPARE(toSet(found), expectedInView);
+
+    // the visible filter is applied as before
+    PickFilter visibleFilter;
+    visibleFilter.setFlag(PickFilter::VISIBLE, true);
+    tree.evalEntitiesInBox(queries.boxes[0], visibleFilter, found);
+    for (const auto& id : found) {
+        QVERIFY(tree.findEntityByID(id)->isVisible());
+    }
+}
+
+void EntityTreeQueryTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+}
+
+void EntityTreeQueryTests::matchesOctreeWalk() {
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    tree->setIsServer(true);
+    tree->createRootElement();
+
+    std::mt19937 generator(1);
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        QVERIFY(tree->addEntity(EntityItemID(QUuid::createUuid()), createProperties(generator)));
+    }
+    QCOMPARE(tree->getSpatialIndex().size(), NUM_ENTITIES);
+
+    Queries queries = createQueries(generator);
+    tree->withReadLock([&] {
+        compareWithOctreeWalk(*tree, queries);
+    });
+}
+
+void EntityTreeQueryTests::matchesOctreeWalkAfterEdits() {
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    tree->setIsServer(true);
+    tree->createRootElement();
+
+    std::mt19937 generator(2);
+    std::vector<EntityItemID> ids;
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        EntityItemID id(QUuid::createUuid());
+        QVERIFY(tree->addEntity(id, createProperties(generator)));
+        ids.push_back(id);
+    }
+
+    // move and resize a third of the entities, which moves many of them to other elements, and delete a quarter
+    std::uniform_real_distribution<float> position(-DOMAIN_SIZE / 2.0f, DOMAIN_SIZE / 2.0f);
+    for (int i = 0; i < NUM_ENTITIES; i += 3) {
+        EntityItemProperties properties;
+        properties.setPosition(glm::vec3(position(generator), position(generator), position(generator)));
+        if (i % 2 == 0) {
+            properties.setDimensions(glm::vec3(DOMAIN_SIZE / 20.0f));
+        }
+        QVERIFY(tree->updateEntity(ids[i], properties));
+    }
+    int numDeleted = 0;
+    for (int i = 1; i < NUM_ENTITIES; i += 4) {
+        tree->deleteEntity(ids[i], true);
+        numDeleted++;
+    }
+    QCOMPARE(tree->getSpatialIndex().size(), NUM_ENTITIES - numDeleted);
+
+    Queries queries = createQueries(generator);
+    tree->withReadLock([&] {
+        compareWithOctreeWalk(*tree, queries);
+    });
+}
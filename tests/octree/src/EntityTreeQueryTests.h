@@ -0,0 +1,26 @@
+//
+//  EntityTreeQueryTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityTreeQueryTests_h
+#define hifi_EntityTreeQueryTests_h
+
+#include <QtTest/QtTest>
+
+class EntityTreeQueryTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void matchesOctreeWalk();
+    void matchesOctreeWalkAfterEdits();
+};
+
+#endif // hifi_EntityTreeQueryTests_h
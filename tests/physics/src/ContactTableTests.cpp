@@ -0,0 +1,180 @@
+//
+//  ContactTableTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContactTableTests.h"
+
+#include <map>
+
+#include <QElapsedTimer>
+
+#include <ContactTable.h>
+#include <NumericalConstants.h>
+
+QTEST_MAIN(ContactTableTests)
+
+// fake motion state pointers, aligned like the real ones
+static void* motionState(int i) {
+    return reinterpret_cast<void*>((uintptr_t)(i + 1) * 64);
+}
+
+static btManifoldPoint makePoint(float distance) {
+    btManifoldPoint point(btVector3(0.0f, 0.0f, 0.0f), btVector3(0.0f, 1.0f, 0.0f), btVector3(0.0f, 1.0f, 0.0f), distance);
+    return point;
+}
+
+void ContactTableTests::testAddAndFind() {
+    ContactTable table;
+    QVERIFY(table.empty());
+    QVERIFY(table.find(ContactKey(motionState(0), motionState(1))) == nullptr);
+
+    table[ContactKey(motionState(0), motionState(1))].update(1, makePoint(-0.1f));
+    table[ContactKey(motionState(1), motionState(0))].update(1, makePoint(-0.2f));
+    table[ContactKey(motionState(2), nullptr)].update(1, makePoint(-0.3f));
+    QCOMPARE(table.size(), 3);
+
+    // the same key finds the same contact
+    table[ContactKey(motionState(0), motionState(1))].update(2, makePoint(-0.4f));
+    QCOMPARE(table.size(), 3);
+    ContactInfo* contact = table.find(ContactKey(motionState(0), motionState(1)));
+    QVERIFY(contact != nullptr);
+    QCOMPARE(contact->distance, -0.4f);
+    QCOMPARE(table.find(ContactKey(motionState(1), motionState(0)))->distance, -0.2f);
+    QCOMPARE(table.find(ContactKey(motionState(2), nullptr))->distance, -0.3f);
+
+    table.clear();
+    QVERIFY(table.empty());
+    QVERIFY(table.find(ContactKey(motionState(2), nullptr)) == nullptr);
+}
+
+void ContactTableTests::testGrowAndPrune() {
+    const int NUM_OBJECTS = 1000;
+    ContactTable table;
+    for (int i = 0; i < NUM_OBJECTS; ++i) {
+        table[ContactKey(motionState(i), motionState(i + 1))].update(1, makePoint((float)i));
+        table[ContactKey(motionState(i), nullptr)].update(1, makePoint((float)i));
+    }
+    QCOMPARE(table.size(), 2 * NUM_OBJECTS);
+
+    // remove everything that touches an even object, like PhysicsEngine::removeContacts() for many objects at once
+    int numRemoved = table.removeIf([](const ContactKey& key, const ContactInfo& contact) {
+        return ((uintptr_t)key._a / 64 - 1) % 2 == 0;
+    });
+    QCOMPARE(numRemoved, NUM_OBJECTS);
+    QCOMPARE(table.size(), NUM_OBJECTS);
+
+    for (int i = 0; i < NUM_OBJECTS; ++i) {
+        ContactInfo* contact = table.find(ContactKey(motionState(i), motionState(i + 1)));
+        if (i % 2 == 0) {
+            QVERIFY(contact == nullptr);
+        } else {
+            QVERIFY(contact != nullptr);
+            QCOMPARE(contact->distance, (float)i);
+        }
+    }
+
+    // the survivors keep the order they were added in
+    int lastObject = -1;
+    table.forEach([&](const ContactKey& key, ContactInfo& contact) {
+        int object = (int)((uintptr_t)key._a / 64) - 1;
+        QVERIFY(object >= lastObject);
+        lastObject = object;
+    });
+}
+
+void ContactTableTests::testPruneByStep() {
+    ContactTable table;
+    const int NUM_CONTACTS = 100;
+    uint32_t step = 1;
+    for (int i = 0; i < NUM_CONTACTS; ++i) {
+        table[ContactKey(motionState(i), nullptr)].update(step, makePoint(-0.1f));
+    }
+
+    // the first pass starts every contact
+    int numStarted = 0;
+    table.removeIf([&](const ContactKey& key, ContactInfo& contact) {
+        numStarted += (contact.computeType(step) == CONTACT_EVENT_TYPE_START) ? 1 : 0;
+        return false;
+    });
+    QCOMPARE(numStarted, NUM_CONTACTS);
+
+    // only half of them are seen in the next step, the others end and are pruned
+    ++step;
+    for (int i = 0; i < NUM_CONTACTS; i += 2) {
+        table[ContactKey(motionState(i), nullptr)].update(step, makePoint(-0.1f));
+    }
+    int numEnded = 0;
+    table.removeIf([&](const ContactKey& key, ContactInfo& contact) {
+        ContactEventType type = contact.computeType(step);
+        numEnded += (type == CONTACT_EVENT_TYPE_END) ? 1 : 0;
+        return type == CONTACT_EVENT_TYPE_END;
+    });
+    QCOMPARE(numEnded, NUM_CONTACTS / 2);
+    QCOMPARE(table.size(), NUM_CONTACTS / 2);
+}
+
+// A pile of objects touching their neighbors, with a tenth of the contacts changing every step:
+// the cost of updating the contacts and producing the collision events, against the std::map it replaces.
+void ContactTableTests::benchmarkCollisionEvents() {
+    const int NUM_OBJECTS = 10000;
+    const int NUM_NEIGHBORS = 4;
+    const int NUM_STEPS = 100;
+
+    auto neighbor = [](int object, int n, uint32_t step) {
+        // a tenth of the pile reshuffles its neighbors each step
+        int shift = (object % 10 == (int)(step % 10)) ? (int)step : 0;
+        return (object + 1 + n + shift) % NUM_OBJECTS;
+    };
+    btManifoldPoint point = makePoint(-0.01f);
+
+    QElapsedTimer timer;
+    {
+        ContactTable table;
+        size_t numEvents = 0;
+        timer.start();
+        for (uint32_t step = 1; step <= (uint32_t)NUM_STEPS; ++step) {
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                for (int n = 0; n < NUM_NEIGHBORS; ++n) {
+                    table[ContactKey(motionState(i), motionState(neighbor(i, n, step)))].update(step, point);
+                }
+            }
+            table.removeIf([&](const ContactKey& key, ContactInfo& contact) {
+                ContactEventType type = contact.computeType(step);
+                numEvents += (type != CONTACT_EVENT_TYPE_CONTINUE) ? 1 : 0;
+                return type == CONTACT_EVENT_TYPE_END;
+            });
+        }
+        qDebug() << "ContactTable:" << (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_STEPS) << "ms per step,"
+                 << numEvents << "events," << table.size() << "contacts";
+    }
+    {
+        std::map<ContactKey, ContactInfo> map;
+        size_t numEvents = 0;
+        timer.restart();
+        for (uint32_t step = 1; step <= (uint32_t)NUM_STEPS; ++step) {
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                for (int n = 0; n < NUM_NEIGHBORS; ++n) {
+                    map[ContactKey(motionState(i), motionState(neighbor(i, n, step)))].update(step, point);
+                }
+            }
+            auto itr = map.begin();
+            while (itr != map.end()) {
+                ContactEventType type = itr->second.computeType(step);
+                numEvents += (type != CONTACT_EVENT_TYPE_CONTINUE) ? 1 : 0;
+                if (type == CONTACT_EVENT_TYPE_END) {
+                    itr = map.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+        }
+        qDebug() << "std::map:" << (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_STEPS) << "ms per step,"
+                 << numEvents << "events," << map.size() << "contacts";
+    }
+}
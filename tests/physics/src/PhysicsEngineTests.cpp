@@ -0,0 +1,150 @@
+//
+//  PhysicsEngineTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsEngineTests.h"
+
+#include <QElapsedTimer>
+
+#include <PhysicsEngine.h>
+#include <PhysicsHelpers.h>
+
+QTEST_MAIN(PhysicsEngineTests)
+
+const float GROUND_HALF_THICKNESS = 1.0f;
+const float BOX_HALF_SIDE = 0.25f;
+
+// Piles of boxes dropped on the ground, one island per pile, always built in the same order so that
+// every run simulates the same scene.
+class BoxPiles {
+public:
+    BoxPiles(PhysicsEngine& engine, int numPilesPerSide, int pileSide, int pileHeight) :
+            _world(static_cast<ThreadSafeDynamicsWorld*>(engine.getDynamicsWorld())),
+            _groundShape(btVector3(100.0f, GROUND_HALF_THICKNESS, 100.0f)),
+            _boxShape(btVector3(BOX_HALF_SIDE, BOX_HALF_SIDE, BOX_HALF_SIDE)) {
+        btTransform groundTransform(btQuaternion::getIdentity(), btVector3(0.0f, -GROUND_HALF_THICKNESS, 0.0f));
+        _ground = new btRigidBody(0.0f, nullptr, &_groundShape);
+        _ground->setWorldTransform(groundTransform);
+        _world->addRigidBody(_ground);
+
+        const float MASS = 1.0f;
+        const float SPACING = 2.0f * BOX_HALF_SIDE + 0.01f;
+        const float PILE_SPACING = (float)pileSide * SPACING + 2.0f;
+        btVector3 inertia;
+        _boxShape.calculateLocalInertia(MASS, inertia);
+        for (int pileX = 0; pileX < numPilesPerSide; ++pileX) {
+            for (int pileZ = 0; pileZ < numPilesPerSide; ++pileZ) {
+                btVector3 pileCorner((float)pileX * PILE_SPACING, BOX_HALF_SIDE, (float)pileZ * PILE_SPACING);
+                for (int y = 0; y < pileHeight; ++y) {
+                    for (int x = 0; x < pileSide; ++x) {
+                        for (int z = 0; z < pileSide; ++z) {
+                            // every other layer is nudged so that the piles settle rather than stand
+                            float nudge = (y % 2) ? 0.1f * BOX_HALF_SIDE : 0.0f;
+                            btVector3 position = pileCorner + btVector3((float)x * SPACING + nudge, (float)y * SPACING, (float)z * SPACING);
+                            btRigidBody* box = new btRigidBody(MASS, nullptr, &_boxShape, inertia);
+                            box->setWorldTransform(btTransform(btQuaternion::getIdentity(), position));
+                            _world->addRigidBody(box);
+                            box->setGravity(btVector3(0.0f, -9.8f, 0.0f));
+                            _boxes.push_back(box);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    ~BoxPiles() {
+        for (auto box : _boxes) {
+            _world->removeRigidBody(box);
+            delete box;
+        }
+        _world->removeRigidBody(_ground);
+        delete _ground;
+    }
+
+    void step(int numSteps) {
+        for (int i = 0; i < numSteps; ++i) {
+            _world->stepSimulationWithSubstepCallback(PHYSICS_ENGINE_FIXED_SUBSTEP, 1, PHYSICS_ENGINE_FIXED_SUBSTEP);
+        }
+    }
+
+    const std::vector<btRigidBody*>& getBoxes() const { return _boxes; }
+
+private:
+    ThreadSafeDynamicsWorld* _world;
+    btBoxShape _groundShape;
+    btBoxShape _boxShape;
+    btRigidBody* _ground;
+    std::vector<btRigidBody*> _boxes;
+};
+
+void PhysicsEngineTests::testNumThreads() {
+    {
+        PhysicsEngine engine(glm::vec3(0.0f));
+        engine.init();
+        QCOMPARE(engine.getNumThreads(), 1);
+    }
+    {
+        PhysicsEngine engine(glm::vec3(0.0f));
+        engine.setNumThreads(4);
+        engine.init();
+#if BT_THREADSAFE
+        QVERIFY(engine.getNumThreads() >= 1 && engine.getNumThreads() <= 4);
+#else
+        QCOMPARE(engine.getNumThreads(), 1);
+#endif
+    }
+    // the engine puts back the sequential scheduler when it goes
+    QCOMPARE(btGetTaskScheduler(), btGetSequentialTaskScheduler());
+}
+
+void PhysicsEngineTests::testStepOnThreads() {
+    for (int numThreads : { 1, 4 }) {
+        PhysicsEngine engine(glm::vec3(0.0f));
+        engine.setNumThreads(numThreads);
+        engine.init();
+
+        BoxPiles piles(engine, 3, 3, 4);
+        const int NUM_STEPS = 2 * NUM_SUBSTEPS_PER_SECOND;
+        piles.step(NUM_STEPS);
+        QCOMPARE(engine.getNumSubsteps(), (uint32_t)NUM_STEPS);
+
+        // no box fell through the ground or flew off
+        for (auto box : piles.getBoxes()) {
+            const btVector3& position = box->getWorldTransform().getOrigin();
+            QVERIFY(position.getY() > 0.5f * BOX_HALF_SIDE);
+            QVERIFY(position.getY() < 5.0f);
+        }
+    }
+}
+
+// Step time of the same scene of 16 piles of 128 boxes for each number of threads
+void PhysicsEngineTests::benchmarkStepVsThreads() {
+    const int NUM_WARMUP_STEPS = NUM_SUBSTEPS_PER_SECOND / 2;
+    const int NUM_STEPS = 2 * NUM_SUBSTEPS_PER_SECOND;
+    int maxNumThreads = QThread::idealThreadCount();
+    for (int numThreads = 1; numThreads <= std::max(maxNumThreads, 1); numThreads *= 2) {
+        PhysicsEngine engine(glm::vec3(0.0f));
+        engine.setNumThreads(numThreads);
+        engine.init();
+        if (engine.getNumThreads() != numThreads) {
+            qDebug() << "bullet can't step on" << numThreads << "threads";
+            break;
+        }
+
+        BoxPiles piles(engine, 4, 4, 8);
+        piles.step(NUM_WARMUP_STEPS);
+
+        QElapsedTimer timer;
+        timer.start();
+        piles.step(NUM_STEPS);
+        float msecsPerStep = (float)timer.nsecsElapsed() / (float)(NSECS_PER_MSEC * NUM_STEPS);
+        qDebug() << piles.getBoxes().size() << "boxes on" << numThreads << "threads:" << msecsPerStep << "ms per step";
+    }
+}
@@ -0,0 +1,25 @@
+//
+//  PhysicsEngineTests.h
+//  tests/physics/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsEngineTests_h
+#define hifi_PhysicsEngineTests_h
+
+#include <QtTest/QtTest>
+
+class PhysicsEngineTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testNumThreads();
+    void testStepOnThreads();
+    void benchmarkStepVsThreads();
+};
+
+#endif // hifi_PhysicsEngineTests_h
@@ -13,6 +13,9 @@
 
 #include <iostream>
 
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+
 #include <ShapeManager.h>
 #include <StreamUtils.h>
 #include <Extents.h>
@@ -244,3 +247,189 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+// a height field of numSide x numSide quads, like the floor of a domain
+static ShapeInfo createStaticMeshInfo(int numSide, const QString& url) {
+    ShapeInfo::PointList points;
+    Extents extents;
+    for (int z = 0; z <= numSide; ++z) {
+        for (int x = 0; x <= numSide; ++x) {
+            glm::vec3 point((float)x, sinf(0.3f * (float)x) * cosf(0.2f * (float)z), (float)z);
+            points.push_back(point);
+            extents.addPoint(point);
+        }
+    }
+
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_STATIC_MESH, 0.5f * (extents.maximum - extents.minimum), url);
+    info.setPointCollection({ points });
+    ShapeInfo::TriangleIndices& triangleIndices = info.getTriangleIndices();
+    for (int z = 0; z < numSide; ++z) {
+        for (int x = 0; x < numSide; ++x) {
+            int32_t i = z * (numSide + 1) + x;
+            int32_t j = i + numSide + 1;
+            triangleIndices.insert(triangleIndices.end(), { i, j, i + 1, i + 1, j, j + 1 });
+        }
+    }
+    return info;
+}
+
+// numHulls hulls of numHullPoints points on spheres, like the decomposition of a detailed model
+static ShapeInfo createManyHullsInfo(int numHulls, int numHullPoints) {
+    ShapeInfo::PointCollection pointCollection;
+    Extents extents;
+    for (int i = 0; i < numHulls; ++i) {
+        glm::vec3 center((float)i, 0.0f, 0.0f);
+        ShapeInfo::PointList pointList;
+        for (int j = 0; j < numHullPoints; ++j) {
+            float theta = (float)j * 2.399963f; // golden angle
+            float y = 1.0f - 2.0f * ((float)j + 0.5f) / (float)numHullPoints;
+            float r = sqrtf(1.0f - y * y);
+            glm::vec3 point = center + glm::vec3(r * cosf(theta), y, r * sinf(theta));
+            pointList.push_back(point);
+            extents.addPoint(point);
+        }
+        pointCollection.push_back(pointList);
+    }
+
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_COMPOUND, 0.5f * (extents.maximum - extents.minimum));
+    info.setPointCollection(pointCollection);
+    return info;
+}
+
+void ShapeManagerTests::addStaticMeshShapeAsync() {
+    ShapeInfo info = createStaticMeshInfo(32, "meshA");
+
+    // static meshes are always built on another thread
+    ShapeManager shapeManager;
+    QVERIFY(shapeManager.getShape(info) == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)1);
+    QCOMPARE(shapeManager.getNumPendingShapes(), 1);
+
+    // asking again while it is pending doesn't start another worker
+    QVERIFY(shapeManager.getShape(info) == nullptr);
+    QCOMPARE(shapeManager.getNumPendingShapes(), 1);
+
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)1);
+    QCOMPARE(shapeManager.getNumPendingShapes(), 0);
+    QVERIFY(shapeManager.hasShapeWithKey(info.getHash()));
+
+    const btCollisionShape* shape = shapeManager.getShapeByKey(info.getHash());
+    QVERIFY(shape != nullptr);
+    QCOMPARE(shape->getShapeType(), (int)TRIANGLE_MESH_SHAPE_PROXYTYPE);
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
+}
+
+void ShapeManagerTests::addCompoundShapeAsync() {
+    ShapeInfo info = createManyHullsInfo(16, 128);
+
+    // built right away when the caller can't wait...
+    {
+        ShapeManager shapeManager;
+        const btCollisionShape* shape = shapeManager.getShape(info);
+        QVERIFY(shape != nullptr);
+        QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)0);
+    }
+
+    // ...and on another thread when it can
+    ShapeManager shapeManager;
+    QVERIFY(shapeManager.getShape(info, true) == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)1);
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)1);
+
+    const btCollisionShape* shape = shapeManager.getShape(info, true);
+    QVERIFY(shape != nullptr);
+    QCOMPARE(shape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+    QCOMPARE(static_cast<const btCompoundShape*>(shape)->getNumChildShapes(), 16);
+
+    // a caller that can't wait doesn't build a second copy while a worker is building it
+    ShapeInfo otherInfo = createManyHullsInfo(17, 128);
+    QVERIFY(shapeManager.getShape(otherInfo, true) == nullptr);
+    QVERIFY(shapeManager.getShape(otherInfo) == nullptr);
+    QCOMPARE(shapeManager.getNumPendingShapes(), 1);
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)2);
+    QCOMPARE(shapeManager.getNumReferences(otherInfo), 0);
+    const btCollisionShape* otherShape = shapeManager.getShape(otherInfo);
+    QVERIFY(otherShape != nullptr);
+    QCOMPARE(shapeManager.getNumReferences(otherInfo), 1);
+    QCOMPARE(shapeManager.getNumShapes(), 2);
+
+    // small compound shapes are not worth a worker
+    ShapeInfo smallInfo = createManyHullsInfo(2, 8);
+    QVERIFY(shapeManager.getShape(smallInfo, true) != nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)2);
+}
+
+void ShapeManagerTests::cacheStaticMeshBvh() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    auto cache = std::make_shared<StaticMeshCache>(dir.path().toStdString(), "bvh");
+    cache->initialize();
+
+    ShapeInfo info = createStaticMeshInfo(64, "meshB");
+    const btCollisionShape* builtShape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(builtShape != nullptr);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)1);
+
+    // the second time the bvh comes from the cache
+    const btCollisionShape* cachedShape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(cachedShape != nullptr);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)1);
+
+    auto builtMesh = static_cast<const btBvhTriangleMeshShape*>(builtShape);
+    auto cachedMesh = static_cast<const btBvhTriangleMeshShape*>(cachedShape);
+    btBvhTriangleMeshShape* nonConstBuiltMesh = const_cast<btBvhTriangleMeshShape*>(builtMesh);
+    btBvhTriangleMeshShape* nonConstCachedMesh = const_cast<btBvhTriangleMeshShape*>(cachedMesh);
+    QCOMPARE(nonConstCachedMesh->getOptimizedBvh()->getQuantizedNodeArray().size(),
+             nonConstBuiltMesh->getOptimizedBvh()->getQuantizedNodeArray().size());
+    QCOMPARE(bulletToGLM(cachedMesh->getLocalAabbMin()), bulletToGLM(builtMesh->getLocalAabbMin()));
+    QCOMPARE(bulletToGLM(cachedMesh->getLocalAabbMax()), bulletToGLM(builtMesh->getLocalAabbMax()));
+
+    // a different mesh at the same url doesn't hit the cache
+    ShapeInfo otherInfo = createStaticMeshInfo(63, "meshB");
+    const btCollisionShape* otherShape = ShapeFactory::createShapeFromInfo(otherInfo, cache.get());
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)2);
+
+    ShapeFactory::deleteShape(builtShape);
+    ShapeFactory::deleteShape(cachedShape);
+    ShapeFactory::deleteShape(otherShape);
+}
+
+// the time from asking for the shapes of a domain full of mesh colliders until all of them can be added to physics
+void ShapeManagerTests::benchmarkTimeToFirstPhysics() {
+    const int NUM_MESHES = 64;
+    const int NUM_SIDE = 128;
+    std::vector<ShapeInfo> infos;
+    for (int i = 0; i < NUM_MESHES; ++i) {
+        infos.push_back(createStaticMeshInfo(NUM_SIDE, QString("mesh%1").arg(i)));
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (const auto& info : infos) {
+        ShapeFactory::deleteShape(ShapeFactory::createShapeFromInfo(info));
+    }
+    qDebug() << "building" << NUM_MESHES << "meshes on the simulation thread:" << timer.elapsed() << "ms";
+
+    QTemporaryDir dir;
+    auto cache = std::make_shared<StaticMeshCache>(dir.path().toStdString(), "bvh");
+    cache->initialize();
+
+    for (const char* pass : { "cold cache", "warm cache" }) {
+        ShapeManager shapeManager;
+        shapeManager.setStaticMeshCache(cache);
+
+        timer.restart();
+        qint64 longestCall = 0;
+        for (const auto& info : infos) {
+            QElapsedTimer callTimer;
+            callTimer.start();
+            shapeManager.getShape(info);
+            longestCall = std::max(longestCall, callTimer.nsecsElapsed());
+        }
+        QTRY_COMPARE_WITH_TIMEOUT(shapeManager.getWorkDeliveryCount(), (uint32_t)NUM_MESHES, 60000);
+        qDebug() << "building" << NUM_MESHES << "meshes on workers with a" << pass << ":" << timer.elapsed() << "ms,"
+                 << "longest stall of the simulation thread:" << longestCall / NSECS_PER_USEC << "us";
+    }
+}
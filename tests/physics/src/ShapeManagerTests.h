@@ -25,6 +25,10 @@ private slots:
     void addCylinderShape();
     void addCapsuleShape();
     void addCompoundShape();
+    void addStaticMeshShapeAsync();
+    void addCompoundShapeAsync();
+    void cacheStaticMeshBvh();
+    void benchmarkTimeToFirstPhysics();
 };
 
 #endif // hifi_ShapeManagerTests_h
@@ -0,0 +1,217 @@
+//
+//  BlendshapeAccumulationTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BlendshapeAccumulationTests.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+#include <BlendshapeAccumulation.h>
+#include <CPUDetect.h>
+
+QTEST_MAIN(BlendshapeAccumulationTests)
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+void accumulateBlendshapeOffsets_AVX2(const int32_t* indices, const float* const* components, int begin, int end,
+                                      float positionCoefficient, float normalCoefficient, float (*unpacked)[9]);
+#endif
+
+struct TestBlendshape {
+    std::vector<int> indices;
+    std::vector<glm::vec3> vertices;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec3> tangents;
+};
+
+// A face mesh with the ARKit blendshapes, each of which moves a random part of the face
+static const int NUM_FACE_VERTICES = 24000;
+static const int NUM_ARKIT_BLENDSHAPES = 52;
+static const float BLENDSHAPE_COVERAGE = 0.15f;
+
+static std::vector<TestBlendshape> faceBlendshapes;
+static std::vector<float> faceCoefficients;
+
+static std::vector<TestBlendshape> createBlendshapes(int numVertices, int numBlendshapes, float coverage, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> offset(-0.01f, 0.01f);
+
+    std::vector<int> allIndices(numVertices);
+    std::iota(allIndices.begin(), allIndices.end(), 0);
+
+    std::vector<TestBlendshape> blendshapes(numBlendshapes);
+    for (auto& blendshape : blendshapes) {
+        // a contiguous region, like the vertices around an eye or the mouth, listed in no particular order
+        int numIndices = (int)(numVertices * coverage);
+        int first = std::uniform_int_distribution<int>(0, numVertices - numIndices)(generator);
+        blendshape.indices.assign(allIndices.begin() + first, allIndices.begin() + first + numIndices);
+        std::shuffle(blendshape.indices.begin(), blendshape.indices.end(), generator);
+        for (int i = 0; i < numIndices; i++) {
+            blendshape.vertices.emplace_back(offset(generator), offset(generator), offset(generator));
+            blendshape.normals.emplace_back(offset(generator), offset(generator), offset(generator));
+            blendshape.tangents.emplace_back(offset(generator), offset(generator), offset(generator));
+        }
+    }
+    return blendshapes;
+}
+
+static BlendshapeAccumulationData createData(int numVertices, const std::vector<TestBlendshape>& blendshapes) {
+    BlendshapeAccumulationData data(numVertices);
+    for (const auto& blendshape : blendshapes) {
+        data.addBlendshape(blendshape.indices.data(), blendshape.vertices.data(), (int)blendshape.indices.size(),
+                           blendshape.normals.data(), (int)blendshape.normals.size(),
+                           blendshape.tangents.data(), (int)blendshape.tangents.size());
+    }
+    return data;
+}
+
+// the accumulation loop of Blender::run, before the blendshapes were rearranged, except that it leaves out indices
+// outside the mesh as BlendshapeAccumulationData does, where Blender::run wrote past the end of its buffer
+static void accumulateUnsorted(const std::vector<TestBlendshape>& blendshapes, const std::vector<float>& coefficients,
+                               std::vector<glm::vec3>& unpacked) {
+    for (size_t i = 0; i < blendshapes.size() && i < coefficients.size(); i++) {
+        float vertexCoefficient = coefficients[i];
+        if (vertexCoefficient < BlendshapeAccumulationData::MIN_COEFFICIENT) {
+            continue;
+        }
+        float normalCoefficient = vertexCoefficient * BlendshapeAccumulationData::NORMAL_COEFFICIENT_SCALE;
+        const auto& blendshape = blendshapes[i];
+        for (size_t j = 0; j < blendshape.indices.size(); j++) {
+            int index = blendshape.indices[j];
+            if (index < 0 || 3 * index >= (int)unpacked.size()) {
+                continue;
+            }
+            unpacked[3 * index + 0] += blendshape.vertices[j] * vertexCoefficient;
+            unpacked[3 * index + 1] += blendshape.normals[j] * normalCoefficient;
+            unpacked[3 * index + 2] += blendshape.tangents[j] * normalCoefficient;
+        }
+    }
+}
+
+static void accumulateChunks(const BlendshapeAccumulationData& data, const std::vector<float>& coefficients,
+                             std::vector<glm::vec3>& unpacked) {
+    for (int chunk = 0; chunk < data.getNumChunks(); chunk++) {
+        data.accumulate(chunk, coefficients.data(), (int)coefficients.size(), (float(*)[9])unpacked.data());
+    }
+}
+
+void BlendshapeAccumulationTests::initTestCase() {
+    faceBlendshapes = createBlendshapes(NUM_FACE_VERTICES, NUM_ARKIT_BLENDSHAPES, BLENDSHAPE_COVERAGE, 1);
+
+    // a typical expression: about a third of the shapes are in use, the rest are zero
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> coefficient(0.0f, 1.0f);
+    for (int i = 0; i < NUM_ARKIT_BLENDSHAPES; i++) {
+        faceCoefficients.push_back((i % 3 == 0) ? coefficient(generator) : 0.0f);
+    }
+}
+
+void BlendshapeAccumulationTests::testAVX2() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    if (!cpuSupportsAVX2()) {
+        QSKIP("AVX2 is not supported by this CPU");
+    }
+
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+    const int NUM_VERTICES = 100;
+    for (int numEntries = 0; numEntries < NUM_VERTICES; numEntries++) {
+        std::vector<int32_t> indices(NUM_VERTICES);
+        std::iota(indices.begin(), indices.end(), 0);
+        std::shuffle(indices.begin(), indices.end(), generator);
+
+        std::vector<float> components[9];
+        const float* componentPointers[9];
+        for (int c = 0; c < 9; c++) {
+            for (int i = 0; i < numEntries; i++) {
+                components[c].push_back(value(generator));
+            }
+            componentPointers[c] = components[c].data();
+        }
+
+        std::vector<float> unpacked1(9 * NUM_VERTICES);
+        for (auto& x : unpacked1) {
+            x = value(generator);
+        }
+        std::vector<float> unpacked2 = unpacked1;
+
+        accumulateBlendshapeOffsets_ref(indices.data(), componentPointers, 0, numEntries, 0.5f, 0.005f, (float(*)[9])unpacked1.data());
+        accumulateBlendshapeOffsets_AVX2(indices.data(), componentPointers, 0, numEntries, 0.5f, 0.005f, (float(*)[9])unpacked2.data());
+
+        for (int i = 0; i < 9 * NUM_VERTICES; i++) {
+            QCOMPARE_WITH_ABS_ERROR(unpacked2[i], unpacked1[i], 1.0e-6f);
+        }
+    }
+#else
+    QSKIP("AVX2 is not available on this platform");
+#endif
+}
+
+void BlendshapeAccumulationTests::testAccumulate() {
+    // small chunks of a mesh larger than one chunk, with repeated and out of range indices
+    const int NUM_VERTICES = 3 * BlendshapeAccumulationData::CHUNK_SIZE + 17;
+    auto blendshapes = createBlendshapes(NUM_VERTICES, 8, 0.4f, 4);
+    blendshapes[1].indices.push_back(blendshapes[1].indices.front());
+    blendshapes[1].vertices.push_back(glm::vec3(0.001f));
+    blendshapes[1].normals.push_back(glm::vec3(0.002f));
+    blendshapes[1].tangents.push_back(glm::vec3(0.003f));
+    for (int index : { -1, NUM_VERTICES, NUM_VERTICES + 1000 }) {
+        blendshapes[0].indices.push_back(index);
+        blendshapes[0].vertices.push_back(glm::vec3(1.0f));
+        blendshapes[0].normals.push_back(glm::vec3(1.0f));
+        blendshapes[0].tangents.push_back(glm::vec3(1.0f));
+    }
+    blendshapes[2].tangents.clear();
+
+    std::vector<float> coefficients = { 1.0f, 0.5f, 0.25f, 0.0f, 0.75f, 0.00001f, 1.0f };
+
+    auto data = createData(NUM_VERTICES, blendshapes);
+    QCOMPARE(data.getNumVertices(), NUM_VERTICES);
+    QCOMPARE(data.getNumBlendshapes(), 8);
+    QCOMPARE(data.getNumChunks(), 4);
+    QVERIFY(data.hasActiveBlendshapes(coefficients.data(), (int)coefficients.size()));
+    std::vector<float> zeros(8, 0.0f);
+    QVERIFY(!data.hasActiveBlendshapes(zeros.data(), (int)zeros.size()));
+
+    // the unsorted loop skips missing tangents the same way Blender::run did
+    blendshapes[2].tangents.resize(blendshapes[2].indices.size(), glm::vec3(0.0f));
+
+    std::vector<glm::vec3> expected(3 * NUM_VERTICES, glm::vec3(0.0f));
+    accumulateUnsorted(blendshapes, coefficients, expected);
+
+    std::vector<glm::vec3> actual(3 * NUM_VERTICES, glm::vec3(0.0f));
+    accumulateChunks(data, coefficients, actual);
+
+    for (int i = 0; i < 3 * NUM_VERTICES; i++) {
+        QCOMPARE_WITH_ABS_ERROR(actual[i], expected[i], 1.0e-6f);
+    }
+}
+
+void BlendshapeAccumulationTests::benchmarkAccumulate_ref() {
+    std::vector<glm::vec3> unpacked(3 * NUM_FACE_VERTICES);
+    QBENCHMARK {
+        std::fill(unpacked.begin(), unpacked.end(), glm::vec3(0.0f));
+        accumulateUnsorted(faceBlendshapes, faceCoefficients, unpacked);
+    }
+}
+
+void BlendshapeAccumulationTests::benchmarkAccumulate() {
+    auto data = createData(NUM_FACE_VERTICES, faceBlendshapes);
+    std::vector<glm::vec3> unpacked(3 * NUM_FACE_VERTICES);
+    QBENCHMARK {
+        std::fill(unpacked.begin(), unpacked.end(), glm::vec3(0.0f));
+        accumulateChunks(data, faceCoefficients, unpacked);
+    }
+}
@@ -0,0 +1,26 @@
+//
+//  BlendshapeAccumulationTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BlendshapeAccumulationTests_h
+#define hifi_BlendshapeAccumulationTests_h
+
+#include <QtTest/QtTest>
+
+class BlendshapeAccumulationTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void testAVX2();
+    void testAccumulate();
+    void benchmarkAccumulate_ref();
+    void benchmarkAccumulate();
+};
+
+#endif // hifi_BlendshapeAccumulationTests_h
@@ -0,0 +1,130 @@
+//
+//  ClusterMatricesTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ClusterMatricesTests.h"
+
+#include <random>
+#include <vector>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+#include <ClusterMatrices.h>
+#include <CPUDetect.h>
+#include <GLMHelpers.h>
+
+QTEST_MAIN(ClusterMatricesTests)
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+void computeClusterMatrices_AVX2(const glm::mat4* jointMatrices, const int32_t* jointIndices, const glm::mat4* inverseBindMatrices,
+                                 int numClusters, glm::mat4* clusterMatrices);
+#endif
+
+// A crowd of avatars, each with a skeleton of the usual size whose meshes are skinned to most of its joints
+static const int NUM_AVATARS = 100;
+static const int NUM_JOINTS = 150;
+static const int NUM_CLUSTERS = 200;
+
+struct TestSkin {
+    std::vector<glm::mat4> jointMatrices;
+    std::vector<int32_t> jointIndices;
+    std::vector<glm::mat4> inverseBindMatrices;
+};
+
+static std::vector<TestSkin> crowd;
+
+static glm::mat4 createRandomTransform(std::mt19937& generator) {
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    glm::quat rotation = glm::normalize(glm::quat(value(generator), value(generator), value(generator), value(generator)));
+    glm::vec3 translation(value(generator), value(generator), value(generator));
+    return createMatFromScaleQuatAndPos(glm::vec3(1.0f + 0.1f * value(generator)), rotation, translation);
+}
+
+static TestSkin createSkin(int numJoints, int numClusters, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int32_t> joint(0, numJoints - 1);
+
+    TestSkin skin;
+    for (int i = 0; i < numJoints; i++) {
+        skin.jointMatrices.push_back(createRandomTransform(generator));
+    }
+    for (int i = 0; i < numClusters; i++) {
+        skin.jointIndices.push_back(joint(generator));
+        skin.inverseBindMatrices.push_back(glm::inverse(createRandomTransform(generator)));
+    }
+    return skin;
+}
+
+void ClusterMatricesTests::initTestCase() {
+    for (int i = 0; i < NUM_AVATARS; i++) {
+        crowd.push_back(createSkin(NUM_JOINTS, NUM_CLUSTERS, i + 1));
+    }
+}
+
+void ClusterMatricesTests::testAVX2() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    if (!cpuSupportsAVX2()) {
+        QSKIP("AVX2 is not supported by this CPU");
+    }
+
+    // clusters sharing joints, and the matrices past the last cluster left alone
+    const int MAX_CLUSTERS = 20;
+    TestSkin skin = createSkin(8, MAX_CLUSTERS, 0);
+    for (int numClusters = 0; numClusters <= MAX_CLUSTERS; numClusters++) {
+        std::vector<glm::mat4> matrices1(MAX_CLUSTERS, glm::mat4(0.0f));
+        std::vector<glm::mat4> matrices2(MAX_CLUSTERS, glm::mat4(0.0f));
+
+        computeClusterMatrices_ref(skin.jointMatrices.data(), skin.jointIndices.data(), skin.inverseBindMatrices.data(),
+                                   numClusters, matrices1.data());
+        computeClusterMatrices_AVX2(skin.jointMatrices.data(), skin.jointIndices.data(), skin.inverseBindMatrices.data(),
+                                    numClusters, matrices2.data());
+
+        for (int i = 0; i < MAX_CLUSTERS; i++) {
+            QCOMPARE_WITH_ABS_ERROR(matrices2[i], matrices1[i], 1.0e-5f);
+        }
+    }
+#else
+    QSKIP("AVX2 is not available on this platform");
+#endif
+}
+
+void ClusterMatricesTests::testClusterMatrices() {
+    const TestSkin& skin = crowd.front();
+    std::vector<glm::mat4> matrices(NUM_CLUSTERS);
+    computeClusterMatrices(skin.jointMatrices.data(), skin.jointIndices.data(), skin.inverseBindMatrices.data(),
+                           NUM_CLUSTERS, matrices.data());
+
+    for (int i = 0; i < NUM_CLUSTERS; i++) {
+        glm::mat4 expected = skin.jointMatrices[skin.jointIndices[i]] * skin.inverseBindMatrices[i];
+        QCOMPARE_WITH_ABS_ERROR(matrices[i], expected, 1.0e-5f);
+    }
+}
+
+void ClusterMatricesTests::benchmarkClusterMatrices_ref() {
+    std::vector<glm::mat4> matrices(NUM_CLUSTERS);
+    QBENCHMARK {
+        for (const auto& skin : crowd) {
+            computeClusterMatrices_ref(skin.jointMatrices.data(), skin.jointIndices.data(), skin.inverseBindMatrices.data(),
+                                       NUM_CLUSTERS, matrices.data());
+        }
+    }
+}
+
+void ClusterMatricesTests::benchmarkClusterMatrices() {
+    std::vector<glm::mat4> matrices(NUM_CLUSTERS);
+    QBENCHMARK {
+        for (const auto& skin : crowd) {
+            computeClusterMatrices(skin.jointMatrices.data(), skin.jointIndices.data(), skin.inverseBindMatrices.data(),
+                                   NUM_CLUSTERS, matrices.data());
+        }
+    }
+}
@@ -0,0 +1,26 @@
+//
+//  ClusterMatricesTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ClusterMatricesTests_h
+#define hifi_ClusterMatricesTests_h
+
+#include <QtTest/QtTest>
+
+class ClusterMatricesTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void testAVX2();
+    void testClusterMatrices();
+    void benchmarkClusterMatrices_ref();
+    void benchmarkClusterMatrices();
+};
+
+#endif // hifi_ClusterMatricesTests_h
@@ -0,0 +1,275 @@
+//
+//  TriangleSetTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TriangleSetTests.h"
+
+#include <random>
+
+#include <GeometryUtil.h>
+#include <TriangleSet.h>
+
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(TriangleSetTests)
+
+const float TEST_EPSILON = 0.0001f;
+const int NUM_TEST_TRIANGLES = 2000;
+const int NUM_TEST_RAYS = 500;
+
+// small triangles scattered through a unit box, like the faces of a detailed model
+static void makeTriangles(TriangleSet& triangleSet, std::vector<Triangle>& triangles, int numTriangles) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> position(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> offset(-0.1f, 0.1f);
+    for (int i = 0; i < numTriangles; i++) {
+        glm::vec3 v0(position(generator), position(generator), position(generator));
+        glm::vec3 v1 = v0 + glm::vec3(offset(generator), offset(generator), offset(generator));
+        glm::vec3 v2 = v0 + glm::vec3(offset(generator), offset(generator), offset(generator));
+        Triangle triangle { v0, v1, v2 };
+        triangles.push_back(triangle);
+        triangleSet.insert(triangle);
+    }
+}
+
+// rays from outside the box aimed at random points within it
+static void makeRays(std::vector<glm::vec3>& origins, std::vector<glm::vec3>& directions, int numRays) {
+    std::mt19937 generator(5678);
+    std::uniform_real_distribution<float> position(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> outside(-3.0f, 3.0f);
+    for (int i = 0; i < numRays; i++) {
+        glm::vec3 origin(outside(generator), outside(generator), 3.0f);
+        glm::vec3 target(position(generator), position(generator), position(generator));
+        origins.push_back(origin);
+        directions.push_back(glm::normalize(target - origin));
+    }
+}
+
+static bool findBruteForceRayIntersection(const std::vector<Triangle>& triangles, const glm::vec3& origin,
+                                          const glm::vec3& direction, float& distance, bool allowBackface) {
+    bool hit = false;
+    distance = FLT_MAX;
+    for (const auto& triangle : triangles) {
+        float triangleDistance;
+        if (findRayTriangleIntersection(origin, direction, triangle, triangleDistance, allowBackface) &&
+            triangleDistance < distance) {
+            distance = triangleDistance;
+            hit = true;
+        }
+    }
+    return hit;
+}
+
+static void compareRayIntersections(bool allowBackface) {
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES);
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    makeRays(origins, directions, NUM_TEST_RAYS);
+
+    int numHits = 0;
+    for (int i = 0; i < NUM_TEST_RAYS; i++) {
+        float expectedDistance;
+        bool expectedHit = findBruteForceRayIntersection(triangles, origins[i], directions[i], expectedDistance, allowBackface);
+
+        float distance = FLT_MAX;
+        BoxFace face;
+        Triangle triangle;
+        bool hit = triangleSet.findRayIntersection(origins[i], directions[i], 1.0f / directions[i], distance, face, triangle,
+                                                   true, allowBackface);
+        QCOMPARE(hit, expectedHit);
+        if (hit) {
+            QCOMPARE_WITH_ABS_ERROR(distance, expectedDistance, TEST_EPSILON);
+            float triangleDistance;
+            QVERIFY(findRayTriangleIntersection(origins[i], directions[i], triangle, triangleDistance, allowBackface));
+            QCOMPARE_WITH_ABS_ERROR(triangleDistance, distance, TEST_EPSILON);
+            numHits++;
+        }
+    }
+    // make sure the test is meaningful
+    QVERIFY(numHits > NUM_TEST_RAYS / 10);
+}
+
+void TriangleSetTests::testRayIntersection() {
+    compareRayIntersections(false);
+}
+
+void TriangleSetTests::testRayIntersectionWithBackfaces() {
+    compareRayIntersections(true);
+}
+
+void TriangleSetTests::testParabolaIntersection() {
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES);
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    makeRays(origins, directions, NUM_TEST_RAYS);
+
+    const glm::vec3 acceleration(0.0f, -0.5f, 0.0f);
+    int numHits = 0;
+    for (int i = 0; i < NUM_TEST_RAYS; i++) {
+        glm::vec3 velocity = directions[i] * 2.0f;
+
+        bool expectedHit = false;
+        float expectedDistance = FLT_MAX;
+        for (const auto& triangle : triangles) {
+            float triangleDistance;
+            if (findParabolaTriangleIntersection(origins[i], velocity, acceleration, triangle, triangleDistance, false) &&
+                triangleDistance < expectedDistance) {
+                expectedDistance = triangleDistance;
+                expectedHit = true;
+            }
+        }
+
+        float distance = FLT_MAX;
+        BoxFace face;
+        Triangle triangle;
+        bool hit = triangleSet.findParabolaIntersection(origins[i], velocity, acceleration, distance, face, triangle, true);
+        QCOMPARE(hit, expectedHit);
+        if (hit) {
+            QCOMPARE_WITH_ABS_ERROR(distance, expectedDistance, TEST_EPSILON);
+            numHits++;
+        }
+    }
+    QVERIFY(numHits > 0);
+}
+
+void TriangleSetTests::testBoundsIntersection() {
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES);
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    makeRays(origins, directions, NUM_TEST_RAYS);
+
+    for (int i = 0; i < NUM_TEST_RAYS; i++) {
+        float expectedDistance;
+        bool expectedHit = findBruteForceRayIntersection(triangles, origins[i], directions[i], expectedDistance, false);
+
+        float distance = FLT_MAX;
+        BoxFace face;
+        Triangle triangle;
+        bool hit = triangleSet.findRayIntersection(origins[i], directions[i], 1.0f / directions[i], distance, face, triangle, false);
+
+        // the bounds of the triangles are always hit before, or where, the triangles are
+        if (expectedHit) {
+            QVERIFY(hit);
+            QVERIFY(distance <= expectedDistance + TEST_EPSILON);
+        }
+    }
+}
+
+void TriangleSetTests::testBatchedRayIntersections_data() {
+    QTest::addColumn<bool>("precision");
+    QTest::addColumn<bool>("allowBackface");
+    QTest::addColumn<bool>("coherent");
+
+    QTest::newRow("triangles") << true << false << false;
+    QTest::newRow("triangles with backfaces") << true << true << false;
+    QTest::newRow("coherent triangles") << true << false << true;
+    QTest::newRow("bounds") << false << false << false;
+}
+
+void TriangleSetTests::testBatchedRayIntersections() {
+    QFETCH(bool, precision);
+    QFETCH(bool, allowBackface);
+    QFETCH(bool, coherent);
+
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES);
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    makeRays(origins, directions, NUM_TEST_RAYS);
+    if (coherent) {
+        // rays from one eye, whose packets share most of their traversal
+        for (auto& origin : origins) {
+            origin = origins[0];
+        }
+    }
+
+    // the packets are traced with the same tests as the single rays, so the results are the same
+    std::vector<TriangleSet::RayPick> picks;
+    for (int i = 0; i < NUM_TEST_RAYS; i++) {
+        picks.emplace_back(origins[i], directions[i]);
+    }
+    triangleSet.findRayIntersections(picks.data(), picks.size(), precision, allowBackface);
+
+    int numHits = 0;
+    for (int i = 0; i < NUM_TEST_RAYS; i++) {
+        float distance = FLT_MAX;
+        BoxFace face;
+        Triangle triangle;
+        bool hit = triangleSet.findRayIntersection(origins[i], directions[i], 1.0f / directions[i], distance, face, triangle,
+                                                   precision, allowBackface);
+        QCOMPARE(picks[i].intersects, hit);
+        if (hit) {
+            QCOMPARE(picks[i].distance, distance);
+            QCOMPARE(picks[i].face, face);
+            numHits++;
+        }
+    }
+    QVERIFY(numHits > NUM_TEST_RAYS / 10);
+}
+
+void TriangleSetTests::benchmarkBuild() {
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES * 10);
+
+    QBENCHMARK {
+        triangleSet.balanceTree();
+    }
+}
+
+void TriangleSetTests::benchmarkRayIntersection() {
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES * 10);
+    triangleSet.balanceTree();
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    makeRays(origins, directions, NUM_TEST_RAYS);
+
+    QBENCHMARK {
+        for (int i = 0; i < NUM_TEST_RAYS; i++) {
+            float distance = FLT_MAX;
+            BoxFace face;
+            Triangle triangle;
+            triangleSet.findRayIntersection(origins[i], directions[i], 1.0f / directions[i], distance, face, triangle, true);
+        }
+    }
+}
+
+void TriangleSetTests::benchmarkBatchedRayIntersections() {
+    TriangleSet triangleSet;
+    std::vector<Triangle> triangles;
+    makeTriangles(triangleSet, triangles, NUM_TEST_TRIANGLES * 10);
+    triangleSet.balanceTree();
+
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    makeRays(origins, directions, NUM_TEST_RAYS);
+
+    std::vector<TriangleSet::RayPick> picks;
+    for (int i = 0; i < NUM_TEST_RAYS; i++) {
+        picks.emplace_back(origins[i], directions[i]);
+    }
+
+    QBENCHMARK {
+        triangleSet.findRayIntersections(picks.data(), picks.size(), true);
+    }
+}
@@ -0,0 +1,195 @@
+//
+//  SpaceClassificationTests.cpp
+//  tests/workload/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpaceClassificationTests.h"
+
+#include <random>
+
+#include <glm/gtx/norm.hpp>
+
+#include <workload/Space.h>
+
+QTEST_MAIN(SpaceClassificationTests)
+
+static const float WORLD_SIZE = 1000.0f;
+
+static std::vector<workload::Sphere> createSpheres(uint32_t numProxies) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> position(-WORLD_SIZE / 2.0f, WORLD_SIZE / 2.0f);
+    std::uniform_real_distribution<float> radius(0.1f, 5.0f);
+    std::vector<workload::Sphere> spheres;
+    spheres.reserve(numProxies);
+    for (uint32_t i = 0; i < numProxies; ++i) {
+        spheres.push_back(workload::Sphere(position(generator), position(generator), position(generator), radius(generator)));
+    }
+    return spheres;
+}
+
+static std::vector<workload::ProxyID> addProxies(workload::Space& space, const std::vector<workload::Sphere>& spheres) {
+    std::vector<workload::ProxyID> ids;
+    ids.reserve(spheres.size());
+    workload::Transaction transaction;
+    for (const auto& sphere : spheres) {
+        workload::ProxyID id = space.allocateID();
+        transaction.reset(id, sphere, workload::Owner());
+        ids.push_back(id);
+    }
+    space.enqueueTransaction(transaction);
+    space.enqueueFrame();
+    space.processTransactionQueue();
+    return ids;
+}
+
+static workload::View createView(const glm::vec3& center, float r1, float r2, float r3) {
+    workload::View view;
+    view.origin = center;
+    view.regions[workload::Region::R1] = workload::Sphere(center, r1);
+    view.regions[workload::Region::R2] = workload::Sphere(center, r2);
+    view.regions[workload::Region::R3] = workload::Sphere(center, r3);
+    return view;
+}
+
+// the nearest region of any view that the sphere touches, as categorizeAndGetChanges computed it one proxy at a time
+static uint8_t classify(const workload::Sphere& sphere, const workload::Views& views) {
+    uint8_t region = workload::Region::R4;
+    for (const auto& view : views) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = sphere.w + view.regions[k].w;
+            if (glm::distance2(glm::vec3(sphere), glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
+static void verifyChanges(const workload::Space& space, const std::vector<workload::ProxyID>& ids,
+                          const std::vector<workload::Sphere>& spheres, const std::vector<uint8_t>& prevRegions,
+                          const workload::Views& views, const workload::Changes& changes) {
+    size_t c = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        uint8_t region = classify(spheres[i], views);
+        QCOMPARE(space.getRegion(ids[i]), region);
+        if (region != prevRegions[i]) {
+            // changes come in the order of the proxies, whichever thread found them
+            QVERIFY(c < changes.size());
+            QCOMPARE(changes[c].proxyId, ids[i]);
+            QCOMPARE(changes[c].region, region);
+            QCOMPARE(changes[c].prevRegion, prevRegions[i]);
+            ++c;
+        }
+    }
+    QCOMPARE(c, changes.size());
+}
+
+void SpaceClassificationTests::matchesScalarClassification() {
+    // enough proxies for several chunks, and a partial batch at the end
+    const uint32_t NUM_PROXIES = 5 * workload::Space::CLASSIFY_CHUNK_SIZE + 3;
+    workload::Space space;
+    std::vector<workload::Sphere> spheres = createSpheres(NUM_PROXIES);
+    std::vector<workload::ProxyID> ids = addProxies(space, spheres);
+
+    workload::Views views;
+    views.push_back(createView(glm::vec3(0.0f), 50.0f, 100.0f, 200.0f));
+    views.push_back(createView(glm::vec3(250.0f, 0.0f, 0.0f), 25.0f, 50.0f, 100.0f));
+    space.setViews(views);
+
+    workload::Changes changes;
+    space.categorizeAndGetChanges(changes);
+    std::vector<uint8_t> prevRegions(NUM_PROXIES, workload::Region::UNKNOWN);
+    verifyChanges(space, ids, spheres, prevRegions, views, changes);
+
+    // move the views and every tenth proxy
+    for (size_t i = 0; i < ids.size(); ++i) {
+        prevRegions[i] = space.getRegion(ids[i]);
+    }
+    views[0] = createView(glm::vec3(-100.0f, 0.0f, 0.0f), 50.0f, 100.0f, 200.0f);
+    views[1] = createView(glm::vec3(100.0f, 0.0f, 50.0f), 25.0f, 50.0f, 300.0f);
+    space.setViews(views);
+    workload::Transaction transaction;
+    for (size_t i = 0; i < ids.size(); i += 10) {
+        spheres[i] = workload::Sphere(glm::vec3(spheres[i]) * 0.5f, spheres[i].w);
+        transaction.update(ids[i], spheres[i]);
+    }
+    space.enqueueTransaction(transaction);
+    space.enqueueFrame();
+    space.processTransactionQueue();
+
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    verifyChanges(space, ids, spheres, prevRegions, views, changes);
+
+    // nothing moved
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    QVERIFY(changes.empty());
+}
+
+void SpaceClassificationTests::ignoresRemovedProxies() {
+    const uint32_t NUM_PROXIES = 100;
+    workload::Space space;
+    std::vector<workload::Sphere> spheres(NUM_PROXIES, workload::Sphere(0.0f, 0.0f, 0.0f, 1.0f));
+    std::vector<workload::ProxyID> ids = addProxies(space, spheres);
+
+    workload::Transaction transaction;
+    for (size_t i = 0; i < ids.size(); i += 2) {
+        transaction.remove(ids[i]);
+    }
+    space.enqueueTransaction(transaction);
+    space.enqueueFrame();
+    space.processTransactionQueue();
+
+    workload::Views views;
+    views.push_back(createView(glm::vec3(0.0f), 10.0f, 20.0f, 30.0f));
+    space.setViews(views);
+
+    workload::Changes changes;
+    space.categorizeAndGetChanges(changes);
+    QCOMPARE(changes.size(), (size_t)(NUM_PROXIES / 2));
+    for (const auto& change : changes) {
+        QVERIFY(change.proxyId % 2 == 1);
+        QCOMPARE(change.region, (uint8_t)workload::Region::R1);
+        QCOMPARE(change.prevRegion, (uint8_t)workload::Region::UNKNOWN);
+    }
+    for (size_t i = 0; i < ids.size(); i += 2) {
+        QCOMPARE(space.getRegion(ids[i]), (uint8_t)workload::Region::INVALID);
+    }
+}
+
+void SpaceClassificationTests::benchmarkClassify_data() {
+    QTest::addColumn<int>("numProxies");
+    QTest::newRow("100k") << 100000;
+    QTest::newRow("300k") << 300000;
+    QTest::newRow("1M") << 1000000;
+}
+
+void SpaceClassificationTests::benchmarkClassify() {
+    QFETCH(int, numProxies);
+    workload::Space space;
+    addProxies(space, createSpheres((uint32_t)numProxies));
+
+    // a walking avatar and a secondary view, so that some proxies change region every frame
+    const float R1 = 0.05f * WORLD_SIZE;
+    const float R2 = 0.10f * WORLD_SIZE;
+    const float R3 = 0.25f * WORLD_SIZE;
+    workload::Views views(2);
+    workload::Changes changes;
+    int frame = 0;
+    QBENCHMARK {
+        glm::vec3 center(0.001f * WORLD_SIZE * (float)(frame % 100), 0.0f, 0.0f);
+        views[0] = createView(center, R1, R2, R3);
+        views[1] = createView(-center, R1, R2, R3);
+        space.setViews(views);
+        changes.clear();
+        space.categorizeAndGetChanges(changes);
+        ++frame;
+    }
+}
@@ -0,0 +1,130 @@
+//
+//  ModelCacheToolApp.cpp
+//  tools/model-cache-tool/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ModelCacheToolApp.h"
+
+#include <algorithm>
+
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+
+#include <DependencyManager.h>
+#include <FBXSerializer.h>
+#include <GLTFSerializer.h>
+#include <OBJSerializer.h>
+#include <hfm/ModelFormatRegistry.h>
+#include <model-baker/Baker.h>
+#include <model-networking/HFMCache.h>
+#include <model-networking/ModelLoader.h>
+
+ModelCacheToolApp::ModelCacheToolApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity HFM Cache Benchmark");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption inputFilenameOption("i", "input file", "filename.fbx");
+    parser.addOption(inputFilenameOption);
+
+    const QCommandLineOption cacheDirOption("c", "cache directory, wiped before the cold loads", "dir");
+    parser.addOption(cacheDirOption);
+
+    const QCommandLineOption iterationsOption("n", "number of cold and of warm loads", "count", "5");
+    parser.addOption(iterationsOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    QString inputFilename = parser.value(inputFilenameOption);
+    QFile file(inputFilename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Failed to open file " << inputFilename;
+        _returnCode = 2;
+        return;
+    }
+    QByteArray data = file.readAll();
+    QUrl url = QUrl::fromLocalFile(QFileInfo(inputFilename).absoluteFilePath());
+
+    QString cacheDir = parser.isSet(cacheDirOption) ? parser.value(cacheDirOption) : QDir::temp().filePath("hfm_cache_tool");
+    int iterations = std::max(parser.value(iterationsOption).toInt(), 1);
+
+    {
+        auto modelFormatRegistry = DependencyManager::set<ModelFormatRegistry>();
+        modelFormatRegistry->addFormat(FBXSerializer());
+        modelFormatRegistry->addFormat(OBJSerializer());
+        modelFormatRegistry->addFormat(GLTFSerializer());
+    }
+
+    // same parameters as GeometryReader uses for a model without a mapping
+    QVariantHash serializerMapping;
+    serializerMapping["combineParts"] = true;
+    serializerMapping["deduplicateIndices"] = true;
+
+    HFMCache hfmCache(cacheDir.toStdString(), "hfm");
+    hfmCache.initialize();
+    hfmCache.wipe();
+
+    ModelLoader modelLoader;
+    QElapsedTimer timer;
+
+    qint64 coldNSecs = 0;
+    for (int i = 0; i < iterations; i++) {
+        timer.start();
+        auto key = HFMCache::computeKey(data, url, QString(), serializerMapping, QUrl());
+        auto hfmModel = modelLoader.load(data, serializerMapping, url, "");
+        if (!hfmModel) {
+            qCritical() << "Failed to load model " << inputFilename;
+            _returnCode = 3;
+            return;
+        }
+        baker::Baker modelBaker(hfmModel, QVariantHash(), QUrl());
+        modelBaker.run();
+        hfmCache.writeModel(key, *modelBaker.getHFMModel());
+        coldNSecs += timer.nsecsElapsed();
+    }
+
+    qint64 warmNSecs = 0;
+    for (int i = 0; i < iterations; i++) {
+        timer.start();
+        auto key = HFMCache::computeKey(data, url, QString(), serializerMapping, QUrl());
+        auto hfmModel = hfmCache.readModel(key);
+        if (!hfmModel) {
+            qCritical() << "Failed to read cached model " << inputFilename;
+            _returnCode = 4;
+            return;
+        }
+        warmNSecs += timer.nsecsElapsed();
+    }
+
+    double coldMSecs = (double)coldNSecs / (iterations * 1.0e6);
+    double warmMSecs = (double)warmNSecs / (iterations * 1.0e6);
+    qDebug() << "Model:" << inputFilename << data.size() << "bytes";
+    qDebug() << "Cold load (parse, bake, write cache):" << coldMSecs << "ms";
+    qDebug() << "Warm load (read cache):" << warmMSecs << "ms";
+    if (warmMSecs > 0.0) {
+        qDebug() << "Speedup:" << coldMSecs / warmMSecs;
+    }
+}
+
+ModelCacheToolApp::~ModelCacheToolApp() {
+}
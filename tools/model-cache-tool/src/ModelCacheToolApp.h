@@ -0,0 +1,29 @@
+//
+//  ModelCacheToolApp.h
+//  tools/model-cache-tool/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ModelCacheToolApp_h
+#define hifi_ModelCacheToolApp_h
+
+#include <QCoreApplication>
+
+// Measures how long a model takes to load without the HFM cache (parse and bake) and with it (read the baked model)
+class ModelCacheToolApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    ModelCacheToolApp(int argc, char* argv[]);
+    ~ModelCacheToolApp();
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    int _returnCode { 0 };
+};
+
+#endif // hifi_ModelCacheToolApp_h
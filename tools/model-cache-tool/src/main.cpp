@@ -0,0 +1,20 @@
+//
+//  main.cpp
+//  tools/model-cache-tool/src
+//
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <SharedUtil.h>
+
+#include "ModelCacheToolApp.h"
+
+int main(int argc, char* argv[]) {
+    setupHifiApplication("Model Cache Tool");
+
+    ModelCacheToolApp app(argc, argv);
+    return app.getReturnCode();
+}